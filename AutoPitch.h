@@ -17,6 +17,8 @@
 #include "fft/fftsetup.h"
 #include "fft/mayer_fft.c"
 #include "fft/Scales.h"
+#include <array>
+#include <atomic>
 #include <math.h>
 
 #define L2SC (float)3.32192809488736218171
@@ -516,26 +518,41 @@ class AutoPitchEffect : public AudioEffect
 {
 public:
     
+    // Registration order, so a parameter's index is its enum value
+    enum Parameters
+    {
+        Amount = 0,
+        Glide,
+        Mix,
+        Shift,
+        Tune,
+        Root,
+        Scale,
+        ParamCount
+    };
+    
     AutoPitchEffect()
     {
         //Amount of pitch correction how much you want it?
-        registerParameter("Amount", 0.0f, 0.0f, 100.0f, 1.0f, "%");
+        registerParameter(parameterIDs[Amount], 0.0f, 0.0f, 100.0f, 1.0f, "%");
     
         //control how much pitch slide from one note to the next 0 -> 1000ms
-        registerParameter("Glide", 0.0f, 0.0f, 1000.0f, 0.01f, "ms");
+        registerParameter(parameterIDs[Glide], 0.0f, 0.0f, 1000.0f, 0.01f, "ms");
     
         //This is our scaling factor of how much total effect is applied
-        registerParameter("Mix", 0.0f, 0.0f, 100.0f, 1.0f, "%");
+        registerParameter(parameterIDs[Mix], 0.0f, 0.0f, 100.0f, 1.0f, "%");
         
         // Easy This transposes from -12 to +12 semitones, step size of 1
-        registerParameter("Shift", 0.0f, -12.0f, 12.0f, 1.0f, "st");
+        registerParameter(parameterIDs[Shift], 0.0f, -12.0f, 12.0f, 1.0f, "st");
         
         // This is -100 -> +100 cents transposed
-        registerParameter("Tune", 0.0f, -100.0f, 100.0f, 1.0f, "cents");
+        registerParameter(parameterIDs[Tune], 0.0f, -100.0f, 100.0f, 1.0f, "cents");
         
-        //TODO: register Root with a drop down menu
+        // Key the correction snaps to, C to B in Scales' Notes order
+        registerParameter(parameterIDs[Root], 0.0f, 0.0f, 11.0f, 1.0f, "");
         
-        //TODO: register Scale with a drop down menu
+        // Scale the correction snaps to, Chromatic to MinorBlues in Scales' ScaleNames order
+        registerParameter(parameterIDs[Scale], 0.0f, 0.0f, 12.0f, 1.0f, "");
     };
     
     void prepare(const juce::dsp::ProcessSpec& spec) override {
@@ -547,30 +564,16 @@ public:
         //autoPitchCorrector.reset(pitchShifter.fs);
     }
     
+    // Called on whichever thread changed the parameter, possibly several at once.
+    // The ID is matched here, once, and the change is queued for process() to
+    // apply on the audio thread.
     void parameterChanged (const std::string& parameterID, float newValue) override {
-        if(parameterID == "Mix")
-        {
-            autoPitchCorrector.setMixAmount(newValue / 100);
-        } else if (parameterID == "Shift")
-            {
-            autoPitchCorrector.setShiftAmount(newValue);
-        } else if (parameterID == "Tune")
-            {
-            autoPitchCorrector.setTuneAmount(newValue / 100);
-        } else if (parameterID == "Amount")
-                {
-            autoPitchCorrector.setAmountAmount(newValue / 100);
-        } else if (parameterID == "Glide")
-                {
-            autoPitchCorrector.setGlideAmount(newValue / 1000);
+        for (int i = 0; i < ParamCount; i++) {
+            if (parameterID.compare (parameterIDs[i]) == 0) {
+                queueChange (i, newValue);
+                return;
+            }
         }
-        
-        //TODO: use setRoot with a drop down menu
-        //AutoPitchCorrector.setScale(newRoot, autoPitchCorrector.getScale());
-        //
-        
-        //TODO: implement setScaleType with a drop down menu
-        //AutoPitchCorrector.setScale(autoPitchCorrect.getRoot(), newScale);
     }
     
     void process(const juce::dsp::ProcessContextReplacing<float>& context) override
@@ -579,20 +582,62 @@ public:
         
         auto numSamples = buffer.getNumSamples();
         
-const float* input = buffer.getChannelPointer (0);
-float* output1 = buffer.getChannelPointer(0);
-float* output2 = buffer.getChannelPointer(1);
+        applyQueuedChanges();
         
-        std::vector<const float*> inputs = { reinterpret_cast<const float*>(input)};
-        std::vector<float*> outputs = { reinterpret_cast<float*>(output1), reinterpret_cast<float*>(output2)};
+        // Channel pointer arrays live on the stack: nothing on the audio thread may allocate
+        const float* inputs[] = { buffer.getChannelPointer (0) };
+        float* outputs[] = { buffer.getChannelPointer (0),
+                             buffer.getChannelPointer (buffer.getNumChannels() > 1 ? 1 : 0) };
         
-            autoPitchCorrector.ProcessFloatReplacing (inputs.data(), outputs.data(), numSamples);
+        autoPitchCorrector.ProcessFloatReplacing (inputs, outputs, (int) numSamples);
     }
     
-int getNumParameters() const override { return AdvancedPlateReverbEffect::ParamCount; }
+    int getNumParameters() const override { return ParamCount; }
 
     juce::String getName() const override { return "AutoPitchEffect"; }
     
 private:
+    static constexpr const char* parameterIDs[ParamCount] = { "Amount", "Glide", "Mix", "Shift", "Tune", "Root", "Scale" };
+    
+    // Any number of producers. Only a parameter's latest value matters, so each
+    // has one slot that a newer change simply overwrites, and a bit in
+    // pendingMask saying the slot holds a value not yet applied. The value is
+    // stored before its bit is set, so the audio thread never sees the bit
+    // without the value, and a change landing while the audio thread applies
+    // the slots sets the bit again for the next block.
+    void queueChange (int parameter, float value)
+    {
+        pendingValues[(size_t) parameter].store (value, std::memory_order_relaxed);
+        pendingMask.fetch_or (1u << parameter, std::memory_order_release);
+    }
+    
+    // Single consumer: the audio thread, once per process() call
+    void applyQueuedChanges()
+    {
+        auto mask = pendingMask.exchange (0, std::memory_order_acquire);
+        
+        for (int i = 0; mask != 0; i++, mask >>= 1) {
+            if (mask & 1) {
+                applyChange (i, pendingValues[(size_t) i].load (std::memory_order_relaxed));
+            }
+        }
+    }
+    
+    void applyChange (int parameter, float value)
+    {
+        switch (parameter) {
+            case Amount: autoPitchCorrector.setAmountAmount(value / 100); break;
+            case Glide: autoPitchCorrector.setGlideAmount(value / 1000); break;
+            case Mix: autoPitchCorrector.setMixAmount(value / 100); break;
+            case Shift: autoPitchCorrector.setShiftAmount(value); break;
+            case Tune: autoPitchCorrector.setTuneAmount(value / 100); break;
+            case Root: autoPitchCorrector.setScale((int) value, autoPitchCorrector.getScale()); break;
+            case Scale: autoPitchCorrector.setScale(autoPitchCorrector.getRoot(), (int) value); break;
+        }
+    }
+    
     AutoPitchCorrector autoPitchCorrector;
+    
+    std::array<std::atomic<float>, ParamCount> pendingValues {};
+    std::atomic<unsigned int> pendingMask { 0 };
 };
@@ -0,0 +1,101 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+#ifndef __ALIGNEDARENA__
+#define __ALIGNEDARENA__
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+// One cache-line-aligned block that a shifter carves all of its float buffers
+// from. Add up footprint() for every buffer, reserve() the total, then carve()
+// them in any order; each buffer starts on its own cache line. grow() makes
+// room ahead of time for a larger layout to come.
+class AlignedArena
+{
+public:
+    static const size_t alignment = 64;
+
+    AlignedArena() = default;
+    AlignedArena(const AlignedArena&) = delete;
+    AlignedArena& operator=(const AlignedArena&) = delete;
+
+    ~AlignedArena()
+    {
+        release();
+    }
+
+    // Bytes a buffer of numFloats takes, padded to the next cache line
+    static size_t footprint(size_t numFloats)
+    {
+        return (numFloats * sizeof(float) + alignment - 1) / alignment * alignment;
+    }
+
+    // Makes sure later reserve()s of up to size bytes won't allocate. Drops the
+    // current layout if it has to allocate. Not realtime safe.
+    void grow(size_t size)
+    {
+        if (size > capacity) {
+            release();
+            block = (char*)::operator new(size, std::align_val_t (alignment));
+            capacity = size;
+        }
+    }
+
+    // Makes the arena size bytes and rewinds it. Only allocates if it has less
+    // than that already. Not realtime safe.
+    void reserve(size_t size)
+    {
+        grow (size);
+        used = size;
+        next = 0;
+    }
+
+    // Next buffer of numFloats, zeroed
+    float* carve(size_t numFloats)
+    {
+        float* p = (float*)(block + next);
+        next += footprint (numFloats);
+        memset(p, 0, numFloats * sizeof(float));
+        return p;
+    }
+
+    // Zeroes every buffer carved so far
+    void clear()
+    {
+        if (block != nullptr) {
+            memset(block, 0, used);
+        }
+    }
+
+    // Bytes in use by the current layout
+    size_t getSize() const
+    {
+        return used;
+    }
+
+private:
+    void release()
+    {
+        if (block != nullptr) {
+            ::operator delete(block, std::align_val_t (alignment));
+        }
+        block = nullptr;
+        capacity = 0;
+        used = 0;
+        next = 0;
+    }
+
+    char* block = nullptr;
+    size_t capacity = 0;
+    size_t used = 0;
+    size_t next = 0;
+};
+
+#endif
@@ -0,0 +1,375 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+#ifndef __CORRECTIONENGINE__
+#define __CORRECTIONENGINE__
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "PitchShifter.h"
+#include "RealtimeWorkerPool.h"
+
+#define MAX_INDEPENDENT_CHANNELS 32
+
+// Owns the pitch shifters for a whole bus. In linked mode a single shifter
+// analyses the channel average and moves every channel together; in
+// independent mode each channel gets its own shifter (choir and multi-mic
+// sessions) and the channels are spread over a RealtimeWorkerPool, joining
+// before process() returns. Buses wider than MAX_LINKED_CHANNELS are always
+// independent.
+//
+// The workers only see staged copies of each channel's slice of the block, so
+// one that is preempted past the join's budget can be left behind: its channel
+// is silenced for that slice and skipped until the worker is done, then takes
+// its settings over from another shifter.
+//
+// Everything is allocated in prepare(), so switching mode or parameters on the
+// audio thread never allocates.
+class CorrectionEngine
+{
+public:
+    enum ChannelModes {
+        ChannelsLinked = 0,
+        ChannelsIndependent
+    };
+
+    // Below this many samples per block the fork/join handshake costs more than
+    // it saves, so independent channels are processed serially
+    static const int minParallelBlock = 64;
+
+    // Longer blocks are staged and joined in slices of this many samples, and
+    // a slice is cut short where its events would not fit
+    static const int maxStagedBlock = 2048;
+    static const int maxStagedEvents = 128;
+
+    // Share of a slice's duration process() waits on the workers for
+    static constexpr double joinBudget = 0.8;
+
+    ~CorrectionEngine()
+    {
+        release();
+    }
+
+    // Not realtime safe. latencyMode is one of PitchShifter::LatencyModes.
+    // Shifters and workers from an earlier prepare() are reused, so preparing
+    // the same layout again only resets the shifters.
+    void prepare(double sampleRate, int numChannels, int maxVoices = 1, int latencyMode = PitchShifter::LatencyStandard)
+    {
+        int c;
+        int workers;
+
+        pool.waitForAbandonedTasks();
+        samplerate = sampleRate;
+        numchannels = std::max (1, std::min (numChannels, MAX_INDEPENDENT_CHANNELS));
+
+        if (numchannels <= MAX_LINKED_CHANNELS) {
+            if (linked == nullptr) {
+                linked.reset (new PitchShifter());
+            }
+            linked->init ((unsigned long)sampleRate, numchannels, maxVoices, latencyMode);
+            linked->setPitchHistory (history);
+            linked->setSpectrum (spectrum);
+        }
+        else {
+            linked.reset();
+        }
+
+        independent.resize (numchannels);
+        for (c = 0; c < numchannels; c++) {
+            if (independent[c] == nullptr) {
+                independent[c].reset (new PitchShifter());
+            }
+            independent[c]->init ((unsigned long)sampleRate, 1, maxVoices, latencyMode);
+            independent[c]->setPitchHistory (c == 0 ? history : nullptr);
+            independent[c]->setSpectrum (c == 0 ? spectrum : nullptr);
+        }
+
+        staging.assign ((size_t)numchannels * 2 * maxStagedBlock, 0.0f);
+        for (c = 0; c < numchannels; c++) {
+            staged[c].input = staging.data() + (size_t)c * 2 * maxStagedBlock;
+            staged[c].output = staged[c].input + maxStagedBlock;
+        }
+
+        // The calling thread takes a share of the channels too, and we leave a
+        // core for the host
+        workers = std::max (0, std::min (numchannels, (int)std::thread::hardware_concurrency() - 1) - 1);
+        if (workers != pool.getNumWorkers()) {
+            pool.start (workers);
+        }
+    }
+
+    // Stops the workers; call prepare() again before processing
+    void release()
+    {
+        pool.stop();
+    }
+
+    void setChannelMode(int mode)
+    {
+        channelmode = mode;
+    }
+
+    int getChannelMode()
+    {
+        return isIndependent() ? ChannelsIndependent : ChannelsLinked;
+    }
+
+    int getNumChannels()
+    {
+        return numchannels;
+    }
+
+    // Every shifter was prepared with the same mode, so linked and independent
+    // processing delay the bus by the same amount
+    int getLatencySamples()
+    {
+        return independent.empty() ? 0 : independent[0]->getLatencySamples();
+    }
+
+    // Processes the first getNumChannels() channels in place, float or double.
+    // Every shifter applies the events at their sample offsets; see
+    // PitchShifter::ParameterEvent.
+    template <typename SampleType>
+    void process(SampleType* const* channels, int numSamples, const PitchShifter::ParameterEvent* events = nullptr, int numEvents = 0)
+    {
+        int c, i;
+        int start, len;
+        int next = 0;
+
+        if (! isIndependent()) {
+            linked->process (channels, channels, numSamples, events, numEvents);
+            return;
+        }
+
+        resyncShifters();
+        if (numSamples < minParallelBlock) {
+            for (c = 0; c < numchannels; c++) {
+                SampleType* io[] = { channels[c] };
+                if (pool.isBusy (c)) {
+                    std::fill (channels[c], channels[c] + numSamples, (SampleType)0);
+                    stale[c] = true;
+                    continue;
+                }
+                independent[c]->process (io, io, numSamples, events, numEvents);
+            }
+            return;
+        }
+
+        for (start = 0; start < numSamples; start += len) {
+            len = std::min (numSamples - start, maxStagedBlock);
+            len = stageEvents (events, numEvents, next, start, len, start + len == numSamples);
+
+            for (c = 0; c < numchannels; c++) {
+                StagedChannel& st = staged[c];
+                if (pool.isBusy (c)) {
+                    st.ready.store (false, std::memory_order_relaxed);
+                    continue;
+                }
+                for (i = 0; i < len; i++) {
+                    st.input[i] = (float)channels[c][start + i];
+                }
+                std::copy (sliceevents, sliceevents + numsliceevents, st.events);
+                st.numevents = numsliceevents;
+                st.numsamples = len;
+                st.ready.store (true, std::memory_order_relaxed);
+            }
+
+            pool.run (numchannels, processStaged, this, std::max (1, (int)(1e6 * joinBudget * len / samplerate)));
+
+            for (c = 0; c < numchannels; c++) {
+                StagedChannel& st = staged[c];
+                if (pool.isLate (c) || ! st.ready.load (std::memory_order_relaxed)) {
+                    std::fill (channels[c] + start, channels[c] + start + len, (SampleType)0);
+                    stale[c] = true;
+                    continue;
+                }
+                for (i = 0; i < len; i++) {
+                    channels[c][start + i] = (SampleType)st.output[i];
+                }
+            }
+        }
+    }
+
+    // Applies a setter to every shifter, linked and per channel, so a mode
+    // switch picks up the current parameters. One a late worker is still
+    // inside is left alone and catches up in the next process().
+    template <typename Fn>
+    void forEachShifter(Fn&& fn)
+    {
+        if (linked != nullptr) {
+            fn (*linked);
+        }
+        for (int c = 0; c < numchannels; c++) {
+            if (pool.isBusy (c)) {
+                stale[c] = true;
+                continue;
+            }
+            fn (*independent[c]);
+        }
+    }
+
+    // Ring the lead shifter reports each analysis hop to, linked or not. Set it
+    // before prepare(), or call again afterwards; not while processing.
+    void setPitchHistory(PitchHistory* h)
+    {
+        history = h;
+        if (linked != nullptr) {
+            linked->setPitchHistory (h);
+        }
+        if (! independent.empty()) {
+            independent[0]->setPitchHistory (h);
+        }
+    }
+
+    // Triple buffer the lead shifter publishes its analysis spectrum to; same
+    // rules as setPitchHistory()
+    void setSpectrum(SpectrumBuffer* s)
+    {
+        spectrum = s;
+        if (linked != nullptr) {
+            linked->setSpectrum (s);
+        }
+        if (! independent.empty()) {
+            independent[0]->setSpectrum (s);
+        }
+    }
+
+    // Shifter whose state the UI and MIDI handling read back
+    PitchShifter& getLeadShifter()
+    {
+        return isIndependent() ? *independent[0] : *linked;
+    }
+
+private:
+    bool isIndependent()
+    {
+        return linked == nullptr || channelmode == ChannelsIndependent;
+    }
+
+    // A channel's slice of the block as its worker sees it. Only a channel whose
+    // worker is idle is restaged, so a late worker reads nothing that changes.
+    struct StagedChannel
+    {
+        float* input = nullptr;
+        float* output = nullptr;
+        int numsamples = 0;
+        PitchShifter::ParameterEvent events[maxStagedEvents];
+        int numevents = 0;
+        std::atomic<bool> ready { false }; // false if it was busy when staged
+    };
+
+    static void processStaged(void* context, int channel)
+    {
+        CorrectionEngine* e = (CorrectionEngine*)context;
+        StagedChannel& st = e->staged[channel];
+        const float* in[] = { st.input };
+        float* out[] = { st.output };
+
+        if (st.ready.load (std::memory_order_relaxed)) {
+            e->independent[channel]->process (in, out, st.numsamples, st.events, st.numevents);
+        }
+    }
+
+    // Gathers the events for the slice at start into sliceevents, rebased to it,
+    // and returns how long the slice may be for them to fit. Events before the
+    // slice apply at its start and, in the block's last slice, those past the
+    // block at its end. Of several at one offset only the last value for each
+    // parameter matters, so an offset never needs more than
+    // NumAutomationParameters slots.
+    int stageEvents(const PitchShifter::ParameterEvent* events, int numEvents, int& next, int start, int len, bool last)
+    {
+        int groupevent = next; // first event, and slot, of the last offset staged
+        int groupslot = 0;
+        int j;
+
+        numsliceevents = 0;
+        while (next < numEvents) {
+            PitchShifter::ParameterEvent ev = events[next];
+            if (ev.sampleOffset - start >= len && ! last) {
+                break;
+            }
+            ev.sampleOffset = std::max (0, std::min (len, ev.sampleOffset - start));
+
+            for (j = numsliceevents - 1; j >= 0 && sliceevents[j].sampleOffset == ev.sampleOffset; j--) {
+                if (sliceevents[j].parameter == ev.parameter) {
+                    break;
+                }
+            }
+            if (j >= 0 && sliceevents[j].sampleOffset == ev.sampleOffset) {
+                sliceevents[j].value = ev.value;
+                next++;
+                continue;
+            }
+
+            // Full: end the slice just before this offset, where the events staged
+            // for it still apply (after the slice's last sample). Only those meant
+            // for after the block go back, to a final one-sample slice.
+            if (numsliceevents == maxStagedEvents) {
+                if (ev.sampleOffset < len) {
+                    return ev.sampleOffset;
+                }
+                if (sliceevents[numsliceevents - 1].sampleOffset == len) {
+                    numsliceevents = groupslot;
+                    next = groupevent;
+                }
+                return len - 1;
+            }
+
+            if (numsliceevents == 0 || sliceevents[numsliceevents - 1].sampleOffset != ev.sampleOffset) {
+                groupevent = next;
+                groupslot = numsliceevents;
+            }
+            sliceevents[numsliceevents++] = ev;
+            next++;
+        }
+        return len;
+    }
+
+    // Hands the settings a busy shifter missed back to it once its worker is
+    // done. The linked shifter is never busy and always up to date.
+    void resyncShifters()
+    {
+        PitchShifter* source = linked.get();
+        int c;
+
+        for (c = 0; source == nullptr && c < numchannels; c++) {
+            if (! stale[c] && ! pool.isBusy (c)) {
+                source = independent[c].get();
+            }
+        }
+        if (source == nullptr) {
+            return;
+        }
+        for (c = 0; c < numchannels; c++) {
+            if (stale[c] && ! pool.isBusy (c)) {
+                independent[c]->copySettings (*source);
+                stale[c] = false;
+            }
+        }
+    }
+
+    std::unique_ptr<PitchShifter> linked;
+    std::vector<std::unique_ptr<PitchShifter>> independent;
+    RealtimeWorkerPool pool;
+    int numchannels = 0;
+    int channelmode = ChannelsLinked;
+    PitchHistory* history = nullptr; // not owned
+    SpectrumBuffer* spectrum = nullptr; // not owned
+    double samplerate = 44100;
+
+    std::vector<float> staging; // input then output, maxStagedBlock each, per channel
+    StagedChannel staged[MAX_INDEPENDENT_CHANNELS];
+    PitchShifter::ParameterEvent sliceevents[maxStagedEvents];
+    int numsliceevents = 0;
+    bool stale[MAX_INDEPENDENT_CHANNELS] {}; // missed a setter while busy
+};
+
+#endif
@@ -0,0 +1,143 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+#ifndef __DSPTABLECACHE__
+#define __DSPTABLECACHE__
+#include "fftsetup.h"
+#include <map>
+#include <math.h>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Read-only tables that depend only on the buffer size and window type
+struct ShifterTables
+{
+    unsigned long cbsize;
+    int windowType; // one of DspTableCache::WindowTypes
+    const float* hannwindow; // length-N hann
+    const float* cbwindow; // analysis window, zeros either side of it
+    const float* acwinv; // inverse of autocorrelation of window
+    std::vector<float> storage; // backs the pointers for sets built at runtime
+};
+
+// Compiled-in tables for every size init() picks, from Tools/DspTableGenerator.
+// DSPTABLES_NONE leaves them out, for bootstrapping the generator.
+#ifndef DSPTABLES_NONE
+#include "DspTables.h"
+#else
+static const int generatedTableCount = 0;
+inline const ShifterTables* generatedShifterTables()
+{
+    return nullptr;
+}
+#endif
+
+// Process-wide cache of ShifterTables keyed by (cbsize, window type). Sizes
+// init() picks are compiled in and just looked up. Any other size is built on
+// first use and shared by every shifter of that size; the cache only holds
+// weak references, so a built set is freed with its last user. acquire() may
+// lock and build, so call it from init(), never from the audio thread.
+class DspTableCache
+{
+public:
+    enum WindowTypes {
+        WindowHalfHann = 0, // hann over the middle N/2 samples, as autotalent
+        WindowLiveHann // hann over the middle 7N/8, for live tracking's shorter buffer
+    };
+
+    static std::shared_ptr<const ShifterTables> acquire(unsigned long cbsize, int windowType = WindowHalfHann)
+    {
+        const ShifterTables* generated = generatedShifterTables();
+        for (int i = 0; i < generatedTableCount; i++) {
+            if (generated[i].cbsize == cbsize && generated[i].windowType == windowType) {
+                // Static storage, so the pointer owns nothing
+                return std::shared_ptr<const ShifterTables> (std::shared_ptr<const ShifterTables>(), &generated[i]);
+            }
+        }
+
+        static std::mutex lock;
+        static std::map<std::pair<unsigned long, int>, std::weak_ptr<const ShifterTables>> cache;
+
+        std::lock_guard<std::mutex> guard (lock);
+        std::weak_ptr<const ShifterTables>& entry = cache[std::make_pair (cbsize, windowType)];
+        std::shared_ptr<const ShifterTables> tables = entry.lock();
+
+        if (tables == nullptr) {
+            tables = build (cbsize, windowType);
+            entry = tables;
+        }
+        return tables;
+    }
+
+    // Runtime computation of a set. Tools/DspTableGenerator emits DspTables.h
+    // from this and checks the compiled-in sets against it.
+    static std::shared_ptr<const ShifterTables> build(unsigned long cbsize, int windowType)
+    {
+        std::shared_ptr<ShifterTables> t = std::make_shared<ShifterTables>();
+        unsigned long corrsize = cbsize / 2 + 1;
+        unsigned long ti;
+
+        t->cbsize = cbsize;
+        t->windowType = windowType;
+        t->storage.assign (3 * cbsize, 0.0f);
+        float* hannwindow = t->storage.data();
+        float* cbwindow = hannwindow + cbsize;
+        float* acwinv = cbwindow + cbsize;
+        t->hannwindow = hannwindow;
+        t->cbwindow = cbwindow;
+        t->acwinv = acwinv;
+
+        for (ti=0; ti<cbsize; ti++) {
+            hannwindow[ti] = -0.5*cos(2*M_PI*ti/(cbsize - 1)) + 0.5;
+        }
+
+        if (windowType == WindowLiveHann) {
+            // Two periods at the live floor need more than N/2. What is left of
+            // the zeros is less than the longest lag, but the lags that wrap
+            // around only pick up the far tail of the window's autocorrelation.
+            unsigned long w = cbsize * 7 / 8;
+            for (ti=0; ti<w; ti++) {
+                cbwindow[ti+(cbsize-w)/2] = -0.5*cos(2*M_PI*ti/(w - 1)) + 0.5;
+            }
+        }
+        else {
+            for (ti=0; ti<(cbsize / 2); ti++) {
+                cbwindow[ti+cbsize/4] = -0.5*cos(4*M_PI*ti/(cbsize - 1)) + 0.5;
+            }
+        }
+
+        // Autocorrelation of the window itself, to unbias the pitch confidence
+        fft_vars* fmembvars = fft_con (cbsize);
+        std::vector<float> re (cbsize), im (cbsize), tmp (cbsize);
+        fft_forward(fmembvars, cbwindow, re.data(), im.data());
+        for (ti=0; ti<corrsize; ti++) {
+            re[ti] = re[ti]*re[ti] + im[ti]*im[ti];
+            im[ti] = 0;
+        }
+        fft_inverse(fmembvars, re.data(), im.data(), tmp.data());
+        fft_des(fmembvars);
+
+        for (ti=1; ti<cbsize; ti++) {
+            acwinv[ti] = tmp[ti]/tmp[0];
+            if (acwinv[ti] > 0.000001) {
+                acwinv[ti] = (float)1/acwinv[ti];
+            }
+            else {
+                acwinv[ti] = 0;
+            }
+        }
+        acwinv[0] = 1;
+
+        return t;
+    }
+};
+
+#endif
@@ -0,0 +1,4327 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Generated by Tools/DspTableGenerator.cpp, do not edit. Included by
+// DspTableCache.h after ShifterTables.
+
+#ifndef __DSPTABLES__
+#define __DSPTABLES__
+
+static const int generatedTableCount = 4;
+
+inline const ShifterTables* generatedShifterTables()
+{
+    static const float hannwindow1024[1024] = {
+        0.00000000e+00f, 9.43076884e-06f, 3.77227225e-05f, 8.48747877e-05f, 1.50885186e-04f, 2.35751446e-04f,
+        3.39470338e-04f, 4.62037948e-04f, 6.03449706e-04f, 7.63700227e-04f, 9.42783430e-04f, 1.14069262e-03f,
+        1.35742035e-03f, 1.59295846e-03f, 1.84729788e-03f, 2.12042918e-03f, 2.41234223e-03f, 2.72302562e-03f,
+        3.05246795e-03f, 3.40065663e-03f, 3.76757840e-03f, 4.15321952e-03f, 4.55756579e-03f, 4.98060184e-03f,
+        5.42231137e-03f, 5.88267762e-03f, 6.36168383e-03f, 6.85931137e-03f, 7.37554161e-03f, 7.91035499e-03f,
+        8.46373197e-03f, 9.03565157e-03f, 9.62609146e-03f, 1.02350293e-02f, 1.08624427e-02f, 1.15083084e-02f,
+        1.21726012e-02f, 1.28552960e-02f, 1.35563686e-02f, 1.42757902e-02f, 1.50135355e-02f, 1.57695748e-02f,
+        1.65438820e-02f, 1.73364263e-02f, 1.81471780e-02f, 1.89761072e-02f, 1.98231805e-02f, 2.06883699e-02f,
+        2.15716381e-02f, 2.24729553e-02f, 2.33922862e-02f, 2.43295971e-02f, 2.52848510e-02f, 2.62580123e-02f,
+        2.72490438e-02f, 2.82579102e-02f, 2.92845722e-02f, 3.03289909e-02f, 3.13911252e-02f, 3.24709415e-02f,
+        3.35683897e-02f, 3.46834362e-02f, 3.58160324e-02f, 3.69661413e-02f, 3.81337181e-02f, 3.93187180e-02f,
+        4.05210927e-02f, 4.17408049e-02f, 4.29778025e-02f, 4.42320406e-02f, 4.55034673e-02f, 4.67920452e-02f,
+        4.80977148e-02f, 4.94204350e-02f, 5.07601500e-02f, 5.21168150e-02f, 5.34903742e-02f, 5.48807755e-02f,
+        5.62879667e-02f, 5.77118993e-02f, 5.91525137e-02f, 6.06097616e-02f, 6.20835833e-02f, 6.35739267e-02f,
+        6.50807247e-02f, 6.66039363e-02f, 6.81435019e-02f, 6.96993470e-02f, 7.12714344e-02f, 7.28596896e-02f,
+        7.44640604e-02f, 7.60844797e-02f, 7.77208880e-02f, 7.93732330e-02f, 8.10414404e-02f, 8.27254578e-02f,
+        8.44252110e-02f, 8.61406475e-02f, 8.78716856e-02f, 8.96182805e-02f, 9.13803503e-02f, 9.31578353e-02f,
+        9.49506685e-02f, 9.67587829e-02f, 9.85821113e-02f, 1.00420572e-01f, 1.02274112e-01f, 1.04142658e-01f,
+        1.06026135e-01f, 1.07924476e-01f, 1.09837607e-01f, 1.11765452e-01f, 1.13707945e-01f, 1.15665011e-01f,
+        1.17636569e-01f, 1.19622558e-01f, 1.21622898e-01f, 1.23637505e-01f, 1.25666305e-01f, 1.27709240e-01f,
+        1.29766211e-01f, 1.31837144e-01f, 1.33921981e-01f, 1.36020616e-01f, 1.38132975e-01f, 1.40258998e-01f,
+        1.42398581e-01f, 1.44551665e-01f, 1.46718144e-01f, 1.48897961e-01f, 1.51091024e-01f, 1.53297246e-01f,
+        1.55516535e-01f, 1.57748833e-01f, 1.59994036e-01f, 1.62252069e-01f, 1.64522842e-01f, 1.66806266e-01f,
+        1.69102266e-01f, 1.71410739e-01f, 1.73731610e-01f, 1.76064789e-01f, 1.78410202e-01f, 1.80767730e-01f,
+        1.83137298e-01f, 1.85518831e-01f, 1.87912226e-01f, 1.90317392e-01f, 1.92734227e-01f, 1.95162669e-01f,
+        1.97602600e-01f, 2.00053945e-01f, 2.02516615e-01f, 2.04990491e-01f, 2.07475498e-01f, 2.09971547e-01f,
+        2.12478533e-01f, 2.14996368e-01f, 2.17524946e-01f, 2.20064178e-01f, 2.22613975e-01f, 2.25174248e-01f,
+        2.27744877e-01f, 2.30325773e-01f, 2.32916847e-01f, 2.35517994e-01f, 2.38129124e-01f, 2.40750119e-01f,
+        2.43380904e-01f, 2.46021375e-01f, 2.48671412e-01f, 2.51330942e-01f, 2.53999859e-01f, 2.56678045e-01f,
+        2.59365410e-01f, 2.62061834e-01f, 2.64767259e-01f, 2.67481565e-01f, 2.70204604e-01f, 2.72936344e-01f,
+        2.75676638e-01f, 2.78425395e-01f, 2.81182528e-01f, 2.83947885e-01f, 2.86721408e-01f, 2.89502978e-01f,
+        2.92292506e-01f, 2.95089841e-01f, 2.97894925e-01f, 3.00707608e-01f, 3.03527832e-01f, 3.06355447e-01f,
+        3.09190392e-01f, 3.12032521e-01f, 3.14881742e-01f, 3.17737937e-01f, 3.20601016e-01f, 3.23470861e-01f,
+        3.26347381e-01f, 3.29230428e-01f, 3.32119942e-01f, 3.35015774e-01f, 3.37917805e-01f, 3.40825975e-01f,
+        3.43740165e-01f, 3.46660227e-01f, 3.49586070e-01f, 3.52517605e-01f, 3.55454713e-01f, 3.58397245e-01f,
+        3.61345142e-01f, 3.64298254e-01f, 3.67256492e-01f, 3.70219737e-01f, 3.73187870e-01f, 3.76160800e-01f,
+        3.79138380e-01f, 3.82120520e-01f, 3.85107130e-01f, 3.88098061e-01f, 3.91093224e-01f, 3.94092470e-01f,
+        3.97095740e-01f, 4.00102884e-01f, 4.03113782e-01f, 4.06128347e-01f, 4.09146458e-01f, 4.12167996e-01f,
+        4.15192842e-01f, 4.18220878e-01f, 4.21252012e-01f, 4.24286097e-01f, 4.27323073e-01f, 4.30362761e-01f,
+        4.33405101e-01f, 4.36449915e-01f, 4.39497173e-01f, 4.42546666e-01f, 4.45598364e-01f, 4.48652089e-01f,
+        4.51707780e-01f, 4.54765260e-01f, 4.57824469e-01f, 4.60885257e-01f, 4.63947535e-01f, 4.67011154e-01f,
+        4.70076025e-01f, 4.73142028e-01f, 4.76209044e-01f, 4.79276955e-01f, 4.82345641e-01f, 4.85415012e-01f,
+        4.88484919e-01f, 4.91555274e-01f, 4.94625926e-01f, 4.97696787e-01f, 5.00767767e-01f, 5.03838658e-01f,
+        5.06909430e-01f, 5.09979963e-01f, 5.13050079e-01f, 5.16119778e-01f, 5.19188762e-01f, 5.22257090e-01f,
+        5.25324583e-01f, 5.28391123e-01f, 5.31456530e-01f, 5.34520805e-01f, 5.37583768e-01f, 5.40645301e-01f,
+        5.43705344e-01f, 5.46763718e-01f, 5.49820304e-01f, 5.52875042e-01f, 5.55927753e-01f, 5.58978379e-01f,
+        5.62026739e-01f, 5.65072775e-01f, 5.68116367e-01f, 5.71157396e-01f, 5.74195743e-01f, 5.77231288e-01f,
+        5.80263913e-01f, 5.83293557e-01f, 5.86319983e-01f, 5.89343190e-01f, 5.92363000e-01f, 5.95379353e-01f,
+        5.98392129e-01f, 6.01401150e-01f, 6.04406357e-01f, 6.07407629e-01f, 6.10404849e-01f, 6.13397956e-01f,
+        6.16386712e-01f, 6.19371116e-01f, 6.22350991e-01f, 6.25326276e-01f, 6.28296793e-01f, 6.31262541e-01f,
+        6.34223282e-01f, 6.37178957e-01f, 6.40129447e-01f, 6.43074691e-01f, 6.46014512e-01f, 6.48948848e-01f,
+        6.51877582e-01f, 6.54800534e-01f, 6.57717645e-01f, 6.60628855e-01f, 6.63533986e-01f, 6.66432917e-01f,
+        6.69325590e-01f, 6.72211885e-01f, 6.75091684e-01f, 6.77964866e-01f, 6.80831373e-01f, 6.83691025e-01f,
+        6.86543763e-01f, 6.89389467e-01f, 6.92227960e-01f, 6.95059299e-01f, 6.97883189e-01f, 7.00699687e-01f,
+        7.03508556e-01f, 7.06309795e-01f, 7.09103227e-01f, 7.11888790e-01f, 7.14666367e-01f, 7.17435837e-01f,
+        7.20197082e-01f, 7.22950041e-01f, 7.25694597e-01f, 7.28430569e-01f, 7.31158018e-01f, 7.33876705e-01f,
+        7.36586571e-01f, 7.39287496e-01f, 7.41979420e-01f, 7.44662225e-01f, 7.47335792e-01f, 7.50000000e-01f,
+        7.52654791e-01f, 7.55300045e-01f, 7.57935703e-01f, 7.60561585e-01f, 7.63177693e-01f, 7.65783846e-01f,
+        7.68379927e-01f, 7.70965934e-01f, 7.73541749e-01f, 7.76107192e-01f, 7.78662205e-01f, 7.81206787e-01f,
+        7.83740699e-01f, 7.86263883e-01f, 7.88776338e-01f, 7.91277826e-01f, 7.93768406e-01f, 7.96247840e-01f,
+        7.98716128e-01f, 8.01173151e-01f, 8.03618789e-01f, 8.06052983e-01f, 8.08475673e-01f, 8.10886681e-01f,
+        8.13285947e-01f, 8.15673411e-01f, 8.18048954e-01f, 8.20412576e-01f, 8.22764039e-01f, 8.25103343e-01f,
+        8.27430367e-01f, 8.29745054e-01f, 8.32047284e-01f, 8.34336996e-01f, 8.36614132e-01f, 8.38878572e-01f,
+        8.41130197e-01f, 8.43368948e-01f, 8.45594764e-01f, 8.47807527e-01f, 8.50007176e-01f, 8.52193594e-01f,
+        8.54366779e-01f, 8.56526554e-01f, 8.58672917e-01f, 8.60805690e-01f, 8.62924933e-01f, 8.65030408e-01f,
+        8.67122173e-01f, 8.69200051e-01f, 8.71264040e-01f, 8.73313963e-01f, 8.75349879e-01f, 8.77371550e-01f,
+        8.79379034e-01f, 8.81372213e-01f, 8.83351028e-01f, 8.85315359e-01f, 8.87265146e-01f, 8.89200330e-01f,
+        8.91120791e-01f, 8.93026531e-01f, 8.94917488e-01f, 8.96793485e-01f, 8.98654521e-01f, 9.00500536e-01f,
+        9.02331471e-01f, 9.04147208e-01f, 9.05947685e-01f, 9.07732844e-01f, 9.09502625e-01f, 9.11256969e-01f,
+        9.12995756e-01f, 9.14719045e-01f, 9.16426599e-01f, 9.18118536e-01f, 9.19794619e-01f, 9.21454906e-01f,
+        9.23099339e-01f, 9.24727738e-01f, 9.26340163e-01f, 9.27936435e-01f, 9.29516613e-01f, 9.31080580e-01f,
+        9.32628334e-01f, 9.34159696e-01f, 9.35674727e-01f, 9.37173307e-01f, 9.38655376e-01f, 9.40120935e-01f,
+        9.41569865e-01f, 9.43002164e-01f, 9.44417715e-01f, 9.45816517e-01f, 9.47198510e-01f, 9.48563635e-01f,
+        9.49911833e-01f, 9.51243043e-01f, 9.52557266e-01f, 9.53854382e-01f, 9.55134392e-01f, 9.56397235e-01f,
+        9.57642853e-01f, 9.58871186e-01f, 9.60082293e-01f, 9.61275935e-01f, 9.62452233e-01f, 9.63611126e-01f,
+        9.64752436e-01f, 9.65876281e-01f, 9.66982543e-01f, 9.68071163e-01f, 9.69142139e-01f, 9.70195413e-01f,
+        9.71230984e-01f, 9.72248733e-01f, 9.73248720e-01f, 9.74230826e-01f, 9.75194991e-01f, 9.76141274e-01f,
+        9.77069616e-01f, 9.77979958e-01f, 9.78872240e-01f, 9.79746461e-01f, 9.80602622e-01f, 9.81440604e-01f,
+        9.82260466e-01f, 9.83062148e-01f, 9.83845532e-01f, 9.84610736e-01f, 9.85357642e-01f, 9.86086190e-01f,
+        9.86796439e-01f, 9.87488329e-01f, 9.88161862e-01f, 9.88816917e-01f, 9.89453554e-01f, 9.90071774e-01f,
+        9.90671456e-01f, 9.91252601e-01f, 9.91815269e-01f, 9.92359400e-01f, 9.92884874e-01f, 9.93391812e-01f,
+        9.93880153e-01f, 9.94349837e-01f, 9.94800866e-01f, 9.95233238e-01f, 9.95646954e-01f, 9.96041954e-01f,
+        9.96418238e-01f, 9.96775806e-01f, 9.97114599e-01f, 9.97434676e-01f, 9.97735977e-01f, 9.98018503e-01f,
+        9.98282194e-01f, 9.98527169e-01f, 9.98753309e-01f, 9.98960614e-01f, 9.99149084e-01f, 9.99318779e-01f,
+        9.99469638e-01f, 9.99601603e-01f, 9.99714732e-01f, 9.99809027e-01f, 9.99884486e-01f, 9.99941051e-01f,
+        9.99978781e-01f, 9.99997616e-01f, 9.99997616e-01f, 9.99978781e-01f, 9.99941051e-01f, 9.99884486e-01f,
+        9.99809027e-01f, 9.99714732e-01f, 9.99601603e-01f, 9.99469638e-01f, 9.99318779e-01f, 9.99149084e-01f,
+        9.98960614e-01f, 9.98753309e-01f, 9.98527169e-01f, 9.98282194e-01f, 9.98018503e-01f, 9.97735977e-01f,
+        9.97434676e-01f, 9.97114599e-01f, 9.96775806e-01f, 9.96418238e-01f, 9.96041954e-01f, 9.95646954e-01f,
+        9.95233238e-01f, 9.94800866e-01f, 9.94349837e-01f, 9.93880153e-01f, 9.93391812e-01f, 9.92884874e-01f,
+        9.92359400e-01f, 9.91815269e-01f, 9.91252601e-01f, 9.90671456e-01f, 9.90071774e-01f, 9.89453554e-01f,
+        9.88816917e-01f, 9.88161862e-01f, 9.87488329e-01f, 9.86796439e-01f, 9.86086190e-01f, 9.85357642e-01f,
+        9.84610736e-01f, 9.83845532e-01f, 9.83062148e-01f, 9.82260466e-01f, 9.81440604e-01f, 9.80602622e-01f,
+        9.79746461e-01f, 9.78872240e-01f, 9.77979958e-01f, 9.77069616e-01f, 9.76141274e-01f, 9.75194991e-01f,
+        9.74230826e-01f, 9.73248720e-01f, 9.72248733e-01f, 9.71230984e-01f, 9.70195413e-01f, 9.69142139e-01f,
+        9.68071163e-01f, 9.66982543e-01f, 9.65876281e-01f, 9.64752436e-01f, 9.63611126e-01f, 9.62452233e-01f,
+        9.61275935e-01f, 9.60082293e-01f, 9.58871186e-01f, 9.57642853e-01f, 9.56397235e-01f, 9.55134392e-01f,
+        9.53854382e-01f, 9.52557266e-01f, 9.51243043e-01f, 9.49911833e-01f, 9.48563635e-01f, 9.47198510e-01f,
+        9.45816517e-01f, 9.44417715e-01f, 9.43002164e-01f, 9.41569865e-01f, 9.40120935e-01f, 9.38655376e-01f,
+        9.37173307e-01f, 9.35674727e-01f, 9.34159696e-01f, 9.32628334e-01f, 9.31080580e-01f, 9.29516613e-01f,
+        9.27936435e-01f, 9.26340163e-01f, 9.24727738e-01f, 9.23099339e-01f, 9.21454906e-01f, 9.19794619e-01f,
+        9.18118536e-01f, 9.16426599e-01f, 9.14719045e-01f, 9.12995756e-01f, 9.11256969e-01f, 9.09502625e-01f,
+        9.07732844e-01f, 9.05947685e-01f, 9.04147208e-01f, 9.02331471e-01f, 9.00500536e-01f, 8.98654521e-01f,
+        8.96793485e-01f, 8.94917488e-01f, 8.93026531e-01f, 8.91120791e-01f, 8.89200330e-01f, 8.87265146e-01f,
+        8.85315359e-01f, 8.83351028e-01f, 8.81372213e-01f, 8.79379034e-01f, 8.77371550e-01f, 8.75349879e-01f,
+        8.73313963e-01f, 8.71264040e-01f, 8.69200051e-01f, 8.67122173e-01f, 8.65030408e-01f, 8.62924933e-01f,
+        8.60805690e-01f, 8.58672917e-01f, 8.56526554e-01f, 8.54366779e-01f, 8.52193594e-01f, 8.50007176e-01f,
+        8.47807527e-01f, 8.45594764e-01f, 8.43368948e-01f, 8.41130197e-01f, 8.38878572e-01f, 8.36614132e-01f,
+        8.34336996e-01f, 8.32047284e-01f, 8.29745054e-01f, 8.27430367e-01f, 8.25103343e-01f, 8.22764039e-01f,
+        8.20412576e-01f, 8.18048954e-01f, 8.15673411e-01f, 8.13285947e-01f, 8.10886681e-01f, 8.08475673e-01f,
+        8.06052983e-01f, 8.03618789e-01f, 8.01173151e-01f, 7.98716128e-01f, 7.96247840e-01f, 7.93768406e-01f,
+        7.91277826e-01f, 7.88776338e-01f, 7.86263883e-01f, 7.83740699e-01f, 7.81206787e-01f, 7.78662205e-01f,
+        7.76107192e-01f, 7.73541749e-01f, 7.70965934e-01f, 7.68379927e-01f, 7.65783846e-01f, 7.63177693e-01f,
+        7.60561585e-01f, 7.57935703e-01f, 7.55300045e-01f, 7.52654791e-01f, 7.50000000e-01f, 7.47335792e-01f,
+        7.44662225e-01f, 7.41979420e-01f, 7.39287496e-01f, 7.36586571e-01f, 7.33876705e-01f, 7.31158018e-01f,
+        7.28430569e-01f, 7.25694597e-01f, 7.22950041e-01f, 7.20197082e-01f, 7.17435837e-01f, 7.14666367e-01f,
+        7.11888790e-01f, 7.09103227e-01f, 7.06309795e-01f, 7.03508556e-01f, 7.00699687e-01f, 6.97883189e-01f,
+        6.95059299e-01f, 6.92227960e-01f, 6.89389467e-01f, 6.86543763e-01f, 6.83691025e-01f, 6.80831373e-01f,
+        6.77964866e-01f, 6.75091684e-01f, 6.72211885e-01f, 6.69325590e-01f, 6.66432917e-01f, 6.63533986e-01f,
+        6.60628855e-01f, 6.57717645e-01f, 6.54800534e-01f, 6.51877582e-01f, 6.48948848e-01f, 6.46014512e-01f,
+        6.43074691e-01f, 6.40129447e-01f, 6.37178957e-01f, 6.34223282e-01f, 6.31262541e-01f, 6.28296793e-01f,
+        6.25326276e-01f, 6.22350991e-01f, 6.19371116e-01f, 6.16386712e-01f, 6.13397956e-01f, 6.10404849e-01f,
+        6.07407629e-01f, 6.04406357e-01f, 6.01401150e-01f, 5.98392129e-01f, 5.95379353e-01f, 5.92363000e-01f,
+        5.89343190e-01f, 5.86319983e-01f, 5.83293557e-01f, 5.80263913e-01f, 5.77231288e-01f, 5.74195743e-01f,
+        5.71157396e-01f, 5.68116367e-01f, 5.65072775e-01f, 5.62026739e-01f, 5.58978379e-01f, 5.55927753e-01f,
+        5.52875042e-01f, 5.49820304e-01f, 5.46763718e-01f, 5.43705344e-01f, 5.40645301e-01f, 5.37583768e-01f,
+        5.34520805e-01f, 5.31456530e-01f, 5.28391123e-01f, 5.25324583e-01f, 5.22257090e-01f, 5.19188762e-01f,
+        5.16119778e-01f, 5.13050079e-01f, 5.09979963e-01f, 5.06909430e-01f, 5.03838658e-01f, 5.00767767e-01f,
+        4.97696787e-01f, 4.94625926e-01f, 4.91555274e-01f, 4.88484919e-01f, 4.85415012e-01f, 4.82345641e-01f,
+        4.79276955e-01f, 4.76209044e-01f, 4.73142028e-01f, 4.70076025e-01f, 4.67011154e-01f, 4.63947535e-01f,
+        4.60885257e-01f, 4.57824469e-01f, 4.54765260e-01f, 4.51707780e-01f, 4.48652089e-01f, 4.45598364e-01f,
+        4.42546666e-01f, 4.39497173e-01f, 4.36449915e-01f, 4.33405101e-01f, 4.30362761e-01f, 4.27323073e-01f,
+        4.24286097e-01f, 4.21252012e-01f, 4.18220878e-01f, 4.15192842e-01f, 4.12167996e-01f, 4.09146458e-01f,
+        4.06128347e-01f, 4.03113782e-01f, 4.00102884e-01f, 3.97095740e-01f, 3.94092470e-01f, 3.91093224e-01f,
+        3.88098061e-01f, 3.85107130e-01f, 3.82120520e-01f, 3.79138380e-01f, 3.76160800e-01f, 3.73187870e-01f,
+        3.70219737e-01f, 3.67256492e-01f, 3.64298254e-01f, 3.61345142e-01f, 3.58397245e-01f, 3.55454713e-01f,
+        3.52517605e-01f, 3.49586070e-01f, 3.46660227e-01f, 3.43740165e-01f, 3.40825975e-01f, 3.37917805e-01f,
+        3.35015774e-01f, 3.32119942e-01f, 3.29230428e-01f, 3.26347381e-01f, 3.23470861e-01f, 3.20601016e-01f,
+        3.17737937e-01f, 3.14881742e-01f, 3.12032521e-01f, 3.09190392e-01f, 3.06355447e-01f, 3.03527832e-01f,
+        3.00707608e-01f, 2.97894925e-01f, 2.95089841e-01f, 2.92292506e-01f, 2.89502978e-01f, 2.86721408e-01f,
+        2.83947885e-01f, 2.81182528e-01f, 2.78425395e-01f, 2.75676638e-01f, 2.72936344e-01f, 2.70204604e-01f,
+        2.67481565e-01f, 2.64767259e-01f, 2.62061834e-01f, 2.59365410e-01f, 2.56678045e-01f, 2.53999859e-01f,
+        2.51330942e-01f, 2.48671412e-01f, 2.46021375e-01f, 2.43380904e-01f, 2.40750119e-01f, 2.38129124e-01f,
+        2.35517994e-01f, 2.32916847e-01f, 2.30325773e-01f, 2.27744877e-01f, 2.25174248e-01f, 2.22613975e-01f,
+        2.20064178e-01f, 2.17524946e-01f, 2.14996368e-01f, 2.12478533e-01f, 2.09971547e-01f, 2.07475498e-01f,
+        2.04990491e-01f, 2.02516615e-01f, 2.00053945e-01f, 1.97602600e-01f, 1.95162669e-01f, 1.92734227e-01f,
+        1.90317392e-01f, 1.87912226e-01f, 1.85518831e-01f, 1.83137298e-01f, 1.80767730e-01f, 1.78410202e-01f,
+        1.76064789e-01f, 1.73731610e-01f, 1.71410739e-01f, 1.69102266e-01f, 1.66806266e-01f, 1.64522842e-01f,
+        1.62252069e-01f, 1.59994036e-01f, 1.57748833e-01f, 1.55516535e-01f, 1.53297246e-01f, 1.51091024e-01f,
+        1.48897961e-01f, 1.46718144e-01f, 1.44551665e-01f, 1.42398581e-01f, 1.40258998e-01f, 1.38132975e-01f,
+        1.36020616e-01f, 1.33921981e-01f, 1.31837144e-01f, 1.29766211e-01f, 1.27709240e-01f, 1.25666305e-01f,
+        1.23637505e-01f, 1.21622898e-01f, 1.19622558e-01f, 1.17636569e-01f, 1.15665011e-01f, 1.13707945e-01f,
+        1.11765452e-01f, 1.09837607e-01f, 1.07924476e-01f, 1.06026135e-01f, 1.04142658e-01f, 1.02274112e-01f,
+        1.00420572e-01f, 9.85821113e-02f, 9.67587829e-02f, 9.49506685e-02f, 9.31578353e-02f, 9.13803503e-02f,
+        8.96182805e-02f, 8.78716856e-02f, 8.61406475e-02f, 8.44252110e-02f, 8.27254578e-02f, 8.10414404e-02f,
+        7.93732330e-02f, 7.77208880e-02f, 7.60844797e-02f, 7.44640604e-02f, 7.28596896e-02f, 7.12714344e-02f,
+        6.96993470e-02f, 6.81435019e-02f, 6.66039363e-02f, 6.50807247e-02f, 6.35739267e-02f, 6.20835833e-02f,
+        6.06097616e-02f, 5.91525137e-02f, 5.77118993e-02f, 5.62879667e-02f, 5.48807755e-02f, 5.34903742e-02f,
+        5.21168150e-02f, 5.07601500e-02f, 4.94204350e-02f, 4.80977148e-02f, 4.67920452e-02f, 4.55034673e-02f,
+        4.42320406e-02f, 4.29778025e-02f, 4.17408049e-02f, 4.05210927e-02f, 3.93187180e-02f, 3.81337181e-02f,
+        3.69661413e-02f, 3.58160324e-02f, 3.46834362e-02f, 3.35683897e-02f, 3.24709415e-02f, 3.13911252e-02f,
+        3.03289909e-02f, 2.92845722e-02f, 2.82579102e-02f, 2.72490438e-02f, 2.62580123e-02f, 2.52848510e-02f,
+        2.43295971e-02f, 2.33922862e-02f, 2.24729553e-02f, 2.15716381e-02f, 2.06883699e-02f, 1.98231805e-02f,
+        1.89761072e-02f, 1.81471780e-02f, 1.73364263e-02f, 1.65438820e-02f, 1.57695748e-02f, 1.50135355e-02f,
+        1.42757902e-02f, 1.35563686e-02f, 1.28552960e-02f, 1.21726012e-02f, 1.15083084e-02f, 1.08624427e-02f,
+        1.02350293e-02f, 9.62609146e-03f, 9.03565157e-03f, 8.46373197e-03f, 7.91035499e-03f, 7.37554161e-03f,
+        6.85931137e-03f, 6.36168383e-03f, 5.88267762e-03f, 5.42231137e-03f, 4.98060184e-03f, 4.55756579e-03f,
+        4.15321952e-03f, 3.76757840e-03f, 3.40065663e-03f, 3.05246795e-03f, 2.72302562e-03f, 2.41234223e-03f,
+        2.12042918e-03f, 1.84729788e-03f, 1.59295846e-03f, 1.35742035e-03f, 1.14069262e-03f, 9.42783430e-04f,
+        7.63700227e-04f, 6.03449706e-04f, 4.62037948e-04f, 3.39470338e-04f, 2.35751446e-04f, 1.50885186e-04f,
+        8.48747877e-05f, 3.77227225e-05f, 9.43076884e-06f, 0.00000000e+00f
+    };
+    static const float cbwindow1024live[1024] = {
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 1.23211685e-05f,
+        4.92840663e-05f, 1.10886875e-04f, 1.97126545e-04f, 3.07998853e-04f, 4.43498313e-04f, 6.03618217e-04f,
+        7.88350764e-04f, 9.97686759e-04f, 1.23161590e-03f, 1.49012671e-03f, 1.77320640e-03f, 2.08084099e-03f,
+        2.41301558e-03f, 2.76971329e-03f, 3.15091712e-03f, 3.55660776e-03f, 3.98676563e-03f, 4.44136932e-03f,
+        4.92039602e-03f, 5.42382291e-03f, 5.95162529e-03f, 6.50377618e-03f, 7.08024856e-03f, 7.68101495e-03f,
+        8.30604509e-03f, 8.95530730e-03f, 9.62877180e-03f, 1.03264032e-02f, 1.10481679e-02f, 1.17940307e-02f,
+        1.25639550e-02f, 1.33579019e-02f, 1.41758332e-02f, 1.50177078e-02f, 1.58834849e-02f, 1.67731214e-02f,
+        1.76865738e-02f, 1.86237972e-02f, 1.95847433e-02f, 2.05693673e-02f, 2.15776209e-02f, 2.26094536e-02f,
+        2.36648135e-02f, 2.47436482e-02f, 2.58459076e-02f, 2.69715358e-02f, 2.81204749e-02f, 2.92926729e-02f,
+        3.04880682e-02f, 3.17066014e-02f, 3.29482183e-02f, 3.42128500e-02f, 3.55004407e-02f, 3.68109234e-02f,
+        3.81442346e-02f, 3.95003073e-02f, 4.08790745e-02f, 4.22804691e-02f, 4.37044241e-02f, 4.51508686e-02f,
+        4.66197282e-02f, 4.81109321e-02f, 4.96244095e-02f, 5.11600822e-02f, 5.27178757e-02f, 5.42977117e-02f,
+        5.58995157e-02f, 5.75232059e-02f, 5.91687076e-02f, 6.08359315e-02f, 6.25248030e-02f, 6.42352328e-02f,
+        6.59671351e-02f, 6.77204356e-02f, 6.94950372e-02f, 7.12908506e-02f, 7.31078014e-02f, 7.49457926e-02f,
+        7.68047273e-02f, 7.86845163e-02f, 8.05850774e-02f, 8.25063065e-02f, 8.44481066e-02f, 8.64103958e-02f,
+        8.83930624e-02f, 9.03960168e-02f, 9.24191549e-02f, 9.44623873e-02f, 9.65256020e-02f, 9.86087024e-02f,
+        1.00711584e-01f, 1.02834150e-01f, 1.04976282e-01f, 1.07137889e-01f, 1.09318860e-01f, 1.11519076e-01f,
+        1.13738447e-01f, 1.15976848e-01f, 1.18234180e-01f, 1.20510325e-01f, 1.22805178e-01f, 1.25118613e-01f,
+        1.27450526e-01f, 1.29800811e-01f, 1.32169321e-01f, 1.34555981e-01f, 1.36960641e-01f, 1.39383197e-01f,
+        1.41823515e-01f, 1.44281492e-01f, 1.46757007e-01f, 1.49249926e-01f, 1.51760131e-01f, 1.54287502e-01f,
+        1.56831905e-01f, 1.59393221e-01f, 1.61971331e-01f, 1.64566100e-01f, 1.67177394e-01f, 1.69805095e-01f,
+        1.72449067e-01f, 1.75109193e-01f, 1.77785322e-01f, 1.80477321e-01f, 1.83185086e-01f, 1.85908452e-01f,
+        1.88647300e-01f, 1.91401497e-01f, 1.94170907e-01f, 1.96955383e-01f, 1.99754804e-01f, 2.02569008e-01f,
+        2.05397889e-01f, 2.08241269e-01f, 2.11099043e-01f, 2.13971049e-01f, 2.16857150e-01f, 2.19757214e-01f,
+        2.22671077e-01f, 2.25598618e-01f, 2.28539675e-01f, 2.31494129e-01f, 2.34461799e-01f, 2.37442553e-01f,
+        2.40436256e-01f, 2.43442759e-01f, 2.46461883e-01f, 2.49493524e-01f, 2.52537489e-01f, 2.55593687e-01f,
+        2.58661896e-01f, 2.61742026e-01f, 2.64833868e-01f, 2.67937332e-01f, 2.71052212e-01f, 2.74178386e-01f,
+        2.77315676e-01f, 2.80463934e-01f, 2.83623040e-01f, 2.86792785e-01f, 2.89973050e-01f, 2.93163687e-01f,
+        2.96364486e-01f, 2.99575329e-01f, 3.02796066e-01f, 3.06026489e-01f, 3.09266508e-01f, 3.12515914e-01f,
+        3.15774560e-01f, 3.19042265e-01f, 3.22318912e-01f, 3.25604320e-01f, 3.28898311e-01f, 3.32200736e-01f,
+        3.35511416e-01f, 3.38830233e-01f, 3.42156976e-01f, 3.45491499e-01f, 3.48833650e-01f, 3.52183223e-01f,
+        3.55540097e-01f, 3.58904094e-01f, 3.62275064e-01f, 3.65652800e-01f, 3.69037151e-01f, 3.72427970e-01f,
+        3.75825047e-01f, 3.79228264e-01f, 3.82637441e-01f, 3.86052400e-01f, 3.89472991e-01f, 3.92899007e-01f,
+        3.96330297e-01f, 3.99766713e-01f, 4.03208047e-01f, 4.06654179e-01f, 4.10104871e-01f, 4.13560033e-01f,
+        4.17019427e-01f, 4.20482934e-01f, 4.23950344e-01f, 4.27421510e-01f, 4.30896252e-01f, 4.34374422e-01f,
+        4.37855780e-01f, 4.41340238e-01f, 4.44827557e-01f, 4.48317617e-01f, 4.51810241e-01f, 4.55305219e-01f,
+        4.58802372e-01f, 4.62301582e-01f, 4.65802670e-01f, 4.69305426e-01f, 4.72809672e-01f, 4.76315290e-01f,
+        4.79822069e-01f, 4.83329833e-01f, 4.86838430e-01f, 4.90347654e-01f, 4.93857384e-01f, 4.97367382e-01f,
+        5.00877559e-01f, 5.04387617e-01f, 5.07897556e-01f, 5.11407018e-01f, 5.14915943e-01f, 5.18424153e-01f,
+        5.21931469e-01f, 5.25437653e-01f, 5.28942645e-01f, 5.32446146e-01f, 5.35948098e-01f, 5.39448261e-01f,
+        5.42946458e-01f, 5.46442568e-01f, 5.49936354e-01f, 5.53427756e-01f, 5.56916475e-01f, 5.60402334e-01f,
+        5.63885272e-01f, 5.67365110e-01f, 5.70841551e-01f, 5.74314535e-01f, 5.77783823e-01f, 5.81249297e-01f,
+        5.84710777e-01f, 5.88168085e-01f, 5.91621041e-01f, 5.95069468e-01f, 5.98513246e-01f, 6.01952136e-01f,
+        6.05386019e-01f, 6.08814657e-01f, 6.12237990e-01f, 6.15655780e-01f, 6.19067848e-01f, 6.22474074e-01f,
+        6.25874281e-01f, 6.29268229e-01f, 6.32655859e-01f, 6.36036932e-01f, 6.39411271e-01f, 6.42778754e-01f,
+        6.46139205e-01f, 6.49492502e-01f, 6.52838349e-01f, 6.56176746e-01f, 6.59507394e-01f, 6.62830174e-01f,
+        6.66144967e-01f, 6.69451535e-01f, 6.72749758e-01f, 6.76039457e-01f, 6.79320514e-01f, 6.82592690e-01f,
+        6.85855925e-01f, 6.89109981e-01f, 6.92354679e-01f, 6.95589900e-01f, 6.98815525e-01f, 7.02031314e-01f,
+        7.05237210e-01f, 7.08432913e-01f, 7.11618364e-01f, 7.14793384e-01f, 7.17957854e-01f, 7.21111536e-01f,
+        7.24254370e-01f, 7.27386117e-01f, 7.30506659e-01f, 7.33615816e-01f, 7.36713529e-01f, 7.39799500e-01f,
+        7.42873728e-01f, 7.45935917e-01f, 7.48986006e-01f, 7.52023876e-01f, 7.55049229e-01f, 7.58062065e-01f,
+        7.61062205e-01f, 7.64049470e-01f, 7.67023683e-01f, 7.69984782e-01f, 7.72932529e-01f, 7.75866866e-01f,
+        7.78787553e-01f, 7.81694531e-01f, 7.84587681e-01f, 7.87466705e-01f, 7.90331662e-01f, 7.93182254e-01f,
+        7.96018362e-01f, 7.98839927e-01f, 8.01646769e-01f, 8.04438710e-01f, 8.07215691e-01f, 8.09977531e-01f,
+        8.12724054e-01f, 8.15455198e-01f, 8.18170726e-01f, 8.20870638e-01f, 8.23554754e-01f, 8.26222897e-01f,
+        8.28874946e-01f, 8.31510782e-01f, 8.34130287e-01f, 8.36733341e-01f, 8.39319825e-01f, 8.41889560e-01f,
+        8.44442427e-01f, 8.46978307e-01f, 8.49497139e-01f, 8.51998687e-01f, 8.54482949e-01f, 8.56949687e-01f,
+        8.59398842e-01f, 8.61830294e-01f, 8.64243925e-01f, 8.66639614e-01f, 8.69017184e-01f, 8.71376634e-01f,
+        8.73717725e-01f, 8.76040399e-01f, 8.78344595e-01f, 8.80630076e-01f, 8.82896841e-01f, 8.85144711e-01f,
+        8.87373626e-01f, 8.89583409e-01f, 8.91774058e-01f, 8.93945336e-01f, 8.96097243e-01f, 8.98229599e-01f,
+        9.00342345e-01f, 9.02435303e-01f, 9.04508471e-01f, 9.06561732e-01f, 9.08594906e-01f, 9.10607994e-01f,
+        9.12600815e-01f, 9.14573312e-01f, 9.16525364e-01f, 9.18456912e-01f, 9.20367777e-01f, 9.22257960e-01f,
+        9.24127340e-01f, 9.25975800e-01f, 9.27803278e-01f, 9.29609716e-01f, 9.31394935e-01f, 9.33158875e-01f,
+        9.34901476e-01f, 9.36622679e-01f, 9.38322306e-01f, 9.40000415e-01f, 9.41656768e-01f, 9.43291366e-01f,
+        9.44904149e-01f, 9.46494937e-01f, 9.48063791e-01f, 9.49610531e-01f, 9.51135099e-01f, 9.52637434e-01f,
+        9.54117477e-01f, 9.55575168e-01f, 9.57010388e-01f, 9.58423078e-01f, 9.59813118e-01f, 9.61180568e-01f,
+        9.62525249e-01f, 9.63847160e-01f, 9.65146244e-01f, 9.66422319e-01f, 9.67675447e-01f, 9.68905568e-01f,
+        9.70112503e-01f, 9.71296310e-01f, 9.72456932e-01f, 9.73594189e-01f, 9.74708140e-01f, 9.75798726e-01f,
+        9.76865828e-01f, 9.77909386e-01f, 9.78929460e-01f, 9.79925931e-01f, 9.80898678e-01f, 9.81847763e-01f,
+        9.82773125e-01f, 9.83674705e-01f, 9.84552383e-01f, 9.85406220e-01f, 9.86236155e-01f, 9.87042069e-01f,
+        9.87824023e-01f, 9.88581896e-01f, 9.89315748e-01f, 9.90025461e-01f, 9.90710974e-01f, 9.91372347e-01f,
+        9.92009521e-01f, 9.92622375e-01f, 9.93211031e-01f, 9.93775368e-01f, 9.94315326e-01f, 9.94830966e-01f,
+        9.95322168e-01f, 9.95788991e-01f, 9.96231377e-01f, 9.96649325e-01f, 9.97042775e-01f, 9.97411728e-01f,
+        9.97756124e-01f, 9.98076022e-01f, 9.98371422e-01f, 9.98642206e-01f, 9.98888433e-01f, 9.99110043e-01f,
+        9.99307096e-01f, 9.99479532e-01f, 9.99627352e-01f, 9.99750495e-01f, 9.99849081e-01f, 9.99922991e-01f,
+        9.99972284e-01f, 9.99996901e-01f, 9.99996901e-01f, 9.99972284e-01f, 9.99922991e-01f, 9.99849081e-01f,
+        9.99750495e-01f, 9.99627352e-01f, 9.99479532e-01f, 9.99307096e-01f, 9.99110043e-01f, 9.98888433e-01f,
+        9.98642206e-01f, 9.98371422e-01f, 9.98076022e-01f, 9.97756124e-01f, 9.97411728e-01f, 9.97042775e-01f,
+        9.96649325e-01f, 9.96231377e-01f, 9.95788991e-01f, 9.95322168e-01f, 9.94830966e-01f, 9.94315326e-01f,
+        9.93775368e-01f, 9.93211031e-01f, 9.92622375e-01f, 9.92009521e-01f, 9.91372347e-01f, 9.90710974e-01f,
+        9.90025461e-01f, 9.89315748e-01f, 9.88581896e-01f, 9.87824023e-01f, 9.87042069e-01f, 9.86236155e-01f,
+        9.85406220e-01f, 9.84552383e-01f, 9.83674705e-01f, 9.82773125e-01f, 9.81847763e-01f, 9.80898678e-01f,
+        9.79925931e-01f, 9.78929460e-01f, 9.77909386e-01f, 9.76865828e-01f, 9.75798726e-01f, 9.74708140e-01f,
+        9.73594189e-01f, 9.72456932e-01f, 9.71296310e-01f, 9.70112503e-01f, 9.68905568e-01f, 9.67675447e-01f,
+        9.66422319e-01f, 9.65146244e-01f, 9.63847160e-01f, 9.62525249e-01f, 9.61180568e-01f, 9.59813118e-01f,
+        9.58423078e-01f, 9.57010388e-01f, 9.55575168e-01f, 9.54117477e-01f, 9.52637434e-01f, 9.51135099e-01f,
+        9.49610531e-01f, 9.48063791e-01f, 9.46494937e-01f, 9.44904149e-01f, 9.43291366e-01f, 9.41656768e-01f,
+        9.40000415e-01f, 9.38322306e-01f, 9.36622679e-01f, 9.34901476e-01f, 9.33158875e-01f, 9.31394935e-01f,
+        9.29609716e-01f, 9.27803278e-01f, 9.25975800e-01f, 9.24127340e-01f, 9.22257960e-01f, 9.20367777e-01f,
+        9.18456912e-01f, 9.16525364e-01f, 9.14573312e-01f, 9.12600815e-01f, 9.10607994e-01f, 9.08594906e-01f,
+        9.06561732e-01f, 9.04508471e-01f, 9.02435303e-01f, 9.00342345e-01f, 8.98229599e-01f, 8.96097243e-01f,
+        8.93945336e-01f, 8.91774058e-01f, 8.89583409e-01f, 8.87373626e-01f, 8.85144711e-01f, 8.82896841e-01f,
+        8.80630076e-01f, 8.78344595e-01f, 8.76040399e-01f, 8.73717725e-01f, 8.71376634e-01f, 8.69017184e-01f,
+        8.66639614e-01f, 8.64243925e-01f, 8.61830294e-01f, 8.59398842e-01f, 8.56949687e-01f, 8.54482949e-01f,
+        8.51998687e-01f, 8.49497139e-01f, 8.46978307e-01f, 8.44442427e-01f, 8.41889560e-01f, 8.39319825e-01f,
+        8.36733341e-01f, 8.34130287e-01f, 8.31510782e-01f, 8.28874946e-01f, 8.26222897e-01f, 8.23554754e-01f,
+        8.20870638e-01f, 8.18170726e-01f, 8.15455198e-01f, 8.12724054e-01f, 8.09977531e-01f, 8.07215691e-01f,
+        8.04438710e-01f, 8.01646769e-01f, 7.98839927e-01f, 7.96018362e-01f, 7.93182254e-01f, 7.90331662e-01f,
+        7.87466705e-01f, 7.84587681e-01f, 7.81694531e-01f, 7.78787553e-01f, 7.75866866e-01f, 7.72932529e-01f,
+        7.69984782e-01f, 7.67023683e-01f, 7.64049470e-01f, 7.61062205e-01f, 7.58062065e-01f, 7.55049229e-01f,
+        7.52023876e-01f, 7.48986006e-01f, 7.45935917e-01f, 7.42873728e-01f, 7.39799500e-01f, 7.36713529e-01f,
+        7.33615816e-01f, 7.30506659e-01f, 7.27386117e-01f, 7.24254370e-01f, 7.21111536e-01f, 7.17957854e-01f,
+        7.14793384e-01f, 7.11618364e-01f, 7.08432913e-01f, 7.05237210e-01f, 7.02031314e-01f, 6.98815525e-01f,
+        6.95589900e-01f, 6.92354679e-01f, 6.89109981e-01f, 6.85855925e-01f, 6.82592690e-01f, 6.79320514e-01f,
+        6.76039457e-01f, 6.72749758e-01f, 6.69451535e-01f, 6.66144967e-01f, 6.62830174e-01f, 6.59507394e-01f,
+        6.56176746e-01f, 6.52838349e-01f, 6.49492502e-01f, 6.46139205e-01f, 6.42778754e-01f, 6.39411271e-01f,
+        6.36036932e-01f, 6.32655859e-01f, 6.29268229e-01f, 6.25874281e-01f, 6.22474074e-01f, 6.19067848e-01f,
+        6.15655780e-01f, 6.12237990e-01f, 6.08814657e-01f, 6.05386019e-01f, 6.01952136e-01f, 5.98513246e-01f,
+        5.95069468e-01f, 5.91621041e-01f, 5.88168085e-01f, 5.84710777e-01f, 5.81249297e-01f, 5.77783823e-01f,
+        5.74314535e-01f, 5.70841551e-01f, 5.67365110e-01f, 5.63885272e-01f, 5.60402334e-01f, 5.56916475e-01f,
+        5.53427756e-01f, 5.49936354e-01f, 5.46442568e-01f, 5.42946458e-01f, 5.39448261e-01f, 5.35948098e-01f,
+        5.32446146e-01f, 5.28942645e-01f, 5.25437653e-01f, 5.21931469e-01f, 5.18424153e-01f, 5.14915943e-01f,
+        5.11407018e-01f, 5.07897556e-01f, 5.04387617e-01f, 5.00877559e-01f, 4.97367382e-01f, 4.93857384e-01f,
+        4.90347654e-01f, 4.86838430e-01f, 4.83329833e-01f, 4.79822069e-01f, 4.76315290e-01f, 4.72809672e-01f,
+        4.69305426e-01f, 4.65802670e-01f, 4.62301582e-01f, 4.58802372e-01f, 4.55305219e-01f, 4.51810241e-01f,
+        4.48317617e-01f, 4.44827557e-01f, 4.41340238e-01f, 4.37855780e-01f, 4.34374422e-01f, 4.30896252e-01f,
+        4.27421510e-01f, 4.23950344e-01f, 4.20482934e-01f, 4.17019427e-01f, 4.13560033e-01f, 4.10104871e-01f,
+        4.06654179e-01f, 4.03208047e-01f, 3.99766713e-01f, 3.96330297e-01f, 3.92899007e-01f, 3.89472991e-01f,
+        3.86052400e-01f, 3.82637441e-01f, 3.79228264e-01f, 3.75825047e-01f, 3.72427970e-01f, 3.69037151e-01f,
+        3.65652800e-01f, 3.62275064e-01f, 3.58904094e-01f, 3.55540097e-01f, 3.52183223e-01f, 3.48833650e-01f,
+        3.45491499e-01f, 3.42156976e-01f, 3.38830233e-01f, 3.35511416e-01f, 3.32200736e-01f, 3.28898311e-01f,
+        3.25604320e-01f, 3.22318912e-01f, 3.19042265e-01f, 3.15774560e-01f, 3.12515914e-01f, 3.09266508e-01f,
+        3.06026489e-01f, 3.02796066e-01f, 2.99575329e-01f, 2.96364486e-01f, 2.93163687e-01f, 2.89973050e-01f,
+        2.86792785e-01f, 2.83623040e-01f, 2.80463934e-01f, 2.77315676e-01f, 2.74178386e-01f, 2.71052212e-01f,
+        2.67937332e-01f, 2.64833868e-01f, 2.61742026e-01f, 2.58661896e-01f, 2.55593687e-01f, 2.52537489e-01f,
+        2.49493524e-01f, 2.46461883e-01f, 2.43442759e-01f, 2.40436256e-01f, 2.37442553e-01f, 2.34461799e-01f,
+        2.31494129e-01f, 2.28539675e-01f, 2.25598618e-01f, 2.22671077e-01f, 2.19757214e-01f, 2.16857150e-01f,
+        2.13971049e-01f, 2.11099043e-01f, 2.08241269e-01f, 2.05397889e-01f, 2.02569008e-01f, 1.99754804e-01f,
+        1.96955383e-01f, 1.94170907e-01f, 1.91401497e-01f, 1.88647300e-01f, 1.85908452e-01f, 1.83185086e-01f,
+        1.80477321e-01f, 1.77785322e-01f, 1.75109193e-01f, 1.72449067e-01f, 1.69805095e-01f, 1.67177394e-01f,
+        1.64566100e-01f, 1.61971331e-01f, 1.59393221e-01f, 1.56831905e-01f, 1.54287502e-01f, 1.51760131e-01f,
+        1.49249926e-01f, 1.46757007e-01f, 1.44281492e-01f, 1.41823515e-01f, 1.39383197e-01f, 1.36960641e-01f,
+        1.34555981e-01f, 1.32169321e-01f, 1.29800811e-01f, 1.27450526e-01f, 1.25118613e-01f, 1.22805178e-01f,
+        1.20510325e-01f, 1.18234180e-01f, 1.15976848e-01f, 1.13738447e-01f, 1.11519076e-01f, 1.09318860e-01f,
+        1.07137889e-01f, 1.04976282e-01f, 1.02834150e-01f, 1.00711584e-01f, 9.86087024e-02f, 9.65256020e-02f,
+        9.44623873e-02f, 9.24191549e-02f, 9.03960168e-02f, 8.83930624e-02f, 8.64103958e-02f, 8.44481066e-02f,
+        8.25063065e-02f, 8.05850774e-02f, 7.86845163e-02f, 7.68047273e-02f, 7.49457926e-02f, 7.31078014e-02f,
+        7.12908506e-02f, 6.94950372e-02f, 6.77204356e-02f, 6.59671351e-02f, 6.42352328e-02f, 6.25248030e-02f,
+        6.08359315e-02f, 5.91687076e-02f, 5.75232059e-02f, 5.58995157e-02f, 5.42977117e-02f, 5.27178757e-02f,
+        5.11600822e-02f, 4.96244095e-02f, 4.81109321e-02f, 4.66197282e-02f, 4.51508686e-02f, 4.37044241e-02f,
+        4.22804691e-02f, 4.08790745e-02f, 3.95003073e-02f, 3.81442346e-02f, 3.68109234e-02f, 3.55004407e-02f,
+        3.42128500e-02f, 3.29482183e-02f, 3.17066014e-02f, 3.04880682e-02f, 2.92926729e-02f, 2.81204749e-02f,
+        2.69715358e-02f, 2.58459076e-02f, 2.47436482e-02f, 2.36648135e-02f, 2.26094536e-02f, 2.15776209e-02f,
+        2.05693673e-02f, 1.95847433e-02f, 1.86237972e-02f, 1.76865738e-02f, 1.67731214e-02f, 1.58834849e-02f,
+        1.50177078e-02f, 1.41758332e-02f, 1.33579019e-02f, 1.25639550e-02f, 1.17940307e-02f, 1.10481679e-02f,
+        1.03264032e-02f, 9.62877180e-03f, 8.95530730e-03f, 8.30604509e-03f, 7.68101495e-03f, 7.08024856e-03f,
+        6.50377618e-03f, 5.95162529e-03f, 5.42382291e-03f, 4.92039602e-03f, 4.44136932e-03f, 3.98676563e-03f,
+        3.55660776e-03f, 3.15091712e-03f, 2.76971329e-03f, 2.41301558e-03f, 2.08084099e-03f, 1.77320640e-03f,
+        1.49012671e-03f, 1.23161590e-03f, 9.97686759e-04f, 7.88350764e-04f, 6.03618217e-04f, 4.43498313e-04f,
+        3.07998853e-04f, 1.97126545e-04f, 1.10886875e-04f, 4.92840663e-05f, 1.23211685e-05f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f
+    };
+    static const float acwinv1024live[1024] = {
+        1.00000000e+00f, 1.00000823e+00f, 1.00003290e+00f, 1.00007403e+00f, 1.00013149e+00f, 1.00020540e+00f,
+        1.00029564e+00f, 1.00040257e+00f, 1.00052583e+00f, 1.00066555e+00f, 1.00082171e+00f, 1.00099444e+00f,
+        1.00118363e+00f, 1.00138927e+00f, 1.00161123e+00f, 1.00184989e+00f, 1.00210512e+00f, 1.00237679e+00f,
+        1.00266492e+00f, 1.00296974e+00f, 1.00329113e+00f, 1.00362909e+00f, 1.00398350e+00f, 1.00435483e+00f,
+        1.00474262e+00f, 1.00514710e+00f, 1.00556839e+00f, 1.00600636e+00f, 1.00646091e+00f, 1.00693238e+00f,
+        1.00742054e+00f, 1.00792551e+00f, 1.00844729e+00f, 1.00898588e+00f, 1.00954139e+00f, 1.01011384e+00f,
+        1.01070333e+00f, 1.01130962e+00f, 1.01193297e+00f, 1.01257336e+00f, 1.01323092e+00f, 1.01390529e+00f,
+        1.01459718e+00f, 1.01530600e+00f, 1.01603198e+00f, 1.01677537e+00f, 1.01753592e+00f, 1.01831388e+00f,
+        1.01910913e+00f, 1.01992178e+00f, 1.02075207e+00f, 1.02159965e+00f, 1.02246475e+00f, 1.02334750e+00f,
+        1.02424777e+00f, 1.02516603e+00f, 1.02610171e+00f, 1.02705514e+00f, 1.02802646e+00f, 1.02901578e+00f,
+        1.03002298e+00f, 1.03104818e+00f, 1.03209138e+00f, 1.03315246e+00f, 1.03423202e+00f, 1.03532958e+00f,
+        1.03644550e+00f, 1.03757977e+00f, 1.03873229e+00f, 1.03990328e+00f, 1.04109275e+00f, 1.04230094e+00f,
+        1.04352772e+00f, 1.04477310e+00f, 1.04603720e+00f, 1.04732037e+00f, 1.04862237e+00f, 1.04994321e+00f,
+        1.05128312e+00f, 1.05264211e+00f, 1.05402052e+00f, 1.05541813e+00f, 1.05683494e+00f, 1.05827117e+00f,
+        1.05972695e+00f, 1.06120241e+00f, 1.06269729e+00f, 1.06421208e+00f, 1.06574678e+00f, 1.06730139e+00f,
+        1.06887591e+00f, 1.07047057e+00f, 1.07208526e+00f, 1.07372046e+00f, 1.07537591e+00f, 1.07705164e+00f,
+        1.07874823e+00f, 1.08046520e+00f, 1.08220291e+00f, 1.08396149e+00f, 1.08574104e+00f, 1.08754158e+00f,
+        1.08936322e+00f, 1.09120607e+00f, 1.09307051e+00f, 1.09495604e+00f, 1.09686339e+00f, 1.09879220e+00f,
+        1.10074294e+00f, 1.10271549e+00f, 1.10471010e+00f, 1.10672665e+00f, 1.10876536e+00f, 1.11082673e+00f,
+        1.11291015e+00f, 1.11501646e+00f, 1.11714554e+00f, 1.11929715e+00f, 1.12147188e+00f, 1.12366962e+00f,
+        1.12589073e+00f, 1.12813485e+00f, 1.13040268e+00f, 1.13269413e+00f, 1.13500929e+00f, 1.13734818e+00f,
+        1.13971114e+00f, 1.14209831e+00f, 1.14450955e+00f, 1.14694548e+00f, 1.14940572e+00f, 1.15189087e+00f,
+        1.15440083e+00f, 1.15693605e+00f, 1.15949607e+00f, 1.16208172e+00f, 1.16469252e+00f, 1.16732919e+00f,
+        1.16999161e+00f, 1.17268002e+00f, 1.17539430e+00f, 1.17813516e+00f, 1.18090236e+00f, 1.18369627e+00f,
+        1.18651676e+00f, 1.18936443e+00f, 1.19223917e+00f, 1.19514108e+00f, 1.19807076e+00f, 1.20102799e+00f,
+        1.20401299e+00f, 1.20702612e+00f, 1.21006739e+00f, 1.21313715e+00f, 1.21623552e+00f, 1.21936274e+00f,
+        1.22251892e+00f, 1.22570407e+00f, 1.22891891e+00f, 1.23216319e+00f, 1.23543739e+00f, 1.23874152e+00f,
+        1.24207592e+00f, 1.24544060e+00f, 1.24883604e+00f, 1.25226247e+00f, 1.25571990e+00f, 1.25920856e+00f,
+        1.26272893e+00f, 1.26628077e+00f, 1.26986468e+00f, 1.27348089e+00f, 1.27712929e+00f, 1.28081071e+00f,
+        1.28452468e+00f, 1.28827214e+00f, 1.29205263e+00f, 1.29586697e+00f, 1.29971528e+00f, 1.30359769e+00f,
+        1.30751443e+00f, 1.31146586e+00f, 1.31545222e+00f, 1.31947362e+00f, 1.32353044e+00f, 1.32762301e+00f,
+        1.33175194e+00f, 1.33591664e+00f, 1.34011805e+00f, 1.34435618e+00f, 1.34863138e+00f, 1.35294402e+00f,
+        1.35729444e+00f, 1.36168253e+00f, 1.36610901e+00f, 1.37057376e+00f, 1.37507784e+00f, 1.37962091e+00f,
+        1.38420331e+00f, 1.38882565e+00f, 1.39348757e+00f, 1.39819026e+00f, 1.40293372e+00f, 1.40771794e+00f,
+        1.41254365e+00f, 1.41741085e+00f, 1.42232025e+00f, 1.42727220e+00f, 1.43226647e+00f, 1.43730390e+00f,
+        1.44238472e+00f, 1.44750905e+00f, 1.45267785e+00f, 1.45789063e+00f, 1.46314847e+00f, 1.46845138e+00f,
+        1.47379982e+00f, 1.47919405e+00f, 1.48463476e+00f, 1.49012196e+00f, 1.49565613e+00f, 1.50123763e+00f,
+        1.50686717e+00f, 1.51254439e+00f, 1.51827085e+00f, 1.52404571e+00f, 1.52987015e+00f, 1.53574443e+00f,
+        1.54166877e+00f, 1.54764378e+00f, 1.55366993e+00f, 1.55974746e+00f, 1.56587684e+00f, 1.57205832e+00f,
+        1.57829273e+00f, 1.58458042e+00f, 1.59092152e+00f, 1.59731686e+00f, 1.60376668e+00f, 1.61027133e+00f,
+        1.61683142e+00f, 1.62344754e+00f, 1.63011980e+00f, 1.63684881e+00f, 1.64363551e+00f, 1.65047991e+00f,
+        1.65738237e+00f, 1.66434371e+00f, 1.67136419e+00f, 1.67844450e+00f, 1.68558538e+00f, 1.69278622e+00f,
+        1.70004880e+00f, 1.70737302e+00f, 1.71475959e+00f, 1.72220898e+00f, 1.72972155e+00f, 1.73729825e+00f,
+        1.74493897e+00f, 1.75264466e+00f, 1.76041627e+00f, 1.76825333e+00f, 1.77615774e+00f, 1.78412867e+00f,
+        1.79216707e+00f, 1.80027413e+00f, 1.80844975e+00f, 1.81669450e+00f, 1.82500970e+00f, 1.83339524e+00f,
+        1.84185219e+00f, 1.85038066e+00f, 1.85898137e+00f, 1.86765480e+00f, 1.87640238e+00f, 1.88522339e+00f,
+        1.89411950e+00f, 1.90309072e+00f, 1.91213787e+00f, 1.92126191e+00f, 1.93046260e+00f, 1.93974125e+00f,
+        1.94909894e+00f, 1.95853496e+00f, 1.96805060e+00f, 1.97764719e+00f, 1.98732448e+00f, 1.99708319e+00f,
+        2.00692463e+00f, 2.01684856e+00f, 2.02685690e+00f, 2.03694844e+00f, 2.04712558e+00f, 2.05738831e+00f,
+        2.06773710e+00f, 2.07817292e+00f, 2.08869624e+00f, 2.09930754e+00f, 2.11000824e+00f, 2.12079835e+00f,
+        2.13167882e+00f, 2.14265013e+00f, 2.15371394e+00f, 2.16486859e+00f, 2.17611742e+00f, 2.18745995e+00f,
+        2.19889641e+00f, 2.21042776e+00f, 2.22205567e+00f, 2.23377967e+00f, 2.24560142e+00f, 2.25752068e+00f,
+        2.26953816e+00f, 2.28165555e+00f, 2.29387259e+00f, 2.30618978e+00f, 2.31860828e+00f, 2.33112907e+00f,
+        2.34375310e+00f, 2.35648012e+00f, 2.36931014e+00f, 2.38224602e+00f, 2.39528704e+00f, 2.40843368e+00f,
+        2.42168760e+00f, 2.43504882e+00f, 2.44851804e+00f, 2.46209502e+00f, 2.47578120e+00f, 2.48957872e+00f,
+        2.50348639e+00f, 2.51750422e+00f, 2.53163457e+00f, 2.54587746e+00f, 2.56023312e+00f, 2.57470226e+00f,
+        2.58928609e+00f, 2.60398412e+00f, 2.61879730e+00f, 2.63372684e+00f, 2.64877295e+00f, 2.66393590e+00f,
+        2.67921591e+00f, 2.69461393e+00f, 2.71012974e+00f, 2.72576475e+00f, 2.74151993e+00f, 2.75739455e+00f,
+        2.77338886e+00f, 2.78950334e+00f, 2.80573988e+00f, 2.82209730e+00f, 2.83857679e+00f, 2.85517740e+00f,
+        2.87190199e+00f, 2.88874745e+00f, 2.90571690e+00f, 2.92280936e+00f, 2.94002509e+00f, 2.95736504e+00f,
+        2.97482634e+00f, 2.99241352e+00f, 3.01012254e+00f, 3.02795744e+00f, 3.04591513e+00f, 3.06399655e+00f,
+        3.08220243e+00f, 3.10053277e+00f, 3.11898661e+00f, 3.13756418e+00f, 3.15626431e+00f, 3.17508769e+00f,
+        3.19403434e+00f, 3.21310449e+00f, 3.23229694e+00f, 3.25161052e+00f, 3.27104568e+00f, 3.29060292e+00f,
+        3.31027937e+00f, 3.33007526e+00f, 3.34999108e+00f, 3.37002492e+00f, 3.39017820e+00f, 3.41044760e+00f,
+        3.43083382e+00f, 3.45133400e+00f, 3.47194886e+00f, 3.49267673e+00f, 3.51351714e+00f, 3.53446937e+00f,
+        3.55553079e+00f, 3.57670045e+00f, 3.59797597e+00f, 3.61935806e+00f, 3.64084458e+00f, 3.66243315e+00f,
+        3.68412304e+00f, 3.70591116e+00f, 3.72779751e+00f, 3.74977899e+00f, 3.77185321e+00f, 3.79401898e+00f,
+        3.81627440e+00f, 3.83861589e+00f, 3.86104298e+00f, 3.88355136e+00f, 3.90613937e+00f, 3.92880559e+00f,
+        3.95154285e+00f, 3.97435570e+00f, 3.99723387e+00f, 4.02017641e+00f, 4.04318380e+00f, 4.06625032e+00f,
+        4.08937168e+00f, 4.11254549e+00f, 4.13576984e+00f, 4.15903807e+00f, 4.18234777e+00f, 4.20569658e+00f,
+        4.22907877e+00f, 4.25249004e+00f, 4.27592850e+00f, 4.29938412e+00f, 4.32286024e+00f, 4.34634876e+00f,
+        4.36984396e+00f, 4.39334154e+00f, 4.41683817e+00f, 4.44032860e+00f, 4.46380520e+00f, 4.48726606e+00f,
+        4.51070595e+00f, 4.53411484e+00f, 4.55749273e+00f, 4.58083010e+00f, 4.60412455e+00f, 4.62736845e+00f,
+        4.65055656e+00f, 4.67367935e+00f, 4.69673443e+00f, 4.71971703e+00f, 4.74261761e+00f, 4.76542854e+00f,
+        4.78814554e+00f, 4.81076193e+00f, 4.83327198e+00f, 4.85566664e+00f, 4.87793970e+00f, 4.90008593e+00f,
+        4.92209530e+00f, 4.94395685e+00f, 4.96567583e+00f, 4.98723793e+00f, 5.00863266e+00f, 5.02985859e+00f,
+        5.05089808e+00f, 5.07175589e+00f, 5.09241962e+00f, 5.11287689e+00f, 5.13312912e+00f, 5.15316439e+00f,
+        5.17297363e+00f, 5.19255209e+00f, 5.21188736e+00f, 5.23097420e+00f, 5.24981070e+00f, 5.26837826e+00f,
+        5.28667688e+00f, 5.30469513e+00f, 5.32242966e+00f, 5.33986521e+00f, 5.35700369e+00f, 5.37383509e+00f,
+        5.39034414e+00f, 5.40652990e+00f, 5.42238379e+00f, 5.43790483e+00f, 5.45307827e+00f, 5.46789360e+00f,
+        5.48235369e+00f, 5.49644518e+00f, 5.51016903e+00f, 5.52350664e+00f, 5.53646040e+00f, 5.54902077e+00f,
+        5.56118202e+00f, 5.57293701e+00f, 5.58428335e+00f, 5.59521151e+00f, 5.60571814e+00f, 5.61579657e+00f,
+        5.62544250e+00f, 5.63465405e+00f, 5.64341879e+00f, 5.65173531e+00f, 5.65960836e+00f, 5.66701794e+00f,
+        5.67397165e+00f, 5.68045855e+00f, 5.68648577e+00f, 5.69203758e+00f, 5.69712114e+00f, 5.70173025e+00f,
+        5.70585442e+00f, 5.70950365e+00f, 5.71266794e+00f, 5.71535015e+00f, 5.71754169e+00f, 5.71924829e+00f,
+        5.72047091e+00f, 5.72120428e+00f, 5.72144890e+00f, 5.72120428e+00f, 5.72047091e+00f, 5.71924829e+00f,
+        5.71754026e+00f, 5.71534729e+00f, 5.71266794e+00f, 5.70950222e+00f, 5.70585299e+00f, 5.70173025e+00f,
+        5.69711971e+00f, 5.69203949e+00f, 5.68648577e+00f, 5.68046141e+00f, 5.67397308e+00f, 5.66702080e+00f,
+        5.65960693e+00f, 5.65173674e+00f, 5.64342070e+00f, 5.63465405e+00f, 5.62544250e+00f, 5.61579800e+00f,
+        5.60572100e+00f, 5.59521008e+00f, 5.58428478e+00f, 5.57293844e+00f, 5.56118202e+00f, 5.54901934e+00f,
+        5.53645849e+00f, 5.52350521e+00f, 5.51016617e+00f, 5.49644661e+00f, 5.48235369e+00f, 5.46789503e+00f,
+        5.45307684e+00f, 5.43790483e+00f, 5.42238617e+00f, 5.40652990e+00f, 5.39034557e+00f, 5.37383223e+00f,
+        5.35700369e+00f, 5.33986664e+00f, 5.32242823e+00f, 5.30469513e+00f, 5.28667688e+00f, 5.26837635e+00f,
+        5.24980927e+00f, 5.23097658e+00f, 5.21189022e+00f, 5.19255209e+00f, 5.17297506e+00f, 5.15316677e+00f,
+        5.13313293e+00f, 5.11288071e+00f, 5.09242201e+00f, 5.07175827e+00f, 5.05089903e+00f, 5.02985954e+00f,
+        5.00863457e+00f, 4.98724031e+00f, 4.96567822e+00f, 4.94395876e+00f, 4.92209673e+00f, 4.90008593e+00f,
+        4.87794018e+00f, 4.85566568e+00f, 4.83327293e+00f, 4.81076384e+00f, 4.78814602e+00f, 4.76542902e+00f,
+        4.74261856e+00f, 4.71971607e+00f, 4.69673681e+00f, 4.67367983e+00f, 4.65055752e+00f, 4.62737083e+00f,
+        4.60412455e+00f, 4.58083248e+00f, 4.55749321e+00f, 4.53411579e+00f, 4.51070452e+00f, 4.48726702e+00f,
+        4.46380711e+00f, 4.44033003e+00f, 4.41683912e+00f, 4.39334249e+00f, 4.36984539e+00f, 4.34635162e+00f,
+        4.32286215e+00f, 4.29938650e+00f, 4.27592850e+00f, 4.25249100e+00f, 4.22907925e+00f, 4.20569658e+00f,
+        4.18234873e+00f, 4.15903854e+00f, 4.13577032e+00f, 4.11254644e+00f, 4.08937263e+00f, 4.06625032e+00f,
+        4.04318476e+00f, 4.02017784e+00f, 3.99723291e+00f, 3.97435522e+00f, 3.95154333e+00f, 3.92880464e+00f,
+        3.90613937e+00f, 3.88355184e+00f, 3.86104250e+00f, 3.83861542e+00f, 3.81627440e+00f, 3.79402018e+00f,
+        3.77185369e+00f, 3.74977946e+00f, 3.72779894e+00f, 3.70591235e+00f, 3.68412328e+00f, 3.66243339e+00f,
+        3.64084506e+00f, 3.61935878e+00f, 3.59797621e+00f, 3.57670116e+00f, 3.55552983e+00f, 3.53446889e+00f,
+        3.51351786e+00f, 3.49267721e+00f, 3.47194886e+00f, 3.45133328e+00f, 3.43083382e+00f, 3.41044831e+00f,
+        3.39017940e+00f, 3.37002587e+00f, 3.34999204e+00f, 3.33007479e+00f, 3.31027842e+00f, 3.29060149e+00f,
+        3.27104592e+00f, 3.25160956e+00f, 3.23229623e+00f, 3.21310496e+00f, 3.19403553e+00f, 3.17508841e+00f,
+        3.15626431e+00f, 3.13756394e+00f, 3.11898661e+00f, 3.10053325e+00f, 3.08220243e+00f, 3.06399727e+00f,
+        3.04591513e+00f, 3.02795672e+00f, 3.01012301e+00f, 2.99241233e+00f, 2.97482610e+00f, 2.95736361e+00f,
+        2.94002390e+00f, 2.92280841e+00f, 2.90571666e+00f, 2.88874745e+00f, 2.87190199e+00f, 2.85517788e+00f,
+        2.83857679e+00f, 2.82209802e+00f, 2.80574012e+00f, 2.78950405e+00f, 2.77338862e+00f, 2.75739408e+00f,
+        2.74151945e+00f, 2.72576451e+00f, 2.71012926e+00f, 2.69461322e+00f, 2.67921472e+00f, 2.66393566e+00f,
+        2.64877272e+00f, 2.63372684e+00f, 2.61879730e+00f, 2.60398436e+00f, 2.58928609e+00f, 2.57470274e+00f,
+        2.56023312e+00f, 2.54587746e+00f, 2.53163457e+00f, 2.51750422e+00f, 2.50348592e+00f, 2.48957849e+00f,
+        2.47578192e+00f, 2.46209502e+00f, 2.44851732e+00f, 2.43504834e+00f, 2.42168736e+00f, 2.40843391e+00f,
+        2.39528680e+00f, 2.38224602e+00f, 2.36931014e+00f, 2.35647988e+00f, 2.34375310e+00f, 2.33112979e+00f,
+        2.31860828e+00f, 2.30618930e+00f, 2.29387188e+00f, 2.28165507e+00f, 2.26953864e+00f, 2.25752115e+00f,
+        2.24560118e+00f, 2.23378015e+00f, 2.22205615e+00f, 2.21042848e+00f, 2.19889665e+00f, 2.18746018e+00f,
+        2.17611742e+00f, 2.16486883e+00f, 2.15371394e+00f, 2.14265060e+00f, 2.13167858e+00f, 2.12079835e+00f,
+        2.11000824e+00f, 2.09930754e+00f, 2.08869624e+00f, 2.07817292e+00f, 2.06773663e+00f, 2.05738807e+00f,
+        2.04712558e+00f, 2.03694892e+00f, 2.02685666e+00f, 2.01684880e+00f, 2.00692463e+00f, 1.99708343e+00f,
+        1.98732424e+00f, 1.97764719e+00f, 1.96805084e+00f, 1.95853472e+00f, 1.94909871e+00f, 1.93974102e+00f,
+        1.93046260e+00f, 1.92126167e+00f, 1.91213763e+00f, 1.90309048e+00f, 1.89411950e+00f, 1.88522339e+00f,
+        1.87640238e+00f, 1.86765504e+00f, 1.85898137e+00f, 1.85038066e+00f, 1.84185243e+00f, 1.83339584e+00f,
+        1.82501018e+00f, 1.81669474e+00f, 1.80844975e+00f, 1.80027401e+00f, 1.79216707e+00f, 1.78412831e+00f,
+        1.77615726e+00f, 1.76825333e+00f, 1.76041627e+00f, 1.75264502e+00f, 1.74493909e+00f, 1.73729825e+00f,
+        1.72972155e+00f, 1.72220898e+00f, 1.71475959e+00f, 1.70737338e+00f, 1.70004880e+00f, 1.69278622e+00f,
+        1.68558502e+00f, 1.67844415e+00f, 1.67136443e+00f, 1.66434360e+00f, 1.65738237e+00f, 1.65048015e+00f,
+        1.64363575e+00f, 1.63684928e+00f, 1.63012016e+00f, 1.62344754e+00f, 1.61683142e+00f, 1.61027145e+00f,
+        1.60376668e+00f, 1.59731686e+00f, 1.59092152e+00f, 1.58458030e+00f, 1.57829273e+00f, 1.57205832e+00f,
+        1.56587672e+00f, 1.55974734e+00f, 1.55366993e+00f, 1.54764366e+00f, 1.54166889e+00f, 1.53574443e+00f,
+        1.52987003e+00f, 1.52404594e+00f, 1.51827085e+00f, 1.51254463e+00f, 1.50686705e+00f, 1.50123775e+00f,
+        1.49565613e+00f, 1.49012184e+00f, 1.48463452e+00f, 1.47919405e+00f, 1.47379982e+00f, 1.46845138e+00f,
+        1.46314847e+00f, 1.45789063e+00f, 1.45267773e+00f, 1.44750929e+00f, 1.44238472e+00f, 1.43730402e+00f,
+        1.43226647e+00f, 1.42727232e+00f, 1.42232049e+00f, 1.41741121e+00f, 1.41254389e+00f, 1.40771818e+00f,
+        1.40293360e+00f, 1.39819038e+00f, 1.39348781e+00f, 1.38882554e+00f, 1.38420308e+00f, 1.37962079e+00f,
+        1.37507784e+00f, 1.37057412e+00f, 1.36610889e+00f, 1.36168242e+00f, 1.35729444e+00f, 1.35294402e+00f,
+        1.34863126e+00f, 1.34435630e+00f, 1.34011805e+00f, 1.33591652e+00f, 1.33175159e+00f, 1.32762301e+00f,
+        1.32353067e+00f, 1.31947362e+00f, 1.31545198e+00f, 1.31146586e+00f, 1.30751443e+00f, 1.30359769e+00f,
+        1.29971540e+00f, 1.29586709e+00f, 1.29205263e+00f, 1.28827214e+00f, 1.28452468e+00f, 1.28081071e+00f,
+        1.27712929e+00f, 1.27348089e+00f, 1.26986456e+00f, 1.26628065e+00f, 1.26272869e+00f, 1.25920856e+00f,
+        1.25571990e+00f, 1.25226247e+00f, 1.24883604e+00f, 1.24544084e+00f, 1.24207592e+00f, 1.23874176e+00f,
+        1.23543739e+00f, 1.23216331e+00f, 1.22891891e+00f, 1.22570407e+00f, 1.22251892e+00f, 1.21936250e+00f,
+        1.21623540e+00f, 1.21313691e+00f, 1.21006739e+00f, 1.20702589e+00f, 1.20401299e+00f, 1.20102775e+00f,
+        1.19807076e+00f, 1.19514120e+00f, 1.19223917e+00f, 1.18936455e+00f, 1.18651676e+00f, 1.18369627e+00f,
+        1.18090236e+00f, 1.17813528e+00f, 1.17539442e+00f, 1.17268002e+00f, 1.16999161e+00f, 1.16732907e+00f,
+        1.16469252e+00f, 1.16208160e+00f, 1.15949607e+00f, 1.15693605e+00f, 1.15440106e+00f, 1.15189099e+00f,
+        1.14940584e+00f, 1.14694548e+00f, 1.14450955e+00f, 1.14209819e+00f, 1.13971114e+00f, 1.13734829e+00f,
+        1.13500941e+00f, 1.13269413e+00f, 1.13040268e+00f, 1.12813497e+00f, 1.12589073e+00f, 1.12366974e+00f,
+        1.12147200e+00f, 1.11929715e+00f, 1.11714554e+00f, 1.11501670e+00f, 1.11291039e+00f, 1.11082673e+00f,
+        1.10876536e+00f, 1.10672665e+00f, 1.10471010e+00f, 1.10271537e+00f, 1.10074294e+00f, 1.09879220e+00f,
+        1.09686339e+00f, 1.09495604e+00f, 1.09307051e+00f, 1.09120607e+00f, 1.08936322e+00f, 1.08754170e+00f,
+        1.08574104e+00f, 1.08396149e+00f, 1.08220291e+00f, 1.08046520e+00f, 1.07874823e+00f, 1.07705188e+00f,
+        1.07537591e+00f, 1.07372046e+00f, 1.07208526e+00f, 1.07047057e+00f, 1.06887591e+00f, 1.06730151e+00f,
+        1.06574690e+00f, 1.06421232e+00f, 1.06269741e+00f, 1.06120241e+00f, 1.05972695e+00f, 1.05827141e+00f,
+        1.05683494e+00f, 1.05541813e+00f, 1.05402052e+00f, 1.05264235e+00f, 1.05128312e+00f, 1.04994333e+00f,
+        1.04862237e+00f, 1.04732049e+00f, 1.04603732e+00f, 1.04477310e+00f, 1.04352772e+00f, 1.04230082e+00f,
+        1.04109287e+00f, 1.03990328e+00f, 1.03873241e+00f, 1.03757977e+00f, 1.03644550e+00f, 1.03532958e+00f,
+        1.03423202e+00f, 1.03315246e+00f, 1.03209138e+00f, 1.03104842e+00f, 1.03002322e+00f, 1.02901590e+00f,
+        1.02802670e+00f, 1.02705526e+00f, 1.02610183e+00f, 1.02516603e+00f, 1.02424788e+00f, 1.02334762e+00f,
+        1.02246499e+00f, 1.02159965e+00f, 1.02075207e+00f, 1.01992178e+00f, 1.01910925e+00f, 1.01831388e+00f,
+        1.01753592e+00f, 1.01677537e+00f, 1.01603198e+00f, 1.01530600e+00f, 1.01459718e+00f, 1.01390529e+00f,
+        1.01323092e+00f, 1.01257336e+00f, 1.01193297e+00f, 1.01130962e+00f, 1.01070344e+00f, 1.01011384e+00f,
+        1.00954139e+00f, 1.00898588e+00f, 1.00844729e+00f, 1.00792551e+00f, 1.00742030e+00f, 1.00693226e+00f,
+        1.00646091e+00f, 1.00600624e+00f, 1.00556839e+00f, 1.00514722e+00f, 1.00474274e+00f, 1.00435483e+00f,
+        1.00398374e+00f, 1.00362921e+00f, 1.00329113e+00f, 1.00296974e+00f, 1.00266492e+00f, 1.00237679e+00f,
+        1.00210500e+00f, 1.00185001e+00f, 1.00161123e+00f, 1.00138927e+00f, 1.00118363e+00f, 1.00099444e+00f,
+        1.00082171e+00f, 1.00066555e+00f, 1.00052583e+00f, 1.00040245e+00f, 1.00029564e+00f, 1.00020540e+00f,
+        1.00013137e+00f, 1.00007403e+00f, 1.00003290e+00f, 1.00000823e+00f
+    };
+
+    static const float hannwindow2048[2048] = {
+        0.00000000e+00f, 2.35539483e-06f, 9.42155748e-06f, 2.11984207e-05f, 3.76858734e-05f, 5.88837611e-05f,
+        8.47918855e-05f, 1.15409995e-04f, 1.50737818e-04f, 1.90774997e-04f, 2.35521176e-04f, 2.84975918e-04f,
+        3.39138787e-04f, 3.98009230e-04f, 4.61586722e-04f, 5.29870624e-04f, 6.02860353e-04f, 6.80555182e-04f,
+        7.62954412e-04f, 8.50057229e-04f, 9.41862818e-04f, 1.03837030e-03f, 1.13957888e-03f, 1.24548748e-03f,
+        1.35609508e-03f, 1.47140073e-03f, 1.59140327e-03f, 1.71610166e-03f, 1.84549461e-03f, 1.97958108e-03f,
+        2.11835955e-03f, 2.26182886e-03f, 2.40998762e-03f, 2.56283465e-03f, 2.72036809e-03f, 2.88258679e-03f,
+        3.04948934e-03f, 3.22107365e-03f, 3.39733856e-03f, 3.57828219e-03f, 3.76390293e-03f, 3.95419914e-03f,
+        4.14916826e-03f, 4.34880983e-03f, 4.55312105e-03f, 4.76210006e-03f, 4.97574452e-03f, 5.19405352e-03f,
+        5.41702425e-03f, 5.64465486e-03f, 5.87694254e-03f, 6.11388590e-03f, 6.35548262e-03f, 6.60173036e-03f,
+        6.85262633e-03f, 7.10816868e-03f, 7.36835506e-03f, 7.63318269e-03f, 7.90264923e-03f, 8.17675143e-03f,
+        8.45548790e-03f, 8.73885583e-03f, 9.02685244e-03f, 9.31947399e-03f, 9.61671863e-03f, 9.91858356e-03f,
+        1.02250660e-02f, 1.05361631e-02f, 1.08518712e-02f, 1.11721884e-02f, 1.14971101e-02f, 1.18266353e-02f,
+        1.21607594e-02f, 1.24994796e-02f, 1.28427930e-02f, 1.31906969e-02f, 1.35431867e-02f, 1.39002595e-02f,
+        1.42619126e-02f, 1.46281412e-02f, 1.49989435e-02f, 1.53743150e-02f, 1.57542527e-02f, 1.61387529e-02f,
+        1.65278111e-02f, 1.69214252e-02f, 1.73195899e-02f, 1.77223030e-02f, 1.81295592e-02f, 1.85413565e-02f,
+        1.89576894e-02f, 1.93785541e-02f, 1.98039468e-02f, 2.02338640e-02f, 2.06683017e-02f, 2.11072545e-02f,
+        2.15507206e-02f, 2.19986942e-02f, 2.24511698e-02f, 2.29081456e-02f, 2.33696178e-02f, 2.38355789e-02f,
+        2.43060254e-02f, 2.47809552e-02f, 2.52603628e-02f, 2.57442426e-02f, 2.62325890e-02f, 2.67254021e-02f,
+        2.72226725e-02f, 2.77243964e-02f, 2.82305703e-02f, 2.87411902e-02f, 2.92562488e-02f, 2.97757443e-02f,
+        3.02996691e-02f, 3.08280177e-02f, 3.13607901e-02f, 3.18979733e-02f, 3.24395709e-02f, 3.29855718e-02f,
+        3.35359722e-02f, 3.40907685e-02f, 3.46499532e-02f, 3.52135226e-02f, 3.57814729e-02f, 3.63537930e-02f,
+        3.69304866e-02f, 3.75115387e-02f, 3.80969495e-02f, 3.86867113e-02f, 3.92808206e-02f, 3.98792699e-02f,
+        4.04820554e-02f, 4.10891697e-02f, 4.17006090e-02f, 4.23163660e-02f, 4.29364331e-02f, 4.35608067e-02f,
+        4.41894792e-02f, 4.48224507e-02f, 4.54597063e-02f, 4.61012460e-02f, 4.67470624e-02f, 4.73971516e-02f,
+        4.80515026e-02f, 4.87101115e-02f, 4.93729711e-02f, 5.00400774e-02f, 5.07114232e-02f, 5.13870046e-02f,
+        5.20668104e-02f, 5.27508333e-02f, 5.34390733e-02f, 5.41315228e-02f, 5.48281707e-02f, 5.55290096e-02f,
+        5.62340394e-02f, 5.69432527e-02f, 5.76566346e-02f, 5.83741888e-02f, 5.90959005e-02f, 5.98217696e-02f,
+        6.05517812e-02f, 6.12859391e-02f, 6.20242245e-02f, 6.27666414e-02f, 6.35131747e-02f, 6.42638206e-02f,
+        6.50185719e-02f, 6.57774210e-02f, 6.65403605e-02f, 6.73073903e-02f, 6.80784881e-02f, 6.88536614e-02f,
+        6.96328953e-02f, 7.04161823e-02f, 7.12035149e-02f, 7.19948933e-02f, 7.27902949e-02f, 7.35897273e-02f,
+        7.43931830e-02f, 7.52006397e-02f, 7.60121047e-02f, 7.68275559e-02f, 7.76470006e-02f, 7.84704238e-02f,
+        7.92978182e-02f, 8.01291764e-02f, 8.09644908e-02f, 8.18037540e-02f, 8.26469585e-02f, 8.34940895e-02f,
+        8.43451470e-02f, 8.52001235e-02f, 8.60590041e-02f, 8.69217888e-02f, 8.77884626e-02f, 8.86590183e-02f,
+        8.95334482e-02f, 9.04117525e-02f, 9.12939087e-02f, 9.21799242e-02f, 9.30697769e-02f, 9.39634591e-02f,
+        9.48609710e-02f, 9.57623050e-02f, 9.66674387e-02f, 9.75763798e-02f, 9.84891057e-02f, 9.94056165e-02f,
+        1.00325905e-01f, 1.01249956e-01f, 1.02177761e-01f, 1.03109322e-01f, 1.04044616e-01f, 1.04983643e-01f,
+        1.05926394e-01f, 1.06872857e-01f, 1.07823014e-01f, 1.08776875e-01f, 1.09734423e-01f, 1.10695645e-01f,
+        1.11660540e-01f, 1.12629086e-01f, 1.13601282e-01f, 1.14577122e-01f, 1.15556598e-01f, 1.16539687e-01f,
+        1.17526397e-01f, 1.18516706e-01f, 1.19510606e-01f, 1.20508097e-01f, 1.21509157e-01f, 1.22513786e-01f,
+        1.23521976e-01f, 1.24533705e-01f, 1.25548974e-01f, 1.26567781e-01f, 1.27590090e-01f, 1.28615916e-01f,
+        1.29645243e-01f, 1.30678058e-01f, 1.31714344e-01f, 1.32754117e-01f, 1.33797333e-01f, 1.34844005e-01f,
+        1.35894120e-01f, 1.36947662e-01f, 1.38004631e-01f, 1.39065012e-01f, 1.40128776e-01f, 1.41195953e-01f,
+        1.42266497e-01f, 1.43340409e-01f, 1.44417688e-01f, 1.45498320e-01f, 1.46582291e-01f, 1.47669584e-01f,
+        1.48760200e-01f, 1.49854124e-01f, 1.50951356e-01f, 1.52051866e-01f, 1.53155655e-01f, 1.54262722e-01f,
+        1.55373037e-01f, 1.56486601e-01f, 1.57603398e-01f, 1.58723429e-01f, 1.59846663e-01f, 1.60973117e-01f,
+        1.62102759e-01f, 1.63235575e-01f, 1.64371580e-01f, 1.65510744e-01f, 1.66653052e-01f, 1.67798504e-01f,
+        1.68947086e-01f, 1.70098782e-01f, 1.71253592e-01f, 1.72411501e-01f, 1.73572496e-01f, 1.74736559e-01f,
+        1.75903693e-01f, 1.77073881e-01f, 1.78247109e-01f, 1.79423362e-01f, 1.80602640e-01f, 1.81784928e-01f,
+        1.82970226e-01f, 1.84158489e-01f, 1.85349748e-01f, 1.86543956e-01f, 1.87741131e-01f, 1.88941240e-01f,
+        1.90144271e-01f, 1.91350237e-01f, 1.92559108e-01f, 1.93770871e-01f, 1.94985524e-01f, 1.96203038e-01f,
+        1.97423428e-01f, 1.98646665e-01f, 1.99872732e-01f, 2.01101646e-01f, 2.02333361e-01f, 2.03567877e-01f,
+        2.04805195e-01f, 2.06045300e-01f, 2.07288161e-01f, 2.08533794e-01f, 2.09782153e-01f, 2.11033270e-01f,
+        2.12287098e-01f, 2.13543624e-01f, 2.14802861e-01f, 2.16064796e-01f, 2.17329398e-01f, 2.18596652e-01f,
+        2.19866574e-01f, 2.21139118e-01f, 2.22414300e-01f, 2.23692104e-01f, 2.24972501e-01f, 2.26255491e-01f,
+        2.27541059e-01f, 2.28829190e-01f, 2.30119884e-01f, 2.31413126e-01f, 2.32708886e-01f, 2.34007165e-01f,
+        2.35307962e-01f, 2.36611232e-01f, 2.37917006e-01f, 2.39225239e-01f, 2.40535930e-01f, 2.41849065e-01f,
+        2.43164629e-01f, 2.44482622e-01f, 2.45803013e-01f, 2.47125804e-01f, 2.48450965e-01f, 2.49778509e-01f,
+        2.51108408e-01f, 2.52440661e-01f, 2.53775239e-01f, 2.55112141e-01f, 2.56451339e-01f, 2.57792830e-01f,
+        2.59136617e-01f, 2.60482669e-01f, 2.61830956e-01f, 2.63181508e-01f, 2.64534295e-01f, 2.65889287e-01f,
+        2.67246515e-01f, 2.68605888e-01f, 2.69967467e-01f, 2.71331221e-01f, 2.72697121e-01f, 2.74065167e-01f,
+        2.75435328e-01f, 2.76807636e-01f, 2.78182000e-01f, 2.79558480e-01f, 2.80937046e-01f, 2.82317668e-01f,
+        2.83700347e-01f, 2.85085052e-01f, 2.86471784e-01f, 2.87860513e-01f, 2.89251268e-01f, 2.90643990e-01f,
+        2.92038709e-01f, 2.93435365e-01f, 2.94833958e-01f, 2.96234518e-01f, 2.97636956e-01f, 2.99041331e-01f,
+        3.00447583e-01f, 3.01855743e-01f, 3.03265750e-01f, 3.04677606e-01f, 3.06091309e-01f, 3.07506830e-01f,
+        3.08924168e-01f, 3.10343325e-01f, 3.11764240e-01f, 3.13186944e-01f, 3.14611405e-01f, 3.16037625e-01f,
+        3.17465544e-01f, 3.18895221e-01f, 3.20326596e-01f, 3.21759641e-01f, 3.23194385e-01f, 3.24630797e-01f,
+        3.26068848e-01f, 3.27508539e-01f, 3.28949869e-01f, 3.30392808e-01f, 3.31837326e-01f, 3.33283454e-01f,
+        3.34731132e-01f, 3.36180389e-01f, 3.37631166e-01f, 3.39083493e-01f, 3.40537310e-01f, 3.41992646e-01f,
+        3.43449473e-01f, 3.44907761e-01f, 3.46367538e-01f, 3.47828746e-01f, 3.49291384e-01f, 3.50755453e-01f,
+        3.52220923e-01f, 3.53687763e-01f, 3.55156004e-01f, 3.56625617e-01f, 3.58096570e-01f, 3.59568864e-01f,
+        3.61042470e-01f, 3.62517387e-01f, 3.63993615e-01f, 3.65471095e-01f, 3.66949886e-01f, 3.68429899e-01f,
+        3.69911164e-01f, 3.71393651e-01f, 3.72877330e-01f, 3.74362230e-01f, 3.75848323e-01f, 3.77335548e-01f,
+        3.78823966e-01f, 3.80313516e-01f, 3.81804198e-01f, 3.83295983e-01f, 3.84788871e-01f, 3.86282831e-01f,
+        3.87777865e-01f, 3.89273971e-01f, 3.90771121e-01f, 3.92269284e-01f, 3.93768489e-01f, 3.95268679e-01f,
+        3.96769851e-01f, 3.98272008e-01f, 3.99775088e-01f, 4.01279151e-01f, 4.02784139e-01f, 4.04290020e-01f,
+        4.05796826e-01f, 4.07304525e-01f, 4.08813089e-01f, 4.10322487e-01f, 4.11832750e-01f, 4.13343847e-01f,
+        4.14855748e-01f, 4.16368484e-01f, 4.17881966e-01f, 4.19396251e-01f, 4.20911282e-01f, 4.22427058e-01f,
+        4.23943579e-01f, 4.25460786e-01f, 4.26978737e-01f, 4.28497344e-01f, 4.30016637e-01f, 4.31536585e-01f,
+        4.33057189e-01f, 4.34578419e-01f, 4.36100245e-01f, 4.37622696e-01f, 4.39145714e-01f, 4.40669328e-01f,
+        4.42193508e-01f, 4.43718195e-01f, 4.45243448e-01f, 4.46769208e-01f, 4.48295444e-01f, 4.49822187e-01f,
+        4.51349407e-01f, 4.52877074e-01f, 4.54405218e-01f, 4.55933750e-01f, 4.57462728e-01f, 4.58992094e-01f,
+        4.60521847e-01f, 4.62051958e-01f, 4.63582426e-01f, 4.65113252e-01f, 4.66644406e-01f, 4.68175888e-01f,
+        4.69707638e-01f, 4.71239686e-01f, 4.72772002e-01f, 4.74304587e-01f, 4.75837409e-01f, 4.77370471e-01f,
+        4.78903711e-01f, 4.80437189e-01f, 4.81970817e-01f, 4.83504653e-01f, 4.85038608e-01f, 4.86572713e-01f,
+        4.88106966e-01f, 4.89641309e-01f, 4.91175771e-01f, 4.92710292e-01f, 4.94244903e-01f, 4.95779544e-01f,
+        4.97314245e-01f, 4.98848945e-01f, 5.00383675e-01f, 5.01918435e-01f, 5.03453135e-01f, 5.04987776e-01f,
+        5.06522417e-01f, 5.08056998e-01f, 5.09591460e-01f, 5.11125863e-01f, 5.12660146e-01f, 5.14194369e-01f,
+        5.15728414e-01f, 5.17262280e-01f, 5.18796027e-01f, 5.20329595e-01f, 5.21862924e-01f, 5.23396075e-01f,
+        5.24929047e-01f, 5.26461720e-01f, 5.27994156e-01f, 5.29526353e-01f, 5.31058252e-01f, 5.32589912e-01f,
+        5.34121215e-01f, 5.35652220e-01f, 5.37182868e-01f, 5.38713157e-01f, 5.40243089e-01f, 5.41772664e-01f,
+        5.43301821e-01f, 5.44830561e-01f, 5.46358883e-01f, 5.47886789e-01f, 5.49414277e-01f, 5.50941229e-01f,
+        5.52467763e-01f, 5.53993762e-01f, 5.55519223e-01f, 5.57044208e-01f, 5.58568656e-01f, 5.60092568e-01f,
+        5.61615884e-01f, 5.63138604e-01f, 5.64660728e-01f, 5.66182256e-01f, 5.67703187e-01f, 5.69223464e-01f,
+        5.70743084e-01f, 5.72262049e-01f, 5.73780298e-01f, 5.75297892e-01f, 5.76814771e-01f, 5.78330934e-01f,
+        5.79846323e-01f, 5.81360996e-01f, 5.82874894e-01f, 5.84387958e-01f, 5.85900307e-01f, 5.87411821e-01f,
+        5.88922501e-01f, 5.90432346e-01f, 5.91941297e-01f, 5.93449414e-01f, 5.94956696e-01f, 5.96463025e-01f,
+        5.97968459e-01f, 5.99473000e-01f, 6.00976586e-01f, 6.02479219e-01f, 6.03980839e-01f, 6.05481565e-01f,
+        6.06981218e-01f, 6.08479917e-01f, 6.09977603e-01f, 6.11474216e-01f, 6.12969756e-01f, 6.14464283e-01f,
+        6.15957737e-01f, 6.17450058e-01f, 6.18941307e-01f, 6.20431423e-01f, 6.21920407e-01f, 6.23408198e-01f,
+        6.24894857e-01f, 6.26380384e-01f, 6.27864659e-01f, 6.29347742e-01f, 6.30829632e-01f, 6.32310271e-01f,
+        6.33789659e-01f, 6.35267794e-01f, 6.36744678e-01f, 6.38220251e-01f, 6.39694512e-01f, 6.41167462e-01f,
+        6.42639101e-01f, 6.44109368e-01f, 6.45578265e-01f, 6.47045851e-01f, 6.48512006e-01f, 6.49976790e-01f,
+        6.51440144e-01f, 6.52902067e-01f, 6.54362500e-01f, 6.55821562e-01f, 6.57279134e-01f, 6.58735216e-01f,
+        6.60189807e-01f, 6.61642849e-01f, 6.63094401e-01f, 6.64544463e-01f, 6.65992916e-01f, 6.67439818e-01f,
+        6.68885112e-01f, 6.70328856e-01f, 6.71770990e-01f, 6.73211515e-01f, 6.74650371e-01f, 6.76087618e-01f,
+        6.77523196e-01f, 6.78957105e-01f, 6.80389285e-01f, 6.81819856e-01f, 6.83248639e-01f, 6.84675694e-01f,
+        6.86101019e-01f, 6.87524617e-01f, 6.88946426e-01f, 6.90366507e-01f, 6.91784739e-01f, 6.93201184e-01f,
+        6.94615781e-01f, 6.96028531e-01f, 6.97439492e-01f, 6.98848546e-01f, 7.00255752e-01f, 7.01661110e-01f,
+        7.03064501e-01f, 7.04465985e-01f, 7.05865562e-01f, 7.07263231e-01f, 7.08658874e-01f, 7.10052609e-01f,
+        7.11444378e-01f, 7.12834120e-01f, 7.14221835e-01f, 7.15607584e-01f, 7.16991246e-01f, 7.18372881e-01f,
+        7.19752491e-01f, 7.21130013e-01f, 7.22505450e-01f, 7.23878801e-01f, 7.25250006e-01f, 7.26619124e-01f,
+        7.27986097e-01f, 7.29350924e-01f, 7.30713606e-01f, 7.32074082e-01f, 7.33432353e-01f, 7.34788477e-01f,
+        7.36142397e-01f, 7.37494051e-01f, 7.38843441e-01f, 7.40190625e-01f, 7.41535544e-01f, 7.42878199e-01f,
+        7.44218528e-01f, 7.45556593e-01f, 7.46892333e-01f, 7.48225749e-01f, 7.49556839e-01f, 7.50885546e-01f,
+        7.52211928e-01f, 7.53535867e-01f, 7.54857481e-01f, 7.56176651e-01f, 7.57493436e-01f, 7.58807838e-01f,
+        7.60119736e-01f, 7.61429191e-01f, 7.62736201e-01f, 7.64040709e-01f, 7.65342772e-01f, 7.66642272e-01f,
+        7.67939329e-01f, 7.69233823e-01f, 7.70525753e-01f, 7.71815181e-01f, 7.73102045e-01f, 7.74386346e-01f,
+        7.75668025e-01f, 7.76947141e-01f, 7.78223634e-01f, 7.79497504e-01f, 7.80768692e-01f, 7.82037318e-01f,
+        7.83303261e-01f, 7.84566522e-01f, 7.85827100e-01f, 7.87084997e-01f, 7.88340151e-01f, 7.89592624e-01f,
+        7.90842354e-01f, 7.92089343e-01f, 7.93333590e-01f, 7.94575095e-01f, 7.95813799e-01f, 7.97049701e-01f,
+        7.98282862e-01f, 7.99513161e-01f, 8.00740659e-01f, 8.01965296e-01f, 8.03187132e-01f, 8.04406106e-01f,
+        8.05622160e-01f, 8.06835353e-01f, 8.08045685e-01f, 8.09253097e-01f, 8.10457587e-01f, 8.11659157e-01f,
+        8.12857807e-01f, 8.14053535e-01f, 8.15246224e-01f, 8.16435993e-01f, 8.17622781e-01f, 8.18806589e-01f,
+        8.19987357e-01f, 8.21165144e-01f, 8.22339892e-01f, 8.23511600e-01f, 8.24680269e-01f, 8.25845838e-01f,
+        8.27008367e-01f, 8.28167856e-01f, 8.29324186e-01f, 8.30477476e-01f, 8.31627607e-01f, 8.32774639e-01f,
+        8.33918512e-01f, 8.35059226e-01f, 8.36196840e-01f, 8.37331235e-01f, 8.38462472e-01f, 8.39590490e-01f,
+        8.40715349e-01f, 8.41836989e-01f, 8.42955410e-01f, 8.44070613e-01f, 8.45182538e-01f, 8.46291244e-01f,
+        8.47396672e-01f, 8.48498821e-01f, 8.49597692e-01f, 8.50693226e-01f, 8.51785541e-01f, 8.52874458e-01f,
+        8.53960097e-01f, 8.55042398e-01f, 8.56121361e-01f, 8.57196987e-01f, 8.58269215e-01f, 8.59338045e-01f,
+        8.60403538e-01f, 8.61465633e-01f, 8.62524271e-01f, 8.63579512e-01f, 8.64631355e-01f, 8.65679741e-01f,
+        8.66724730e-01f, 8.67766201e-01f, 8.68804216e-01f, 8.69838774e-01f, 8.70869875e-01f, 8.71897459e-01f,
+        8.72921526e-01f, 8.73942077e-01f, 8.74959111e-01f, 8.75972629e-01f, 8.76982570e-01f, 8.77988994e-01f,
+        8.78991842e-01f, 8.79991114e-01f, 8.80986810e-01f, 8.81978929e-01f, 8.82967412e-01f, 8.83952320e-01f,
+        8.84933591e-01f, 8.85911226e-01f, 8.86885285e-01f, 8.87855649e-01f, 8.88822377e-01f, 8.89785409e-01f,
+        8.90744805e-01f, 8.91700506e-01f, 8.92652512e-01f, 8.93600821e-01f, 8.94545436e-01f, 8.95486355e-01f,
+        8.96423519e-01f, 8.97356927e-01f, 8.98286581e-01f, 8.99212539e-01f, 9.00134683e-01f, 9.01053131e-01f,
+        9.01967704e-01f, 9.02878582e-01f, 9.03785586e-01f, 9.04688835e-01f, 9.05588269e-01f, 9.06483889e-01f,
+        9.07375634e-01f, 9.08263564e-01f, 9.09147680e-01f, 9.10027862e-01f, 9.10904229e-01f, 9.11776721e-01f,
+        9.12645340e-01f, 9.13510084e-01f, 9.14370954e-01f, 9.15227830e-01f, 9.16080892e-01f, 9.16929960e-01f,
+        9.17775154e-01f, 9.18616354e-01f, 9.19453681e-01f, 9.20287013e-01f, 9.21116352e-01f, 9.21941757e-01f,
+        9.22763228e-01f, 9.23580647e-01f, 9.24394131e-01f, 9.25203562e-01f, 9.26009059e-01f, 9.26810503e-01f,
+        9.27607894e-01f, 9.28401291e-01f, 9.29190636e-01f, 9.29975986e-01f, 9.30757225e-01f, 9.31534410e-01f,
+        9.32307541e-01f, 9.33076620e-01f, 9.33841646e-01f, 9.34602499e-01f, 9.35359299e-01f, 9.36111987e-01f,
+        9.36860621e-01f, 9.37605083e-01f, 9.38345432e-01f, 9.39081669e-01f, 9.39813733e-01f, 9.40541685e-01f,
+        9.41265464e-01f, 9.41985130e-01f, 9.42700565e-01f, 9.43411887e-01f, 9.44118977e-01f, 9.44821954e-01f,
+        9.45520699e-01f, 9.46215212e-01f, 9.46905553e-01f, 9.47591722e-01f, 9.48273599e-01f, 9.48951304e-01f,
+        9.49624777e-01f, 9.50294018e-01f, 9.50958967e-01f, 9.51619744e-01f, 9.52276230e-01f, 9.52928424e-01f,
+        9.53576386e-01f, 9.54220057e-01f, 9.54859436e-01f, 9.55494583e-01f, 9.56125379e-01f, 9.56751943e-01f,
+        9.57374156e-01f, 9.57992077e-01f, 9.58605647e-01f, 9.59214926e-01f, 9.59819853e-01f, 9.60420489e-01f,
+        9.61016774e-01f, 9.61608708e-01f, 9.62196290e-01f, 9.62779522e-01f, 9.63358402e-01f, 9.63932931e-01f,
+        9.64503050e-01f, 9.65068817e-01f, 9.65630174e-01f, 9.66187179e-01f, 9.66739774e-01f, 9.67287958e-01f,
+        9.67831790e-01f, 9.68371153e-01f, 9.68906164e-01f, 9.69436705e-01f, 9.69962835e-01f, 9.70484555e-01f,
+        9.71001863e-01f, 9.71514702e-01f, 9.72023070e-01f, 9.72527027e-01f, 9.73026514e-01f, 9.73521590e-01f,
+        9.74012136e-01f, 9.74498272e-01f, 9.74979877e-01f, 9.75457072e-01f, 9.75929737e-01f, 9.76397991e-01f,
+        9.76861656e-01f, 9.77320910e-01f, 9.77775633e-01f, 9.78225827e-01f, 9.78671551e-01f, 9.79112804e-01f,
+        9.79549468e-01f, 9.79981661e-01f, 9.80409324e-01f, 9.80832458e-01f, 9.81251061e-01f, 9.81665134e-01f,
+        9.82074618e-01f, 9.82479632e-01f, 9.82880056e-01f, 9.83275950e-01f, 9.83667314e-01f, 9.84054089e-01f,
+        9.84436274e-01f, 9.84813929e-01f, 9.85187054e-01f, 9.85555530e-01f, 9.85919476e-01f, 9.86278832e-01f,
+        9.86633658e-01f, 9.86983836e-01f, 9.87329423e-01f, 9.87670481e-01f, 9.88006890e-01f, 9.88338709e-01f,
+        9.88665938e-01f, 9.88988519e-01f, 9.89306569e-01f, 9.89619970e-01f, 9.89928722e-01f, 9.90232944e-01f,
+        9.90532458e-01f, 9.90827441e-01f, 9.91117716e-01f, 9.91403401e-01f, 9.91684437e-01f, 9.91960883e-01f,
+        9.92232680e-01f, 9.92499828e-01f, 9.92762327e-01f, 9.93020177e-01f, 9.93273377e-01f, 9.93521988e-01f,
+        9.93765891e-01f, 9.94005144e-01f, 9.94239807e-01f, 9.94469762e-01f, 9.94695067e-01f, 9.94915664e-01f,
+        9.95131671e-01f, 9.95342970e-01f, 9.95549619e-01f, 9.95751619e-01f, 9.95948911e-01f, 9.96141553e-01f,
+        9.96329486e-01f, 9.96512771e-01f, 9.96691406e-01f, 9.96865332e-01f, 9.97034550e-01f, 9.97199118e-01f,
+        9.97358978e-01f, 9.97514188e-01f, 9.97664690e-01f, 9.97810483e-01f, 9.97951627e-01f, 9.98088062e-01f,
+        9.98219788e-01f, 9.98346806e-01f, 9.98469174e-01f, 9.98586833e-01f, 9.98699784e-01f, 9.98808026e-01f,
+        9.98911619e-01f, 9.99010444e-01f, 9.99104619e-01f, 9.99194086e-01f, 9.99278843e-01f, 9.99358892e-01f,
+        9.99434233e-01f, 9.99504864e-01f, 9.99570787e-01f, 9.99632001e-01f, 9.99688506e-01f, 9.99740362e-01f,
+        9.99787450e-01f, 9.99829829e-01f, 9.99867499e-01f, 9.99900460e-01f, 9.99928772e-01f, 9.99952316e-01f,
+        9.99971151e-01f, 9.99985278e-01f, 9.99994695e-01f, 9.99999404e-01f, 9.99999404e-01f, 9.99994695e-01f,
+        9.99985278e-01f, 9.99971151e-01f, 9.99952316e-01f, 9.99928772e-01f, 9.99900460e-01f, 9.99867499e-01f,
+        9.99829829e-01f, 9.99787450e-01f, 9.99740362e-01f, 9.99688506e-01f, 9.99632001e-01f, 9.99570787e-01f,
+        9.99504864e-01f, 9.99434233e-01f, 9.99358892e-01f, 9.99278843e-01f, 9.99194086e-01f, 9.99104619e-01f,
+        9.99010444e-01f, 9.98911619e-01f, 9.98808026e-01f, 9.98699784e-01f, 9.98586833e-01f, 9.98469174e-01f,
+        9.98346806e-01f, 9.98219788e-01f, 9.98088062e-01f, 9.97951627e-01f, 9.97810483e-01f, 9.97664690e-01f,
+        9.97514188e-01f, 9.97358978e-01f, 9.97199118e-01f, 9.97034550e-01f, 9.96865332e-01f, 9.96691406e-01f,
+        9.96512771e-01f, 9.96329486e-01f, 9.96141553e-01f, 9.95948911e-01f, 9.95751619e-01f, 9.95549619e-01f,
+        9.95342970e-01f, 9.95131671e-01f, 9.94915664e-01f, 9.94695067e-01f, 9.94469762e-01f, 9.94239807e-01f,
+        9.94005144e-01f, 9.93765891e-01f, 9.93521988e-01f, 9.93273377e-01f, 9.93020177e-01f, 9.92762327e-01f,
+        9.92499828e-01f, 9.92232680e-01f, 9.91960883e-01f, 9.91684437e-01f, 9.91403401e-01f, 9.91117716e-01f,
+        9.90827441e-01f, 9.90532458e-01f, 9.90232944e-01f, 9.89928722e-01f, 9.89619970e-01f, 9.89306569e-01f,
+        9.88988519e-01f, 9.88665938e-01f, 9.88338709e-01f, 9.88006890e-01f, 9.87670481e-01f, 9.87329423e-01f,
+        9.86983836e-01f, 9.86633658e-01f, 9.86278832e-01f, 9.85919476e-01f, 9.85555530e-01f, 9.85187054e-01f,
+        9.84813929e-01f, 9.84436274e-01f, 9.84054089e-01f, 9.83667314e-01f, 9.83275950e-01f, 9.82880056e-01f,
+        9.82479632e-01f, 9.82074618e-01f, 9.81665134e-01f, 9.81251061e-01f, 9.80832458e-01f, 9.80409324e-01f,
+        9.79981661e-01f, 9.79549468e-01f, 9.79112804e-01f, 9.78671551e-01f, 9.78225827e-01f, 9.77775633e-01f,
+        9.77320910e-01f, 9.76861656e-01f, 9.76397991e-01f, 9.75929737e-01f, 9.75457072e-01f, 9.74979877e-01f,
+        9.74498272e-01f, 9.74012136e-01f, 9.73521590e-01f, 9.73026514e-01f, 9.72527027e-01f, 9.72023070e-01f,
+        9.71514702e-01f, 9.71001863e-01f, 9.70484555e-01f, 9.69962835e-01f, 9.69436705e-01f, 9.68906164e-01f,
+        9.68371153e-01f, 9.67831790e-01f, 9.67287958e-01f, 9.66739774e-01f, 9.66187179e-01f, 9.65630174e-01f,
+        9.65068817e-01f, 9.64503050e-01f, 9.63932931e-01f, 9.63358402e-01f, 9.62779522e-01f, 9.62196290e-01f,
+        9.61608708e-01f, 9.61016774e-01f, 9.60420489e-01f, 9.59819853e-01f, 9.59214926e-01f, 9.58605647e-01f,
+        9.57992077e-01f, 9.57374156e-01f, 9.56751943e-01f, 9.56125379e-01f, 9.55494583e-01f, 9.54859436e-01f,
+        9.54220057e-01f, 9.53576386e-01f, 9.52928424e-01f, 9.52276230e-01f, 9.51619744e-01f, 9.50958967e-01f,
+        9.50294018e-01f, 9.49624777e-01f, 9.48951304e-01f, 9.48273599e-01f, 9.47591722e-01f, 9.46905553e-01f,
+        9.46215212e-01f, 9.45520699e-01f, 9.44821954e-01f, 9.44118977e-01f, 9.43411887e-01f, 9.42700565e-01f,
+        9.41985130e-01f, 9.41265464e-01f, 9.40541685e-01f, 9.39813733e-01f, 9.39081669e-01f, 9.38345432e-01f,
+        9.37605083e-01f, 9.36860621e-01f, 9.36111987e-01f, 9.35359299e-01f, 9.34602499e-01f, 9.33841646e-01f,
+        9.33076620e-01f, 9.32307541e-01f, 9.31534410e-01f, 9.30757225e-01f, 9.29975986e-01f, 9.29190636e-01f,
+        9.28401291e-01f, 9.27607894e-01f, 9.26810503e-01f, 9.26009059e-01f, 9.25203562e-01f, 9.24394131e-01f,
+        9.23580647e-01f, 9.22763228e-01f, 9.21941757e-01f, 9.21116352e-01f, 9.20287013e-01f, 9.19453681e-01f,
+        9.18616354e-01f, 9.17775154e-01f, 9.16929960e-01f, 9.16080892e-01f, 9.15227830e-01f, 9.14370954e-01f,
+        9.13510084e-01f, 9.12645340e-01f, 9.11776721e-01f, 9.10904229e-01f, 9.10027862e-01f, 9.09147680e-01f,
+        9.08263564e-01f, 9.07375634e-01f, 9.06483889e-01f, 9.05588269e-01f, 9.04688835e-01f, 9.03785586e-01f,
+        9.02878582e-01f, 9.01967704e-01f, 9.01053131e-01f, 9.00134683e-01f, 8.99212539e-01f, 8.98286581e-01f,
+        8.97356927e-01f, 8.96423519e-01f, 8.95486355e-01f, 8.94545436e-01f, 8.93600821e-01f, 8.92652512e-01f,
+        8.91700506e-01f, 8.90744805e-01f, 8.89785409e-01f, 8.88822377e-01f, 8.87855649e-01f, 8.86885285e-01f,
+        8.85911226e-01f, 8.84933591e-01f, 8.83952320e-01f, 8.82967412e-01f, 8.81978929e-01f, 8.80986810e-01f,
+        8.79991114e-01f, 8.78991842e-01f, 8.77988994e-01f, 8.76982570e-01f, 8.75972629e-01f, 8.74959111e-01f,
+        8.73942077e-01f, 8.72921526e-01f, 8.71897459e-01f, 8.70869875e-01f, 8.69838774e-01f, 8.68804216e-01f,
+        8.67766201e-01f, 8.66724730e-01f, 8.65679741e-01f, 8.64631355e-01f, 8.63579512e-01f, 8.62524271e-01f,
+        8.61465633e-01f, 8.60403538e-01f, 8.59338045e-01f, 8.58269215e-01f, 8.57196987e-01f, 8.56121361e-01f,
+        8.55042398e-01f, 8.53960097e-01f, 8.52874458e-01f, 8.51785541e-01f, 8.50693226e-01f, 8.49597692e-01f,
+        8.48498821e-01f, 8.47396672e-01f, 8.46291244e-01f, 8.45182538e-01f, 8.44070613e-01f, 8.42955410e-01f,
+        8.41836989e-01f, 8.40715349e-01f, 8.39590490e-01f, 8.38462472e-01f, 8.37331235e-01f, 8.36196840e-01f,
+        8.35059226e-01f, 8.33918512e-01f, 8.32774639e-01f, 8.31627607e-01f, 8.30477476e-01f, 8.29324186e-01f,
+        8.28167856e-01f, 8.27008367e-01f, 8.25845838e-01f, 8.24680269e-01f, 8.23511600e-01f, 8.22339892e-01f,
+        8.21165144e-01f, 8.19987357e-01f, 8.18806589e-01f, 8.17622781e-01f, 8.16435993e-01f, 8.15246224e-01f,
+        8.14053535e-01f, 8.12857807e-01f, 8.11659157e-01f, 8.10457587e-01f, 8.09253097e-01f, 8.08045685e-01f,
+        8.06835353e-01f, 8.05622160e-01f, 8.04406106e-01f, 8.03187132e-01f, 8.01965296e-01f, 8.00740659e-01f,
+        7.99513161e-01f, 7.98282862e-01f, 7.97049701e-01f, 7.95813799e-01f, 7.94575095e-01f, 7.93333590e-01f,
+        7.92089343e-01f, 7.90842354e-01f, 7.89592624e-01f, 7.88340151e-01f, 7.87084997e-01f, 7.85827100e-01f,
+        7.84566522e-01f, 7.83303261e-01f, 7.82037318e-01f, 7.80768692e-01f, 7.79497504e-01f, 7.78223634e-01f,
+        7.76947141e-01f, 7.75668025e-01f, 7.74386346e-01f, 7.73102045e-01f, 7.71815181e-01f, 7.70525753e-01f,
+        7.69233823e-01f, 7.67939329e-01f, 7.66642272e-01f, 7.65342772e-01f, 7.64040709e-01f, 7.62736201e-01f,
+        7.61429191e-01f, 7.60119736e-01f, 7.58807838e-01f, 7.57493436e-01f, 7.56176651e-01f, 7.54857481e-01f,
+        7.53535867e-01f, 7.52211928e-01f, 7.50885546e-01f, 7.49556839e-01f, 7.48225749e-01f, 7.46892333e-01f,
+        7.45556593e-01f, 7.44218528e-01f, 7.42878199e-01f, 7.41535544e-01f, 7.40190625e-01f, 7.38843441e-01f,
+        7.37494051e-01f, 7.36142397e-01f, 7.34788477e-01f, 7.33432353e-01f, 7.32074082e-01f, 7.30713606e-01f,
+        7.29350924e-01f, 7.27986097e-01f, 7.26619124e-01f, 7.25250006e-01f, 7.23878801e-01f, 7.22505450e-01f,
+        7.21130013e-01f, 7.19752491e-01f, 7.18372881e-01f, 7.16991246e-01f, 7.15607584e-01f, 7.14221835e-01f,
+        7.12834120e-01f, 7.11444378e-01f, 7.10052609e-01f, 7.08658874e-01f, 7.07263231e-01f, 7.05865562e-01f,
+        7.04465985e-01f, 7.03064501e-01f, 7.01661110e-01f, 7.00255752e-01f, 6.98848546e-01f, 6.97439492e-01f,
+        6.96028531e-01f, 6.94615781e-01f, 6.93201184e-01f, 6.91784739e-01f, 6.90366507e-01f, 6.88946426e-01f,
+        6.87524617e-01f, 6.86101019e-01f, 6.84675694e-01f, 6.83248639e-01f, 6.81819856e-01f, 6.80389285e-01f,
+        6.78957105e-01f, 6.77523196e-01f, 6.76087618e-01f, 6.74650371e-01f, 6.73211515e-01f, 6.71770990e-01f,
+        6.70328856e-01f, 6.68885112e-01f, 6.67439818e-01f, 6.65992916e-01f, 6.64544463e-01f, 6.63094401e-01f,
+        6.61642849e-01f, 6.60189807e-01f, 6.58735216e-01f, 6.57279134e-01f, 6.55821562e-01f, 6.54362500e-01f,
+        6.52902067e-01f, 6.51440144e-01f, 6.49976790e-01f, 6.48512006e-01f, 6.47045851e-01f, 6.45578265e-01f,
+        6.44109368e-01f, 6.42639101e-01f, 6.41167462e-01f, 6.39694512e-01f, 6.38220251e-01f, 6.36744678e-01f,
+        6.35267794e-01f, 6.33789659e-01f, 6.32310271e-01f, 6.30829632e-01f, 6.29347742e-01f, 6.27864659e-01f,
+        6.26380384e-01f, 6.24894857e-01f, 6.23408198e-01f, 6.21920407e-01f, 6.20431423e-01f, 6.18941307e-01f,
+        6.17450058e-01f, 6.15957737e-01f, 6.14464283e-01f, 6.12969756e-01f, 6.11474216e-01f, 6.09977603e-01f,
+        6.08479917e-01f, 6.06981218e-01f, 6.05481565e-01f, 6.03980839e-01f, 6.02479219e-01f, 6.00976586e-01f,
+        5.99473000e-01f, 5.97968459e-01f, 5.96463025e-01f, 5.94956696e-01f, 5.93449414e-01f, 5.91941297e-01f,
+        5.90432346e-01f, 5.88922501e-01f, 5.87411821e-01f, 5.85900307e-01f, 5.84387958e-01f, 5.82874894e-01f,
+        5.81360996e-01f, 5.79846323e-01f, 5.78330934e-01f, 5.76814771e-01f, 5.75297892e-01f, 5.73780298e-01f,
+        5.72262049e-01f, 5.70743084e-01f, 5.69223464e-01f, 5.67703187e-01f, 5.66182256e-01f, 5.64660728e-01f,
+        5.63138604e-01f, 5.61615884e-01f, 5.60092568e-01f, 5.58568656e-01f, 5.57044208e-01f, 5.55519223e-01f,
+        5.53993762e-01f, 5.52467763e-01f, 5.50941229e-01f, 5.49414277e-01f, 5.47886789e-01f, 5.46358883e-01f,
+        5.44830561e-01f, 5.43301821e-01f, 5.41772664e-01f, 5.40243089e-01f, 5.38713157e-01f, 5.37182868e-01f,
+        5.35652220e-01f, 5.34121215e-01f, 5.32589912e-01f, 5.31058252e-01f, 5.29526353e-01f, 5.27994156e-01f,
+        5.26461720e-01f, 5.24929047e-01f, 5.23396075e-01f, 5.21862924e-01f, 5.20329595e-01f, 5.18796027e-01f,
+        5.17262280e-01f, 5.15728414e-01f, 5.14194369e-01f, 5.12660146e-01f, 5.11125863e-01f, 5.09591460e-01f,
+        5.08056998e-01f, 5.06522417e-01f, 5.04987776e-01f, 5.03453135e-01f, 5.01918435e-01f, 5.00383675e-01f,
+        4.98848945e-01f, 4.97314245e-01f, 4.95779544e-01f, 4.94244903e-01f, 4.92710292e-01f, 4.91175771e-01f,
+        4.89641309e-01f, 4.88106966e-01f, 4.86572713e-01f, 4.85038608e-01f, 4.83504653e-01f, 4.81970817e-01f,
+        4.80437189e-01f, 4.78903711e-01f, 4.77370471e-01f, 4.75837409e-01f, 4.74304587e-01f, 4.72772002e-01f,
+        4.71239686e-01f, 4.69707638e-01f, 4.68175888e-01f, 4.66644406e-01f, 4.65113252e-01f, 4.63582426e-01f,
+        4.62051958e-01f, 4.60521847e-01f, 4.58992094e-01f, 4.57462728e-01f, 4.55933750e-01f, 4.54405218e-01f,
+        4.52877074e-01f, 4.51349407e-01f, 4.49822187e-01f, 4.48295444e-01f, 4.46769208e-01f, 4.45243448e-01f,
+        4.43718195e-01f, 4.42193508e-01f, 4.40669328e-01f, 4.39145714e-01f, 4.37622696e-01f, 4.36100245e-01f,
+        4.34578419e-01f, 4.33057189e-01f, 4.31536585e-01f, 4.30016637e-01f, 4.28497344e-01f, 4.26978737e-01f,
+        4.25460786e-01f, 4.23943579e-01f, 4.22427058e-01f, 4.20911282e-01f, 4.19396251e-01f, 4.17881966e-01f,
+        4.16368484e-01f, 4.14855748e-01f, 4.13343847e-01f, 4.11832750e-01f, 4.10322487e-01f, 4.08813089e-01f,
+        4.07304525e-01f, 4.05796826e-01f, 4.04290020e-01f, 4.02784139e-01f, 4.01279151e-01f, 3.99775088e-01f,
+        3.98272008e-01f, 3.96769851e-01f, 3.95268679e-01f, 3.93768489e-01f, 3.92269284e-01f, 3.90771121e-01f,
+        3.89273971e-01f, 3.87777865e-01f, 3.86282831e-01f, 3.84788871e-01f, 3.83295983e-01f, 3.81804198e-01f,
+        3.80313516e-01f, 3.78823966e-01f, 3.77335548e-01f, 3.75848323e-01f, 3.74362230e-01f, 3.72877330e-01f,
+        3.71393651e-01f, 3.69911164e-01f, 3.68429899e-01f, 3.66949886e-01f, 3.65471095e-01f, 3.63993615e-01f,
+        3.62517387e-01f, 3.61042470e-01f, 3.59568864e-01f, 3.58096570e-01f, 3.56625617e-01f, 3.55156004e-01f,
+        3.53687763e-01f, 3.52220923e-01f, 3.50755453e-01f, 3.49291384e-01f, 3.47828746e-01f, 3.46367538e-01f,
+        3.44907761e-01f, 3.43449473e-01f, 3.41992646e-01f, 3.40537310e-01f, 3.39083493e-01f, 3.37631166e-01f,
+        3.36180389e-01f, 3.34731132e-01f, 3.33283454e-01f, 3.31837326e-01f, 3.30392808e-01f, 3.28949869e-01f,
+        3.27508539e-01f, 3.26068848e-01f, 3.24630797e-01f, 3.23194385e-01f, 3.21759641e-01f, 3.20326596e-01f,
+        3.18895221e-01f, 3.17465544e-01f, 3.16037625e-01f, 3.14611405e-01f, 3.13186944e-01f, 3.11764240e-01f,
+        3.10343325e-01f, 3.08924168e-01f, 3.07506830e-01f, 3.06091309e-01f, 3.04677606e-01f, 3.03265750e-01f,
+        3.01855743e-01f, 3.00447583e-01f, 2.99041331e-01f, 2.97636956e-01f, 2.96234518e-01f, 2.94833958e-01f,
+        2.93435365e-01f, 2.92038709e-01f, 2.90643990e-01f, 2.89251268e-01f, 2.87860513e-01f, 2.86471784e-01f,
+        2.85085052e-01f, 2.83700347e-01f, 2.82317668e-01f, 2.80937046e-01f, 2.79558480e-01f, 2.78182000e-01f,
+        2.76807636e-01f, 2.75435328e-01f, 2.74065167e-01f, 2.72697121e-01f, 2.71331221e-01f, 2.69967467e-01f,
+        2.68605888e-01f, 2.67246515e-01f, 2.65889287e-01f, 2.64534295e-01f, 2.63181508e-01f, 2.61830956e-01f,
+        2.60482669e-01f, 2.59136617e-01f, 2.57792830e-01f, 2.56451339e-01f, 2.55112141e-01f, 2.53775239e-01f,
+        2.52440661e-01f, 2.51108408e-01f, 2.49778509e-01f, 2.48450965e-01f, 2.47125804e-01f, 2.45803013e-01f,
+        2.44482622e-01f, 2.43164629e-01f, 2.41849065e-01f, 2.40535930e-01f, 2.39225239e-01f, 2.37917006e-01f,
+        2.36611232e-01f, 2.35307962e-01f, 2.34007165e-01f, 2.32708886e-01f, 2.31413126e-01f, 2.30119884e-01f,
+        2.28829190e-01f, 2.27541059e-01f, 2.26255491e-01f, 2.24972501e-01f, 2.23692104e-01f, 2.22414300e-01f,
+        2.21139118e-01f, 2.19866574e-01f, 2.18596652e-01f, 2.17329398e-01f, 2.16064796e-01f, 2.14802861e-01f,
+        2.13543624e-01f, 2.12287098e-01f, 2.11033270e-01f, 2.09782153e-01f, 2.08533794e-01f, 2.07288161e-01f,
+        2.06045300e-01f, 2.04805195e-01f, 2.03567877e-01f, 2.02333361e-01f, 2.01101646e-01f, 1.99872732e-01f,
+        1.98646665e-01f, 1.97423428e-01f, 1.96203038e-01f, 1.94985524e-01f, 1.93770871e-01f, 1.92559108e-01f,
+        1.91350237e-01f, 1.90144271e-01f, 1.88941240e-01f, 1.87741131e-01f, 1.86543956e-01f, 1.85349748e-01f,
+        1.84158489e-01f, 1.82970226e-01f, 1.81784928e-01f, 1.80602640e-01f, 1.79423362e-01f, 1.78247109e-01f,
+        1.77073881e-01f, 1.75903693e-01f, 1.74736559e-01f, 1.73572496e-01f, 1.72411501e-01f, 1.71253592e-01f,
+        1.70098782e-01f, 1.68947086e-01f, 1.67798504e-01f, 1.66653052e-01f, 1.65510744e-01f, 1.64371580e-01f,
+        1.63235575e-01f, 1.62102759e-01f, 1.60973117e-01f, 1.59846663e-01f, 1.58723429e-01f, 1.57603398e-01f,
+        1.56486601e-01f, 1.55373037e-01f, 1.54262722e-01f, 1.53155655e-01f, 1.52051866e-01f, 1.50951356e-01f,
+        1.49854124e-01f, 1.48760200e-01f, 1.47669584e-01f, 1.46582291e-01f, 1.45498320e-01f, 1.44417688e-01f,
+        1.43340409e-01f, 1.42266497e-01f, 1.41195953e-01f, 1.40128776e-01f, 1.39065012e-01f, 1.38004631e-01f,
+        1.36947662e-01f, 1.35894120e-01f, 1.34844005e-01f, 1.33797333e-01f, 1.32754117e-01f, 1.31714344e-01f,
+        1.30678058e-01f, 1.29645243e-01f, 1.28615916e-01f, 1.27590090e-01f, 1.26567781e-01f, 1.25548974e-01f,
+        1.24533705e-01f, 1.23521976e-01f, 1.22513786e-01f, 1.21509157e-01f, 1.20508097e-01f, 1.19510606e-01f,
+        1.18516706e-01f, 1.17526397e-01f, 1.16539687e-01f, 1.15556598e-01f, 1.14577122e-01f, 1.13601282e-01f,
+        1.12629086e-01f, 1.11660540e-01f, 1.10695645e-01f, 1.09734423e-01f, 1.08776875e-01f, 1.07823014e-01f,
+        1.06872857e-01f, 1.05926394e-01f, 1.04983643e-01f, 1.04044616e-01f, 1.03109322e-01f, 1.02177761e-01f,
+        1.01249956e-01f, 1.00325905e-01f, 9.94056165e-02f, 9.84891057e-02f, 9.75763798e-02f, 9.66674387e-02f,
+        9.57623050e-02f, 9.48609710e-02f, 9.39634591e-02f, 9.30697769e-02f, 9.21799242e-02f, 9.12939087e-02f,
+        9.04117525e-02f, 8.95334482e-02f, 8.86590183e-02f, 8.77884626e-02f, 8.69217888e-02f, 8.60590041e-02f,
+        8.52001235e-02f, 8.43451470e-02f, 8.34940895e-02f, 8.26469585e-02f, 8.18037540e-02f, 8.09644908e-02f,
+        8.01291764e-02f, 7.92978182e-02f, 7.84704238e-02f, 7.76470006e-02f, 7.68275559e-02f, 7.60121047e-02f,
+        7.52006397e-02f, 7.43931830e-02f, 7.35897273e-02f, 7.27902949e-02f, 7.19948933e-02f, 7.12035149e-02f,
+        7.04161823e-02f, 6.96328953e-02f, 6.88536614e-02f, 6.80784881e-02f, 6.73073903e-02f, 6.65403605e-02f,
+        6.57774210e-02f, 6.50185719e-02f, 6.42638206e-02f, 6.35131747e-02f, 6.27666414e-02f, 6.20242245e-02f,
+        6.12859391e-02f, 6.05517812e-02f, 5.98217696e-02f, 5.90959005e-02f, 5.83741888e-02f, 5.76566346e-02f,
+        5.69432527e-02f, 5.62340394e-02f, 5.55290096e-02f, 5.48281707e-02f, 5.41315228e-02f, 5.34390733e-02f,
+        5.27508333e-02f, 5.20668104e-02f, 5.13870046e-02f, 5.07114232e-02f, 5.00400774e-02f, 4.93729711e-02f,
+        4.87101115e-02f, 4.80515026e-02f, 4.73971516e-02f, 4.67470624e-02f, 4.61012460e-02f, 4.54597063e-02f,
+        4.48224507e-02f, 4.41894792e-02f, 4.35608067e-02f, 4.29364331e-02f, 4.23163660e-02f, 4.17006090e-02f,
+        4.10891697e-02f, 4.04820554e-02f, 3.98792699e-02f, 3.92808206e-02f, 3.86867113e-02f, 3.80969495e-02f,
+        3.75115387e-02f, 3.69304866e-02f, 3.63537930e-02f, 3.57814729e-02f, 3.52135226e-02f, 3.46499532e-02f,
+        3.40907685e-02f, 3.35359722e-02f, 3.29855718e-02f, 3.24395709e-02f, 3.18979733e-02f, 3.13607901e-02f,
+        3.08280177e-02f, 3.02996691e-02f, 2.97757443e-02f, 2.92562488e-02f, 2.87411902e-02f, 2.82305703e-02f,
+        2.77243964e-02f, 2.72226725e-02f, 2.67254021e-02f, 2.62325890e-02f, 2.57442426e-02f, 2.52603628e-02f,
+        2.47809552e-02f, 2.43060254e-02f, 2.38355789e-02f, 2.33696178e-02f, 2.29081456e-02f, 2.24511698e-02f,
+        2.19986942e-02f, 2.15507206e-02f, 2.11072545e-02f, 2.06683017e-02f, 2.02338640e-02f, 1.98039468e-02f,
+        1.93785541e-02f, 1.89576894e-02f, 1.85413565e-02f, 1.81295592e-02f, 1.77223030e-02f, 1.73195899e-02f,
+        1.69214252e-02f, 1.65278111e-02f, 1.61387529e-02f, 1.57542527e-02f, 1.53743150e-02f, 1.49989435e-02f,
+        1.46281412e-02f, 1.42619126e-02f, 1.39002595e-02f, 1.35431867e-02f, 1.31906969e-02f, 1.28427930e-02f,
+        1.24994796e-02f, 1.21607594e-02f, 1.18266353e-02f, 1.14971101e-02f, 1.11721884e-02f, 1.08518712e-02f,
+        1.05361631e-02f, 1.02250660e-02f, 9.91858356e-03f, 9.61671863e-03f, 9.31947399e-03f, 9.02685244e-03f,
+        8.73885583e-03f, 8.45548790e-03f, 8.17675143e-03f, 7.90264923e-03f, 7.63318269e-03f, 7.36835506e-03f,
+        7.10816868e-03f, 6.85262633e-03f, 6.60173036e-03f, 6.35548262e-03f, 6.11388590e-03f, 5.87694254e-03f,
+        5.64465486e-03f, 5.41702425e-03f, 5.19405352e-03f, 4.97574452e-03f, 4.76210006e-03f, 4.55312105e-03f,
+        4.34880983e-03f, 4.14916826e-03f, 3.95419914e-03f, 3.76390293e-03f, 3.57828219e-03f, 3.39733856e-03f,
+        3.22107365e-03f, 3.04948934e-03f, 2.88258679e-03f, 2.72036809e-03f, 2.56283465e-03f, 2.40998762e-03f,
+        2.26182886e-03f, 2.11835955e-03f, 1.97958108e-03f, 1.84549461e-03f, 1.71610166e-03f, 1.59140327e-03f,
+        1.47140073e-03f, 1.35609508e-03f, 1.24548748e-03f, 1.13957888e-03f, 1.03837030e-03f, 9.41862818e-04f,
+        8.50057229e-04f, 7.62954412e-04f, 6.80555182e-04f, 6.02860353e-04f, 5.29870624e-04f, 4.61586722e-04f,
+        3.98009230e-04f, 3.39138787e-04f, 2.84975918e-04f, 2.35521176e-04f, 1.90774997e-04f, 1.50737818e-04f,
+        1.15409995e-04f, 8.47918855e-05f, 5.88837611e-05f, 3.76858734e-05f, 2.11984207e-05f, 9.42155748e-06f,
+        2.35539483e-06f, 0.00000000e+00f
+    };
+    static const float cbwindow2048live[2048] = {
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 3.07686287e-06f, 1.23074133e-05f, 2.76915380e-05f,
+        4.92290455e-05f, 7.69196777e-05f, 1.10763081e-04f, 1.50758860e-04f, 1.96906491e-04f, 2.49205448e-04f,
+        3.07655049e-04f, 3.72254581e-04f, 4.43003257e-04f, 5.19900233e-04f, 6.02944521e-04f, 6.92135072e-04f,
+        7.87470897e-04f, 8.88950715e-04f, 9.96573362e-04f, 1.11033744e-03f, 1.23024150e-03f, 1.35628425e-03f,
+        1.48846407e-03f, 1.62677921e-03f, 1.77122804e-03f, 1.92180881e-03f, 2.07851967e-03f, 2.24135863e-03f,
+        2.41032382e-03f, 2.58541317e-03f, 2.76662409e-03f, 2.95395497e-03f, 3.14740301e-03f, 3.34696635e-03f,
+        3.55264195e-03f, 3.76442773e-03f, 3.98232089e-03f, 4.20631841e-03f, 4.43641841e-03f, 4.67261719e-03f,
+        4.91491240e-03f, 5.16330032e-03f, 5.41777909e-03f, 5.67834452e-03f, 5.94499381e-03f, 6.21772371e-03f,
+        6.49653096e-03f, 6.78141182e-03f, 7.07236305e-03f, 7.36938091e-03f, 7.67246215e-03f, 7.98160210e-03f,
+        8.29679798e-03f, 8.61804467e-03f, 8.94534029e-03f, 9.27867834e-03f, 9.61805694e-03f, 9.96347051e-03f,
+        1.03149144e-02f, 1.06723858e-02f, 1.10358801e-02f, 1.14053916e-02f, 1.17809167e-02f, 1.21624498e-02f,
+        1.25499880e-02f, 1.29435249e-02f, 1.33430567e-02f, 1.37485769e-02f, 1.41600827e-02f, 1.45775676e-02f,
+        1.50010269e-02f, 1.54304551e-02f, 1.58658475e-02f, 1.63071975e-02f, 1.67545024e-02f, 1.72077529e-02f,
+        1.76669452e-02f, 1.81320757e-02f, 1.86031349e-02f, 1.90801192e-02f, 1.95630230e-02f, 2.00518407e-02f,
+        2.05465630e-02f, 2.10471880e-02f, 2.15537064e-02f, 2.20661145e-02f, 2.25844048e-02f, 2.31085699e-02f,
+        2.36386042e-02f, 2.41745021e-02f, 2.47162562e-02f, 2.52638590e-02f, 2.58173048e-02f, 2.63765864e-02f,
+        2.69416980e-02f, 2.75126304e-02f, 2.80893799e-02f, 2.86719352e-02f, 2.92602926e-02f, 2.98544448e-02f,
+        3.04543804e-02f, 3.10600977e-02f, 3.16715837e-02f, 3.22888345e-02f, 3.29118446e-02f, 3.35405990e-02f,
+        3.41750979e-02f, 3.48153263e-02f, 3.54612842e-02f, 3.61129567e-02f, 3.67703401e-02f, 3.74334231e-02f,
+        3.81021984e-02f, 3.87766585e-02f, 3.94567996e-02f, 4.01426032e-02f, 4.08340693e-02f, 4.15311866e-02f,
+        4.22339439e-02f, 4.29423377e-02f, 4.36563566e-02f, 4.43759933e-02f, 4.51012328e-02f, 4.58320752e-02f,
+        4.65685055e-02f, 4.73105162e-02f, 4.80581000e-02f, 4.88112457e-02f, 4.95699421e-02f, 5.03341854e-02f,
+        5.11039607e-02f, 5.18792607e-02f, 5.26600778e-02f, 5.34463972e-02f, 5.42382151e-02f, 5.50355203e-02f,
+        5.58382981e-02f, 5.66465445e-02f, 5.74602485e-02f, 5.82793988e-02f, 5.91039844e-02f, 5.99339977e-02f,
+        6.07694238e-02f, 6.16102591e-02f, 6.24564886e-02f, 6.33081049e-02f, 6.41650930e-02f, 6.50274456e-02f,
+        6.58951551e-02f, 6.67681992e-02f, 6.76465854e-02f, 6.85302839e-02f, 6.94193020e-02f, 7.03136101e-02f,
+        7.12132081e-02f, 7.21180886e-02f, 7.30282366e-02f, 7.39436299e-02f, 7.48642758e-02f, 7.57901520e-02f,
+        7.67212436e-02f, 7.76575506e-02f, 7.85990581e-02f, 7.95457438e-02f, 8.04976076e-02f, 8.14546347e-02f,
+        8.24168175e-02f, 8.33841339e-02f, 8.43565762e-02f, 8.53341371e-02f, 8.63168016e-02f, 8.73045623e-02f,
+        8.82973969e-02f, 8.92952979e-02f, 9.02982503e-02f, 9.13062543e-02f, 9.23192799e-02f, 9.33373272e-02f,
+        9.43603814e-02f, 9.53884274e-02f, 9.64214504e-02f, 9.74594355e-02f, 9.85023826e-02f, 9.95502695e-02f,
+        1.00603089e-01f, 1.01660818e-01f, 1.02723449e-01f, 1.03790969e-01f, 1.04863368e-01f, 1.05940633e-01f,
+        1.07022747e-01f, 1.08109690e-01f, 1.09201461e-01f, 1.10298045e-01f, 1.11399427e-01f, 1.12505585e-01f,
+        1.13616511e-01f, 1.14732198e-01f, 1.15852624e-01f, 1.16977781e-01f, 1.18107647e-01f, 1.19242214e-01f,
+        1.20381467e-01f, 1.21525399e-01f, 1.22673981e-01f, 1.23827212e-01f, 1.24985069e-01f, 1.26147538e-01f,
+        1.27314612e-01f, 1.28486276e-01f, 1.29662514e-01f, 1.30843312e-01f, 1.32028639e-01f, 1.33218512e-01f,
+        1.34412885e-01f, 1.35611758e-01f, 1.36815131e-01f, 1.38022959e-01f, 1.39235243e-01f, 1.40451968e-01f,
+        1.41673118e-01f, 1.42898694e-01f, 1.44128650e-01f, 1.45362988e-01f, 1.46601692e-01f, 1.47844732e-01f,
+        1.49092123e-01f, 1.50343820e-01f, 1.51599839e-01f, 1.52860135e-01f, 1.54124707e-01f, 1.55393526e-01f,
+        1.56666592e-01f, 1.57943889e-01f, 1.59225389e-01f, 1.60511076e-01f, 1.61800951e-01f, 1.63094997e-01f,
+        1.64393172e-01f, 1.65695488e-01f, 1.67001918e-01f, 1.68312445e-01f, 1.69627056e-01f, 1.70945734e-01f,
+        1.72268450e-01f, 1.73595205e-01f, 1.74925983e-01f, 1.76260754e-01f, 1.77599519e-01f, 1.78942248e-01f,
+        1.80288926e-01f, 1.81639537e-01f, 1.82994083e-01f, 1.84352502e-01f, 1.85714826e-01f, 1.87081009e-01f,
+        1.88451052e-01f, 1.89824924e-01f, 1.91202611e-01f, 1.92584112e-01f, 1.93969384e-01f, 1.95358425e-01f,
+        1.96751207e-01f, 1.98147729e-01f, 1.99547976e-01f, 2.00951904e-01f, 2.02359527e-01f, 2.03770801e-01f,
+        2.05185726e-01f, 2.06604272e-01f, 2.08026439e-01f, 2.09452197e-01f, 2.10881531e-01f, 2.12314427e-01f,
+        2.13750854e-01f, 2.15190813e-01f, 2.16634274e-01f, 2.18081221e-01f, 2.19531640e-01f, 2.20985502e-01f,
+        2.22442806e-01f, 2.23903537e-01f, 2.25367650e-01f, 2.26835147e-01f, 2.28306010e-01f, 2.29780212e-01f,
+        2.31257737e-01f, 2.32738584e-01f, 2.34222710e-01f, 2.35710099e-01f, 2.37200752e-01f, 2.38694638e-01f,
+        2.40191728e-01f, 2.41692036e-01f, 2.43195504e-01f, 2.44702145e-01f, 2.46211931e-01f, 2.47724831e-01f,
+        2.49240831e-01f, 2.50759929e-01f, 2.52282083e-01f, 2.53807306e-01f, 2.55335540e-01f, 2.56866783e-01f,
+        2.58401036e-01f, 2.59938270e-01f, 2.61478424e-01f, 2.63021529e-01f, 2.64567554e-01f, 2.66116470e-01f,
+        2.67668277e-01f, 2.69222945e-01f, 2.70780444e-01f, 2.72340775e-01f, 2.73903877e-01f, 2.75469780e-01f,
+        2.77038455e-01f, 2.78609872e-01f, 2.80184001e-01f, 2.81760842e-01f, 2.83340394e-01f, 2.84922570e-01f,
+        2.86507428e-01f, 2.88094908e-01f, 2.89684981e-01f, 2.91277647e-01f, 2.92872876e-01f, 2.94470668e-01f,
+        2.96070963e-01f, 2.97673792e-01f, 2.99279124e-01f, 3.00886899e-01f, 3.02497119e-01f, 3.04109812e-01f,
+        3.05724889e-01f, 3.07342350e-01f, 3.08962196e-01f, 3.10584366e-01f, 3.12208891e-01f, 3.13835740e-01f,
+        3.15464854e-01f, 3.17096233e-01f, 3.18729907e-01f, 3.20365757e-01f, 3.22003871e-01f, 3.23644131e-01f,
+        3.25286597e-01f, 3.26931179e-01f, 3.28577906e-01f, 3.30226749e-01f, 3.31877679e-01f, 3.33530694e-01f,
+        3.35185736e-01f, 3.36842805e-01f, 3.38501900e-01f, 3.40162963e-01f, 3.41825992e-01f, 3.43490988e-01f,
+        3.45157892e-01f, 3.46826702e-01f, 3.48497421e-01f, 3.50169986e-01f, 3.51844400e-01f, 3.53520632e-01f,
+        3.55198652e-01f, 3.56878489e-01f, 3.58560055e-01f, 3.60243380e-01f, 3.61928433e-01f, 3.63615155e-01f,
+        3.65303576e-01f, 3.66993666e-01f, 3.68685365e-01f, 3.70378703e-01f, 3.72073621e-01f, 3.73770118e-01f,
+        3.75468165e-01f, 3.77167761e-01f, 3.78868848e-01f, 3.80571455e-01f, 3.82275492e-01f, 3.83981019e-01f,
+        3.85687947e-01f, 3.87396306e-01f, 3.89106005e-01f, 3.90817106e-01f, 3.92529547e-01f, 3.94243300e-01f,
+        3.95958364e-01f, 3.97674710e-01f, 3.99392307e-01f, 4.01111156e-01f, 4.02831197e-01f, 4.04552460e-01f,
+        4.06274885e-01f, 4.07998472e-01f, 4.09723163e-01f, 4.11448985e-01f, 4.13175911e-01f, 4.14903879e-01f,
+        4.16632921e-01f, 4.18362975e-01f, 4.20094043e-01f, 4.21826094e-01f, 4.23559099e-01f, 4.25293028e-01f,
+        4.27027911e-01f, 4.28763658e-01f, 4.30500299e-01f, 4.32237804e-01f, 4.33976114e-01f, 4.35715258e-01f,
+        4.37455207e-01f, 4.39195901e-01f, 4.40937370e-01f, 4.42679524e-01f, 4.44422424e-01f, 4.46165979e-01f,
+        4.47910219e-01f, 4.49655086e-01f, 4.51400578e-01f, 4.53146666e-01f, 4.54893351e-01f, 4.56640571e-01f,
+        4.58388329e-01f, 4.60136592e-01f, 4.61885333e-01f, 4.63634580e-01f, 4.65384245e-01f, 4.67134356e-01f,
+        4.68884856e-01f, 4.70635742e-01f, 4.72386986e-01f, 4.74138588e-01f, 4.75890487e-01f, 4.77642685e-01f,
+        4.79395151e-01f, 4.81147885e-01f, 4.82900858e-01f, 4.84654039e-01f, 4.86407399e-01f, 4.88160938e-01f,
+        4.89914596e-01f, 4.91668403e-01f, 4.93422329e-01f, 4.95176315e-01f, 4.96930331e-01f, 4.98684436e-01f,
+        5.00438511e-01f, 5.02192616e-01f, 5.03946662e-01f, 5.05700707e-01f, 5.07454634e-01f, 5.09208500e-01f,
+        5.10962248e-01f, 5.12715876e-01f, 5.14469326e-01f, 5.16222596e-01f, 5.17975628e-01f, 5.19728482e-01f,
+        5.21481097e-01f, 5.23233473e-01f, 5.24985492e-01f, 5.26737273e-01f, 5.28488696e-01f, 5.30239761e-01f,
+        5.31990469e-01f, 5.33740759e-01f, 5.35490632e-01f, 5.37240088e-01f, 5.38989127e-01f, 5.40737629e-01f,
+        5.42485654e-01f, 5.44233143e-01f, 5.45980036e-01f, 5.47726452e-01f, 5.49472213e-01f, 5.51217437e-01f,
+        5.52962005e-01f, 5.54705858e-01f, 5.56449115e-01f, 5.58191657e-01f, 5.59933484e-01f, 5.61674535e-01f,
+        5.63414872e-01f, 5.65154374e-01f, 5.66893160e-01f, 5.68631053e-01f, 5.70368111e-01f, 5.72104335e-01f,
+        5.73839664e-01f, 5.75574040e-01f, 5.77307522e-01f, 5.79040051e-01f, 5.80771625e-01f, 5.82502186e-01f,
+        5.84231734e-01f, 5.85960209e-01f, 5.87687671e-01f, 5.89414060e-01f, 5.91139317e-01f, 5.92863500e-01f,
+        5.94586492e-01f, 5.96308291e-01f, 5.98028958e-01f, 5.99748433e-01f, 6.01466656e-01f, 6.03183627e-01f,
+        6.04899347e-01f, 6.06613755e-01f, 6.08326852e-01f, 6.10038579e-01f, 6.11748993e-01f, 6.13458037e-01f,
+        6.15165710e-01f, 6.16871893e-01f, 6.18576705e-01f, 6.20280027e-01f, 6.21981859e-01f, 6.23682201e-01f,
+        6.25381052e-01f, 6.27078295e-01f, 6.28774047e-01f, 6.30468190e-01f, 6.32160664e-01f, 6.33851588e-01f,
+        6.35540843e-01f, 6.37228429e-01f, 6.38914287e-01f, 6.40598476e-01f, 6.42280936e-01f, 6.43961668e-01f,
+        6.45640612e-01f, 6.47317708e-01f, 6.48993075e-01f, 6.50666535e-01f, 6.52338147e-01f, 6.54007912e-01f,
+        6.55675828e-01f, 6.57341778e-01f, 6.59005761e-01f, 6.60667837e-01f, 6.62327886e-01f, 6.63985968e-01f,
+        6.65642023e-01f, 6.67296052e-01f, 6.68948054e-01f, 6.70597911e-01f, 6.72245741e-01f, 6.73891366e-01f,
+        6.75534904e-01f, 6.77176297e-01f, 6.78815484e-01f, 6.80452466e-01f, 6.82087183e-01f, 6.83719754e-01f,
+        6.85350001e-01f, 6.86977983e-01f, 6.88603640e-01f, 6.90227032e-01f, 6.91848040e-01f, 6.93466663e-01f,
+        6.95082963e-01f, 6.96696818e-01f, 6.98308289e-01f, 6.99917316e-01f, 7.01523840e-01f, 7.03127921e-01f,
+        7.04729497e-01f, 7.06328571e-01f, 7.07925081e-01f, 7.09519029e-01f, 7.11110413e-01f, 7.12699175e-01f,
+        7.14285314e-01f, 7.15868831e-01f, 7.17449725e-01f, 7.19027877e-01f, 7.20603406e-01f, 7.22176194e-01f,
+        7.23746240e-01f, 7.25313485e-01f, 7.26878047e-01f, 7.28439748e-01f, 7.29998648e-01f, 7.31554747e-01f,
+        7.33107984e-01f, 7.34658360e-01f, 7.36205816e-01f, 7.37750411e-01f, 7.39292026e-01f, 7.40830719e-01f,
+        7.42366433e-01f, 7.43899226e-01f, 7.45428979e-01f, 7.46955693e-01f, 7.48479366e-01f, 7.50000000e-01f,
+        7.51517534e-01f, 7.53032029e-01f, 7.54543364e-01f, 7.56051540e-01f, 7.57556617e-01f, 7.59058535e-01f,
+        7.60557234e-01f, 7.62052715e-01f, 7.63544977e-01f, 7.65034020e-01f, 7.66519785e-01f, 7.68002272e-01f,
+        7.69481421e-01f, 7.70957291e-01f, 7.72429824e-01f, 7.73899019e-01f, 7.75364816e-01f, 7.76827276e-01f,
+        7.78286278e-01f, 7.79741883e-01f, 7.81194031e-01f, 7.82642663e-01f, 7.84087896e-01f, 7.85529613e-01f,
+        7.86967814e-01f, 7.88402438e-01f, 7.89833605e-01f, 7.91261137e-01f, 7.92685091e-01f, 7.94105470e-01f,
+        7.95522213e-01f, 7.96935320e-01f, 7.98344731e-01f, 7.99750507e-01f, 8.01152587e-01f, 8.02550972e-01f,
+        8.03945661e-01f, 8.05336595e-01f, 8.06723714e-01f, 8.08107138e-01f, 8.09486687e-01f, 8.10862482e-01f,
+        8.12234461e-01f, 8.13602567e-01f, 8.14966798e-01f, 8.16327214e-01f, 8.17683697e-01f, 8.19036245e-01f,
+        8.20384920e-01f, 8.21729600e-01f, 8.23070347e-01f, 8.24407101e-01f, 8.25739920e-01f, 8.27068686e-01f,
+        8.28393400e-01f, 8.29714119e-01f, 8.31030786e-01f, 8.32343340e-01f, 8.33651781e-01f, 8.34956169e-01f,
+        8.36256444e-01f, 8.37552547e-01f, 8.38844478e-01f, 8.40132296e-01f, 8.41415882e-01f, 8.42695296e-01f,
+        8.43970478e-01f, 8.45241427e-01f, 8.46508145e-01f, 8.47770572e-01f, 8.49028707e-01f, 8.50282550e-01f,
+        8.51532102e-01f, 8.52777302e-01f, 8.54018211e-01f, 8.55254710e-01f, 8.56486857e-01f, 8.57714653e-01f,
+        8.58937979e-01f, 8.60156953e-01f, 8.61371458e-01f, 8.62581491e-01f, 8.63787115e-01f, 8.64988267e-01f,
+        8.66184890e-01f, 8.67376983e-01f, 8.68564606e-01f, 8.69747639e-01f, 8.70926201e-01f, 8.72100115e-01f,
+        8.73269498e-01f, 8.74434292e-01f, 8.75594437e-01f, 8.76749992e-01f, 8.77900898e-01f, 8.79047155e-01f,
+        8.80188763e-01f, 8.81325662e-01f, 8.82457852e-01f, 8.83585393e-01f, 8.84708166e-01f, 8.85826230e-01f,
+        8.86939526e-01f, 8.88048112e-01f, 8.89151871e-01f, 8.90250862e-01f, 8.91345024e-01f, 8.92434359e-01f,
+        8.93518925e-01f, 8.94598603e-01f, 8.95673454e-01f, 8.96743417e-01f, 8.97808492e-01f, 8.98868680e-01f,
+        8.99923921e-01f, 9.00974274e-01f, 9.02019680e-01f, 9.03060198e-01f, 9.04095709e-01f, 9.05126214e-01f,
+        9.06151772e-01f, 9.07172322e-01f, 9.08187866e-01f, 9.09198403e-01f, 9.10203874e-01f, 9.11204278e-01f,
+        9.12199676e-01f, 9.13189948e-01f, 9.14175153e-01f, 9.15155292e-01f, 9.16130304e-01f, 9.17100191e-01f,
+        9.18064892e-01f, 9.19024527e-01f, 9.19978976e-01f, 9.20928240e-01f, 9.21872318e-01f, 9.22811270e-01f,
+        9.23744977e-01f, 9.24673438e-01f, 9.25596714e-01f, 9.26514745e-01f, 9.27427471e-01f, 9.28335011e-01f,
+        9.29237247e-01f, 9.30134177e-01f, 9.31025863e-01f, 9.31912243e-01f, 9.32793260e-01f, 9.33668971e-01f,
+        9.34539378e-01f, 9.35404420e-01f, 9.36264098e-01f, 9.37118351e-01f, 9.37967300e-01f, 9.38810825e-01f,
+        9.39648986e-01f, 9.40481663e-01f, 9.41308975e-01f, 9.42130864e-01f, 9.42947268e-01f, 9.43758249e-01f,
+        9.44563746e-01f, 9.45363820e-01f, 9.46158409e-01f, 9.46947455e-01f, 9.47731018e-01f, 9.48509097e-01f,
+        9.49281633e-01f, 9.50048625e-01f, 9.50810075e-01f, 9.51566041e-01f, 9.52316403e-01f, 9.53061163e-01f,
+        9.53800380e-01f, 9.54534054e-01f, 9.55262065e-01f, 9.55984533e-01f, 9.56701338e-01f, 9.57412541e-01f,
+        9.58118141e-01f, 9.58818078e-01f, 9.59512353e-01f, 9.60201025e-01f, 9.60883975e-01f, 9.61561263e-01f,
+        9.62232888e-01f, 9.62898850e-01f, 9.63559091e-01f, 9.64213610e-01f, 9.64862406e-01f, 9.65505481e-01f,
+        9.66142893e-01f, 9.66774523e-01f, 9.67400372e-01f, 9.68020499e-01f, 9.68634903e-01f, 9.69243467e-01f,
+        9.69846308e-01f, 9.70443368e-01f, 9.71034586e-01f, 9.71620083e-01f, 9.72199738e-01f, 9.72773552e-01f,
+        9.73341584e-01f, 9.73903775e-01f, 9.74460125e-01f, 9.75010693e-01f, 9.75555360e-01f, 9.76094186e-01f,
+        9.76627171e-01f, 9.77154255e-01f, 9.77675498e-01f, 9.78190839e-01f, 9.78700280e-01f, 9.79203880e-01f,
+        9.79701519e-01f, 9.80193317e-01f, 9.80679154e-01f, 9.81159091e-01f, 9.81633127e-01f, 9.82101202e-01f,
+        9.82563376e-01f, 9.83019590e-01f, 9.83469903e-01f, 9.83914196e-01f, 9.84352589e-01f, 9.84785020e-01f,
+        9.85211432e-01f, 9.85631943e-01f, 9.86046433e-01f, 9.86454904e-01f, 9.86857474e-01f, 9.87253964e-01f,
+        9.87644553e-01f, 9.88029063e-01f, 9.88407612e-01f, 9.88780141e-01f, 9.89146590e-01f, 9.89507079e-01f,
+        9.89861548e-01f, 9.90209997e-01f, 9.90552366e-01f, 9.90888774e-01f, 9.91219044e-01f, 9.91543353e-01f,
+        9.91861582e-01f, 9.92173731e-01f, 9.92479861e-01f, 9.92779911e-01f, 9.93073881e-01f, 9.93361771e-01f,
+        9.93643641e-01f, 9.93919373e-01f, 9.94189084e-01f, 9.94452715e-01f, 9.94710207e-01f, 9.94961679e-01f,
+        9.95207012e-01f, 9.95446265e-01f, 9.95679379e-01f, 9.95906472e-01f, 9.96127367e-01f, 9.96342242e-01f,
+        9.96550977e-01f, 9.96753573e-01f, 9.96950090e-01f, 9.97140467e-01f, 9.97324765e-01f, 9.97502923e-01f,
+        9.97674942e-01f, 9.97840822e-01f, 9.98000622e-01f, 9.98154223e-01f, 9.98301744e-01f, 9.98443127e-01f,
+        9.98578370e-01f, 9.98707533e-01f, 9.98830497e-01f, 9.98947322e-01f, 9.99058008e-01f, 9.99162555e-01f,
+        9.99260962e-01f, 9.99353230e-01f, 9.99439359e-01f, 9.99519289e-01f, 9.99593139e-01f, 9.99660790e-01f,
+        9.99722362e-01f, 9.99777734e-01f, 9.99826908e-01f, 9.99870002e-01f, 9.99906957e-01f, 9.99937713e-01f,
+        9.99962330e-01f, 9.99980748e-01f, 9.99993086e-01f, 9.99999225e-01f, 9.99999225e-01f, 9.99993086e-01f,
+        9.99980748e-01f, 9.99962330e-01f, 9.99937713e-01f, 9.99906957e-01f, 9.99870002e-01f, 9.99826908e-01f,
+        9.99777734e-01f, 9.99722362e-01f, 9.99660790e-01f, 9.99593139e-01f, 9.99519289e-01f, 9.99439359e-01f,
+        9.99353230e-01f, 9.99260962e-01f, 9.99162555e-01f, 9.99058008e-01f, 9.98947322e-01f, 9.98830497e-01f,
+        9.98707533e-01f, 9.98578370e-01f, 9.98443127e-01f, 9.98301744e-01f, 9.98154223e-01f, 9.98000622e-01f,
+        9.97840822e-01f, 9.97674942e-01f, 9.97502923e-01f, 9.97324765e-01f, 9.97140467e-01f, 9.96950090e-01f,
+        9.96753573e-01f, 9.96550977e-01f, 9.96342242e-01f, 9.96127367e-01f, 9.95906472e-01f, 9.95679379e-01f,
+        9.95446265e-01f, 9.95207012e-01f, 9.94961679e-01f, 9.94710207e-01f, 9.94452715e-01f, 9.94189084e-01f,
+        9.93919373e-01f, 9.93643641e-01f, 9.93361771e-01f, 9.93073881e-01f, 9.92779911e-01f, 9.92479861e-01f,
+        9.92173731e-01f, 9.91861582e-01f, 9.91543353e-01f, 9.91219044e-01f, 9.90888774e-01f, 9.90552366e-01f,
+        9.90209997e-01f, 9.89861548e-01f, 9.89507079e-01f, 9.89146590e-01f, 9.88780141e-01f, 9.88407612e-01f,
+        9.88029063e-01f, 9.87644553e-01f, 9.87253964e-01f, 9.86857474e-01f, 9.86454904e-01f, 9.86046433e-01f,
+        9.85631943e-01f, 9.85211432e-01f, 9.84785020e-01f, 9.84352589e-01f, 9.83914196e-01f, 9.83469903e-01f,
+        9.83019590e-01f, 9.82563376e-01f, 9.82101202e-01f, 9.81633127e-01f, 9.81159091e-01f, 9.80679154e-01f,
+        9.80193317e-01f, 9.79701519e-01f, 9.79203880e-01f, 9.78700280e-01f, 9.78190839e-01f, 9.77675498e-01f,
+        9.77154255e-01f, 9.76627171e-01f, 9.76094186e-01f, 9.75555360e-01f, 9.75010693e-01f, 9.74460125e-01f,
+        9.73903775e-01f, 9.73341584e-01f, 9.72773552e-01f, 9.72199738e-01f, 9.71620083e-01f, 9.71034586e-01f,
+        9.70443368e-01f, 9.69846308e-01f, 9.69243467e-01f, 9.68634903e-01f, 9.68020499e-01f, 9.67400372e-01f,
+        9.66774523e-01f, 9.66142893e-01f, 9.65505481e-01f, 9.64862406e-01f, 9.64213610e-01f, 9.63559091e-01f,
+        9.62898850e-01f, 9.62232888e-01f, 9.61561263e-01f, 9.60883975e-01f, 9.60201025e-01f, 9.59512353e-01f,
+        9.58818078e-01f, 9.58118141e-01f, 9.57412541e-01f, 9.56701338e-01f, 9.55984533e-01f, 9.55262065e-01f,
+        9.54534054e-01f, 9.53800380e-01f, 9.53061163e-01f, 9.52316403e-01f, 9.51566041e-01f, 9.50810075e-01f,
+        9.50048625e-01f, 9.49281633e-01f, 9.48509097e-01f, 9.47731018e-01f, 9.46947455e-01f, 9.46158409e-01f,
+        9.45363820e-01f, 9.44563746e-01f, 9.43758249e-01f, 9.42947268e-01f, 9.42130864e-01f, 9.41308975e-01f,
+        9.40481663e-01f, 9.39648986e-01f, 9.38810825e-01f, 9.37967300e-01f, 9.37118351e-01f, 9.36264098e-01f,
+        9.35404420e-01f, 9.34539378e-01f, 9.33668971e-01f, 9.32793260e-01f, 9.31912243e-01f, 9.31025863e-01f,
+        9.30134177e-01f, 9.29237247e-01f, 9.28335011e-01f, 9.27427471e-01f, 9.26514745e-01f, 9.25596714e-01f,
+        9.24673438e-01f, 9.23744977e-01f, 9.22811270e-01f, 9.21872318e-01f, 9.20928240e-01f, 9.19978976e-01f,
+        9.19024527e-01f, 9.18064892e-01f, 9.17100191e-01f, 9.16130304e-01f, 9.15155292e-01f, 9.14175153e-01f,
+        9.13189948e-01f, 9.12199676e-01f, 9.11204278e-01f, 9.10203874e-01f, 9.09198403e-01f, 9.08187866e-01f,
+        9.07172322e-01f, 9.06151772e-01f, 9.05126214e-01f, 9.04095709e-01f, 9.03060198e-01f, 9.02019680e-01f,
+        9.00974274e-01f, 8.99923921e-01f, 8.98868680e-01f, 8.97808492e-01f, 8.96743417e-01f, 8.95673454e-01f,
+        8.94598603e-01f, 8.93518925e-01f, 8.92434359e-01f, 8.91345024e-01f, 8.90250862e-01f, 8.89151871e-01f,
+        8.88048112e-01f, 8.86939526e-01f, 8.85826230e-01f, 8.84708166e-01f, 8.83585393e-01f, 8.82457852e-01f,
+        8.81325662e-01f, 8.80188763e-01f, 8.79047155e-01f, 8.77900898e-01f, 8.76749992e-01f, 8.75594437e-01f,
+        8.74434292e-01f, 8.73269498e-01f, 8.72100115e-01f, 8.70926201e-01f, 8.69747639e-01f, 8.68564606e-01f,
+        8.67376983e-01f, 8.66184890e-01f, 8.64988267e-01f, 8.63787115e-01f, 8.62581491e-01f, 8.61371458e-01f,
+        8.60156953e-01f, 8.58937979e-01f, 8.57714653e-01f, 8.56486857e-01f, 8.55254710e-01f, 8.54018211e-01f,
+        8.52777302e-01f, 8.51532102e-01f, 8.50282550e-01f, 8.49028707e-01f, 8.47770572e-01f, 8.46508145e-01f,
+        8.45241427e-01f, 8.43970478e-01f, 8.42695296e-01f, 8.41415882e-01f, 8.40132296e-01f, 8.38844478e-01f,
+        8.37552547e-01f, 8.36256444e-01f, 8.34956169e-01f, 8.33651781e-01f, 8.32343340e-01f, 8.31030786e-01f,
+        8.29714119e-01f, 8.28393400e-01f, 8.27068686e-01f, 8.25739920e-01f, 8.24407101e-01f, 8.23070347e-01f,
+        8.21729600e-01f, 8.20384920e-01f, 8.19036245e-01f, 8.17683697e-01f, 8.16327214e-01f, 8.14966798e-01f,
+        8.13602567e-01f, 8.12234461e-01f, 8.10862482e-01f, 8.09486687e-01f, 8.08107138e-01f, 8.06723714e-01f,
+        8.05336595e-01f, 8.03945661e-01f, 8.02550972e-01f, 8.01152587e-01f, 7.99750507e-01f, 7.98344731e-01f,
+        7.96935320e-01f, 7.95522213e-01f, 7.94105470e-01f, 7.92685091e-01f, 7.91261137e-01f, 7.89833605e-01f,
+        7.88402438e-01f, 7.86967814e-01f, 7.85529613e-01f, 7.84087896e-01f, 7.82642663e-01f, 7.81194031e-01f,
+        7.79741883e-01f, 7.78286278e-01f, 7.76827276e-01f, 7.75364816e-01f, 7.73899019e-01f, 7.72429824e-01f,
+        7.70957291e-01f, 7.69481421e-01f, 7.68002272e-01f, 7.66519785e-01f, 7.65034020e-01f, 7.63544977e-01f,
+        7.62052715e-01f, 7.60557234e-01f, 7.59058535e-01f, 7.57556617e-01f, 7.56051540e-01f, 7.54543364e-01f,
+        7.53032029e-01f, 7.51517534e-01f, 7.50000000e-01f, 7.48479366e-01f, 7.46955693e-01f, 7.45428979e-01f,
+        7.43899226e-01f, 7.42366433e-01f, 7.40830719e-01f, 7.39292026e-01f, 7.37750411e-01f, 7.36205816e-01f,
+        7.34658360e-01f, 7.33107984e-01f, 7.31554747e-01f, 7.29998648e-01f, 7.28439748e-01f, 7.26878047e-01f,
+        7.25313485e-01f, 7.23746240e-01f, 7.22176194e-01f, 7.20603406e-01f, 7.19027877e-01f, 7.17449725e-01f,
+        7.15868831e-01f, 7.14285314e-01f, 7.12699175e-01f, 7.11110413e-01f, 7.09519029e-01f, 7.07925081e-01f,
+        7.06328571e-01f, 7.04729497e-01f, 7.03127921e-01f, 7.01523840e-01f, 6.99917316e-01f, 6.98308289e-01f,
+        6.96696818e-01f, 6.95082963e-01f, 6.93466663e-01f, 6.91848040e-01f, 6.90227032e-01f, 6.88603640e-01f,
+        6.86977983e-01f, 6.85350001e-01f, 6.83719754e-01f, 6.82087183e-01f, 6.80452466e-01f, 6.78815484e-01f,
+        6.77176297e-01f, 6.75534904e-01f, 6.73891366e-01f, 6.72245741e-01f, 6.70597911e-01f, 6.68948054e-01f,
+        6.67296052e-01f, 6.65642023e-01f, 6.63985968e-01f, 6.62327886e-01f, 6.60667837e-01f, 6.59005761e-01f,
+        6.57341778e-01f, 6.55675828e-01f, 6.54007912e-01f, 6.52338147e-01f, 6.50666535e-01f, 6.48993075e-01f,
+        6.47317708e-01f, 6.45640612e-01f, 6.43961668e-01f, 6.42280936e-01f, 6.40598476e-01f, 6.38914287e-01f,
+        6.37228429e-01f, 6.35540843e-01f, 6.33851588e-01f, 6.32160664e-01f, 6.30468190e-01f, 6.28774047e-01f,
+        6.27078295e-01f, 6.25381052e-01f, 6.23682201e-01f, 6.21981859e-01f, 6.20280027e-01f, 6.18576705e-01f,
+        6.16871893e-01f, 6.15165710e-01f, 6.13458037e-01f, 6.11748993e-01f, 6.10038579e-01f, 6.08326852e-01f,
+        6.06613755e-01f, 6.04899347e-01f, 6.03183627e-01f, 6.01466656e-01f, 5.99748433e-01f, 5.98028958e-01f,
+        5.96308291e-01f, 5.94586492e-01f, 5.92863500e-01f, 5.91139317e-01f, 5.89414060e-01f, 5.87687671e-01f,
+        5.85960209e-01f, 5.84231734e-01f, 5.82502186e-01f, 5.80771625e-01f, 5.79040051e-01f, 5.77307522e-01f,
+        5.75574040e-01f, 5.73839664e-01f, 5.72104335e-01f, 5.70368111e-01f, 5.68631053e-01f, 5.66893160e-01f,
+        5.65154374e-01f, 5.63414872e-01f, 5.61674535e-01f, 5.59933484e-01f, 5.58191657e-01f, 5.56449115e-01f,
+        5.54705858e-01f, 5.52962005e-01f, 5.51217437e-01f, 5.49472213e-01f, 5.47726452e-01f, 5.45980036e-01f,
+        5.44233143e-01f, 5.42485654e-01f, 5.40737629e-01f, 5.38989127e-01f, 5.37240088e-01f, 5.35490632e-01f,
+        5.33740759e-01f, 5.31990469e-01f, 5.30239761e-01f, 5.28488696e-01f, 5.26737273e-01f, 5.24985492e-01f,
+        5.23233473e-01f, 5.21481097e-01f, 5.19728482e-01f, 5.17975628e-01f, 5.16222596e-01f, 5.14469326e-01f,
+        5.12715876e-01f, 5.10962248e-01f, 5.09208500e-01f, 5.07454634e-01f, 5.05700707e-01f, 5.03946662e-01f,
+        5.02192616e-01f, 5.00438511e-01f, 4.98684436e-01f, 4.96930331e-01f, 4.95176315e-01f, 4.93422329e-01f,
+        4.91668403e-01f, 4.89914596e-01f, 4.88160938e-01f, 4.86407399e-01f, 4.84654039e-01f, 4.82900858e-01f,
+        4.81147885e-01f, 4.79395151e-01f, 4.77642685e-01f, 4.75890487e-01f, 4.74138588e-01f, 4.72386986e-01f,
+        4.70635742e-01f, 4.68884856e-01f, 4.67134356e-01f, 4.65384245e-01f, 4.63634580e-01f, 4.61885333e-01f,
+        4.60136592e-01f, 4.58388329e-01f, 4.56640571e-01f, 4.54893351e-01f, 4.53146666e-01f, 4.51400578e-01f,
+        4.49655086e-01f, 4.47910219e-01f, 4.46165979e-01f, 4.44422424e-01f, 4.42679524e-01f, 4.40937370e-01f,
+        4.39195901e-01f, 4.37455207e-01f, 4.35715258e-01f, 4.33976114e-01f, 4.32237804e-01f, 4.30500299e-01f,
+        4.28763658e-01f, 4.27027911e-01f, 4.25293028e-01f, 4.23559099e-01f, 4.21826094e-01f, 4.20094043e-01f,
+        4.18362975e-01f, 4.16632921e-01f, 4.14903879e-01f, 4.13175911e-01f, 4.11448985e-01f, 4.09723163e-01f,
+        4.07998472e-01f, 4.06274885e-01f, 4.04552460e-01f, 4.02831197e-01f, 4.01111156e-01f, 3.99392307e-01f,
+        3.97674710e-01f, 3.95958364e-01f, 3.94243300e-01f, 3.92529547e-01f, 3.90817106e-01f, 3.89106005e-01f,
+        3.87396306e-01f, 3.85687947e-01f, 3.83981019e-01f, 3.82275492e-01f, 3.80571455e-01f, 3.78868848e-01f,
+        3.77167761e-01f, 3.75468165e-01f, 3.73770118e-01f, 3.72073621e-01f, 3.70378703e-01f, 3.68685365e-01f,
+        3.66993666e-01f, 3.65303576e-01f, 3.63615155e-01f, 3.61928433e-01f, 3.60243380e-01f, 3.58560055e-01f,
+        3.56878489e-01f, 3.55198652e-01f, 3.53520632e-01f, 3.51844400e-01f, 3.50169986e-01f, 3.48497421e-01f,
+        3.46826702e-01f, 3.45157892e-01f, 3.43490988e-01f, 3.41825992e-01f, 3.40162963e-01f, 3.38501900e-01f,
+        3.36842805e-01f, 3.35185736e-01f, 3.33530694e-01f, 3.31877679e-01f, 3.30226749e-01f, 3.28577906e-01f,
+        3.26931179e-01f, 3.25286597e-01f, 3.23644131e-01f, 3.22003871e-01f, 3.20365757e-01f, 3.18729907e-01f,
+        3.17096233e-01f, 3.15464854e-01f, 3.13835740e-01f, 3.12208891e-01f, 3.10584366e-01f, 3.08962196e-01f,
+        3.07342350e-01f, 3.05724889e-01f, 3.04109812e-01f, 3.02497119e-01f, 3.00886899e-01f, 2.99279124e-01f,
+        2.97673792e-01f, 2.96070963e-01f, 2.94470668e-01f, 2.92872876e-01f, 2.91277647e-01f, 2.89684981e-01f,
+        2.88094908e-01f, 2.86507428e-01f, 2.84922570e-01f, 2.83340394e-01f, 2.81760842e-01f, 2.80184001e-01f,
+        2.78609872e-01f, 2.77038455e-01f, 2.75469780e-01f, 2.73903877e-01f, 2.72340775e-01f, 2.70780444e-01f,
+        2.69222945e-01f, 2.67668277e-01f, 2.66116470e-01f, 2.64567554e-01f, 2.63021529e-01f, 2.61478424e-01f,
+        2.59938270e-01f, 2.58401036e-01f, 2.56866783e-01f, 2.55335540e-01f, 2.53807306e-01f, 2.52282083e-01f,
+        2.50759929e-01f, 2.49240831e-01f, 2.47724831e-01f, 2.46211931e-01f, 2.44702145e-01f, 2.43195504e-01f,
+        2.41692036e-01f, 2.40191728e-01f, 2.38694638e-01f, 2.37200752e-01f, 2.35710099e-01f, 2.34222710e-01f,
+        2.32738584e-01f, 2.31257737e-01f, 2.29780212e-01f, 2.28306010e-01f, 2.26835147e-01f, 2.25367650e-01f,
+        2.23903537e-01f, 2.22442806e-01f, 2.20985502e-01f, 2.19531640e-01f, 2.18081221e-01f, 2.16634274e-01f,
+        2.15190813e-01f, 2.13750854e-01f, 2.12314427e-01f, 2.10881531e-01f, 2.09452197e-01f, 2.08026439e-01f,
+        2.06604272e-01f, 2.05185726e-01f, 2.03770801e-01f, 2.02359527e-01f, 2.00951904e-01f, 1.99547976e-01f,
+        1.98147729e-01f, 1.96751207e-01f, 1.95358425e-01f, 1.93969384e-01f, 1.92584112e-01f, 1.91202611e-01f,
+        1.89824924e-01f, 1.88451052e-01f, 1.87081009e-01f, 1.85714826e-01f, 1.84352502e-01f, 1.82994083e-01f,
+        1.81639537e-01f, 1.80288926e-01f, 1.78942248e-01f, 1.77599519e-01f, 1.76260754e-01f, 1.74925983e-01f,
+        1.73595205e-01f, 1.72268450e-01f, 1.70945734e-01f, 1.69627056e-01f, 1.68312445e-01f, 1.67001918e-01f,
+        1.65695488e-01f, 1.64393172e-01f, 1.63094997e-01f, 1.61800951e-01f, 1.60511076e-01f, 1.59225389e-01f,
+        1.57943889e-01f, 1.56666592e-01f, 1.55393526e-01f, 1.54124707e-01f, 1.52860135e-01f, 1.51599839e-01f,
+        1.50343820e-01f, 1.49092123e-01f, 1.47844732e-01f, 1.46601692e-01f, 1.45362988e-01f, 1.44128650e-01f,
+        1.42898694e-01f, 1.41673118e-01f, 1.40451968e-01f, 1.39235243e-01f, 1.38022959e-01f, 1.36815131e-01f,
+        1.35611758e-01f, 1.34412885e-01f, 1.33218512e-01f, 1.32028639e-01f, 1.30843312e-01f, 1.29662514e-01f,
+        1.28486276e-01f, 1.27314612e-01f, 1.26147538e-01f, 1.24985069e-01f, 1.23827212e-01f, 1.22673981e-01f,
+        1.21525399e-01f, 1.20381467e-01f, 1.19242214e-01f, 1.18107647e-01f, 1.16977781e-01f, 1.15852624e-01f,
+        1.14732198e-01f, 1.13616511e-01f, 1.12505585e-01f, 1.11399427e-01f, 1.10298045e-01f, 1.09201461e-01f,
+        1.08109690e-01f, 1.07022747e-01f, 1.05940633e-01f, 1.04863368e-01f, 1.03790969e-01f, 1.02723449e-01f,
+        1.01660818e-01f, 1.00603089e-01f, 9.95502695e-02f, 9.85023826e-02f, 9.74594355e-02f, 9.64214504e-02f,
+        9.53884274e-02f, 9.43603814e-02f, 9.33373272e-02f, 9.23192799e-02f, 9.13062543e-02f, 9.02982503e-02f,
+        8.92952979e-02f, 8.82973969e-02f, 8.73045623e-02f, 8.63168016e-02f, 8.53341371e-02f, 8.43565762e-02f,
+        8.33841339e-02f, 8.24168175e-02f, 8.14546347e-02f, 8.04976076e-02f, 7.95457438e-02f, 7.85990581e-02f,
+        7.76575506e-02f, 7.67212436e-02f, 7.57901520e-02f, 7.48642758e-02f, 7.39436299e-02f, 7.30282366e-02f,
+        7.21180886e-02f, 7.12132081e-02f, 7.03136101e-02f, 6.94193020e-02f, 6.85302839e-02f, 6.76465854e-02f,
+        6.67681992e-02f, 6.58951551e-02f, 6.50274456e-02f, 6.41650930e-02f, 6.33081049e-02f, 6.24564886e-02f,
+        6.16102591e-02f, 6.07694238e-02f, 5.99339977e-02f, 5.91039844e-02f, 5.82793988e-02f, 5.74602485e-02f,
+        5.66465445e-02f, 5.58382981e-02f, 5.50355203e-02f, 5.42382151e-02f, 5.34463972e-02f, 5.26600778e-02f,
+        5.18792607e-02f, 5.11039607e-02f, 5.03341854e-02f, 4.95699421e-02f, 4.88112457e-02f, 4.80581000e-02f,
+        4.73105162e-02f, 4.65685055e-02f, 4.58320752e-02f, 4.51012328e-02f, 4.43759933e-02f, 4.36563566e-02f,
+        4.29423377e-02f, 4.22339439e-02f, 4.15311866e-02f, 4.08340693e-02f, 4.01426032e-02f, 3.94567996e-02f,
+        3.87766585e-02f, 3.81021984e-02f, 3.74334231e-02f, 3.67703401e-02f, 3.61129567e-02f, 3.54612842e-02f,
+        3.48153263e-02f, 3.41750979e-02f, 3.35405990e-02f, 3.29118446e-02f, 3.22888345e-02f, 3.16715837e-02f,
+        3.10600977e-02f, 3.04543804e-02f, 2.98544448e-02f, 2.92602926e-02f, 2.86719352e-02f, 2.80893799e-02f,
+        2.75126304e-02f, 2.69416980e-02f, 2.63765864e-02f, 2.58173048e-02f, 2.52638590e-02f, 2.47162562e-02f,
+        2.41745021e-02f, 2.36386042e-02f, 2.31085699e-02f, 2.25844048e-02f, 2.20661145e-02f, 2.15537064e-02f,
+        2.10471880e-02f, 2.05465630e-02f, 2.00518407e-02f, 1.95630230e-02f, 1.90801192e-02f, 1.86031349e-02f,
+        1.81320757e-02f, 1.76669452e-02f, 1.72077529e-02f, 1.67545024e-02f, 1.63071975e-02f, 1.58658475e-02f,
+        1.54304551e-02f, 1.50010269e-02f, 1.45775676e-02f, 1.41600827e-02f, 1.37485769e-02f, 1.33430567e-02f,
+        1.29435249e-02f, 1.25499880e-02f, 1.21624498e-02f, 1.17809167e-02f, 1.14053916e-02f, 1.10358801e-02f,
+        1.06723858e-02f, 1.03149144e-02f, 9.96347051e-03f, 9.61805694e-03f, 9.27867834e-03f, 8.94534029e-03f,
+        8.61804467e-03f, 8.29679798e-03f, 7.98160210e-03f, 7.67246215e-03f, 7.36938091e-03f, 7.07236305e-03f,
+        6.78141182e-03f, 6.49653096e-03f, 6.21772371e-03f, 5.94499381e-03f, 5.67834452e-03f, 5.41777909e-03f,
+        5.16330032e-03f, 4.91491240e-03f, 4.67261719e-03f, 4.43641841e-03f, 4.20631841e-03f, 3.98232089e-03f,
+        3.76442773e-03f, 3.55264195e-03f, 3.34696635e-03f, 3.14740301e-03f, 2.95395497e-03f, 2.76662409e-03f,
+        2.58541317e-03f, 2.41032382e-03f, 2.24135863e-03f, 2.07851967e-03f, 1.92180881e-03f, 1.77122804e-03f,
+        1.62677921e-03f, 1.48846407e-03f, 1.35628425e-03f, 1.23024150e-03f, 1.11033744e-03f, 9.96573362e-04f,
+        8.88950715e-04f, 7.87470897e-04f, 6.92135072e-04f, 6.02944521e-04f, 5.19900233e-04f, 4.43003257e-04f,
+        3.72254581e-04f, 3.07655049e-04f, 2.49205448e-04f, 1.96906491e-04f, 1.50758860e-04f, 1.10763081e-04f,
+        7.69196777e-05f, 4.92290455e-05f, 2.76915380e-05f, 1.23074133e-05f, 3.07686287e-06f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f
+    };
+    static const float acwinv2048live[2048] = {
+        1.00000000e+00f, 1.00000203e+00f, 1.00000823e+00f, 1.00001860e+00f, 1.00003290e+00f, 1.00005126e+00f,
+        1.00007391e+00f, 1.00010049e+00f, 1.00013125e+00f, 1.00016618e+00f, 1.00020504e+00f, 1.00024819e+00f,
+        1.00029540e+00f, 1.00034666e+00f, 1.00040209e+00f, 1.00046158e+00f, 1.00052524e+00f, 1.00059307e+00f,
+        1.00066471e+00f, 1.00074065e+00f, 1.00082088e+00f, 1.00090504e+00f, 1.00099337e+00f, 1.00108588e+00f,
+        1.00118220e+00f, 1.00128293e+00f, 1.00138760e+00f, 1.00149643e+00f, 1.00160944e+00f, 1.00172651e+00f,
+        1.00184786e+00f, 1.00197315e+00f, 1.00210273e+00f, 1.00223637e+00f, 1.00237405e+00f, 1.00251579e+00f,
+        1.00266194e+00f, 1.00281203e+00f, 1.00296652e+00f, 1.00312495e+00f, 1.00328743e+00f, 1.00345409e+00f,
+        1.00362492e+00f, 1.00379992e+00f, 1.00397909e+00f, 1.00416243e+00f, 1.00434995e+00f, 1.00454152e+00f,
+        1.00473726e+00f, 1.00493741e+00f, 1.00514138e+00f, 1.00534964e+00f, 1.00556207e+00f, 1.00577879e+00f,
+        1.00599945e+00f, 1.00622463e+00f, 1.00645363e+00f, 1.00668705e+00f, 1.00692439e+00f, 1.00716615e+00f,
+        1.00741208e+00f, 1.00766206e+00f, 1.00791669e+00f, 1.00817502e+00f, 1.00843787e+00f, 1.00870478e+00f,
+        1.00897574e+00f, 1.00925112e+00f, 1.00953066e+00f, 1.00981450e+00f, 1.01010251e+00f, 1.01039481e+00f,
+        1.01069117e+00f, 1.01099193e+00f, 1.01129687e+00f, 1.01160598e+00f, 1.01191950e+00f, 1.01223719e+00f,
+        1.01255918e+00f, 1.01288545e+00f, 1.01321590e+00f, 1.01355076e+00f, 1.01388979e+00f, 1.01423311e+00f,
+        1.01458061e+00f, 1.01493275e+00f, 1.01528871e+00f, 1.01564932e+00f, 1.01601398e+00f, 1.01638305e+00f,
+        1.01675653e+00f, 1.01713419e+00f, 1.01751614e+00f, 1.01790249e+00f, 1.01829314e+00f, 1.01868820e+00f,
+        1.01908767e+00f, 1.01949131e+00f, 1.01989937e+00f, 1.02031183e+00f, 1.02072871e+00f, 1.02114975e+00f,
+        1.02157521e+00f, 1.02200520e+00f, 1.02243948e+00f, 1.02287805e+00f, 1.02332115e+00f, 1.02376854e+00f,
+        1.02422035e+00f, 1.02467680e+00f, 1.02513754e+00f, 1.02560258e+00f, 1.02607214e+00f, 1.02654612e+00f,
+        1.02702451e+00f, 1.02750742e+00f, 1.02799475e+00f, 1.02848661e+00f, 1.02898288e+00f, 1.02948380e+00f,
+        1.02998900e+00f, 1.03049874e+00f, 1.03101289e+00f, 1.03153157e+00f, 1.03205490e+00f, 1.03258264e+00f,
+        1.03311503e+00f, 1.03365183e+00f, 1.03419316e+00f, 1.03473914e+00f, 1.03528953e+00f, 1.03584456e+00f,
+        1.03640389e+00f, 1.03696823e+00f, 1.03753686e+00f, 1.03811026e+00f, 1.03868818e+00f, 1.03927064e+00f,
+        1.03985775e+00f, 1.04044950e+00f, 1.04104590e+00f, 1.04164696e+00f, 1.04225254e+00f, 1.04286289e+00f,
+        1.04347789e+00f, 1.04409754e+00f, 1.04472184e+00f, 1.04535103e+00f, 1.04598463e+00f, 1.04662323e+00f,
+        1.04726613e+00f, 1.04791415e+00f, 1.04856670e+00f, 1.04922402e+00f, 1.04988599e+00f, 1.05055273e+00f,
+        1.05122423e+00f, 1.05190063e+00f, 1.05258179e+00f, 1.05326772e+00f, 1.05395854e+00f, 1.05465400e+00f,
+        1.05535436e+00f, 1.05605960e+00f, 1.05676949e+00f, 1.05748439e+00f, 1.05820417e+00f, 1.05892885e+00f,
+        1.05965817e+00f, 1.06039262e+00f, 1.06113195e+00f, 1.06187594e+00f, 1.06262505e+00f, 1.06337917e+00f,
+        1.06413794e+00f, 1.06490207e+00f, 1.06567097e+00f, 1.06644487e+00f, 1.06722367e+00f, 1.06800735e+00f,
+        1.06879640e+00f, 1.06959021e+00f, 1.07038915e+00f, 1.07119310e+00f, 1.07200181e+00f, 1.07281601e+00f,
+        1.07363498e+00f, 1.07445920e+00f, 1.07528841e+00f, 1.07612276e+00f, 1.07696235e+00f, 1.07780695e+00f,
+        1.07865667e+00f, 1.07951152e+00f, 1.08037150e+00f, 1.08123696e+00f, 1.08210731e+00f, 1.08298302e+00f,
+        1.08386362e+00f, 1.08474970e+00f, 1.08564103e+00f, 1.08653772e+00f, 1.08743942e+00f, 1.08834660e+00f,
+        1.08925891e+00f, 1.09017658e+00f, 1.09109950e+00f, 1.09202790e+00f, 1.09296155e+00f, 1.09390056e+00f,
+        1.09484482e+00f, 1.09579456e+00f, 1.09674990e+00f, 1.09771049e+00f, 1.09867632e+00f, 1.09964788e+00f,
+        1.10062456e+00f, 1.10160697e+00f, 1.10259473e+00f, 1.10358810e+00f, 1.10458684e+00f, 1.10559118e+00f,
+        1.10660100e+00f, 1.10761642e+00f, 1.10863733e+00f, 1.10966361e+00f, 1.11069596e+00f, 1.11173368e+00f,
+        1.11277699e+00f, 1.11382604e+00f, 1.11488056e+00f, 1.11594093e+00f, 1.11700702e+00f, 1.11807847e+00f,
+        1.11915588e+00f, 1.12023890e+00f, 1.12132788e+00f, 1.12242258e+00f, 1.12352288e+00f, 1.12462914e+00f,
+        1.12574100e+00f, 1.12685895e+00f, 1.12798250e+00f, 1.12911212e+00f, 1.13024747e+00f, 1.13138902e+00f,
+        1.13253593e+00f, 1.13368917e+00f, 1.13484812e+00f, 1.13601327e+00f, 1.13718426e+00f, 1.13836110e+00f,
+        1.13954425e+00f, 1.14073312e+00f, 1.14192808e+00f, 1.14312935e+00f, 1.14433646e+00f, 1.14554977e+00f,
+        1.14676917e+00f, 1.14799476e+00f, 1.14922631e+00f, 1.15046442e+00f, 1.15170825e+00f, 1.15295851e+00f,
+        1.15421522e+00f, 1.15547776e+00f, 1.15674675e+00f, 1.15802205e+00f, 1.15930367e+00f, 1.16059160e+00f,
+        1.16188586e+00f, 1.16318643e+00f, 1.16449344e+00f, 1.16580689e+00f, 1.16712666e+00f, 1.16845274e+00f,
+        1.16978562e+00f, 1.17112482e+00f, 1.17247033e+00f, 1.17382264e+00f, 1.17518127e+00f, 1.17654657e+00f,
+        1.17791843e+00f, 1.17929673e+00f, 1.18068194e+00f, 1.18207359e+00f, 1.18347216e+00f, 1.18487740e+00f,
+        1.18628907e+00f, 1.18770754e+00f, 1.18913293e+00f, 1.19056499e+00f, 1.19200373e+00f, 1.19344938e+00f,
+        1.19490194e+00f, 1.19636130e+00f, 1.19782758e+00f, 1.19930053e+00f, 1.20078075e+00f, 1.20226789e+00f,
+        1.20376170e+00f, 1.20526302e+00f, 1.20677078e+00f, 1.20828593e+00f, 1.20980811e+00f, 1.21133745e+00f,
+        1.21287358e+00f, 1.21441734e+00f, 1.21596789e+00f, 1.21752596e+00f, 1.21909082e+00f, 1.22066307e+00f,
+        1.22224271e+00f, 1.22382951e+00f, 1.22542369e+00f, 1.22702503e+00f, 1.22863400e+00f, 1.23025036e+00f,
+        1.23187399e+00f, 1.23350513e+00f, 1.23514366e+00f, 1.23678958e+00f, 1.23844314e+00f, 1.24010444e+00f,
+        1.24177301e+00f, 1.24344921e+00f, 1.24513304e+00f, 1.24682474e+00f, 1.24852395e+00f, 1.25023079e+00f,
+        1.25194538e+00f, 1.25366771e+00f, 1.25539804e+00f, 1.25713611e+00f, 1.25888169e+00f, 1.26063550e+00f,
+        1.26239717e+00f, 1.26416659e+00f, 1.26594412e+00f, 1.26772940e+00f, 1.26952302e+00f, 1.27132440e+00f,
+        1.27313387e+00f, 1.27495170e+00f, 1.27677715e+00f, 1.27861130e+00f, 1.28045332e+00f, 1.28230369e+00f,
+        1.28416216e+00f, 1.28602898e+00f, 1.28790402e+00f, 1.28978741e+00f, 1.29167914e+00f, 1.29357946e+00f,
+        1.29548824e+00f, 1.29740524e+00f, 1.29933083e+00f, 1.30126500e+00f, 1.30320752e+00f, 1.30515873e+00f,
+        1.30711854e+00f, 1.30908728e+00f, 1.31106448e+00f, 1.31305003e+00f, 1.31504488e+00f, 1.31704831e+00f,
+        1.31906044e+00f, 1.32108140e+00f, 1.32311130e+00f, 1.32515025e+00f, 1.32719803e+00f, 1.32925475e+00f,
+        1.33132052e+00f, 1.33339548e+00f, 1.33547914e+00f, 1.33757222e+00f, 1.33967435e+00f, 1.34178555e+00f,
+        1.34390604e+00f, 1.34603584e+00f, 1.34817493e+00f, 1.35032344e+00f, 1.35248113e+00f, 1.35464823e+00f,
+        1.35682487e+00f, 1.35901082e+00f, 1.36120653e+00f, 1.36341155e+00f, 1.36562622e+00f, 1.36785066e+00f,
+        1.37008440e+00f, 1.37232804e+00f, 1.37458146e+00f, 1.37684453e+00f, 1.37911749e+00f, 1.38140023e+00f,
+        1.38369298e+00f, 1.38599563e+00f, 1.38830781e+00f, 1.39063048e+00f, 1.39296293e+00f, 1.39530563e+00f,
+        1.39765811e+00f, 1.40002120e+00f, 1.40239429e+00f, 1.40477765e+00f, 1.40717101e+00f, 1.40957499e+00f,
+        1.41198921e+00f, 1.41441381e+00f, 1.41684890e+00f, 1.41929436e+00f, 1.42175043e+00f, 1.42421710e+00f,
+        1.42669427e+00f, 1.42918241e+00f, 1.43168080e+00f, 1.43419015e+00f, 1.43671012e+00f, 1.43924117e+00f,
+        1.44178271e+00f, 1.44433546e+00f, 1.44689894e+00f, 1.44947374e+00f, 1.45205939e+00f, 1.45465577e+00f,
+        1.45726383e+00f, 1.45988297e+00f, 1.46251309e+00f, 1.46515465e+00f, 1.46780741e+00f, 1.47047150e+00f,
+        1.47314703e+00f, 1.47583413e+00f, 1.47853255e+00f, 1.48124278e+00f, 1.48396420e+00f, 1.48669755e+00f,
+        1.48944211e+00f, 1.49219894e+00f, 1.49496722e+00f, 1.49774742e+00f, 1.50053942e+00f, 1.50334358e+00f,
+        1.50615931e+00f, 1.50898755e+00f, 1.51182723e+00f, 1.51467955e+00f, 1.51754379e+00f, 1.52042043e+00f,
+        1.52330923e+00f, 1.52621043e+00f, 1.52912378e+00f, 1.53204954e+00f, 1.53498793e+00f, 1.53793883e+00f,
+        1.54090226e+00f, 1.54387820e+00f, 1.54686689e+00f, 1.54986835e+00f, 1.55288267e+00f, 1.55590987e+00f,
+        1.55894971e+00f, 1.56200242e+00f, 1.56506824e+00f, 1.56814730e+00f, 1.57123935e+00f, 1.57434428e+00f,
+        1.57746291e+00f, 1.58059442e+00f, 1.58373916e+00f, 1.58689737e+00f, 1.59006917e+00f, 1.59325409e+00f,
+        1.59645307e+00f, 1.59966528e+00f, 1.60289121e+00f, 1.60613084e+00f, 1.60938430e+00f, 1.61265159e+00f,
+        1.61593258e+00f, 1.61922765e+00f, 1.62253666e+00f, 1.62585998e+00f, 1.62919712e+00f, 1.63254845e+00f,
+        1.63591385e+00f, 1.63929379e+00f, 1.64268804e+00f, 1.64609635e+00f, 1.64951980e+00f, 1.65295732e+00f,
+        1.65640962e+00f, 1.65987659e+00f, 1.66335785e+00f, 1.66685438e+00f, 1.67036569e+00f, 1.67389154e+00f,
+        1.67743230e+00f, 1.68098879e+00f, 1.68455958e+00f, 1.68814611e+00f, 1.69174755e+00f, 1.69536388e+00f,
+        1.69899595e+00f, 1.70264316e+00f, 1.70630634e+00f, 1.70998478e+00f, 1.71367872e+00f, 1.71738827e+00f,
+        1.72111344e+00f, 1.72485495e+00f, 1.72861195e+00f, 1.73238492e+00f, 1.73617375e+00f, 1.73997915e+00f,
+        1.74379981e+00f, 1.74763727e+00f, 1.75149035e+00f, 1.75536013e+00f, 1.75924671e+00f, 1.76314902e+00f,
+        1.76706886e+00f, 1.77100432e+00f, 1.77495670e+00f, 1.77892637e+00f, 1.78291202e+00f, 1.78691483e+00f,
+        1.79093444e+00f, 1.79497123e+00f, 1.79902494e+00f, 1.80309629e+00f, 1.80718434e+00f, 1.81128991e+00f,
+        1.81541252e+00f, 1.81955278e+00f, 1.82371056e+00f, 1.82788587e+00f, 1.83207905e+00f, 1.83629000e+00f,
+        1.84051836e+00f, 1.84476483e+00f, 1.84902918e+00f, 1.85331202e+00f, 1.85761201e+00f, 1.86193085e+00f,
+        1.86626768e+00f, 1.87062311e+00f, 1.87499630e+00f, 1.87938845e+00f, 1.88379920e+00f, 1.88822806e+00f,
+        1.89267647e+00f, 1.89714265e+00f, 1.90162873e+00f, 1.90613294e+00f, 1.91065645e+00f, 1.91519856e+00f,
+        1.91976058e+00f, 1.92434132e+00f, 1.92894149e+00f, 1.93356109e+00f, 1.93820024e+00f, 1.94285893e+00f,
+        1.94753706e+00f, 1.95223486e+00f, 1.95695221e+00f, 1.96168995e+00f, 1.96644711e+00f, 1.97122502e+00f,
+        1.97602260e+00f, 1.98084009e+00f, 1.98567832e+00f, 1.99053657e+00f, 1.99541497e+00f, 2.00031447e+00f,
+        2.00523424e+00f, 2.01017427e+00f, 2.01513577e+00f, 2.02011824e+00f, 2.02512097e+00f, 2.03014517e+00f,
+        2.03519011e+00f, 2.04025626e+00f, 2.04534364e+00f, 2.05045223e+00f, 2.05558228e+00f, 2.06073427e+00f,
+        2.06590748e+00f, 2.07110262e+00f, 2.07631874e+00f, 2.08155704e+00f, 2.08681726e+00f, 2.09209967e+00f,
+        2.09740376e+00f, 2.10273051e+00f, 2.10807920e+00f, 2.11345077e+00f, 2.11884332e+00f, 2.12425900e+00f,
+        2.12969756e+00f, 2.13515878e+00f, 2.14064288e+00f, 2.14614987e+00f, 2.15167904e+00f, 2.15723205e+00f,
+        2.16280746e+00f, 2.16840649e+00f, 2.17402840e+00f, 2.17967439e+00f, 2.18534327e+00f, 2.19103551e+00f,
+        2.19675136e+00f, 2.20249128e+00f, 2.20825434e+00f, 2.21404123e+00f, 2.21985245e+00f, 2.22568774e+00f,
+        2.23154736e+00f, 2.23743081e+00f, 2.24333930e+00f, 2.24927139e+00f, 2.25522757e+00f, 2.26120949e+00f,
+        2.26721478e+00f, 2.27324557e+00f, 2.27930093e+00f, 2.28538156e+00f, 2.29148650e+00f, 2.29761672e+00f,
+        2.30377126e+00f, 2.30995178e+00f, 2.31615734e+00f, 2.32238865e+00f, 2.32864523e+00f, 2.33492804e+00f,
+        2.34123635e+00f, 2.34756994e+00f, 2.35392880e+00f, 2.36031389e+00f, 2.36672521e+00f, 2.37316203e+00f,
+        2.37962604e+00f, 2.38611579e+00f, 2.39263177e+00f, 2.39917421e+00f, 2.40574217e+00f, 2.41233683e+00f,
+        2.41895986e+00f, 2.42560840e+00f, 2.43228388e+00f, 2.43898630e+00f, 2.44571638e+00f, 2.45247269e+00f,
+        2.45925546e+00f, 2.46606636e+00f, 2.47290397e+00f, 2.47976923e+00f, 2.48666191e+00f, 2.49358225e+00f,
+        2.50053048e+00f, 2.50750542e+00f, 2.51450849e+00f, 2.52153897e+00f, 2.52859783e+00f, 2.53568482e+00f,
+        2.54279900e+00f, 2.54994249e+00f, 2.55711365e+00f, 2.56431389e+00f, 2.57154059e+00f, 2.57879686e+00f,
+        2.58608150e+00f, 2.59339452e+00f, 2.60073614e+00f, 2.60810709e+00f, 2.61550593e+00f, 2.62293386e+00f,
+        2.63039088e+00f, 2.63787627e+00f, 2.64539123e+00f, 2.65293479e+00f, 2.66050839e+00f, 2.66811037e+00f,
+        2.67574215e+00f, 2.68340325e+00f, 2.69109297e+00f, 2.69881201e+00f, 2.70656109e+00f, 2.71433949e+00f,
+        2.72214770e+00f, 2.72998714e+00f, 2.73785472e+00f, 2.74575114e+00f, 2.75367832e+00f, 2.76163483e+00f,
+        2.76962233e+00f, 2.77763939e+00f, 2.78568697e+00f, 2.79376388e+00f, 2.80187082e+00f, 2.81000829e+00f,
+        2.81817508e+00f, 2.82637310e+00f, 2.83460212e+00f, 2.84286022e+00f, 2.85114908e+00f, 2.85946870e+00f,
+        2.86781859e+00f, 2.87619781e+00f, 2.88460851e+00f, 2.89305067e+00f, 2.90152168e+00f, 2.91002393e+00f,
+        2.91855717e+00f, 2.92712140e+00f, 2.93571591e+00f, 2.94434094e+00f, 2.95299602e+00f, 2.96168184e+00f,
+        2.97039986e+00f, 2.97914743e+00f, 2.98792601e+00f, 2.99673605e+00f, 3.00557566e+00f, 3.01444626e+00f,
+        3.02334714e+00f, 3.03227901e+00f, 3.04124308e+00f, 3.05023646e+00f, 3.05926132e+00f, 3.06831741e+00f,
+        3.07740450e+00f, 3.08652163e+00f, 3.09566832e+00f, 3.10484672e+00f, 3.11405683e+00f, 3.12329698e+00f,
+        3.13256741e+00f, 3.14186907e+00f, 3.15120101e+00f, 3.16056299e+00f, 3.16995597e+00f, 3.17937946e+00f,
+        3.18883395e+00f, 3.19831848e+00f, 3.20783377e+00f, 3.21737933e+00f, 3.22695518e+00f, 3.23656106e+00f,
+        3.24619675e+00f, 3.25586367e+00f, 3.26555872e+00f, 3.27528644e+00f, 3.28504181e+00f, 3.29482889e+00f,
+        3.30464482e+00f, 3.31448960e+00f, 3.32436538e+00f, 3.33427000e+00f, 3.34420443e+00f, 3.35416818e+00f,
+        3.36416101e+00f, 3.37418509e+00f, 3.38423634e+00f, 3.39431787e+00f, 3.40442634e+00f, 3.41456509e+00f,
+        3.42473245e+00f, 3.43492746e+00f, 3.44515252e+00f, 3.45540571e+00f, 3.46568465e+00f, 3.47599316e+00f,
+        3.48632932e+00f, 3.49669361e+00f, 3.50708604e+00f, 3.51750588e+00f, 3.52795219e+00f, 3.53842807e+00f,
+        3.54892969e+00f, 3.55945730e+00f, 3.57001114e+00f, 3.58059311e+00f, 3.59119940e+00f, 3.60183311e+00f,
+        3.61249352e+00f, 3.62317944e+00f, 3.63388991e+00f, 3.64462614e+00f, 3.65538788e+00f, 3.66617417e+00f,
+        3.67698455e+00f, 3.68782020e+00f, 3.69868088e+00f, 3.70956540e+00f, 3.72047424e+00f, 3.73140621e+00f,
+        3.74236012e+00f, 3.75333881e+00f, 3.76433921e+00f, 3.77536106e+00f, 3.78640747e+00f, 3.79747725e+00f,
+        3.80856657e+00f, 3.81967711e+00f, 3.83080912e+00f, 3.84196210e+00f, 3.85313535e+00f, 3.86432934e+00f,
+        3.87554526e+00f, 3.88677955e+00f, 3.89803123e+00f, 3.90930438e+00f, 3.92059398e+00f, 3.93190265e+00f,
+        3.94322968e+00f, 3.95457482e+00f, 3.96593547e+00f, 3.97731519e+00f, 3.98870993e+00f, 4.00012064e+00f,
+        4.01154709e+00f, 4.02298927e+00f, 4.03444672e+00f, 4.04591990e+00f, 4.05740356e+00f, 4.06890488e+00f,
+        4.08041859e+00f, 4.09194422e+00f, 4.10348272e+00f, 4.11503315e+00f, 4.12659645e+00f, 4.13816881e+00f,
+        4.14975262e+00f, 4.16134691e+00f, 4.17295074e+00f, 4.18456411e+00f, 4.19618750e+00f, 4.20781612e+00f,
+        4.21945333e+00f, 4.23109722e+00f, 4.24275064e+00f, 4.25440741e+00f, 4.26607370e+00f, 4.27774286e+00f,
+        4.28941393e+00f, 4.30109024e+00f, 4.31277227e+00f, 4.32445478e+00f, 4.33614206e+00f, 4.34783173e+00f,
+        4.35951900e+00f, 4.37120962e+00f, 4.38289833e+00f, 4.39458752e+00f, 4.40627337e+00f, 4.41795874e+00f,
+        4.42964363e+00f, 4.44132328e+00f, 4.45300150e+00f, 4.46467447e+00f, 4.47633934e+00f, 4.48800039e+00f,
+        4.49965620e+00f, 4.51130533e+00f, 4.52294350e+00f, 4.53457832e+00f, 4.54619932e+00f, 4.55781174e+00f,
+        4.56941271e+00f, 4.58100414e+00f, 4.59258366e+00f, 4.60414743e+00f, 4.61570120e+00f, 4.62724304e+00f,
+        4.63876629e+00f, 4.65027332e+00f, 4.66176558e+00f, 4.67323828e+00f, 4.68469524e+00f, 4.69613409e+00f,
+        4.70755005e+00f, 4.71895075e+00f, 4.73032713e+00f, 4.74168015e+00f, 4.75301170e+00f, 4.76432037e+00f,
+        4.77560043e+00f, 4.78685856e+00f, 4.79809141e+00f, 4.80930185e+00f, 4.82047749e+00f, 4.83162928e+00f,
+        4.84274673e+00f, 4.85383654e+00f, 4.86489391e+00f, 4.87591934e+00f, 4.88691282e+00f, 4.89787388e+00f,
+        4.90879965e+00f, 4.91968727e+00f, 4.93053627e+00f, 4.94135284e+00f, 4.95212841e+00f, 4.96286678e+00f,
+        4.97356749e+00f, 4.98422337e+00f, 4.99483967e+00f, 5.00541019e+00f, 5.01593685e+00f, 5.02642107e+00f,
+        5.03685760e+00f, 5.04725122e+00f, 5.05759096e+00f, 5.06788731e+00f, 5.07813358e+00f, 5.08832455e+00f,
+        5.09847164e+00f, 5.10856056e+00f, 5.11860085e+00f, 5.12858343e+00f, 5.13851738e+00f, 5.14839268e+00f,
+        5.15820980e+00f, 5.16796970e+00f, 5.17766809e+00f, 5.18730927e+00f, 5.19688654e+00f, 5.20640373e+00f,
+        5.21585798e+00f, 5.22525120e+00f, 5.23457861e+00f, 5.24383879e+00f, 5.25303316e+00f, 5.26215935e+00f,
+        5.27121878e+00f, 5.28020573e+00f, 5.28912783e+00f, 5.29797745e+00f, 5.30675364e+00f, 5.31545258e+00f,
+        5.32408237e+00f, 5.33263302e+00f, 5.34111214e+00f, 5.34951401e+00f, 5.35783720e+00f, 5.36608124e+00f,
+        5.37424374e+00f, 5.38232613e+00f, 5.39032650e+00f, 5.39824724e+00f, 5.40608311e+00f, 5.41383648e+00f,
+        5.42150640e+00f, 5.42908382e+00f, 5.43658400e+00f, 5.44398594e+00f, 5.45130396e+00f, 5.45852947e+00f,
+        5.46567249e+00f, 5.47271967e+00f, 5.47967720e+00f, 5.48653889e+00f, 5.49330950e+00f, 5.49998188e+00f,
+        5.50656223e+00f, 5.51304531e+00f, 5.51943207e+00f, 5.52571964e+00f, 5.53191137e+00f, 5.53800440e+00f,
+        5.54399490e+00f, 5.54988623e+00f, 5.55567551e+00f, 5.56136417e+00f, 5.56694651e+00f, 5.57242775e+00f,
+        5.57780313e+00f, 5.58307552e+00f, 5.58824301e+00f, 5.59330177e+00f, 5.59825611e+00f, 5.60309649e+00f,
+        5.60783911e+00f, 5.61246586e+00f, 5.61698818e+00f, 5.62139654e+00f, 5.62569618e+00f, 5.62988520e+00f,
+        5.63395882e+00f, 5.63792181e+00f, 5.64177513e+00f, 5.64551878e+00f, 5.64913750e+00f, 5.65265179e+00f,
+        5.65604687e+00f, 5.65932655e+00f, 5.66249371e+00f, 5.66554165e+00f, 5.66847897e+00f, 5.67129707e+00f,
+        5.67399454e+00f, 5.67658186e+00f, 5.67904854e+00f, 5.68139172e+00f, 5.68362045e+00f, 5.68572903e+00f,
+        5.68771744e+00f, 5.68959188e+00f, 5.69134140e+00f, 5.69297695e+00f, 5.69448566e+00f, 5.69587660e+00f,
+        5.69715071e+00f, 5.69829655e+00f, 5.69932795e+00f, 5.70023489e+00f, 5.70102453e+00f, 5.70169353e+00f,
+        5.70224047e+00f, 5.70266294e+00f, 5.70296574e+00f, 5.70315075e+00f, 5.70320988e+00f, 5.70314932e+00f,
+        5.70296574e+00f, 5.70266151e+00f, 5.70223904e+00f, 5.70169353e+00f, 5.70102596e+00f, 5.70023632e+00f,
+        5.69932795e+00f, 5.69829988e+00f, 5.69714928e+00f, 5.69587660e+00f, 5.69448566e+00f, 5.69297695e+00f,
+        5.69134283e+00f, 5.68959188e+00f, 5.68771887e+00f, 5.68572760e+00f, 5.68361902e+00f, 5.68139172e+00f,
+        5.67904425e+00f, 5.67657757e+00f, 5.67399740e+00f, 5.67129230e+00f, 5.66847897e+00f, 5.66554165e+00f,
+        5.66249371e+00f, 5.65933084e+00f, 5.65604830e+00f, 5.65265322e+00f, 5.64914179e+00f, 5.64551735e+00f,
+        5.64177656e+00f, 5.63792467e+00f, 5.63396025e+00f, 5.62988520e+00f, 5.62569761e+00f, 5.62139797e+00f,
+        5.61698961e+00f, 5.61246729e+00f, 5.60783768e+00f, 5.60310078e+00f, 5.59825754e+00f, 5.59330463e+00f,
+        5.58824587e+00f, 5.58307695e+00f, 5.57780457e+00f, 5.57242632e+00f, 5.56694651e+00f, 5.56135988e+00f,
+        5.55567551e+00f, 5.54988766e+00f, 5.54399490e+00f, 5.53800201e+00f, 5.53191137e+00f, 5.52571821e+00f,
+        5.51943064e+00f, 5.51304436e+00f, 5.50656223e+00f, 5.49998331e+00f, 5.49330854e+00f, 5.48653889e+00f,
+        5.47967577e+00f, 5.47271967e+00f, 5.46567249e+00f, 5.45853090e+00f, 5.45130491e+00f, 5.44398594e+00f,
+        5.43658257e+00f, 5.42908382e+00f, 5.42150497e+00f, 5.41383648e+00f, 5.40608454e+00f, 5.39824867e+00f,
+        5.39032888e+00f, 5.38232851e+00f, 5.37424517e+00f, 5.36608028e+00f, 5.35783577e+00f, 5.34951496e+00f,
+        5.34111214e+00f, 5.33263397e+00f, 5.32408333e+00f, 5.31545258e+00f, 5.30675125e+00f, 5.29797363e+00f,
+        5.28912926e+00f, 5.28020573e+00f, 5.27122021e+00f, 5.26215935e+00f, 5.25303173e+00f, 5.24383736e+00f,
+        5.23457623e+00f, 5.22525120e+00f, 5.21586084e+00f, 5.20640516e+00f, 5.19688940e+00f, 5.18730927e+00f,
+        5.17766809e+00f, 5.16796827e+00f, 5.15820980e+00f, 5.14839125e+00f, 5.13851881e+00f, 5.12858820e+00f,
+        5.11860323e+00f, 5.10856533e+00f, 5.09847307e+00f, 5.08833075e+00f, 5.07813597e+00f, 5.06788635e+00f,
+        5.05759287e+00f, 5.04725122e+00f, 5.03685999e+00f, 5.02642202e+00f, 5.01593876e+00f, 5.00541258e+00f,
+        4.99484205e+00f, 4.98422337e+00f, 4.97356844e+00f, 4.96286821e+00f, 4.95213175e+00f, 4.94135284e+00f,
+        4.93053865e+00f, 4.91968727e+00f, 4.90879869e+00f, 4.89787292e+00f, 4.88691425e+00f, 4.87591839e+00f,
+        4.86489391e+00f, 4.85383654e+00f, 4.84274530e+00f, 4.83162689e+00f, 4.82047844e+00f, 4.80930138e+00f,
+        4.79809427e+00f, 4.78686285e+00f, 4.77560282e+00f, 4.76432085e+00f, 4.75301218e+00f, 4.74168253e+00f,
+        4.73032618e+00f, 4.71894979e+00f, 4.70755196e+00f, 4.69613409e+00f, 4.68469620e+00f, 4.67323971e+00f,
+        4.66176605e+00f, 4.65027428e+00f, 4.63876677e+00f, 4.62724161e+00f, 4.61570454e+00f, 4.60414743e+00f,
+        4.59258461e+00f, 4.58100462e+00f, 4.56941509e+00f, 4.55781460e+00f, 4.54620123e+00f, 4.53457832e+00f,
+        4.52294588e+00f, 4.51130533e+00f, 4.49965620e+00f, 4.48800182e+00f, 4.47634077e+00f, 4.46467543e+00f,
+        4.45300341e+00f, 4.44132566e+00f, 4.42964506e+00f, 4.41796112e+00f, 4.40627527e+00f, 4.39458990e+00f,
+        4.38289928e+00f, 4.37121153e+00f, 4.35952091e+00f, 4.34783125e+00f, 4.33614397e+00f, 4.32445765e+00f,
+        4.31277370e+00f, 4.30109167e+00f, 4.28941536e+00f, 4.27774239e+00f, 4.26607370e+00f, 4.25440598e+00f,
+        4.24275064e+00f, 4.23109818e+00f, 4.21945524e+00f, 4.20781565e+00f, 4.19618654e+00f, 4.18456316e+00f,
+        4.17295170e+00f, 4.16134834e+00f, 4.14975309e+00f, 4.13816881e+00f, 4.12659645e+00f, 4.11503506e+00f,
+        4.10348272e+00f, 4.09194422e+00f, 4.08041859e+00f, 4.06890440e+00f, 4.05740595e+00f, 4.04591990e+00f,
+        4.03444767e+00f, 4.02298975e+00f, 4.01154757e+00f, 4.00012112e+00f, 3.98870993e+00f, 3.97731519e+00f,
+        3.96593547e+00f, 3.95457506e+00f, 3.94322920e+00f, 3.93190265e+00f, 3.92059326e+00f, 3.90930319e+00f,
+        3.89802980e+00f, 3.88677788e+00f, 3.87554479e+00f, 3.86432934e+00f, 3.85313630e+00f, 3.84196210e+00f,
+        3.83080912e+00f, 3.81967711e+00f, 3.80856633e+00f, 3.79747629e+00f, 3.78640842e+00f, 3.77536249e+00f,
+        3.76434016e+00f, 3.75334001e+00f, 3.74236059e+00f, 3.73140502e+00f, 3.72047377e+00f, 3.70956421e+00f,
+        3.69868231e+00f, 3.68782210e+00f, 3.67698574e+00f, 3.66617537e+00f, 3.65538859e+00f, 3.64462757e+00f,
+        3.63389039e+00f, 3.62317991e+00f, 3.61249447e+00f, 3.60183311e+00f, 3.59119964e+00f, 3.58059263e+00f,
+        3.57001209e+00f, 3.55945659e+00f, 3.54892945e+00f, 3.53842616e+00f, 3.52795315e+00f, 3.51750588e+00f,
+        3.50708723e+00f, 3.49669433e+00f, 3.48632979e+00f, 3.47599339e+00f, 3.46568465e+00f, 3.45540428e+00f,
+        3.44515252e+00f, 3.43492746e+00f, 3.42473245e+00f, 3.41456509e+00f, 3.40442681e+00f, 3.39431763e+00f,
+        3.38423729e+00f, 3.37418437e+00f, 3.36416268e+00f, 3.35416961e+00f, 3.34420466e+00f, 3.33427095e+00f,
+        3.32436562e+00f, 3.31449103e+00f, 3.30464411e+00f, 3.29482722e+00f, 3.28504181e+00f, 3.27528524e+00f,
+        3.26555896e+00f, 3.25586295e+00f, 3.24619603e+00f, 3.23656011e+00f, 3.22695422e+00f, 3.21737838e+00f,
+        3.20783401e+00f, 3.19831848e+00f, 3.18883419e+00f, 3.17937970e+00f, 3.16995645e+00f, 3.16056418e+00f,
+        3.15120125e+00f, 3.14186907e+00f, 3.13256764e+00f, 3.12329578e+00f, 3.11405659e+00f, 3.10484695e+00f,
+        3.09566855e+00f, 3.08652115e+00f, 3.07740402e+00f, 3.06831741e+00f, 3.05926204e+00f, 3.05023742e+00f,
+        3.04124308e+00f, 3.03227949e+00f, 3.02334666e+00f, 3.01444626e+00f, 3.00557542e+00f, 2.99673462e+00f,
+        2.98792529e+00f, 2.97914648e+00f, 2.97039914e+00f, 2.96168089e+00f, 2.95299530e+00f, 2.94433951e+00f,
+        2.93571472e+00f, 2.92712021e+00f, 2.91855717e+00f, 2.91002393e+00f, 2.90152168e+00f, 2.89304972e+00f,
+        2.88460898e+00f, 2.87619901e+00f, 2.86781859e+00f, 2.85946846e+00f, 2.85114932e+00f, 2.84285998e+00f,
+        2.83460188e+00f, 2.82637382e+00f, 2.81817627e+00f, 2.81000781e+00f, 2.80187130e+00f, 2.79376364e+00f,
+        2.78568649e+00f, 2.77763939e+00f, 2.76962233e+00f, 2.76163530e+00f, 2.75367880e+00f, 2.74575186e+00f,
+        2.73785353e+00f, 2.72998548e+00f, 2.72214794e+00f, 2.71433997e+00f, 2.70656061e+00f, 2.69881201e+00f,
+        2.69109201e+00f, 2.68340230e+00f, 2.67574072e+00f, 2.66810918e+00f, 2.66050792e+00f, 2.65293455e+00f,
+        2.64539099e+00f, 2.63787580e+00f, 2.63039064e+00f, 2.62293363e+00f, 2.61550570e+00f, 2.60810637e+00f,
+        2.60073662e+00f, 2.59339452e+00f, 2.58608222e+00f, 2.57879686e+00f, 2.57154083e+00f, 2.56431341e+00f,
+        2.55711365e+00f, 2.54994249e+00f, 2.54279947e+00f, 2.53568530e+00f, 2.52859807e+00f, 2.52153945e+00f,
+        2.51450849e+00f, 2.50750566e+00f, 2.50053024e+00f, 2.49358201e+00f, 2.48666215e+00f, 2.47976923e+00f,
+        2.47290397e+00f, 2.46606612e+00f, 2.45925570e+00f, 2.45247173e+00f, 2.44571543e+00f, 2.43898606e+00f,
+        2.43228388e+00f, 2.42560840e+00f, 2.41895986e+00f, 2.41233778e+00f, 2.40574288e+00f, 2.39917374e+00f,
+        2.39263153e+00f, 2.38611579e+00f, 2.37962604e+00f, 2.37316251e+00f, 2.36672521e+00f, 2.36031389e+00f,
+        2.35392904e+00f, 2.34756899e+00f, 2.34123588e+00f, 2.33492756e+00f, 2.32864642e+00f, 2.32238913e+00f,
+        2.31615782e+00f, 2.30995178e+00f, 2.30377126e+00f, 2.29761624e+00f, 2.29148555e+00f, 2.28538060e+00f,
+        2.27930069e+00f, 2.27324533e+00f, 2.26721525e+00f, 2.26120901e+00f, 2.25522780e+00f, 2.24927115e+00f,
+        2.24333882e+00f, 2.23743081e+00f, 2.23154759e+00f, 2.22568846e+00f, 2.21985316e+00f, 2.21404219e+00f,
+        2.20825481e+00f, 2.20249128e+00f, 2.19675183e+00f, 2.19103551e+00f, 2.18534327e+00f, 2.17967415e+00f,
+        2.17402887e+00f, 2.16840696e+00f, 2.16280794e+00f, 2.15723181e+00f, 2.15167975e+00f, 2.14615011e+00f,
+        2.14064336e+00f, 2.13515925e+00f, 2.12969804e+00f, 2.12425971e+00f, 2.11884332e+00f, 2.11345053e+00f,
+        2.10807943e+00f, 2.10273027e+00f, 2.09740400e+00f, 2.09209967e+00f, 2.08681750e+00f, 2.08155704e+00f,
+        2.07631874e+00f, 2.07110190e+00f, 2.06590700e+00f, 2.06073380e+00f, 2.05558252e+00f, 2.05045223e+00f,
+        2.04534388e+00f, 2.04025626e+00f, 2.03519011e+00f, 2.03014517e+00f, 2.02512097e+00f, 2.02011824e+00f,
+        2.01513624e+00f, 2.01017499e+00f, 2.00523424e+00f, 2.00031495e+00f, 1.99541545e+00f, 1.99053633e+00f,
+        1.98567784e+00f, 1.98084009e+00f, 1.97602260e+00f, 1.97122502e+00f, 1.96644735e+00f, 1.96168995e+00f,
+        1.95695221e+00f, 1.95223475e+00f, 1.94753683e+00f, 1.94285846e+00f, 1.93820000e+00f, 1.93356109e+00f,
+        1.92894149e+00f, 1.92434156e+00f, 1.91976058e+00f, 1.91519856e+00f, 1.91065598e+00f, 1.90613234e+00f,
+        1.90162849e+00f, 1.89714313e+00f, 1.89267647e+00f, 1.88822854e+00f, 1.88379920e+00f, 1.87938845e+00f,
+        1.87499630e+00f, 1.87062287e+00f, 1.86626804e+00f, 1.86193097e+00f, 1.85761225e+00f, 1.85331202e+00f,
+        1.84902942e+00f, 1.84476483e+00f, 1.84051836e+00f, 1.83629000e+00f, 1.83207965e+00f, 1.82788634e+00f,
+        1.82371068e+00f, 1.81955302e+00f, 1.81541288e+00f, 1.81128967e+00f, 1.80718434e+00f, 1.80309594e+00f,
+        1.79902494e+00f, 1.79497123e+00f, 1.79093444e+00f, 1.78691459e+00f, 1.78291202e+00f, 1.77892554e+00f,
+        1.77495658e+00f, 1.77100396e+00f, 1.76706827e+00f, 1.76314914e+00f, 1.75924683e+00f, 1.75536048e+00f,
+        1.75149071e+00f, 1.74763703e+00f, 1.74379981e+00f, 1.73997891e+00f, 1.73617387e+00f, 1.73238480e+00f,
+        1.72861195e+00f, 1.72485483e+00f, 1.72111368e+00f, 1.71738827e+00f, 1.71367872e+00f, 1.70998454e+00f,
+        1.70630670e+00f, 1.70264375e+00f, 1.69899607e+00f, 1.69536412e+00f, 1.69174719e+00f, 1.68814576e+00f,
+        1.68455958e+00f, 1.68098831e+00f, 1.67743230e+00f, 1.67389143e+00f, 1.67036569e+00f, 1.66685426e+00f,
+        1.66335785e+00f, 1.65987647e+00f, 1.65640938e+00f, 1.65295720e+00f, 1.64951992e+00f, 1.64609659e+00f,
+        1.64268816e+00f, 1.63929403e+00f, 1.63591433e+00f, 1.63254869e+00f, 1.62919712e+00f, 1.62585998e+00f,
+        1.62253702e+00f, 1.61922765e+00f, 1.61593258e+00f, 1.61265171e+00f, 1.60938442e+00f, 1.60613072e+00f,
+        1.60289109e+00f, 1.59966528e+00f, 1.59645307e+00f, 1.59325445e+00f, 1.59006917e+00f, 1.58689773e+00f,
+        1.58373904e+00f, 1.58059406e+00f, 1.57746255e+00f, 1.57434416e+00f, 1.57123935e+00f, 1.56814730e+00f,
+        1.56506824e+00f, 1.56200242e+00f, 1.55894959e+00f, 1.55590940e+00f, 1.55288255e+00f, 1.54986823e+00f,
+        1.54686689e+00f, 1.54387820e+00f, 1.54090226e+00f, 1.53793883e+00f, 1.53498793e+00f, 1.53204954e+00f,
+        1.52912366e+00f, 1.52621031e+00f, 1.52330935e+00f, 1.52042055e+00f, 1.51754379e+00f, 1.51467991e+00f,
+        1.51182759e+00f, 1.50898755e+00f, 1.50615931e+00f, 1.50334358e+00f, 1.50053942e+00f, 1.49774742e+00f,
+        1.49496722e+00f, 1.49219894e+00f, 1.48944223e+00f, 1.48669744e+00f, 1.48396397e+00f, 1.48124230e+00f,
+        1.47853255e+00f, 1.47583413e+00f, 1.47314715e+00f, 1.47047150e+00f, 1.46780753e+00f, 1.46515453e+00f,
+        1.46251321e+00f, 1.45988286e+00f, 1.45726383e+00f, 1.45465624e+00f, 1.45205951e+00f, 1.44947386e+00f,
+        1.44689918e+00f, 1.44433558e+00f, 1.44178307e+00f, 1.43924105e+00f, 1.43671036e+00f, 1.43419039e+00f,
+        1.43168092e+00f, 1.42918229e+00f, 1.42669439e+00f, 1.42421710e+00f, 1.42175066e+00f, 1.41929436e+00f,
+        1.41684914e+00f, 1.41441417e+00f, 1.41198957e+00f, 1.40957522e+00f, 1.40717101e+00f, 1.40477765e+00f,
+        1.40239418e+00f, 1.40002108e+00f, 1.39765823e+00f, 1.39530551e+00f, 1.39296305e+00f, 1.39063036e+00f,
+        1.38830781e+00f, 1.38599527e+00f, 1.38369262e+00f, 1.38140011e+00f, 1.37911749e+00f, 1.37684453e+00f,
+        1.37458169e+00f, 1.37232804e+00f, 1.37008464e+00f, 1.36785042e+00f, 1.36562622e+00f, 1.36341143e+00f,
+        1.36120641e+00f, 1.35901082e+00f, 1.35682487e+00f, 1.35464835e+00f, 1.35248113e+00f, 1.35032332e+00f,
+        1.34817493e+00f, 1.34603572e+00f, 1.34390616e+00f, 1.34178591e+00f, 1.33967435e+00f, 1.33757222e+00f,
+        1.33547914e+00f, 1.33339536e+00f, 1.33132029e+00f, 1.32925463e+00f, 1.32719815e+00f, 1.32515013e+00f,
+        1.32311130e+00f, 1.32108140e+00f, 1.31906056e+00f, 1.31704831e+00f, 1.31504476e+00f, 1.31305015e+00f,
+        1.31106448e+00f, 1.30908728e+00f, 1.30711865e+00f, 1.30515885e+00f, 1.30320776e+00f, 1.30126500e+00f,
+        1.29933083e+00f, 1.29740512e+00f, 1.29548836e+00f, 1.29357946e+00f, 1.29167938e+00f, 1.28978741e+00f,
+        1.28790402e+00f, 1.28602874e+00f, 1.28416216e+00f, 1.28230369e+00f, 1.28045332e+00f, 1.27861118e+00f,
+        1.27677715e+00f, 1.27495158e+00f, 1.27313375e+00f, 1.27132416e+00f, 1.26952267e+00f, 1.26772916e+00f,
+        1.26594388e+00f, 1.26416659e+00f, 1.26239693e+00f, 1.26063561e+00f, 1.25888169e+00f, 1.25713575e+00f,
+        1.25539780e+00f, 1.25366783e+00f, 1.25194538e+00f, 1.25023079e+00f, 1.24852395e+00f, 1.24682474e+00f,
+        1.24513304e+00f, 1.24344921e+00f, 1.24177313e+00f, 1.24010432e+00f, 1.23844337e+00f, 1.23678970e+00f,
+        1.23514354e+00f, 1.23350513e+00f, 1.23187399e+00f, 1.23025036e+00f, 1.22863400e+00f, 1.22702527e+00f,
+        1.22542381e+00f, 1.22382951e+00f, 1.22224271e+00f, 1.22066319e+00f, 1.21909082e+00f, 1.21752572e+00f,
+        1.21596766e+00f, 1.21441698e+00f, 1.21287346e+00f, 1.21133721e+00f, 1.20980811e+00f, 1.20828581e+00f,
+        1.20677078e+00f, 1.20526266e+00f, 1.20376170e+00f, 1.20226765e+00f, 1.20078075e+00f, 1.19930065e+00f,
+        1.19782758e+00f, 1.19636130e+00f, 1.19490194e+00f, 1.19344938e+00f, 1.19200361e+00f, 1.19056487e+00f,
+        1.18913293e+00f, 1.18770754e+00f, 1.18628907e+00f, 1.18487704e+00f, 1.18347216e+00f, 1.18207359e+00f,
+        1.18068194e+00f, 1.17929697e+00f, 1.17791843e+00f, 1.17654669e+00f, 1.17518127e+00f, 1.17382264e+00f,
+        1.17247033e+00f, 1.17112470e+00f, 1.16978538e+00f, 1.16845262e+00f, 1.16712666e+00f, 1.16580677e+00f,
+        1.16449344e+00f, 1.16318631e+00f, 1.16188586e+00f, 1.16059148e+00f, 1.15930367e+00f, 1.15802217e+00f,
+        1.15674686e+00f, 1.15547788e+00f, 1.15421522e+00f, 1.15295863e+00f, 1.15170848e+00f, 1.15046442e+00f,
+        1.14922631e+00f, 1.14799464e+00f, 1.14676917e+00f, 1.14554977e+00f, 1.14433646e+00f, 1.14312935e+00f,
+        1.14192808e+00f, 1.14073300e+00f, 1.13954425e+00f, 1.13836110e+00f, 1.13718426e+00f, 1.13601327e+00f,
+        1.13484824e+00f, 1.13368917e+00f, 1.13253605e+00f, 1.13138878e+00f, 1.13024747e+00f, 1.12911212e+00f,
+        1.12798262e+00f, 1.12685883e+00f, 1.12574124e+00f, 1.12462914e+00f, 1.12352300e+00f, 1.12242258e+00f,
+        1.12132788e+00f, 1.12023902e+00f, 1.11915600e+00f, 1.11807859e+00f, 1.11700702e+00f, 1.11594105e+00f,
+        1.11488080e+00f, 1.11382592e+00f, 1.11277699e+00f, 1.11173368e+00f, 1.11069596e+00f, 1.10966372e+00f,
+        1.10863733e+00f, 1.10761642e+00f, 1.10660112e+00f, 1.10559118e+00f, 1.10458684e+00f, 1.10358810e+00f,
+        1.10259473e+00f, 1.10160697e+00f, 1.10062456e+00f, 1.09964788e+00f, 1.09867632e+00f, 1.09771025e+00f,
+        1.09674978e+00f, 1.09579456e+00f, 1.09484482e+00f, 1.09390056e+00f, 1.09296155e+00f, 1.09202790e+00f,
+        1.09109950e+00f, 1.09017658e+00f, 1.08925879e+00f, 1.08834660e+00f, 1.08743942e+00f, 1.08653784e+00f,
+        1.08564126e+00f, 1.08474982e+00f, 1.08386385e+00f, 1.08298302e+00f, 1.08210731e+00f, 1.08123696e+00f,
+        1.08037150e+00f, 1.07951152e+00f, 1.07865667e+00f, 1.07780695e+00f, 1.07696235e+00f, 1.07612288e+00f,
+        1.07528853e+00f, 1.07445920e+00f, 1.07363498e+00f, 1.07281590e+00f, 1.07200193e+00f, 1.07119310e+00f,
+        1.07038915e+00f, 1.06959021e+00f, 1.06879640e+00f, 1.06800735e+00f, 1.06722379e+00f, 1.06644499e+00f,
+        1.06567109e+00f, 1.06490219e+00f, 1.06413817e+00f, 1.06337905e+00f, 1.06262505e+00f, 1.06187606e+00f,
+        1.06113195e+00f, 1.06039286e+00f, 1.05965841e+00f, 1.05892885e+00f, 1.05820429e+00f, 1.05748439e+00f,
+        1.05676961e+00f, 1.05605960e+00f, 1.05535436e+00f, 1.05465400e+00f, 1.05395854e+00f, 1.05326772e+00f,
+        1.05258191e+00f, 1.05190063e+00f, 1.05122435e+00f, 1.05055285e+00f, 1.04988611e+00f, 1.04922402e+00f,
+        1.04856670e+00f, 1.04791415e+00f, 1.04726636e+00f, 1.04662311e+00f, 1.04598463e+00f, 1.04535103e+00f,
+        1.04472196e+00f, 1.04409766e+00f, 1.04347801e+00f, 1.04286289e+00f, 1.04225266e+00f, 1.04164684e+00f,
+        1.04104590e+00f, 1.04044962e+00f, 1.03985775e+00f, 1.03927064e+00f, 1.03868830e+00f, 1.03811038e+00f,
+        1.03753710e+00f, 1.03696823e+00f, 1.03640413e+00f, 1.03584445e+00f, 1.03528953e+00f, 1.03473914e+00f,
+        1.03419316e+00f, 1.03365183e+00f, 1.03311503e+00f, 1.03258264e+00f, 1.03205490e+00f, 1.03153157e+00f,
+        1.03101313e+00f, 1.03049874e+00f, 1.02998924e+00f, 1.02948391e+00f, 1.02898300e+00f, 1.02848661e+00f,
+        1.02799487e+00f, 1.02750754e+00f, 1.02702463e+00f, 1.02654624e+00f, 1.02607214e+00f, 1.02560258e+00f,
+        1.02513754e+00f, 1.02467680e+00f, 1.02422047e+00f, 1.02376878e+00f, 1.02332115e+00f, 1.02287829e+00f,
+        1.02243960e+00f, 1.02200532e+00f, 1.02157533e+00f, 1.02114975e+00f, 1.02072871e+00f, 1.02031171e+00f,
+        1.01989937e+00f, 1.01949131e+00f, 1.01908767e+00f, 1.01868832e+00f, 1.01829338e+00f, 1.01790249e+00f,
+        1.01751614e+00f, 1.01713407e+00f, 1.01675653e+00f, 1.01638305e+00f, 1.01601410e+00f, 1.01564932e+00f,
+        1.01528871e+00f, 1.01493239e+00f, 1.01458049e+00f, 1.01423311e+00f, 1.01388979e+00f, 1.01355076e+00f,
+        1.01321590e+00f, 1.01288545e+00f, 1.01255918e+00f, 1.01223707e+00f, 1.01191950e+00f, 1.01160622e+00f,
+        1.01129699e+00f, 1.01099205e+00f, 1.01069129e+00f, 1.01039481e+00f, 1.01010239e+00f, 1.00981450e+00f,
+        1.00953066e+00f, 1.00925112e+00f, 1.00897586e+00f, 1.00870478e+00f, 1.00843787e+00f, 1.00817502e+00f,
+        1.00791657e+00f, 1.00766206e+00f, 1.00741208e+00f, 1.00716627e+00f, 1.00692439e+00f, 1.00668705e+00f,
+        1.00645363e+00f, 1.00622451e+00f, 1.00599945e+00f, 1.00577867e+00f, 1.00556207e+00f, 1.00534964e+00f,
+        1.00514138e+00f, 1.00493717e+00f, 1.00473726e+00f, 1.00454152e+00f, 1.00435007e+00f, 1.00416255e+00f,
+        1.00397921e+00f, 1.00380003e+00f, 1.00362504e+00f, 1.00345433e+00f, 1.00328743e+00f, 1.00312495e+00f,
+        1.00296652e+00f, 1.00281215e+00f, 1.00266194e+00f, 1.00251579e+00f, 1.00237417e+00f, 1.00223649e+00f,
+        1.00210273e+00f, 1.00197315e+00f, 1.00184798e+00f, 1.00172663e+00f, 1.00160944e+00f, 1.00149667e+00f,
+        1.00138760e+00f, 1.00128293e+00f, 1.00118220e+00f, 1.00108564e+00f, 1.00099337e+00f, 1.00090480e+00f,
+        1.00082076e+00f, 1.00074065e+00f, 1.00066471e+00f, 1.00059295e+00f, 1.00052536e+00f, 1.00046158e+00f,
+        1.00040221e+00f, 1.00034666e+00f, 1.00029540e+00f, 1.00024819e+00f, 1.00020504e+00f, 1.00016618e+00f,
+        1.00013125e+00f, 1.00010061e+00f, 1.00007403e+00f, 1.00005126e+00f, 1.00003278e+00f, 1.00001848e+00f,
+        1.00000823e+00f, 1.00000203e+00f
+    };
+
+    static const float cbwindow2048[2048] = {
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 9.42155748e-06f, 3.76858734e-05f, 8.47918855e-05f,
+        1.50737818e-04f, 2.35521176e-04f, 3.39138787e-04f, 4.61586722e-04f, 6.02860353e-04f, 7.62954412e-04f,
+        9.41862818e-04f, 1.13957888e-03f, 1.35609508e-03f, 1.59140327e-03f, 1.84549461e-03f, 2.11835955e-03f,
+        2.40998762e-03f, 2.72036809e-03f, 3.04948934e-03f, 3.39733856e-03f, 3.76390293e-03f, 4.14916826e-03f,
+        4.55312105e-03f, 4.97574452e-03f, 5.41702425e-03f, 5.87694254e-03f, 6.35548262e-03f, 6.85262633e-03f,
+        7.36835506e-03f, 7.90264923e-03f, 8.45548790e-03f, 9.02685244e-03f, 9.61671863e-03f, 1.02250660e-02f,
+        1.08518712e-02f, 1.14971101e-02f, 1.21607594e-02f, 1.28427930e-02f, 1.35431867e-02f, 1.42619126e-02f,
+        1.49989435e-02f, 1.57542527e-02f, 1.65278111e-02f, 1.73195899e-02f, 1.81295592e-02f, 1.89576894e-02f,
+        1.98039468e-02f, 2.06683017e-02f, 2.15507206e-02f, 2.24511698e-02f, 2.33696178e-02f, 2.43060254e-02f,
+        2.52603628e-02f, 2.62325890e-02f, 2.72226725e-02f, 2.82305703e-02f, 2.92562488e-02f, 3.02996691e-02f,
+        3.13607901e-02f, 3.24395709e-02f, 3.35359722e-02f, 3.46499532e-02f, 3.57814729e-02f, 3.69304866e-02f,
+        3.80969495e-02f, 3.92808206e-02f, 4.04820554e-02f, 4.17006090e-02f, 4.29364331e-02f, 4.41894792e-02f,
+        4.54597063e-02f, 4.67470624e-02f, 4.80515026e-02f, 4.93729711e-02f, 5.07114232e-02f, 5.20668104e-02f,
+        5.34390733e-02f, 5.48281707e-02f, 5.62340394e-02f, 5.76566346e-02f, 5.90959005e-02f, 6.05517812e-02f,
+        6.20242245e-02f, 6.35131747e-02f, 6.50185719e-02f, 6.65403605e-02f, 6.80784881e-02f, 6.96328953e-02f,
+        7.12035149e-02f, 7.27902949e-02f, 7.43931830e-02f, 7.60121047e-02f, 7.76470006e-02f, 7.92978182e-02f,
+        8.09644908e-02f, 8.26469585e-02f, 8.43451470e-02f, 8.60590041e-02f, 8.77884626e-02f, 8.95334482e-02f,
+        9.12939087e-02f, 9.30697769e-02f, 9.48609710e-02f, 9.66674387e-02f, 9.84891057e-02f, 1.00325905e-01f,
+        1.02177761e-01f, 1.04044616e-01f, 1.05926394e-01f, 1.07823014e-01f, 1.09734423e-01f, 1.11660540e-01f,
+        1.13601282e-01f, 1.15556598e-01f, 1.17526397e-01f, 1.19510606e-01f, 1.21509157e-01f, 1.23521976e-01f,
+        1.25548974e-01f, 1.27590090e-01f, 1.29645243e-01f, 1.31714344e-01f, 1.33797333e-01f, 1.35894120e-01f,
+        1.38004631e-01f, 1.40128776e-01f, 1.42266497e-01f, 1.44417688e-01f, 1.46582291e-01f, 1.48760200e-01f,
+        1.50951356e-01f, 1.53155655e-01f, 1.55373037e-01f, 1.57603398e-01f, 1.59846663e-01f, 1.62102759e-01f,
+        1.64371580e-01f, 1.66653052e-01f, 1.68947086e-01f, 1.71253592e-01f, 1.73572496e-01f, 1.75903693e-01f,
+        1.78247109e-01f, 1.80602640e-01f, 1.82970226e-01f, 1.85349748e-01f, 1.87741131e-01f, 1.90144271e-01f,
+        1.92559108e-01f, 1.94985524e-01f, 1.97423428e-01f, 1.99872732e-01f, 2.02333361e-01f, 2.04805195e-01f,
+        2.07288161e-01f, 2.09782153e-01f, 2.12287098e-01f, 2.14802861e-01f, 2.17329398e-01f, 2.19866574e-01f,
+        2.22414300e-01f, 2.24972501e-01f, 2.27541059e-01f, 2.30119884e-01f, 2.32708886e-01f, 2.35307962e-01f,
+        2.37917006e-01f, 2.40535930e-01f, 2.43164629e-01f, 2.45803013e-01f, 2.48450965e-01f, 2.51108408e-01f,
+        2.53775239e-01f, 2.56451339e-01f, 2.59136617e-01f, 2.61830956e-01f, 2.64534295e-01f, 2.67246515e-01f,
+        2.69967467e-01f, 2.72697121e-01f, 2.75435328e-01f, 2.78182000e-01f, 2.80937046e-01f, 2.83700347e-01f,
+        2.86471784e-01f, 2.89251268e-01f, 2.92038709e-01f, 2.94833958e-01f, 2.97636956e-01f, 3.00447583e-01f,
+        3.03265750e-01f, 3.06091309e-01f, 3.08924168e-01f, 3.11764240e-01f, 3.14611405e-01f, 3.17465544e-01f,
+        3.20326596e-01f, 3.23194385e-01f, 3.26068848e-01f, 3.28949869e-01f, 3.31837326e-01f, 3.34731132e-01f,
+        3.37631166e-01f, 3.40537310e-01f, 3.43449473e-01f, 3.46367538e-01f, 3.49291384e-01f, 3.52220923e-01f,
+        3.55156004e-01f, 3.58096570e-01f, 3.61042470e-01f, 3.63993615e-01f, 3.66949886e-01f, 3.69911164e-01f,
+        3.72877330e-01f, 3.75848323e-01f, 3.78823966e-01f, 3.81804198e-01f, 3.84788871e-01f, 3.87777865e-01f,
+        3.90771121e-01f, 3.93768489e-01f, 3.96769851e-01f, 3.99775088e-01f, 4.02784139e-01f, 4.05796826e-01f,
+        4.08813089e-01f, 4.11832750e-01f, 4.14855748e-01f, 4.17881966e-01f, 4.20911282e-01f, 4.23943579e-01f,
+        4.26978737e-01f, 4.30016637e-01f, 4.33057189e-01f, 4.36100245e-01f, 4.39145714e-01f, 4.42193508e-01f,
+        4.45243448e-01f, 4.48295444e-01f, 4.51349407e-01f, 4.54405218e-01f, 4.57462728e-01f, 4.60521847e-01f,
+        4.63582426e-01f, 4.66644406e-01f, 4.69707638e-01f, 4.72772002e-01f, 4.75837409e-01f, 4.78903711e-01f,
+        4.81970817e-01f, 4.85038608e-01f, 4.88106966e-01f, 4.91175771e-01f, 4.94244903e-01f, 4.97314245e-01f,
+        5.00383675e-01f, 5.03453135e-01f, 5.06522417e-01f, 5.09591460e-01f, 5.12660146e-01f, 5.15728414e-01f,
+        5.18796027e-01f, 5.21862924e-01f, 5.24929047e-01f, 5.27994156e-01f, 5.31058252e-01f, 5.34121215e-01f,
+        5.37182868e-01f, 5.40243089e-01f, 5.43301821e-01f, 5.46358883e-01f, 5.49414277e-01f, 5.52467763e-01f,
+        5.55519223e-01f, 5.58568656e-01f, 5.61615884e-01f, 5.64660728e-01f, 5.67703187e-01f, 5.70743084e-01f,
+        5.73780298e-01f, 5.76814771e-01f, 5.79846323e-01f, 5.82874894e-01f, 5.85900307e-01f, 5.88922501e-01f,
+        5.91941297e-01f, 5.94956696e-01f, 5.97968459e-01f, 6.00976586e-01f, 6.03980839e-01f, 6.06981218e-01f,
+        6.09977603e-01f, 6.12969756e-01f, 6.15957737e-01f, 6.18941307e-01f, 6.21920407e-01f, 6.24894857e-01f,
+        6.27864659e-01f, 6.30829632e-01f, 6.33789659e-01f, 6.36744678e-01f, 6.39694512e-01f, 6.42639101e-01f,
+        6.45578265e-01f, 6.48512006e-01f, 6.51440144e-01f, 6.54362500e-01f, 6.57279134e-01f, 6.60189807e-01f,
+        6.63094401e-01f, 6.65992916e-01f, 6.68885112e-01f, 6.71770990e-01f, 6.74650371e-01f, 6.77523196e-01f,
+        6.80389285e-01f, 6.83248639e-01f, 6.86101019e-01f, 6.88946426e-01f, 6.91784739e-01f, 6.94615781e-01f,
+        6.97439492e-01f, 7.00255752e-01f, 7.03064501e-01f, 7.05865562e-01f, 7.08658874e-01f, 7.11444378e-01f,
+        7.14221835e-01f, 7.16991246e-01f, 7.19752491e-01f, 7.22505450e-01f, 7.25250006e-01f, 7.27986097e-01f,
+        7.30713606e-01f, 7.33432353e-01f, 7.36142397e-01f, 7.38843441e-01f, 7.41535544e-01f, 7.44218528e-01f,
+        7.46892333e-01f, 7.49556839e-01f, 7.52211928e-01f, 7.54857481e-01f, 7.57493436e-01f, 7.60119736e-01f,
+        7.62736201e-01f, 7.65342772e-01f, 7.67939329e-01f, 7.70525753e-01f, 7.73102045e-01f, 7.75668025e-01f,
+        7.78223634e-01f, 7.80768692e-01f, 7.83303261e-01f, 7.85827100e-01f, 7.88340151e-01f, 7.90842354e-01f,
+        7.93333590e-01f, 7.95813799e-01f, 7.98282862e-01f, 8.00740659e-01f, 8.03187132e-01f, 8.05622160e-01f,
+        8.08045685e-01f, 8.10457587e-01f, 8.12857807e-01f, 8.15246224e-01f, 8.17622781e-01f, 8.19987357e-01f,
+        8.22339892e-01f, 8.24680269e-01f, 8.27008367e-01f, 8.29324186e-01f, 8.31627607e-01f, 8.33918512e-01f,
+        8.36196840e-01f, 8.38462472e-01f, 8.40715349e-01f, 8.42955410e-01f, 8.45182538e-01f, 8.47396672e-01f,
+        8.49597692e-01f, 8.51785541e-01f, 8.53960097e-01f, 8.56121361e-01f, 8.58269215e-01f, 8.60403538e-01f,
+        8.62524271e-01f, 8.64631355e-01f, 8.66724730e-01f, 8.68804216e-01f, 8.70869875e-01f, 8.72921526e-01f,
+        8.74959111e-01f, 8.76982570e-01f, 8.78991842e-01f, 8.80986810e-01f, 8.82967412e-01f, 8.84933591e-01f,
+        8.86885285e-01f, 8.88822377e-01f, 8.90744805e-01f, 8.92652512e-01f, 8.94545436e-01f, 8.96423519e-01f,
+        8.98286581e-01f, 9.00134683e-01f, 9.01967704e-01f, 9.03785586e-01f, 9.05588269e-01f, 9.07375634e-01f,
+        9.09147680e-01f, 9.10904229e-01f, 9.12645340e-01f, 9.14370954e-01f, 9.16080892e-01f, 9.17775154e-01f,
+        9.19453681e-01f, 9.21116352e-01f, 9.22763228e-01f, 9.24394131e-01f, 9.26009059e-01f, 9.27607894e-01f,
+        9.29190636e-01f, 9.30757225e-01f, 9.32307541e-01f, 9.33841646e-01f, 9.35359299e-01f, 9.36860621e-01f,
+        9.38345432e-01f, 9.39813733e-01f, 9.41265464e-01f, 9.42700565e-01f, 9.44118977e-01f, 9.45520699e-01f,
+        9.46905553e-01f, 9.48273599e-01f, 9.49624777e-01f, 9.50958967e-01f, 9.52276230e-01f, 9.53576386e-01f,
+        9.54859436e-01f, 9.56125379e-01f, 9.57374156e-01f, 9.58605647e-01f, 9.59819853e-01f, 9.61016774e-01f,
+        9.62196290e-01f, 9.63358402e-01f, 9.64503050e-01f, 9.65630174e-01f, 9.66739774e-01f, 9.67831790e-01f,
+        9.68906164e-01f, 9.69962835e-01f, 9.71001863e-01f, 9.72023070e-01f, 9.73026514e-01f, 9.74012136e-01f,
+        9.74979877e-01f, 9.75929737e-01f, 9.76861656e-01f, 9.77775633e-01f, 9.78671551e-01f, 9.79549468e-01f,
+        9.80409324e-01f, 9.81251061e-01f, 9.82074618e-01f, 9.82880056e-01f, 9.83667314e-01f, 9.84436274e-01f,
+        9.85187054e-01f, 9.85919476e-01f, 9.86633658e-01f, 9.87329423e-01f, 9.88006890e-01f, 9.88665938e-01f,
+        9.89306569e-01f, 9.89928722e-01f, 9.90532458e-01f, 9.91117716e-01f, 9.91684437e-01f, 9.92232680e-01f,
+        9.92762327e-01f, 9.93273377e-01f, 9.93765891e-01f, 9.94239807e-01f, 9.94695067e-01f, 9.95131671e-01f,
+        9.95549619e-01f, 9.95948911e-01f, 9.96329486e-01f, 9.96691406e-01f, 9.97034550e-01f, 9.97358978e-01f,
+        9.97664690e-01f, 9.97951627e-01f, 9.98219788e-01f, 9.98469174e-01f, 9.98699784e-01f, 9.98911619e-01f,
+        9.99104619e-01f, 9.99278843e-01f, 9.99434233e-01f, 9.99570787e-01f, 9.99688506e-01f, 9.99787450e-01f,
+        9.99867499e-01f, 9.99928772e-01f, 9.99971151e-01f, 9.99994695e-01f, 9.99999404e-01f, 9.99985278e-01f,
+        9.99952316e-01f, 9.99900460e-01f, 9.99829829e-01f, 9.99740362e-01f, 9.99632001e-01f, 9.99504864e-01f,
+        9.99358892e-01f, 9.99194086e-01f, 9.99010444e-01f, 9.98808026e-01f, 9.98586833e-01f, 9.98346806e-01f,
+        9.98088062e-01f, 9.97810483e-01f, 9.97514188e-01f, 9.97199118e-01f, 9.96865332e-01f, 9.96512771e-01f,
+        9.96141553e-01f, 9.95751619e-01f, 9.95342970e-01f, 9.94915664e-01f, 9.94469762e-01f, 9.94005144e-01f,
+        9.93521988e-01f, 9.93020177e-01f, 9.92499828e-01f, 9.91960883e-01f, 9.91403401e-01f, 9.90827441e-01f,
+        9.90232944e-01f, 9.89619970e-01f, 9.88988519e-01f, 9.88338709e-01f, 9.87670481e-01f, 9.86983836e-01f,
+        9.86278832e-01f, 9.85555530e-01f, 9.84813929e-01f, 9.84054089e-01f, 9.83275950e-01f, 9.82479632e-01f,
+        9.81665134e-01f, 9.80832458e-01f, 9.79981661e-01f, 9.79112804e-01f, 9.78225827e-01f, 9.77320910e-01f,
+        9.76397991e-01f, 9.75457072e-01f, 9.74498272e-01f, 9.73521590e-01f, 9.72527027e-01f, 9.71514702e-01f,
+        9.70484555e-01f, 9.69436705e-01f, 9.68371153e-01f, 9.67287958e-01f, 9.66187179e-01f, 9.65068817e-01f,
+        9.63932931e-01f, 9.62779522e-01f, 9.61608708e-01f, 9.60420489e-01f, 9.59214926e-01f, 9.57992077e-01f,
+        9.56751943e-01f, 9.55494583e-01f, 9.54220057e-01f, 9.52928424e-01f, 9.51619744e-01f, 9.50294018e-01f,
+        9.48951304e-01f, 9.47591722e-01f, 9.46215212e-01f, 9.44821954e-01f, 9.43411887e-01f, 9.41985130e-01f,
+        9.40541685e-01f, 9.39081669e-01f, 9.37605083e-01f, 9.36111987e-01f, 9.34602499e-01f, 9.33076620e-01f,
+        9.31534410e-01f, 9.29975986e-01f, 9.28401291e-01f, 9.26810503e-01f, 9.25203562e-01f, 9.23580647e-01f,
+        9.21941757e-01f, 9.20287013e-01f, 9.18616354e-01f, 9.16929960e-01f, 9.15227830e-01f, 9.13510084e-01f,
+        9.11776721e-01f, 9.10027862e-01f, 9.08263564e-01f, 9.06483889e-01f, 9.04688835e-01f, 9.02878582e-01f,
+        9.01053131e-01f, 8.99212539e-01f, 8.97356927e-01f, 8.95486355e-01f, 8.93600821e-01f, 8.91700506e-01f,
+        8.89785409e-01f, 8.87855649e-01f, 8.85911226e-01f, 8.83952320e-01f, 8.81978929e-01f, 8.79991114e-01f,
+        8.77988994e-01f, 8.75972629e-01f, 8.73942077e-01f, 8.71897459e-01f, 8.69838774e-01f, 8.67766201e-01f,
+        8.65679741e-01f, 8.63579512e-01f, 8.61465633e-01f, 8.59338045e-01f, 8.57196987e-01f, 8.55042398e-01f,
+        8.52874458e-01f, 8.50693226e-01f, 8.48498821e-01f, 8.46291244e-01f, 8.44070613e-01f, 8.41836989e-01f,
+        8.39590490e-01f, 8.37331235e-01f, 8.35059226e-01f, 8.32774639e-01f, 8.30477476e-01f, 8.28167856e-01f,
+        8.25845838e-01f, 8.23511600e-01f, 8.21165144e-01f, 8.18806589e-01f, 8.16435993e-01f, 8.14053535e-01f,
+        8.11659157e-01f, 8.09253097e-01f, 8.06835353e-01f, 8.04406106e-01f, 8.01965296e-01f, 7.99513161e-01f,
+        7.97049701e-01f, 7.94575095e-01f, 7.92089343e-01f, 7.89592624e-01f, 7.87084997e-01f, 7.84566522e-01f,
+        7.82037318e-01f, 7.79497504e-01f, 7.76947141e-01f, 7.74386346e-01f, 7.71815181e-01f, 7.69233823e-01f,
+        7.66642272e-01f, 7.64040709e-01f, 7.61429191e-01f, 7.58807838e-01f, 7.56176651e-01f, 7.53535867e-01f,
+        7.50885546e-01f, 7.48225749e-01f, 7.45556593e-01f, 7.42878199e-01f, 7.40190625e-01f, 7.37494051e-01f,
+        7.34788477e-01f, 7.32074082e-01f, 7.29350924e-01f, 7.26619124e-01f, 7.23878801e-01f, 7.21130013e-01f,
+        7.18372881e-01f, 7.15607584e-01f, 7.12834120e-01f, 7.10052609e-01f, 7.07263231e-01f, 7.04465985e-01f,
+        7.01661110e-01f, 6.98848546e-01f, 6.96028531e-01f, 6.93201184e-01f, 6.90366507e-01f, 6.87524617e-01f,
+        6.84675694e-01f, 6.81819856e-01f, 6.78957105e-01f, 6.76087618e-01f, 6.73211515e-01f, 6.70328856e-01f,
+        6.67439818e-01f, 6.64544463e-01f, 6.61642849e-01f, 6.58735216e-01f, 6.55821562e-01f, 6.52902067e-01f,
+        6.49976790e-01f, 6.47045851e-01f, 6.44109368e-01f, 6.41167462e-01f, 6.38220251e-01f, 6.35267794e-01f,
+        6.32310271e-01f, 6.29347742e-01f, 6.26380384e-01f, 6.23408198e-01f, 6.20431423e-01f, 6.17450058e-01f,
+        6.14464283e-01f, 6.11474216e-01f, 6.08479917e-01f, 6.05481565e-01f, 6.02479219e-01f, 5.99473000e-01f,
+        5.96463025e-01f, 5.93449414e-01f, 5.90432346e-01f, 5.87411821e-01f, 5.84387958e-01f, 5.81360996e-01f,
+        5.78330934e-01f, 5.75297892e-01f, 5.72262049e-01f, 5.69223464e-01f, 5.66182256e-01f, 5.63138604e-01f,
+        5.60092568e-01f, 5.57044208e-01f, 5.53993762e-01f, 5.50941229e-01f, 5.47886789e-01f, 5.44830561e-01f,
+        5.41772664e-01f, 5.38713157e-01f, 5.35652220e-01f, 5.32589912e-01f, 5.29526353e-01f, 5.26461720e-01f,
+        5.23396075e-01f, 5.20329595e-01f, 5.17262280e-01f, 5.14194369e-01f, 5.11125863e-01f, 5.08056998e-01f,
+        5.04987776e-01f, 5.01918435e-01f, 4.98848945e-01f, 4.95779544e-01f, 4.92710292e-01f, 4.89641309e-01f,
+        4.86572713e-01f, 4.83504653e-01f, 4.80437189e-01f, 4.77370471e-01f, 4.74304587e-01f, 4.71239686e-01f,
+        4.68175888e-01f, 4.65113252e-01f, 4.62051958e-01f, 4.58992094e-01f, 4.55933750e-01f, 4.52877074e-01f,
+        4.49822187e-01f, 4.46769208e-01f, 4.43718195e-01f, 4.40669328e-01f, 4.37622696e-01f, 4.34578419e-01f,
+        4.31536585e-01f, 4.28497344e-01f, 4.25460786e-01f, 4.22427058e-01f, 4.19396251e-01f, 4.16368484e-01f,
+        4.13343847e-01f, 4.10322487e-01f, 4.07304525e-01f, 4.04290020e-01f, 4.01279151e-01f, 3.98272008e-01f,
+        3.95268679e-01f, 3.92269284e-01f, 3.89273971e-01f, 3.86282831e-01f, 3.83295983e-01f, 3.80313516e-01f,
+        3.77335548e-01f, 3.74362230e-01f, 3.71393651e-01f, 3.68429899e-01f, 3.65471095e-01f, 3.62517387e-01f,
+        3.59568864e-01f, 3.56625617e-01f, 3.53687763e-01f, 3.50755453e-01f, 3.47828746e-01f, 3.44907761e-01f,
+        3.41992646e-01f, 3.39083493e-01f, 3.36180389e-01f, 3.33283454e-01f, 3.30392808e-01f, 3.27508539e-01f,
+        3.24630797e-01f, 3.21759641e-01f, 3.18895221e-01f, 3.16037625e-01f, 3.13186944e-01f, 3.10343325e-01f,
+        3.07506830e-01f, 3.04677606e-01f, 3.01855743e-01f, 2.99041331e-01f, 2.96234518e-01f, 2.93435365e-01f,
+        2.90643990e-01f, 2.87860513e-01f, 2.85085052e-01f, 2.82317668e-01f, 2.79558480e-01f, 2.76807636e-01f,
+        2.74065167e-01f, 2.71331221e-01f, 2.68605888e-01f, 2.65889287e-01f, 2.63181508e-01f, 2.60482669e-01f,
+        2.57792830e-01f, 2.55112141e-01f, 2.52440661e-01f, 2.49778509e-01f, 2.47125804e-01f, 2.44482622e-01f,
+        2.41849065e-01f, 2.39225239e-01f, 2.36611232e-01f, 2.34007165e-01f, 2.31413126e-01f, 2.28829190e-01f,
+        2.26255491e-01f, 2.23692104e-01f, 2.21139118e-01f, 2.18596652e-01f, 2.16064796e-01f, 2.13543624e-01f,
+        2.11033270e-01f, 2.08533794e-01f, 2.06045300e-01f, 2.03567877e-01f, 2.01101646e-01f, 1.98646665e-01f,
+        1.96203038e-01f, 1.93770871e-01f, 1.91350237e-01f, 1.88941240e-01f, 1.86543956e-01f, 1.84158489e-01f,
+        1.81784928e-01f, 1.79423362e-01f, 1.77073881e-01f, 1.74736559e-01f, 1.72411501e-01f, 1.70098782e-01f,
+        1.67798504e-01f, 1.65510744e-01f, 1.63235575e-01f, 1.60973117e-01f, 1.58723429e-01f, 1.56486601e-01f,
+        1.54262722e-01f, 1.52051866e-01f, 1.49854124e-01f, 1.47669584e-01f, 1.45498320e-01f, 1.43340409e-01f,
+        1.41195953e-01f, 1.39065012e-01f, 1.36947662e-01f, 1.34844005e-01f, 1.32754117e-01f, 1.30678058e-01f,
+        1.28615916e-01f, 1.26567781e-01f, 1.24533705e-01f, 1.22513786e-01f, 1.20508097e-01f, 1.18516706e-01f,
+        1.16539687e-01f, 1.14577122e-01f, 1.12629086e-01f, 1.10695645e-01f, 1.08776875e-01f, 1.06872857e-01f,
+        1.04983643e-01f, 1.03109322e-01f, 1.01249956e-01f, 9.94056165e-02f, 9.75763798e-02f, 9.57623050e-02f,
+        9.39634591e-02f, 9.21799242e-02f, 9.04117525e-02f, 8.86590183e-02f, 8.69217888e-02f, 8.52001235e-02f,
+        8.34940895e-02f, 8.18037540e-02f, 8.01291764e-02f, 7.84704238e-02f, 7.68275559e-02f, 7.52006397e-02f,
+        7.35897273e-02f, 7.19948933e-02f, 7.04161823e-02f, 6.88536614e-02f, 6.73073903e-02f, 6.57774210e-02f,
+        6.42638206e-02f, 6.27666414e-02f, 6.12859391e-02f, 5.98217696e-02f, 5.83741888e-02f, 5.69432527e-02f,
+        5.55290096e-02f, 5.41315228e-02f, 5.27508333e-02f, 5.13870046e-02f, 5.00400774e-02f, 4.87101115e-02f,
+        4.73971516e-02f, 4.61012460e-02f, 4.48224507e-02f, 4.35608067e-02f, 4.23163660e-02f, 4.10891697e-02f,
+        3.98792699e-02f, 3.86867113e-02f, 3.75115387e-02f, 3.63537930e-02f, 3.52135226e-02f, 3.40907685e-02f,
+        3.29855718e-02f, 3.18979733e-02f, 3.08280177e-02f, 2.97757443e-02f, 2.87411902e-02f, 2.77243964e-02f,
+        2.67254021e-02f, 2.57442426e-02f, 2.47809552e-02f, 2.38355789e-02f, 2.29081456e-02f, 2.19986942e-02f,
+        2.11072545e-02f, 2.02338640e-02f, 1.93785541e-02f, 1.85413565e-02f, 1.77223030e-02f, 1.69214252e-02f,
+        1.61387529e-02f, 1.53743150e-02f, 1.46281412e-02f, 1.39002595e-02f, 1.31906969e-02f, 1.24994796e-02f,
+        1.18266353e-02f, 1.11721884e-02f, 1.05361631e-02f, 9.91858356e-03f, 9.31947399e-03f, 8.73885583e-03f,
+        8.17675143e-03f, 7.63318269e-03f, 7.10816868e-03f, 6.60173036e-03f, 6.11388590e-03f, 5.64465486e-03f,
+        5.19405352e-03f, 4.76210006e-03f, 4.34880983e-03f, 3.95419914e-03f, 3.57828219e-03f, 3.22107365e-03f,
+        2.88258679e-03f, 2.56283465e-03f, 2.26182886e-03f, 1.97958108e-03f, 1.71610166e-03f, 1.47140073e-03f,
+        1.24548748e-03f, 1.03837030e-03f, 8.50057229e-04f, 6.80555182e-04f, 5.29870624e-04f, 3.98009230e-04f,
+        2.84975918e-04f, 1.90774997e-04f, 1.15409995e-04f, 5.88837611e-05f, 2.11984207e-05f, 2.35539483e-06f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f
+    };
+    static const float acwinv2048[2048] = {
+        1.00000000e+00f, 1.00000644e+00f, 1.00002515e+00f, 1.00005662e+00f, 1.00010049e+00f, 1.00015712e+00f,
+        1.00022614e+00f, 1.00030792e+00f, 1.00040209e+00f, 1.00050902e+00f, 1.00062823e+00f, 1.00076020e+00f,
+        1.00090480e+00f, 1.00106192e+00f, 1.00123191e+00f, 1.00141418e+00f, 1.00160933e+00f, 1.00181687e+00f,
+        1.00203705e+00f, 1.00226998e+00f, 1.00251555e+00f, 1.00277400e+00f, 1.00304472e+00f, 1.00332844e+00f,
+        1.00362456e+00f, 1.00393355e+00f, 1.00425518e+00f, 1.00458956e+00f, 1.00493658e+00f, 1.00529647e+00f,
+        1.00566912e+00f, 1.00605452e+00f, 1.00645280e+00f, 1.00686395e+00f, 1.00728786e+00f, 1.00772429e+00f,
+        1.00817394e+00f, 1.00863636e+00f, 1.00911164e+00f, 1.00959992e+00f, 1.01010108e+00f, 1.01061535e+00f,
+        1.01114213e+00f, 1.01168239e+00f, 1.01223540e+00f, 1.01280165e+00f, 1.01338089e+00f, 1.01397324e+00f,
+        1.01457858e+00f, 1.01519716e+00f, 1.01582873e+00f, 1.01647365e+00f, 1.01713157e+00f, 1.01780307e+00f,
+        1.01848745e+00f, 1.01918554e+00f, 1.01989663e+00f, 1.02062106e+00f, 1.02135885e+00f, 1.02211010e+00f,
+        1.02287483e+00f, 1.02365291e+00f, 1.02444458e+00f, 1.02524972e+00f, 1.02606845e+00f, 1.02690089e+00f,
+        1.02774668e+00f, 1.02860641e+00f, 1.02947950e+00f, 1.03036654e+00f, 1.03126717e+00f, 1.03218198e+00f,
+        1.03311038e+00f, 1.03405261e+00f, 1.03500867e+00f, 1.03597879e+00f, 1.03696287e+00f, 1.03796101e+00f,
+        1.03897333e+00f, 1.03999960e+00f, 1.04104006e+00f, 1.04209483e+00f, 1.04316378e+00f, 1.04424703e+00f,
+        1.04534459e+00f, 1.04645669e+00f, 1.04758263e+00f, 1.04872382e+00f, 1.04987895e+00f, 1.05104899e+00f,
+        1.05223334e+00f, 1.05343246e+00f, 1.05464625e+00f, 1.05587494e+00f, 1.05711830e+00f, 1.05837667e+00f,
+        1.05964971e+00f, 1.06093800e+00f, 1.06224120e+00f, 1.06355953e+00f, 1.06489289e+00f, 1.06624150e+00f,
+        1.06760526e+00f, 1.06898463e+00f, 1.07037890e+00f, 1.07178891e+00f, 1.07321429e+00f, 1.07465506e+00f,
+        1.07611179e+00f, 1.07758403e+00f, 1.07907212e+00f, 1.08057559e+00f, 1.08209538e+00f, 1.08363080e+00f,
+        1.08518231e+00f, 1.08674991e+00f, 1.08833361e+00f, 1.08993363e+00f, 1.09154963e+00f, 1.09318233e+00f,
+        1.09483123e+00f, 1.09649658e+00f, 1.09817851e+00f, 1.09987676e+00f, 1.10159194e+00f, 1.10332406e+00f,
+        1.10507286e+00f, 1.10683858e+00f, 1.10862136e+00f, 1.11042130e+00f, 1.11223817e+00f, 1.11407232e+00f,
+        1.11592364e+00f, 1.11779261e+00f, 1.11967909e+00f, 1.12158298e+00f, 1.12350464e+00f, 1.12544394e+00f,
+        1.12740111e+00f, 1.12937605e+00f, 1.13136911e+00f, 1.13338029e+00f, 1.13540959e+00f, 1.13745725e+00f,
+        1.13952315e+00f, 1.14160764e+00f, 1.14371037e+00f, 1.14583218e+00f, 1.14797235e+00f, 1.15013170e+00f,
+        1.15230978e+00f, 1.15450704e+00f, 1.15672314e+00f, 1.15895879e+00f, 1.16121340e+00f, 1.16348779e+00f,
+        1.16578150e+00f, 1.16809511e+00f, 1.17042840e+00f, 1.17278147e+00f, 1.17515457e+00f, 1.17754769e+00f,
+        1.17996120e+00f, 1.18239474e+00f, 1.18484890e+00f, 1.18732357e+00f, 1.18981874e+00f, 1.19233513e+00f,
+        1.19487202e+00f, 1.19742990e+00f, 1.20000911e+00f, 1.20260930e+00f, 1.20523119e+00f, 1.20787454e+00f,
+        1.21053922e+00f, 1.21322608e+00f, 1.21593451e+00f, 1.21866536e+00f, 1.22141802e+00f, 1.22419286e+00f,
+        1.22699022e+00f, 1.22981048e+00f, 1.23265278e+00f, 1.23551857e+00f, 1.23840678e+00f, 1.24131835e+00f,
+        1.24425304e+00f, 1.24721134e+00f, 1.25019288e+00f, 1.25319815e+00f, 1.25622749e+00f, 1.25928080e+00f,
+        1.26235783e+00f, 1.26545942e+00f, 1.26858556e+00f, 1.27173615e+00f, 1.27491140e+00f, 1.27811182e+00f,
+        1.28133690e+00f, 1.28458750e+00f, 1.28786349e+00f, 1.29116499e+00f, 1.29449213e+00f, 1.29784524e+00f,
+        1.30122435e+00f, 1.30462968e+00f, 1.30806172e+00f, 1.31151998e+00f, 1.31500530e+00f, 1.31851721e+00f,
+        1.32205641e+00f, 1.32562327e+00f, 1.32921731e+00f, 1.33283913e+00f, 1.33648849e+00f, 1.34016621e+00f,
+        1.34387195e+00f, 1.34760630e+00f, 1.35136902e+00f, 1.35516083e+00f, 1.35898161e+00f, 1.36283171e+00f,
+        1.36671090e+00f, 1.37062013e+00f, 1.37455904e+00f, 1.37852800e+00f, 1.38252699e+00f, 1.38655698e+00f,
+        1.39061725e+00f, 1.39470911e+00f, 1.39883113e+00f, 1.40298510e+00f, 1.40717053e+00f, 1.41138768e+00f,
+        1.41563690e+00f, 1.41991842e+00f, 1.42423260e+00f, 1.42857945e+00f, 1.43295932e+00f, 1.43737209e+00f,
+        1.44181871e+00f, 1.44629908e+00f, 1.45081317e+00f, 1.45536149e+00f, 1.45994437e+00f, 1.46456230e+00f,
+        1.46921468e+00f, 1.47390246e+00f, 1.47862577e+00f, 1.48338497e+00f, 1.48818004e+00f, 1.49301159e+00f,
+        1.49787951e+00f, 1.50278461e+00f, 1.50772655e+00f, 1.51270604e+00f, 1.51772320e+00f, 1.52277827e+00f,
+        1.52787185e+00f, 1.53300416e+00f, 1.53817523e+00f, 1.54338562e+00f, 1.54863513e+00f, 1.55392480e+00f,
+        1.55925453e+00f, 1.56462455e+00f, 1.57003570e+00f, 1.57548726e+00f, 1.58098078e+00f, 1.58651614e+00f,
+        1.59209299e+00f, 1.59771264e+00f, 1.60337472e+00f, 1.60908031e+00f, 1.61482882e+00f, 1.62062144e+00f,
+        1.62645793e+00f, 1.63233912e+00f, 1.63826501e+00f, 1.64423609e+00f, 1.65025234e+00f, 1.65631509e+00f,
+        1.66242385e+00f, 1.66857910e+00f, 1.67478204e+00f, 1.68103194e+00f, 1.68732989e+00f, 1.69367623e+00f,
+        1.70007086e+00f, 1.70651460e+00f, 1.71300781e+00f, 1.71955085e+00f, 1.72614396e+00f, 1.73278809e+00f,
+        1.73948300e+00f, 1.74622989e+00f, 1.75302851e+00f, 1.75987923e+00f, 1.76678336e+00f, 1.77374017e+00f,
+        1.78075123e+00f, 1.78781664e+00f, 1.79493618e+00f, 1.80211127e+00f, 1.80934167e+00f, 1.81662846e+00f,
+        1.82397151e+00f, 1.83137202e+00f, 1.83882952e+00f, 1.84634554e+00f, 1.85391963e+00f, 1.86155319e+00f,
+        1.86924589e+00f, 1.87699902e+00f, 1.88481259e+00f, 1.89268708e+00f, 1.90062392e+00f, 1.90862274e+00f,
+        1.91668403e+00f, 1.92480874e+00f, 1.93299747e+00f, 1.94125044e+00f, 1.94956839e+00f, 1.95795262e+00f,
+        1.96640217e+00f, 1.97491908e+00f, 1.98350298e+00f, 1.99215519e+00f, 2.00087595e+00f, 2.00966549e+00f,
+        2.01852560e+00f, 2.02745509e+00f, 2.03645706e+00f, 2.04553056e+00f, 2.05467534e+00f, 2.06389356e+00f,
+        2.07318616e+00f, 2.08255243e+00f, 2.09199452e+00f, 2.10151219e+00f, 2.11110592e+00f, 2.12077761e+00f,
+        2.13052607e+00f, 2.14035392e+00f, 2.15026069e+00f, 2.16024780e+00f, 2.17031550e+00f, 2.18046594e+00f,
+        2.19069743e+00f, 2.20101285e+00f, 2.21141124e+00f, 2.22189498e+00f, 2.23246408e+00f, 2.24312019e+00f,
+        2.25386238e+00f, 2.26469326e+00f, 2.27561235e+00f, 2.28662181e+00f, 2.29772115e+00f, 2.30891156e+00f,
+        2.32019520e+00f, 2.33157134e+00f, 2.34304214e+00f, 2.35460687e+00f, 2.36626840e+00f, 2.37802672e+00f,
+        2.38988185e+00f, 2.40183663e+00f, 2.41389012e+00f, 2.42604494e+00f, 2.43830037e+00f, 2.45065999e+00f,
+        2.46312261e+00f, 2.47568965e+00f, 2.48836136e+00f, 2.50114083e+00f, 2.51402736e+00f, 2.52702332e+00f,
+        2.54012918e+00f, 2.55334640e+00f, 2.56667471e+00f, 2.58011723e+00f, 2.59367299e+00f, 2.60734439e+00f,
+        2.62113357e+00f, 2.63504004e+00f, 2.64906549e+00f, 2.66321135e+00f, 2.67747808e+00f, 2.69186807e+00f,
+        2.70638108e+00f, 2.72101998e+00f, 2.73578572e+00f, 2.75067854e+00f, 2.76570177e+00f, 2.78085399e+00f,
+        2.79613829e+00f, 2.81155586e+00f, 2.82710743e+00f, 2.84279561e+00f, 2.85861993e+00f, 2.87458467e+00f,
+        2.89068770e+00f, 2.90693378e+00f, 2.92332220e+00f, 2.93985629e+00f, 2.95653486e+00f, 2.97336125e+00f,
+        2.99033761e+00f, 3.00746417e+00f, 3.02474356e+00f, 3.04217696e+00f, 3.05976605e+00f, 3.07751346e+00f,
+        3.09541798e+00f, 3.11348414e+00f, 3.13171291e+00f, 3.15010452e+00f, 3.16866326e+00f, 3.18738961e+00f,
+        3.20628452e+00f, 3.22535181e+00f, 3.24459100e+00f, 3.26400638e+00f, 3.28359866e+00f, 3.30336857e+00f,
+        3.32332206e+00f, 3.34345579e+00f, 3.36377549e+00f, 3.38428235e+00f, 3.40497708e+00f, 3.42586398e+00f,
+        3.44694304e+00f, 3.46821785e+00f, 3.48968863e+00f, 3.51136136e+00f, 3.53323483e+00f, 3.55531287e+00f,
+        3.57759547e+00f, 3.60008788e+00f, 3.62279153e+00f, 3.64570880e+00f, 3.66884160e+00f, 3.69219208e+00f,
+        3.71576452e+00f, 3.73955917e+00f, 3.76357794e+00f, 3.78782749e+00f, 3.81230831e+00f, 3.83702207e+00f,
+        3.86197162e+00f, 3.88716102e+00f, 3.91259146e+00f, 3.93826652e+00f, 3.96418881e+00f, 3.99036121e+00f,
+        4.01678610e+00f, 4.04346704e+00f, 4.07040882e+00f, 4.09761095e+00f, 4.12508059e+00f, 4.15281677e+00f,
+        4.18082333e+00f, 4.20910406e+00f, 4.23766327e+00f, 4.26650333e+00f, 4.29562855e+00f, 4.32504225e+00f,
+        4.35474682e+00f, 4.38474560e+00f, 4.41504145e+00f, 4.44563723e+00f, 4.47654247e+00f, 4.50775528e+00f,
+        4.53928137e+00f, 4.57112360e+00f, 4.60328531e+00f, 4.63577223e+00f, 4.66858482e+00f, 4.70173120e+00f,
+        4.73521566e+00f, 4.76904011e+00f, 4.80320692e+00f, 4.83772326e+00f, 4.87259007e+00f, 4.90781736e+00f,
+        4.94340467e+00f, 4.97935724e+00f, 5.01568460e+00f, 5.05238295e+00f, 5.08946466e+00f, 5.12693024e+00f,
+        5.16478586e+00f, 5.20303583e+00f, 5.24168348e+00f, 5.28073597e+00f, 5.32019472e+00f, 5.36007643e+00f,
+        5.40036917e+00f, 5.44109392e+00f, 5.48224688e+00f, 5.52383566e+00f, 5.56586504e+00f, 5.60833931e+00f,
+        5.65127039e+00f, 5.69465637e+00f, 5.73851252e+00f, 5.78283882e+00f, 5.82763815e+00f, 5.87292290e+00f,
+        5.91869736e+00f, 5.96496677e+00f, 6.01173973e+00f, 6.05901909e+00f, 6.10681391e+00f, 6.15513277e+00f,
+        6.20397902e+00f, 6.25336361e+00f, 6.30328512e+00f, 6.35375738e+00f, 6.40479612e+00f, 6.45639038e+00f,
+        6.50857067e+00f, 6.56131840e+00f, 6.61465883e+00f, 6.66859484e+00f, 6.72312975e+00f, 6.77828407e+00f,
+        6.83404684e+00f, 6.89045143e+00f, 6.94748592e+00f, 7.00516796e+00f, 7.06350422e+00f, 7.12250233e+00f,
+        7.18217516e+00f, 7.24252462e+00f, 7.30357027e+00f, 7.36531305e+00f, 7.42777348e+00f, 7.49094725e+00f,
+        7.55485773e+00f, 7.61950922e+00f, 7.68490696e+00f, 7.75106907e+00f, 7.81799936e+00f, 7.88570786e+00f,
+        7.95421839e+00f, 8.02353764e+00f, 8.09366226e+00f, 8.16461754e+00f, 8.23641682e+00f, 8.30906010e+00f,
+        8.38257694e+00f, 8.45694828e+00f, 8.53224373e+00f, 8.60841656e+00f, 8.68550968e+00f, 8.76352787e+00f,
+        8.84249115e+00f, 8.92240143e+00f, 9.00328827e+00f, 9.08515549e+00f, 9.16802311e+00f, 9.25189972e+00f,
+        9.33680248e+00f, 9.42273808e+00f, 9.50973606e+00f, 9.59779453e+00f, 9.68696022e+00f, 9.77722645e+00f,
+        9.86861515e+00f, 9.96113873e+00f, 1.00548182e+01f, 1.01496630e+01f, 1.02456942e+01f, 1.03429384e+01f,
+        1.04414110e+01f, 1.05411167e+01f, 1.06421022e+01f, 1.07443666e+01f, 1.08479357e+01f, 1.09528208e+01f,
+        1.10590496e+01f, 1.11666298e+01f, 1.12755976e+01f, 1.13859739e+01f, 1.14977875e+01f, 1.16110401e+01f,
+        1.17257757e+01f, 1.18419962e+01f, 1.19597254e+01f, 1.20790043e+01f, 1.21998472e+01f, 1.23222761e+01f,
+        1.24463243e+01f, 1.25720139e+01f, 1.26993656e+01f, 1.28284264e+01f, 1.29592009e+01f, 1.30916929e+01f,
+        1.32259941e+01f, 1.33620844e+01f, 1.35000229e+01f, 1.36398315e+01f, 1.37815218e+01f, 1.39251356e+01f,
+        1.40706873e+01f, 1.42182369e+01f, 1.43678331e+01f, 1.45194645e+01f, 1.46731634e+01f, 1.48290091e+01f,
+        1.49869804e+01f, 1.51471615e+01f, 1.53095608e+01f, 1.54742079e+01f, 1.56412048e+01f, 1.58105030e+01f,
+        1.59822416e+01f, 1.61563454e+01f, 1.63329544e+01f, 1.65120354e+01f, 1.66936741e+01f, 1.68779259e+01f,
+        1.70647392e+01f, 1.72542839e+01f, 1.74465523e+01f, 1.76415882e+01f, 1.78394375e+01f, 1.80401497e+01f,
+        1.82437782e+01f, 1.84503231e+01f, 1.86599560e+01f, 1.88726482e+01f, 1.90884628e+01f, 1.93074932e+01f,
+        1.95297413e+01f, 1.97552776e+01f, 1.99841537e+01f, 2.02164078e+01f, 2.04522152e+01f, 2.06914806e+01f,
+        2.09344063e+01f, 2.11810150e+01f, 2.14312954e+01f, 2.16854553e+01f, 2.19433155e+01f, 2.22051563e+01f,
+        2.24711132e+01f, 2.27411022e+01f, 2.30152779e+01f, 2.32936001e+01f, 2.35763493e+01f, 2.38634300e+01f,
+        2.41549110e+01f, 2.44510098e+01f, 2.47517414e+01f, 2.50571918e+01f, 2.53674469e+01f, 2.56826248e+01f,
+        2.60028267e+01f, 2.63280830e+01f, 2.66584873e+01f, 2.69941730e+01f, 2.73353634e+01f, 2.76819344e+01f,
+        2.80341263e+01f, 2.83920155e+01f, 2.87558537e+01f, 2.91255112e+01f, 2.95011673e+01f, 2.98830318e+01f,
+        3.02712364e+01f, 3.06656933e+01f, 3.10667114e+01f, 3.14744949e+01f, 3.18890228e+01f, 3.23104248e+01f,
+        3.27388496e+01f, 3.31745224e+01f, 3.36176109e+01f, 3.40680313e+01f, 3.45263290e+01f, 3.49923515e+01f,
+        3.54662781e+01f, 3.59483337e+01f, 3.64386635e+01f, 3.69372330e+01f, 3.74447594e+01f, 3.79608421e+01f,
+        3.84861031e+01f, 3.90206299e+01f, 3.95642967e+01f, 4.01173782e+01f, 4.06805496e+01f, 4.12533607e+01f,
+        4.18366890e+01f, 4.24302025e+01f, 4.30345383e+01f, 4.36493645e+01f, 4.42753906e+01f, 4.49128571e+01f,
+        4.55614777e+01f, 4.62222290e+01f, 4.68950806e+01f, 4.75803375e+01f, 4.82777672e+01f, 4.89881630e+01f,
+        4.97118721e+01f, 5.04487839e+01f, 5.11994286e+01f, 5.19643745e+01f, 5.27432289e+01f, 5.35367851e+01f,
+        5.43456612e+01f, 5.51694908e+01f, 5.60095711e+01f, 5.68650932e+01f, 5.77371521e+01f, 5.86257095e+01f,
+        5.95314751e+01f, 6.04551277e+01f, 6.13964310e+01f, 6.23559151e+01f, 6.33338280e+01f, 6.43315430e+01f,
+        6.53485413e+01f, 6.63851547e+01f, 6.74433517e+01f, 6.85220947e+01f, 6.96226120e+01f, 7.07448273e+01f,
+        7.18898392e+01f, 7.30578842e+01f, 7.42492676e+01f, 7.54649811e+01f, 7.67061996e+01f, 7.79729767e+01f,
+        7.92651825e+01f, 8.05837631e+01f, 8.19296036e+01f, 8.33037872e+01f, 8.47067261e+01f, 8.61378250e+01f,
+        8.76011658e+01f, 8.90940933e+01f, 9.06195374e+01f, 9.21768341e+01f, 9.37669067e+01f, 9.53916473e+01f,
+        9.70510101e+01f, 9.87470398e+01f, 1.00479095e+02f, 1.02248894e+02f, 1.04057617e+02f, 1.05906059e+02f,
+        1.07795250e+02f, 1.09724815e+02f, 1.11698677e+02f, 1.13714767e+02f, 1.15777802e+02f, 1.17886940e+02f,
+        1.20043983e+02f, 1.22249352e+02f, 1.24505508e+02f, 1.26813576e+02f, 1.29172333e+02f, 1.31586777e+02f,
+        1.34058533e+02f, 1.36585236e+02f, 1.39173187e+02f, 1.41820724e+02f, 1.44528992e+02f, 1.47301727e+02f,
+        1.50140335e+02f, 1.53045792e+02f, 1.56020920e+02f, 1.59067719e+02f, 1.62190887e+02f, 1.65389130e+02f,
+        1.68664001e+02f, 1.72018219e+02f, 1.75453476e+02f, 1.78975220e+02f, 1.82582916e+02f, 1.86282471e+02f,
+        1.90070404e+02f, 1.93952728e+02f, 1.97940887e+02f, 2.02023453e+02f, 2.06215393e+02f, 2.10502182e+02f,
+        2.14912170e+02f, 2.19422836e+02f, 2.24063004e+02f, 2.28820358e+02f, 2.33697235e+02f, 2.38714035e+02f,
+        2.43851593e+02f, 2.49126297e+02f, 2.54544067e+02f, 2.60095093e+02f, 2.65806519e+02f, 2.71677551e+02f,
+        2.77700287e+02f, 2.83883942e+02f, 2.90245392e+02f, 2.96772369e+02f, 3.03489777e+02f, 3.10376526e+02f,
+        3.17482910e+02f, 3.24775482e+02f, 3.32270416e+02f, 3.39986145e+02f, 3.47914703e+02f, 3.56060455e+02f,
+        3.64443634e+02f, 3.73076111e+02f, 3.81959137e+02f, 3.91105133e+02f, 4.00508484e+02f, 4.10181091e+02f,
+        4.20156921e+02f, 4.30416443e+02f, 4.41003845e+02f, 4.51897797e+02f, 4.63104797e+02f, 4.74693542e+02f,
+        4.86604034e+02f, 4.98880127e+02f, 5.11552277e+02f, 5.24611267e+02f, 5.38089600e+02f, 5.51963684e+02f,
+        5.66265991e+02f, 5.81087524e+02f, 5.96323853e+02f, 6.12097534e+02f, 6.28351440e+02f, 6.45111328e+02f,
+        6.62440674e+02f, 6.80284912e+02f, 6.98864624e+02f, 7.17913513e+02f, 7.37705261e+02f, 7.58138977e+02f,
+        7.79181458e+02f, 8.00965942e+02f, 8.23518127e+02f, 8.46834839e+02f, 8.70997437e+02f, 8.96068359e+02f,
+        9.21915283e+02f, 9.48653015e+02f, 9.76419189e+02f, 1.00501581e+03f, 1.03478430e+03f, 1.06560205e+03f,
+        1.09744922e+03f, 1.13064844e+03f, 1.16494702e+03f, 1.20058887e+03f, 1.23738379e+03f, 1.27572839e+03f,
+        1.31556152e+03f, 1.35679028e+03f, 1.39959583e+03f, 1.44411157e+03f, 1.49013831e+03f, 1.53797217e+03f,
+        1.58777527e+03f, 1.63984204e+03f, 1.69349878e+03f, 1.74956787e+03f, 1.80817603e+03f, 1.86903967e+03f,
+        1.93206360e+03f, 1.99773938e+03f, 2.06650806e+03f, 2.13763379e+03f, 2.21227222e+03f, 2.28939062e+03f,
+        2.37029175e+03f, 2.45496167e+03f, 2.54307324e+03f, 2.63442993e+03f, 2.73051855e+03f, 2.83005566e+03f,
+        2.93472583e+03f, 3.04264380e+03f, 3.15761182e+03f, 3.27904272e+03f, 3.40280542e+03f, 3.53379272e+03f,
+        3.67097729e+03f, 3.81287500e+03f, 3.96305908e+03f, 4.12015332e+03f, 4.28656006e+03f, 4.46063770e+03f,
+        4.64087354e+03f, 4.83257178e+03f, 5.02869580e+03f, 5.23922852e+03f, 5.45985156e+03f, 5.68827148e+03f,
+        5.93663818e+03f, 6.19392627e+03f, 6.46288135e+03f, 6.75081494e+03f, 7.04975830e+03f, 7.36344727e+03f,
+        7.69927637e+03f, 8.05170801e+03f, 8.42100293e+03f, 8.80726074e+03f, 9.22388574e+03f, 9.65216309e+03f,
+        1.01180762e+04f, 1.05865049e+04f, 1.11249609e+04f, 1.16667607e+04f, 1.22640352e+04f, 1.28728428e+04f,
+        1.35379639e+04f, 1.42432256e+04f, 1.49723428e+04f, 1.57900420e+04f, 1.66139609e+04f, 1.74798711e+04f,
+        1.84410078e+04f, 1.94686816e+04f, 2.05502754e+04f, 2.17027930e+04f, 2.28876582e+04f, 2.42093691e+04f,
+        2.56668730e+04f, 2.70759277e+04f, 2.87797910e+04f, 3.05632285e+04f, 3.24143516e+04f, 3.42691211e+04f,
+        3.64543984e+04f, 3.87573750e+04f, 4.13709492e+04f, 4.41290117e+04f, 4.69282383e+04f, 5.03070703e+04f,
+        5.34045391e+04f, 5.69084531e+04f, 6.09044453e+04f, 6.51646016e+04f, 6.96773828e+04f, 7.50851875e+04f,
+        8.11404375e+04f, 8.70364531e+04f, 9.38564766e+04f, 1.00213289e+05f, 1.08889773e+05f, 1.15914914e+05f,
+        1.25141969e+05f, 1.36704000e+05f, 1.47096703e+05f, 1.61240625e+05f, 1.78393875e+05f, 1.93488734e+05f,
+        2.09612797e+05f, 2.28668516e+05f, 2.46603297e+05f, 2.70468125e+05f, 3.10537500e+05f, 3.39912656e+05f,
+        3.69904938e+05f, 3.99262469e+05f, 4.49170312e+05f, 4.93206594e+05f, 5.46816000e+05f, 6.13500875e+05f,
+        6.98709312e+05f, 7.62228375e+05f, 8.11404375e+05f, 8.98340625e+05f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        8.98340625e+05f, 7.39809875e+05f, 7.18672438e+05f, 5.98893688e+05f, 5.46816000e+05f, 4.93206594e+05f,
+        4.41290125e+05f, 4.05702188e+05f, 3.69904938e+05f, 3.30967594e+05f, 3.03054656e+05f, 2.70468125e+05f,
+        2.46603297e+05f, 2.26608438e+05f, 2.09612797e+05f, 1.93488734e+05f, 1.75898859e+05f, 1.61240625e+05f,
+        1.47961969e+05f, 1.37451016e+05f, 1.27038062e+05f, 1.16451562e+05f, 1.08420422e+05f, 1.01018211e+05f,
+        9.35075703e+04f, 8.64382656e+04f, 8.11404375e+04f, 7.50851875e+04f, 6.96773828e+04f, 6.55040000e+04f,
+        6.10522734e+04f, 5.72973516e+04f, 5.35181641e+04f, 5.02066562e+04f, 4.68408477e+04f, 4.41290117e+04f,
+        4.13709492e+04f, 3.88771836e+04f, 3.65073086e+04f, 3.43627539e+04f, 3.23310234e+04f, 3.04154004e+04f,
+        2.88127578e+04f, 2.70759277e+04f, 2.56668730e+04f, 2.42093691e+04f, 2.28876582e+04f, 2.16654062e+04f,
+        2.05167500e+04f, 1.94385918e+04f, 1.84410078e+04f, 1.74920273e+04f, 1.66139609e+04f, 1.57603613e+04f,
+        1.49812607e+04f, 1.42351650e+04f, 1.35452539e+04f, 1.28728428e+04f, 1.22640352e+04f, 1.16830166e+04f,
+        1.11348096e+04f, 1.06088301e+04f, 1.01262227e+04f, 9.67443750e+03f, 9.23065527e+03f, 8.81034473e+03f,
+        8.41818457e+03f, 8.05170801e+03f, 7.69692041e+03f, 7.36776123e+03f, 7.05173438e+03f, 6.75262744e+03f,
+        6.46620410e+03f, 6.19545215e+03f, 5.94084424e+03f, 5.69213281e+03f, 5.45866650e+03f, 5.24031982e+03f,
+        5.02970117e+03f, 4.83257178e+03f, 4.64087354e+03f, 4.45826562e+03f, 4.28656006e+03f, 4.12150342e+03f,
+        3.96430835e+03f, 3.81229712e+03f, 3.66990625e+03f, 3.53379272e+03f, 3.40280542e+03f, 3.27861548e+03f,
+        3.15840479e+03f, 3.04411670e+03f, 2.93506836e+03f, 2.83069287e+03f, 2.73051855e+03f, 2.63553394e+03f,
+        2.54333032e+03f, 2.45520117e+03f, 2.37073853e+03f, 2.29001587e+03f, 2.21227222e+03f, 2.13781543e+03f,
+        2.06667773e+03f, 1.99805676e+03f, 1.93236047e+03f, 1.86890088e+03f, 1.80830603e+03f, 1.74981128e+03f,
+        1.69395496e+03f, 1.63973511e+03f, 1.58807593e+03f, 1.53834839e+03f, 1.49031494e+03f, 1.44402869e+03f,
+        1.39967371e+03f, 1.35679028e+03f, 1.31549268e+03f, 1.27572839e+03f, 1.23744458e+03f, 1.20064612e+03f,
+        1.16500098e+03f, 1.13075012e+03f, 1.09759290e+03f, 1.06560205e+03f, 1.03486938e+03f, 1.00509613e+03f,
+        9.76419189e+02f, 9.48760437e+02f, 9.21949036e+02f, 8.96068359e+02f, 8.71148315e+02f, 8.46920410e+02f,
+        8.23598938e+02f, 8.00991516e+02f, 7.79205627e+02f, 7.58161865e+02f, 7.37726868e+02f, 7.17913513e+02f,
+        6.98864624e+02f, 6.80358521e+02f, 6.62493042e+02f, 6.45127869e+02f, 6.28335754e+02f, 6.12097534e+02f,
+        5.96323853e+02f, 5.81100952e+02f, 5.66291504e+02f, 5.51963684e+02f, 5.38078064e+02f, 5.24622192e+02f,
+        5.11541840e+02f, 4.98890045e+02f, 4.86604034e+02f, 4.74666687e+02f, 4.63130371e+02f, 4.51897797e+02f,
+        4.41011597e+02f, 4.30423767e+02f, 4.20156921e+02f, 4.10187805e+02f, 4.00502136e+02f, 3.91105133e+02f,
+        3.81959137e+02f, 3.73076111e+02f, 3.64438354e+02f, 3.56055420e+02f, 3.47909882e+02f, 3.39976959e+02f,
+        3.32261658e+02f, 3.24762909e+02f, 3.17482910e+02f, 3.10388031e+02f, 3.03486115e+02f, 2.96772369e+02f,
+        2.90245392e+02f, 2.83883942e+02f, 2.77700287e+02f, 2.71677551e+02f, 2.65814941e+02f, 2.60103180e+02f,
+        2.54538910e+02f, 2.49126297e+02f, 2.43851593e+02f, 2.38709503e+02f, 2.33701584e+02f, 2.28814117e+02f,
+        2.24063004e+02f, 2.19430481e+02f, 2.14910339e+02f, 2.10507462e+02f, 2.06215393e+02f, 2.02026703e+02f,
+        1.97942444e+02f, 1.93957214e+02f, 1.90071838e+02f, 1.86282471e+02f, 1.82584244e+02f, 1.78975220e+02f,
+        1.75455917e+02f, 1.72019394e+02f, 1.68664001e+02f, 1.65384781e+02f, 1.62191940e+02f, 1.59069717e+02f,
+        1.56022842e+02f, 1.53046738e+02f, 1.50139450e+02f, 1.47302139e+02f, 1.44528580e+02f, 1.41819122e+02f,
+        1.39172028e+02f, 1.36585602e+02f, 1.34058533e+02f, 1.31587463e+02f, 1.29174332e+02f, 1.26813889e+02f,
+        1.24505806e+02f, 1.22250237e+02f, 1.20045418e+02f, 1.17887764e+02f, 1.15779121e+02f, 1.13716568e+02f,
+        1.11698174e+02f, 1.09726738e+02f, 1.07794563e+02f, 1.05905159e+02f, 1.04057404e+02f, 1.02248894e+02f,
+        1.00478699e+02f, 9.87466507e+01f, 9.70511932e+01f, 9.53914566e+01f, 9.37667313e+01f, 9.21759872e+01f,
+        9.06193695e+01f, 8.90942612e+01f, 8.76013184e+01f, 8.61387100e+01f, 8.47068710e+01f, 8.33046112e+01f,
+        8.19298706e+01f, 8.05840149e+01f, 7.92648087e+01f, 7.79722519e+01f, 7.67063217e+01f, 7.54653244e+01f,
+        7.42492676e+01f, 7.30580978e+01f, 7.18897400e+01f, 7.07450256e+01f, 6.96229019e+01f, 6.85221863e+01f,
+        6.74433517e+01f, 6.63857727e+01f, 6.53484573e+01f, 6.43317871e+01f, 6.33339844e+01f, 6.23556137e+01f,
+        6.13961372e+01f, 6.04544754e+01f, 5.95312653e+01f, 5.86254349e+01f, 5.77368851e+01f, 5.68645172e+01f,
+        5.60091972e+01f, 5.51693726e+01f, 5.43455429e+01f, 5.35368385e+01f, 5.27431717e+01f, 5.19641571e+01f,
+        5.11994781e+01f, 5.04489365e+01f, 4.97117729e+01f, 4.89881172e+01f, 4.82776718e+01f, 4.75801125e+01f,
+        4.68950348e+01f, 4.62223549e+01f, 4.55616837e+01f, 4.49127350e+01f, 4.42755852e+01f, 4.36494408e+01f,
+        4.30344658e+01f, 4.24302711e+01f, 4.18366203e+01f, 4.12535324e+01f, 4.06804504e+01f, 4.01175995e+01f,
+        3.95641403e+01f, 3.90203857e+01f, 3.84860725e+01f, 3.79608955e+01f, 3.74445915e+01f, 3.69372063e+01f,
+        3.64384270e+01f, 3.59481583e+01f, 3.54661026e+01f, 3.49920845e+01f, 3.45262337e+01f, 3.40680084e+01f,
+        3.36175652e+01f, 3.31744995e+01f, 3.27388496e+01f, 3.23102798e+01f, 3.18888836e+01f, 3.14743996e+01f,
+        3.10667114e+01f, 3.06656189e+01f, 3.02711811e+01f, 2.98829098e+01f, 2.95011673e+01f, 2.91254807e+01f,
+        2.87558212e+01f, 2.83919964e+01f, 2.80341415e+01f, 2.76819801e+01f, 2.73353767e+01f, 2.69942760e+01f,
+        2.66584740e+01f, 2.63281002e+01f, 2.60028000e+01f, 2.56826248e+01f, 2.53674355e+01f, 2.50571651e+01f,
+        2.47517300e+01f, 2.44509983e+01f, 2.41549110e+01f, 2.38633633e+01f, 2.35762730e+01f, 2.32935791e+01f,
+        2.30152683e+01f, 2.27410927e+01f, 2.24711342e+01f, 2.22052269e+01f, 2.19433441e+01f, 2.16853905e+01f,
+        2.14312763e+01f, 2.11810074e+01f, 2.09344311e+01f, 2.06915398e+01f, 2.04522324e+01f, 2.02164268e+01f,
+        1.99841595e+01f, 1.97552624e+01f, 1.95297279e+01f, 1.93074894e+01f, 1.90884933e+01f, 1.88726864e+01f,
+        1.86599655e+01f, 1.84503593e+01f, 1.82437420e+01f, 1.80401306e+01f, 1.78394127e+01f, 1.76415653e+01f,
+        1.74465313e+01f, 1.72542744e+01f, 1.70647469e+01f, 1.68778973e+01f, 1.66936684e+01f, 1.65120468e+01f,
+        1.63329430e+01f, 1.61563358e+01f, 1.59822454e+01f, 1.58105421e+01f, 1.56412306e+01f, 1.54742479e+01f,
+        1.53095903e+01f, 1.51471872e+01f, 1.49869967e+01f, 1.48290071e+01f, 1.46731758e+01f, 1.45194492e+01f,
+        1.43678141e+01f, 1.42182465e+01f, 1.40706930e+01f, 1.39251356e+01f, 1.37815247e+01f, 1.36398401e+01f,
+        1.35000553e+01f, 1.33621120e+01f, 1.32260065e+01f, 1.30917234e+01f, 1.29591942e+01f, 1.28284330e+01f,
+        1.26993799e+01f, 1.25720196e+01f, 1.24463291e+01f, 1.23222733e+01f, 1.21998472e+01f, 1.20790014e+01f,
+        1.19597340e+01f, 1.18419876e+01f, 1.17257700e+01f, 1.16110334e+01f, 1.14977894e+01f, 1.13859816e+01f,
+        1.12756138e+01f, 1.11666317e+01f, 1.10590448e+01f, 1.09528208e+01f, 1.08479357e+01f, 1.07443705e+01f,
+        1.06421194e+01f, 1.05411263e+01f, 1.04414177e+01f, 1.03429413e+01f, 1.02457018e+01f, 1.01496592e+01f,
+        1.00548124e+01f, 9.96113300e+00f, 9.86861515e+00f, 9.77722931e+00f, 9.68696690e+00f, 9.59781075e+00f,
+        9.50973225e+00f, 9.42273998e+00f, 9.33679199e+00f, 9.25188923e+00f, 9.16801548e+00f, 9.08515453e+00f,
+        9.00328732e+00f, 8.92240524e+00f, 8.84248829e+00f, 8.76352692e+00f, 8.68550491e+00f, 8.60840797e+00f,
+        8.53223801e+00f, 8.45696354e+00f, 8.38257599e+00f, 8.30906582e+00f, 8.23641872e+00f, 8.16461468e+00f,
+        8.09366226e+00f, 8.02353191e+00f, 7.95422268e+00f, 7.88571167e+00f, 7.81800127e+00f, 7.75106287e+00f,
+        7.68490791e+00f, 7.61950731e+00f, 7.55486631e+00f, 7.49095154e+00f, 7.42778015e+00f, 7.36532116e+00f,
+        7.30357695e+00f, 7.24253321e+00f, 7.18217659e+00f, 7.12250662e+00f, 7.06350517e+00f, 7.00516653e+00f,
+        6.94748497e+00f, 6.89045000e+00f, 6.83405018e+00f, 6.77827883e+00f, 6.72312975e+00f, 6.66859007e+00f,
+        6.61465502e+00f, 6.56131411e+00f, 6.50856686e+00f, 6.45639610e+00f, 6.40479803e+00f, 6.35376501e+00f,
+        6.30328751e+00f, 6.25336123e+00f, 6.20398045e+00f, 6.15513325e+00f, 6.10681534e+00f, 6.05901909e+00f,
+        6.01173973e+00f, 5.96496868e+00f, 5.91869974e+00f, 5.87292480e+00f, 5.82764196e+00f, 5.78283787e+00f,
+        5.73851538e+00f, 5.69466305e+00f, 5.65127230e+00f, 5.60834265e+00f, 5.56586218e+00f, 5.52383375e+00f,
+        5.48224401e+00f, 5.44109154e+00f, 5.40037012e+00f, 5.36007309e+00f, 5.32019806e+00f, 5.28073359e+00f,
+        5.24168348e+00f, 5.20303535e+00f, 5.16478539e+00f, 5.12693024e+00f, 5.08946609e+00f, 5.05238628e+00f,
+        5.01568747e+00f, 4.97936249e+00f, 4.94340801e+00f, 4.90782118e+00f, 4.87259436e+00f, 4.83772421e+00f,
+        4.80320835e+00f, 4.76903868e+00f, 4.73521519e+00f, 4.70173407e+00f, 4.66858673e+00f, 4.63577127e+00f,
+        4.60328531e+00f, 4.57112360e+00f, 4.53928137e+00f, 4.50775623e+00f, 4.47654200e+00f, 4.44564295e+00f,
+        4.41504049e+00f, 4.38474464e+00f, 4.35474634e+00f, 4.32504177e+00f, 4.29562855e+00f, 4.26650381e+00f,
+        4.23766375e+00f, 4.20910311e+00f, 4.18082142e+00f, 4.15281391e+00f, 4.12507820e+00f, 4.09761000e+00f,
+        4.07040834e+00f, 4.04346848e+00f, 4.01678753e+00f, 3.99036121e+00f, 3.96418786e+00f, 3.93826604e+00f,
+        3.91259098e+00f, 3.88716054e+00f, 3.86197305e+00f, 3.83702207e+00f, 3.81230927e+00f, 3.78783059e+00f,
+        3.76358104e+00f, 3.73955917e+00f, 3.71576452e+00f, 3.69219208e+00f, 3.66884160e+00f, 3.64570904e+00f,
+        3.62279296e+00f, 3.60008907e+00f, 3.57759571e+00f, 3.55531263e+00f, 3.53323412e+00f, 3.51135993e+00f,
+        3.48968911e+00f, 3.46821761e+00f, 3.44694304e+00f, 3.42586398e+00f, 3.40497756e+00f, 3.38428164e+00f,
+        3.36377597e+00f, 3.34345555e+00f, 3.32332206e+00f, 3.30337048e+00f, 3.28360009e+00f, 3.26400757e+00f,
+        3.24459267e+00f, 3.22535157e+00f, 3.20628500e+00f, 3.18738937e+00f, 3.16866446e+00f, 3.15010548e+00f,
+        3.13171291e+00f, 3.11348414e+00f, 3.09541845e+00f, 3.07751298e+00f, 3.05976725e+00f, 3.04217792e+00f,
+        3.02474499e+00f, 3.00746632e+00f, 2.99033904e+00f, 2.97336340e+00f, 2.95653558e+00f, 2.93985677e+00f,
+        2.92332268e+00f, 2.90693378e+00f, 2.89068794e+00f, 2.87458348e+00f, 2.85862088e+00f, 2.84279537e+00f,
+        2.82710719e+00f, 2.81155515e+00f, 2.79613781e+00f, 2.78085327e+00f, 2.76570129e+00f, 2.75067973e+00f,
+        2.73578620e+00f, 2.72102094e+00f, 2.70638204e+00f, 2.69186735e+00f, 2.67747808e+00f, 2.66321087e+00f,
+        2.64906526e+00f, 2.63504028e+00f, 2.62113357e+00f, 2.60734558e+00f, 2.59367371e+00f, 2.58011651e+00f,
+        2.56667542e+00f, 2.55334520e+00f, 2.54013014e+00f, 2.52702475e+00f, 2.51402807e+00f, 2.50114107e+00f,
+        2.48836136e+00f, 2.47568893e+00f, 2.46312165e+00f, 2.45065904e+00f, 2.43830132e+00f, 2.42604470e+00f,
+        2.41389036e+00f, 2.40183616e+00f, 2.38988233e+00f, 2.37802625e+00f, 2.36626840e+00f, 2.35460687e+00f,
+        2.34304237e+00f, 2.33157206e+00f, 2.32019544e+00f, 2.30891228e+00f, 2.29772186e+00f, 2.28662205e+00f,
+        2.27561283e+00f, 2.26469278e+00f, 2.25386262e+00f, 2.24311972e+00f, 2.23246384e+00f, 2.22189498e+00f,
+        2.21141148e+00f, 2.20101213e+00f, 2.19069719e+00f, 2.18046522e+00f, 2.17031598e+00f, 2.16024780e+00f,
+        2.15026045e+00f, 2.14035416e+00f, 2.13052583e+00f, 2.12077689e+00f, 2.11110568e+00f, 2.10151124e+00f,
+        2.09199405e+00f, 2.08255243e+00f, 2.07318592e+00f, 2.06389380e+00f, 2.05467534e+00f, 2.04552937e+00f,
+        2.03645635e+00f, 2.02745533e+00f, 2.01852560e+00f, 2.00966597e+00f, 2.00087595e+00f, 1.99215519e+00f,
+        1.98350298e+00f, 1.97491908e+00f, 1.96640241e+00f, 1.95795238e+00f, 1.94956934e+00f, 1.94125092e+00f,
+        1.93299770e+00f, 1.92480874e+00f, 1.91668439e+00f, 1.90862274e+00f, 1.90062392e+00f, 1.89268732e+00f,
+        1.88481271e+00f, 1.87699878e+00f, 1.86924601e+00f, 1.86155319e+00f, 1.85391963e+00f, 1.84634542e+00f,
+        1.83882892e+00f, 1.83137143e+00f, 1.82397103e+00f, 1.81662810e+00f, 1.80934167e+00f, 1.80211091e+00f,
+        1.79493594e+00f, 1.78781581e+00f, 1.78075123e+00f, 1.77374017e+00f, 1.76678324e+00f, 1.75987959e+00f,
+        1.75302851e+00f, 1.74622989e+00f, 1.73948312e+00f, 1.73278809e+00f, 1.72614431e+00f, 1.71955073e+00f,
+        1.71300805e+00f, 1.70651495e+00f, 1.70007086e+00f, 1.69367599e+00f, 1.68732989e+00f, 1.68103194e+00f,
+        1.67478216e+00f, 1.66857946e+00f, 1.66242397e+00f, 1.65631557e+00f, 1.65025270e+00f, 1.64423621e+00f,
+        1.63826478e+00f, 1.63233912e+00f, 1.62645805e+00f, 1.62062132e+00f, 1.61482906e+00f, 1.60907996e+00f,
+        1.60337484e+00f, 1.59771252e+00f, 1.59209311e+00f, 1.58651567e+00f, 1.58098078e+00f, 1.57548738e+00f,
+        1.57003558e+00f, 1.56462491e+00f, 1.55925477e+00f, 1.55392504e+00f, 1.54863536e+00f, 1.54338562e+00f,
+        1.53817546e+00f, 1.53300405e+00f, 1.52787220e+00f, 1.52277863e+00f, 1.51772320e+00f, 1.51270628e+00f,
+        1.50772655e+00f, 1.50278413e+00f, 1.49787962e+00f, 1.49301136e+00f, 1.48818016e+00f, 1.48338509e+00f,
+        1.47862613e+00f, 1.47390282e+00f, 1.46921468e+00f, 1.46456206e+00f, 1.45994437e+00f, 1.45536149e+00f,
+        1.45081353e+00f, 1.44629884e+00f, 1.44181895e+00f, 1.43737209e+00f, 1.43295944e+00f, 1.42857945e+00f,
+        1.42423272e+00f, 1.41991854e+00f, 1.41563690e+00f, 1.41138792e+00f, 1.40717065e+00f, 1.40298533e+00f,
+        1.39883149e+00f, 1.39470899e+00f, 1.39061761e+00f, 1.38655674e+00f, 1.38252723e+00f, 1.37852800e+00f,
+        1.37455904e+00f, 1.37062025e+00f, 1.36671138e+00f, 1.36283147e+00f, 1.35898173e+00f, 1.35516083e+00f,
+        1.35136902e+00f, 1.34760630e+00f, 1.34387195e+00f, 1.34016633e+00f, 1.33648837e+00f, 1.33283877e+00f,
+        1.32921708e+00f, 1.32562292e+00f, 1.32205641e+00f, 1.31851733e+00f, 1.31500530e+00f, 1.31151998e+00f,
+        1.30806172e+00f, 1.30462968e+00f, 1.30122435e+00f, 1.29784536e+00f, 1.29449213e+00f, 1.29116511e+00f,
+        1.28786349e+00f, 1.28458750e+00f, 1.28133726e+00f, 1.27811182e+00f, 1.27491152e+00f, 1.27173626e+00f,
+        1.26858556e+00f, 1.26545966e+00f, 1.26235795e+00f, 1.25928080e+00f, 1.25622773e+00f, 1.25319839e+00f,
+        1.25019288e+00f, 1.24721122e+00f, 1.24425304e+00f, 1.24131846e+00f, 1.23840690e+00f, 1.23551881e+00f,
+        1.23265302e+00f, 1.22981048e+00f, 1.22699022e+00f, 1.22419286e+00f, 1.22141802e+00f, 1.21866536e+00f,
+        1.21593487e+00f, 1.21322632e+00f, 1.21053958e+00f, 1.20787454e+00f, 1.20523131e+00f, 1.20260954e+00f,
+        1.20000911e+00f, 1.19743025e+00f, 1.19487214e+00f, 1.19233513e+00f, 1.18981910e+00f, 1.18732357e+00f,
+        1.18484914e+00f, 1.18239486e+00f, 1.17996120e+00f, 1.17754793e+00f, 1.17515457e+00f, 1.17278147e+00f,
+        1.17042840e+00f, 1.16809499e+00f, 1.16578174e+00f, 1.16348803e+00f, 1.16121376e+00f, 1.15895879e+00f,
+        1.15672338e+00f, 1.15450704e+00f, 1.15230978e+00f, 1.15013170e+00f, 1.14797258e+00f, 1.14583218e+00f,
+        1.14371061e+00f, 1.14160764e+00f, 1.13952327e+00f, 1.13745737e+00f, 1.13540983e+00f, 1.13338029e+00f,
+        1.13136911e+00f, 1.12937629e+00f, 1.12740111e+00f, 1.12544417e+00f, 1.12350476e+00f, 1.12158346e+00f,
+        1.11967933e+00f, 1.11779249e+00f, 1.11592388e+00f, 1.11407220e+00f, 1.11223805e+00f, 1.11042142e+00f,
+        1.10862136e+00f, 1.10683882e+00f, 1.10507286e+00f, 1.10332394e+00f, 1.10159206e+00f, 1.09987676e+00f,
+        1.09817851e+00f, 1.09649658e+00f, 1.09483135e+00f, 1.09318244e+00f, 1.09154975e+00f, 1.08993363e+00f,
+        1.08833373e+00f, 1.08674991e+00f, 1.08518243e+00f, 1.08363092e+00f, 1.08209550e+00f, 1.08057559e+00f,
+        1.07907212e+00f, 1.07758403e+00f, 1.07611191e+00f, 1.07465553e+00f, 1.07321453e+00f, 1.07178926e+00f,
+        1.07037914e+00f, 1.06898475e+00f, 1.06760550e+00f, 1.06624150e+00f, 1.06489301e+00f, 1.06355941e+00f,
+        1.06224120e+00f, 1.06093800e+00f, 1.05964971e+00f, 1.05837679e+00f, 1.05711842e+00f, 1.05587482e+00f,
+        1.05464625e+00f, 1.05343235e+00f, 1.05223334e+00f, 1.05104876e+00f, 1.04987895e+00f, 1.04872382e+00f,
+        1.04758275e+00f, 1.04645646e+00f, 1.04534447e+00f, 1.04424703e+00f, 1.04316378e+00f, 1.04209483e+00f,
+        1.04104006e+00f, 1.03999960e+00f, 1.03897333e+00f, 1.03796101e+00f, 1.03696299e+00f, 1.03597891e+00f,
+        1.03500867e+00f, 1.03405261e+00f, 1.03311038e+00f, 1.03218198e+00f, 1.03126729e+00f, 1.03036654e+00f,
+        1.02947950e+00f, 1.02860641e+00f, 1.02774680e+00f, 1.02690113e+00f, 1.02606869e+00f, 1.02524996e+00f,
+        1.02444470e+00f, 1.02365291e+00f, 1.02287471e+00f, 1.02211010e+00f, 1.02135885e+00f, 1.02062094e+00f,
+        1.01989663e+00f, 1.01918542e+00f, 1.01848745e+00f, 1.01780283e+00f, 1.01713145e+00f, 1.01647353e+00f,
+        1.01582873e+00f, 1.01519716e+00f, 1.01457858e+00f, 1.01397324e+00f, 1.01338089e+00f, 1.01280165e+00f,
+        1.01223564e+00f, 1.01168251e+00f, 1.01114225e+00f, 1.01061547e+00f, 1.01010120e+00f, 1.00960004e+00f,
+        1.00911164e+00f, 1.00863636e+00f, 1.00817394e+00f, 1.00772440e+00f, 1.00728774e+00f, 1.00686395e+00f,
+        1.00645280e+00f, 1.00605452e+00f, 1.00566924e+00f, 1.00529659e+00f, 1.00493681e+00f, 1.00458968e+00f,
+        1.00425529e+00f, 1.00393379e+00f, 1.00362468e+00f, 1.00332844e+00f, 1.00304484e+00f, 1.00277376e+00f,
+        1.00251555e+00f, 1.00226998e+00f, 1.00203705e+00f, 1.00181687e+00f, 1.00160933e+00f, 1.00141418e+00f,
+        1.00123179e+00f, 1.00106192e+00f, 1.00090480e+00f, 1.00076044e+00f, 1.00062823e+00f, 1.00050902e+00f,
+        1.00040221e+00f, 1.00030816e+00f, 1.00022614e+00f, 1.00015712e+00f, 1.00010061e+00f, 1.00005662e+00f,
+        1.00002527e+00f, 1.00000644e+00f
+    };
+
+    static const float hannwindow4096[4096] = {
+        0.00000000e+00f, 5.88561477e-07f, 2.35424454e-06f, 5.29704494e-06f, 9.41695635e-06f, 1.47139681e-05f,
+        2.11880688e-05f, 2.88392421e-05f, 3.76674689e-05f, 4.76727328e-05f, 5.88550065e-05f, 7.12142646e-05f,
+        8.47504780e-05f, 9.94636139e-05f, 1.15353643e-04f, 1.32420522e-04f, 1.50664200e-04f, 1.70084662e-04f,
+        1.90681836e-04f, 2.12455692e-04f, 2.35406173e-04f, 2.59533204e-04f, 2.84836773e-04f, 3.11316777e-04f,
+        3.38973186e-04f, 3.67805915e-04f, 3.97814874e-04f, 4.29000065e-04f, 4.61361342e-04f, 4.94898646e-04f,
+        5.29611949e-04f, 5.65501105e-04f, 6.02565997e-04f, 6.40806684e-04f, 6.80222933e-04f, 7.20814744e-04f,
+        7.62581942e-04f, 8.05524469e-04f, 8.49642209e-04f, 8.94935103e-04f, 9.41403036e-04f, 9.89045831e-04f,
+        1.03786343e-03f, 1.08785566e-03f, 1.13902253e-03f, 1.19136390e-03f, 1.24487944e-03f, 1.29956927e-03f,
+        1.35543314e-03f, 1.41247094e-03f, 1.47068244e-03f, 1.53006776e-03f, 1.59062655e-03f, 1.65235868e-03f,
+        1.71526405e-03f, 1.77934254e-03f, 1.84459391e-03f, 1.91101816e-03f, 1.97861483e-03f, 2.04738416e-03f,
+        2.11732578e-03f, 2.18843948e-03f, 2.26072525e-03f, 2.33418262e-03f, 2.40881182e-03f, 2.48461240e-03f,
+        2.56158412e-03f, 2.63972720e-03f, 2.71904096e-03f, 2.79952539e-03f, 2.88118050e-03f, 2.96400604e-03f,
+        3.04800156e-03f, 3.13316705e-03f, 3.21950228e-03f, 3.30700725e-03f, 3.39568127e-03f, 3.48552456e-03f,
+        3.57653690e-03f, 3.66871781e-03f, 3.76206706e-03f, 3.85658466e-03f, 3.95227037e-03f, 4.04912420e-03f,
+        4.14714497e-03f, 4.24633361e-03f, 4.34668921e-03f, 4.44821175e-03f, 4.55090078e-03f, 4.65475628e-03f,
+        4.75977780e-03f, 4.86596581e-03f, 4.97331889e-03f, 5.08183753e-03f, 5.19152172e-03f, 5.30237006e-03f,
+        5.41438349e-03f, 5.52756153e-03f, 5.64190326e-03f, 5.75740915e-03f, 5.87407826e-03f, 5.99191105e-03f,
+        6.11090660e-03f, 6.23106491e-03f, 6.35238551e-03f, 6.47486886e-03f, 6.59851357e-03f, 6.72332011e-03f,
+        6.84928754e-03f, 6.97641633e-03f, 7.10470602e-03f, 7.23415567e-03f, 7.36476574e-03f, 7.49653531e-03f,
+        7.62946438e-03f, 7.76355295e-03f, 7.89880008e-03f, 8.03520530e-03f, 8.17277003e-03f, 8.31149146e-03f,
+        8.45137052e-03f, 8.59240722e-03f, 8.73460062e-03f, 8.87795072e-03f, 9.02245753e-03f, 9.16811917e-03f,
+        9.31493659e-03f, 9.46290977e-03f, 9.61203780e-03f, 9.76231974e-03f, 9.91375651e-03f, 1.00663463e-02f,
+        1.02200899e-02f, 1.03749866e-02f, 1.05310353e-02f, 1.06882369e-02f, 1.08465906e-02f, 1.10060964e-02f,
+        1.11667523e-02f, 1.13285594e-02f, 1.14915175e-02f, 1.16556250e-02f, 1.18208826e-02f, 1.19872894e-02f,
+        1.21548455e-02f, 1.23235490e-02f, 1.24934018e-02f, 1.26644019e-02f, 1.28365485e-02f, 1.30098425e-02f,
+        1.31842839e-02f, 1.33598708e-02f, 1.35366032e-02f, 1.37144802e-02f, 1.38935028e-02f, 1.40736699e-02f,
+        1.42549807e-02f, 1.44374352e-02f, 1.46210333e-02f, 1.48057733e-02f, 1.49916559e-02f, 1.51786804e-02f,
+        1.53668458e-02f, 1.55561529e-02f, 1.57466009e-02f, 1.59381870e-02f, 1.61309149e-02f, 1.63247809e-02f,
+        1.65197849e-02f, 1.67159289e-02f, 1.69132091e-02f, 1.71116274e-02f, 1.73111819e-02f, 1.75118726e-02f,
+        1.77136995e-02f, 1.79166626e-02f, 1.81207601e-02f, 1.83259919e-02f, 1.85323581e-02f, 1.87398568e-02f,
+        1.89484898e-02f, 1.91582553e-02f, 1.93691514e-02f, 1.95811801e-02f, 1.97943393e-02f, 2.00086311e-02f,
+        2.02240497e-02f, 2.04405989e-02f, 2.06582788e-02f, 2.08770856e-02f, 2.10970212e-02f, 2.13180836e-02f,
+        2.15402730e-02f, 2.17635874e-02f, 2.19880305e-02f, 2.22135969e-02f, 2.24402882e-02f, 2.26681046e-02f,
+        2.28970461e-02f, 2.31271088e-02f, 2.33582947e-02f, 2.35906020e-02f, 2.38240324e-02f, 2.40585823e-02f,
+        2.42942534e-02f, 2.45310441e-02f, 2.47689541e-02f, 2.50079837e-02f, 2.52481308e-02f, 2.54893973e-02f,
+        2.57317796e-02f, 2.59752776e-02f, 2.62198932e-02f, 2.64656227e-02f, 2.67124679e-02f, 2.69604269e-02f,
+        2.72094999e-02f, 2.74596866e-02f, 2.77109835e-02f, 2.79633943e-02f, 2.82169152e-02f, 2.84715481e-02f,
+        2.87272912e-02f, 2.89841425e-02f, 2.92421039e-02f, 2.95011718e-02f, 2.97613498e-02f, 3.00226323e-02f,
+        3.02850232e-02f, 3.05485185e-02f, 3.08131203e-02f, 3.10788266e-02f, 3.13456357e-02f, 3.16135474e-02f,
+        3.18825655e-02f, 3.21526825e-02f, 3.24239023e-02f, 3.26962210e-02f, 3.29696424e-02f, 3.32441628e-02f,
+        3.35197821e-02f, 3.37964967e-02f, 3.40743102e-02f, 3.43532227e-02f, 3.46332304e-02f, 3.49143334e-02f,
+        3.51965316e-02f, 3.54798250e-02f, 3.57642099e-02f, 3.60496901e-02f, 3.63362581e-02f, 3.66239212e-02f,
+        3.69126759e-02f, 3.72025184e-02f, 3.74934524e-02f, 3.77854742e-02f, 3.80785838e-02f, 3.83727811e-02f,
+        3.86680663e-02f, 3.89644392e-02f, 3.92618924e-02f, 3.95604335e-02f, 3.98600586e-02f, 4.01607677e-02f,
+        4.04625572e-02f, 4.07654308e-02f, 4.10693847e-02f, 4.13744189e-02f, 4.16805334e-02f, 4.19877246e-02f,
+        4.22959961e-02f, 4.26053442e-02f, 4.29157689e-02f, 4.32272702e-02f, 4.35398482e-02f, 4.38534990e-02f,
+        4.41682264e-02f, 4.44840230e-02f, 4.48008925e-02f, 4.51188348e-02f, 4.54378501e-02f, 4.57579345e-02f,
+        4.60790880e-02f, 4.64013070e-02f, 4.67245989e-02f, 4.70489562e-02f, 4.73743789e-02f, 4.77008671e-02f,
+        4.80284207e-02f, 4.83570360e-02f, 4.86867167e-02f, 4.90174592e-02f, 4.93492670e-02f, 4.96821329e-02f,
+        5.00160567e-02f, 5.03510423e-02f, 5.06870858e-02f, 5.10241874e-02f, 5.13623469e-02f, 5.17015643e-02f,
+        5.20418324e-02f, 5.23831584e-02f, 5.27255386e-02f, 5.30689694e-02f, 5.34134544e-02f, 5.37589863e-02f,
+        5.41055724e-02f, 5.44532090e-02f, 5.48018925e-02f, 5.51516265e-02f, 5.55024073e-02f, 5.58542348e-02f,
+        5.62071055e-02f, 5.65610230e-02f, 5.69159836e-02f, 5.72719872e-02f, 5.76290339e-02f, 5.79871200e-02f,
+        5.83462492e-02f, 5.87064177e-02f, 5.90676256e-02f, 5.94298691e-02f, 5.97931519e-02f, 6.01574704e-02f,
+        6.05228245e-02f, 6.08892143e-02f, 6.12566359e-02f, 6.16250895e-02f, 6.19945787e-02f, 6.23650961e-02f,
+        6.27366453e-02f, 6.31092265e-02f, 6.34828284e-02f, 6.38574660e-02f, 6.42331243e-02f, 6.46098182e-02f,
+        6.49875253e-02f, 6.53662607e-02f, 6.57460243e-02f, 6.61268085e-02f, 6.65086061e-02f, 6.68914318e-02f,
+        6.72752783e-02f, 6.76601380e-02f, 6.80460185e-02f, 6.84329197e-02f, 6.88208267e-02f, 6.92097545e-02f,
+        6.95997030e-02f, 6.99906573e-02f, 7.03826249e-02f, 7.07756057e-02f, 7.11695924e-02f, 7.15645924e-02f,
+        7.19605982e-02f, 7.23576173e-02f, 7.27556422e-02f, 7.31546655e-02f, 7.35547021e-02f, 7.39557371e-02f,
+        7.43577778e-02f, 7.47608244e-02f, 7.51648620e-02f, 7.55699053e-02f, 7.59759545e-02f, 7.63829947e-02f,
+        7.67910331e-02f, 7.72000700e-02f, 7.76100978e-02f, 7.80211240e-02f, 7.84331411e-02f, 7.88461491e-02f,
+        7.92601556e-02f, 7.96751454e-02f, 8.00911263e-02f, 8.05080980e-02f, 8.09260532e-02f, 8.13449994e-02f,
+        8.17649290e-02f, 8.21858495e-02f, 8.26077461e-02f, 8.30306262e-02f, 8.34544897e-02f, 8.38793367e-02f,
+        8.43051597e-02f, 8.47319588e-02f, 8.51597413e-02f, 8.55884925e-02f, 8.60182270e-02f, 8.64489302e-02f,
+        8.68806094e-02f, 8.73132646e-02f, 8.77468884e-02f, 8.81814882e-02f, 8.86170492e-02f, 8.90535787e-02f,
+        8.94910842e-02f, 8.99295509e-02f, 9.03689787e-02f, 9.08093750e-02f, 9.12507400e-02f, 9.16930586e-02f,
+        9.21363458e-02f, 9.25805867e-02f, 9.30257887e-02f, 9.34719518e-02f, 9.39190686e-02f, 9.43671390e-02f,
+        9.48161706e-02f, 9.52661559e-02f, 9.57170874e-02f, 9.61689800e-02f, 9.66218188e-02f, 9.70756039e-02f,
+        9.75303426e-02f, 9.79860201e-02f, 9.84426513e-02f, 9.89002287e-02f, 9.93587524e-02f, 9.98182148e-02f,
+        1.00278616e-01f, 1.00739963e-01f, 1.01202250e-01f, 1.01665474e-01f, 1.02129638e-01f, 1.02594741e-01f,
+        1.03060775e-01f, 1.03527747e-01f, 1.03995644e-01f, 1.04464486e-01f, 1.04934253e-01f, 1.05404943e-01f,
+        1.05876572e-01f, 1.06349126e-01f, 1.06822602e-01f, 1.07297011e-01f, 1.07772343e-01f, 1.08248599e-01f,
+        1.08725771e-01f, 1.09203868e-01f, 1.09682888e-01f, 1.10162824e-01f, 1.10643677e-01f, 1.11125447e-01f,
+        1.11608133e-01f, 1.12091735e-01f, 1.12576246e-01f, 1.13061674e-01f, 1.13548011e-01f, 1.14035256e-01f,
+        1.14523411e-01f, 1.15012474e-01f, 1.15502447e-01f, 1.15993321e-01f, 1.16485097e-01f, 1.16977781e-01f,
+        1.17471360e-01f, 1.17965847e-01f, 1.18461229e-01f, 1.18957512e-01f, 1.19454689e-01f, 1.19952761e-01f,
+        1.20451733e-01f, 1.20951593e-01f, 1.21452346e-01f, 1.21953994e-01f, 1.22456528e-01f, 1.22959957e-01f,
+        1.23464264e-01f, 1.23969465e-01f, 1.24475554e-01f, 1.24982521e-01f, 1.25490367e-01f, 1.25999108e-01f,
+        1.26508713e-01f, 1.27019212e-01f, 1.27530575e-01f, 1.28042832e-01f, 1.28555954e-01f, 1.29069954e-01f,
+        1.29584819e-01f, 1.30100563e-01f, 1.30617172e-01f, 1.31134659e-01f, 1.31653011e-01f, 1.32172227e-01f,
+        1.32692322e-01f, 1.33213267e-01f, 1.33735076e-01f, 1.34257749e-01f, 1.34781286e-01f, 1.35305688e-01f,
+        1.35830939e-01f, 1.36357054e-01f, 1.36884019e-01f, 1.37411848e-01f, 1.37940526e-01f, 1.38470054e-01f,
+        1.39000431e-01f, 1.39531657e-01f, 1.40063748e-01f, 1.40596673e-01f, 1.41130447e-01f, 1.41665056e-01f,
+        1.42200515e-01f, 1.42736822e-01f, 1.43273965e-01f, 1.43811956e-01f, 1.44350767e-01f, 1.44890428e-01f,
+        1.45430937e-01f, 1.45972267e-01f, 1.46514431e-01f, 1.47057429e-01f, 1.47601247e-01f, 1.48145899e-01f,
+        1.48691386e-01f, 1.49237707e-01f, 1.49784848e-01f, 1.50332808e-01f, 1.50881588e-01f, 1.51431203e-01f,
+        1.51981622e-01f, 1.52532876e-01f, 1.53084934e-01f, 1.53637826e-01f, 1.54191524e-01f, 1.54746026e-01f,
+        1.55301362e-01f, 1.55857489e-01f, 1.56414434e-01f, 1.56972200e-01f, 1.57530755e-01f, 1.58090129e-01f,
+        1.58650309e-01f, 1.59211278e-01f, 1.59773067e-01f, 1.60335645e-01f, 1.60899028e-01f, 1.61463201e-01f,
+        1.62028179e-01f, 1.62593946e-01f, 1.63160518e-01f, 1.63727880e-01f, 1.64296031e-01f, 1.64864972e-01f,
+        1.65434703e-01f, 1.66005209e-01f, 1.66576520e-01f, 1.67148605e-01f, 1.67721480e-01f, 1.68295130e-01f,
+        1.68869570e-01f, 1.69444785e-01f, 1.70020774e-01f, 1.70597553e-01f, 1.71175092e-01f, 1.71753421e-01f,
+        1.72332510e-01f, 1.72912374e-01f, 1.73493013e-01f, 1.74074411e-01f, 1.74656585e-01f, 1.75239518e-01f,
+        1.75823212e-01f, 1.76407680e-01f, 1.76992908e-01f, 1.77578896e-01f, 1.78165644e-01f, 1.78753138e-01f,
+        1.79341406e-01f, 1.79930419e-01f, 1.80520177e-01f, 1.81110710e-01f, 1.81701973e-01f, 1.82293996e-01f,
+        1.82886764e-01f, 1.83480278e-01f, 1.84074536e-01f, 1.84669539e-01f, 1.85265288e-01f, 1.85861766e-01f,
+        1.86458990e-01f, 1.87056959e-01f, 1.87655658e-01f, 1.88255101e-01f, 1.88855276e-01f, 1.89456180e-01f,
+        1.90057799e-01f, 1.90660164e-01f, 1.91263258e-01f, 1.91867083e-01f, 1.92471623e-01f, 1.93076894e-01f,
+        1.93682879e-01f, 1.94289595e-01f, 1.94897026e-01f, 1.95505172e-01f, 1.96114048e-01f, 1.96723625e-01f,
+        1.97333917e-01f, 1.97944924e-01f, 1.98556647e-01f, 1.99169084e-01f, 1.99782223e-01f, 2.00396061e-01f,
+        2.01010615e-01f, 2.01625869e-01f, 2.02241823e-01f, 2.02858478e-01f, 2.03475833e-01f, 2.04093888e-01f,
+        2.04712644e-01f, 2.05332085e-01f, 2.05952227e-01f, 2.06573069e-01f, 2.07194582e-01f, 2.07816795e-01f,
+        2.08439693e-01f, 2.09063292e-01f, 2.09687561e-01f, 2.10312515e-01f, 2.10938156e-01f, 2.11564466e-01f,
+        2.12191463e-01f, 2.12819144e-01f, 2.13447496e-01f, 2.14076519e-01f, 2.14706212e-01f, 2.15336591e-01f,
+        2.15967625e-01f, 2.16599330e-01f, 2.17231706e-01f, 2.17864752e-01f, 2.18498453e-01f, 2.19132826e-01f,
+        2.19767854e-01f, 2.20403552e-01f, 2.21039891e-01f, 2.21676901e-01f, 2.22314566e-01f, 2.22952873e-01f,
+        2.23591834e-01f, 2.24231452e-01f, 2.24871725e-01f, 2.25512639e-01f, 2.26154193e-01f, 2.26796404e-01f,
+        2.27439255e-01f, 2.28082731e-01f, 2.28726864e-01f, 2.29371637e-01f, 2.30017036e-01f, 2.30663076e-01f,
+        2.31309757e-01f, 2.31957063e-01f, 2.32605010e-01f, 2.33253568e-01f, 2.33902767e-01f, 2.34552592e-01f,
+        2.35203043e-01f, 2.35854104e-01f, 2.36505806e-01f, 2.37158120e-01f, 2.37811044e-01f, 2.38464594e-01f,
+        2.39118755e-01f, 2.39773542e-01f, 2.40428925e-01f, 2.41084933e-01f, 2.41741553e-01f, 2.42398769e-01f,
+        2.43056595e-01f, 2.43715033e-01f, 2.44374067e-01f, 2.45033696e-01f, 2.45693937e-01f, 2.46354774e-01f,
+        2.47016206e-01f, 2.47678235e-01f, 2.48340860e-01f, 2.49004066e-01f, 2.49667883e-01f, 2.50332266e-01f,
+        2.50997245e-01f, 2.51662821e-01f, 2.52328992e-01f, 2.52995729e-01f, 2.53663033e-01f, 2.54330933e-01f,
+        2.54999399e-01f, 2.55668461e-01f, 2.56338090e-01f, 2.57008284e-01f, 2.57679075e-01f, 2.58350402e-01f,
+        2.59022325e-01f, 2.59694815e-01f, 2.60367841e-01f, 2.61041462e-01f, 2.61715651e-01f, 2.62390375e-01f,
+        2.63065666e-01f, 2.63741523e-01f, 2.64417917e-01f, 2.65094906e-01f, 2.65772402e-01f, 2.66450465e-01f,
+        2.67129093e-01f, 2.67808259e-01f, 2.68487960e-01f, 2.69168228e-01f, 2.69849032e-01f, 2.70530373e-01f,
+        2.71212250e-01f, 2.71894664e-01f, 2.72577643e-01f, 2.73261130e-01f, 2.73945153e-01f, 2.74629712e-01f,
+        2.75314808e-01f, 2.76000410e-01f, 2.76686579e-01f, 2.77373224e-01f, 2.78060436e-01f, 2.78748155e-01f,
+        2.79436380e-01f, 2.80125141e-01f, 2.80814439e-01f, 2.81504214e-01f, 2.82194525e-01f, 2.82885343e-01f,
+        2.83576667e-01f, 2.84268528e-01f, 2.84960866e-01f, 2.85653710e-01f, 2.86347091e-01f, 2.87040949e-01f,
+        2.87735313e-01f, 2.88430154e-01f, 2.89125532e-01f, 2.89821386e-01f, 2.90517747e-01f, 2.91214585e-01f,
+        2.91911930e-01f, 2.92609751e-01f, 2.93308049e-01f, 2.94006854e-01f, 2.94706166e-01f, 2.95405924e-01f,
+        2.96106160e-01f, 2.96806902e-01f, 2.97508121e-01f, 2.98209816e-01f, 2.98911959e-01f, 2.99614608e-01f,
+        3.00317705e-01f, 3.01021278e-01f, 3.01725328e-01f, 3.02429855e-01f, 3.03134829e-01f, 3.03840250e-01f,
+        3.04546177e-01f, 3.05252522e-01f, 3.05959344e-01f, 3.06666642e-01f, 3.07374358e-01f, 3.08082551e-01f,
+        3.08791190e-01f, 3.09500277e-01f, 3.10209811e-01f, 3.10919791e-01f, 3.11630219e-01f, 3.12341094e-01f,
+        3.13052416e-01f, 3.13764185e-01f, 3.14476371e-01f, 3.15189004e-01f, 3.15902054e-01f, 3.16615552e-01f,
+        3.17329496e-01f, 3.18043858e-01f, 3.18758637e-01f, 3.19473863e-01f, 3.20189506e-01f, 3.20905566e-01f,
+        3.21622044e-01f, 3.22338939e-01f, 3.23056281e-01f, 3.23774010e-01f, 3.24492157e-01f, 3.25210720e-01f,
+        3.25929701e-01f, 3.26649100e-01f, 3.27368915e-01f, 3.28089118e-01f, 3.28809708e-01f, 3.29530716e-01f,
+        3.30252141e-01f, 3.30973953e-01f, 3.31696153e-01f, 3.32418770e-01f, 3.33141774e-01f, 3.33865166e-01f,
+        3.34588945e-01f, 3.35313112e-01f, 3.36037695e-01f, 3.36762637e-01f, 3.37487966e-01f, 3.38213682e-01f,
+        3.38939786e-01f, 3.39666247e-01f, 3.40393096e-01f, 3.41120332e-01f, 3.41847926e-01f, 3.42575908e-01f,
+        3.43304247e-01f, 3.44032973e-01f, 3.44762057e-01f, 3.45491499e-01f, 3.46221328e-01f, 3.46951485e-01f,
+        3.47682029e-01f, 3.48412901e-01f, 3.49144161e-01f, 3.49875778e-01f, 3.50607723e-01f, 3.51340026e-01f,
+        3.52072686e-01f, 3.52805704e-01f, 3.53539050e-01f, 3.54272753e-01f, 3.55006784e-01f, 3.55741173e-01f,
+        3.56475890e-01f, 3.57210964e-01f, 3.57946366e-01f, 3.58682096e-01f, 3.59418154e-01f, 3.60154539e-01f,
+        3.60891283e-01f, 3.61628324e-01f, 3.62365693e-01f, 3.63103390e-01f, 3.63841414e-01f, 3.64579767e-01f,
+        3.65318418e-01f, 3.66057396e-01f, 3.66796702e-01f, 3.67536306e-01f, 3.68276238e-01f, 3.69016469e-01f,
+        3.69756997e-01f, 3.70497853e-01f, 3.71239007e-01f, 3.71980458e-01f, 3.72722208e-01f, 3.73464257e-01f,
+        3.74206632e-01f, 3.74949276e-01f, 3.75692219e-01f, 3.76435459e-01f, 3.77178967e-01f, 3.77922803e-01f,
+        3.78666908e-01f, 3.79411280e-01f, 3.80155951e-01f, 3.80900919e-01f, 3.81646156e-01f, 3.82391661e-01f,
+        3.83137465e-01f, 3.83883506e-01f, 3.84629846e-01f, 3.85376483e-01f, 3.86123359e-01f, 3.86870503e-01f,
+        3.87617916e-01f, 3.88365597e-01f, 3.89113545e-01f, 3.89861733e-01f, 3.90610218e-01f, 3.91358912e-01f,
+        3.92107904e-01f, 3.92857134e-01f, 3.93606603e-01f, 3.94356340e-01f, 3.95106316e-01f, 3.95856559e-01f,
+        3.96607041e-01f, 3.97357762e-01f, 3.98108721e-01f, 3.98859918e-01f, 3.99611354e-01f, 4.00363028e-01f,
+        4.01114941e-01f, 4.01867062e-01f, 4.02619451e-01f, 4.03372049e-01f, 4.04124856e-01f, 4.04877931e-01f,
+        4.05631214e-01f, 4.06384706e-01f, 4.07138437e-01f, 4.07892376e-01f, 4.08646524e-01f, 4.09400880e-01f,
+        4.10155475e-01f, 4.10910279e-01f, 4.11665291e-01f, 4.12420481e-01f, 4.13175911e-01f, 4.13931549e-01f,
+        4.14687365e-01f, 4.15443391e-01f, 4.16199625e-01f, 4.16956037e-01f, 4.17712659e-01f, 4.18469489e-01f,
+        4.19226468e-01f, 4.19983685e-01f, 4.20741051e-01f, 4.21498626e-01f, 4.22256380e-01f, 4.23014313e-01f,
+        4.23772454e-01f, 4.24530745e-01f, 4.25289214e-01f, 4.26047862e-01f, 4.26806688e-01f, 4.27565694e-01f,
+        4.28324878e-01f, 4.29084212e-01f, 4.29843724e-01f, 4.30603385e-01f, 4.31363225e-01f, 4.32123214e-01f,
+        4.32883382e-01f, 4.33643669e-01f, 4.34404165e-01f, 4.35164779e-01f, 4.35925543e-01f, 4.36686486e-01f,
+        4.37447548e-01f, 4.38208789e-01f, 4.38970149e-01f, 4.39731658e-01f, 4.40493315e-01f, 4.41255122e-01f,
+        4.42017049e-01f, 4.42779124e-01f, 4.43541318e-01f, 4.44303662e-01f, 4.45066124e-01f, 4.45828706e-01f,
+        4.46591437e-01f, 4.47354287e-01f, 4.48117286e-01f, 4.48880374e-01f, 4.49643582e-01f, 4.50406909e-01f,
+        4.51170385e-01f, 4.51933950e-01f, 4.52697635e-01f, 4.53461409e-01f, 4.54225332e-01f, 4.54989314e-01f,
+        4.55753446e-01f, 4.56517667e-01f, 4.57281977e-01f, 4.58046407e-01f, 4.58810925e-01f, 4.59575534e-01f,
+        4.60340261e-01f, 4.61105078e-01f, 4.61869955e-01f, 4.62634951e-01f, 4.63400036e-01f, 4.64165181e-01f,
+        4.64930445e-01f, 4.65695769e-01f, 4.66461182e-01f, 4.67226654e-01f, 4.67992246e-01f, 4.68757868e-01f,
+        4.69523579e-01f, 4.70289379e-01f, 4.71055239e-01f, 4.71821159e-01f, 4.72587138e-01f, 4.73353207e-01f,
+        4.74119335e-01f, 4.74885494e-01f, 4.75651741e-01f, 4.76418048e-01f, 4.77184385e-01f, 4.77950782e-01f,
+        4.78717238e-01f, 4.79483753e-01f, 4.80250299e-01f, 4.81016904e-01f, 4.81783569e-01f, 4.82550263e-01f,
+        4.83316988e-01f, 4.84083742e-01f, 4.84850556e-01f, 4.85617399e-01f, 4.86384273e-01f, 4.87151176e-01f,
+        4.87918139e-01f, 4.88685101e-01f, 4.89452094e-01f, 4.90219116e-01f, 4.90986139e-01f, 4.91753221e-01f,
+        4.92520303e-01f, 4.93287385e-01f, 4.94054526e-01f, 4.94821638e-01f, 4.95588779e-01f, 4.96355951e-01f,
+        4.97123092e-01f, 4.97890264e-01f, 4.98657435e-01f, 4.99424607e-01f, 5.00191808e-01f, 5.00958979e-01f,
+        5.01726151e-01f, 5.02493322e-01f, 5.03260493e-01f, 5.04027665e-01f, 5.04794776e-01f, 5.05561948e-01f,
+        5.06329060e-01f, 5.07096171e-01f, 5.07863224e-01f, 5.08630335e-01f, 5.09397388e-01f, 5.10164380e-01f,
+        5.10931432e-01f, 5.11698365e-01f, 5.12465358e-01f, 5.13232291e-01f, 5.13999164e-01f, 5.14766037e-01f,
+        5.15532851e-01f, 5.16299665e-01f, 5.17066360e-01f, 5.17833114e-01f, 5.18599749e-01f, 5.19366384e-01f,
+        5.20132959e-01f, 5.20899475e-01f, 5.21665990e-01f, 5.22432387e-01f, 5.23198783e-01f, 5.23965120e-01f,
+        5.24731398e-01f, 5.25497615e-01f, 5.26263714e-01f, 5.27029812e-01f, 5.27795851e-01f, 5.28561831e-01f,
+        5.29327691e-01f, 5.30093551e-01f, 5.30859292e-01f, 5.31624973e-01f, 5.32390535e-01f, 5.33156097e-01f,
+        5.33921540e-01f, 5.34686923e-01f, 5.35452187e-01f, 5.36217391e-01f, 5.36982536e-01f, 5.37747562e-01f,
+        5.38512468e-01f, 5.39277375e-01f, 5.40042102e-01f, 5.40806770e-01f, 5.41571319e-01f, 5.42335808e-01f,
+        5.43100178e-01f, 5.43864489e-01f, 5.44628620e-01f, 5.45392692e-01f, 5.46156645e-01f, 5.46920478e-01f,
+        5.47684252e-01f, 5.48447847e-01f, 5.49211383e-01f, 5.49974740e-01f, 5.50738037e-01f, 5.51501215e-01f,
+        5.52264214e-01f, 5.53027153e-01f, 5.53789914e-01f, 5.54552615e-01f, 5.55315137e-01f, 5.56077540e-01f,
+        5.56839824e-01f, 5.57601929e-01f, 5.58363914e-01f, 5.59125781e-01f, 5.59887528e-01f, 5.60649097e-01f,
+        5.61410546e-01f, 5.62171876e-01f, 5.62933028e-01f, 5.63694000e-01f, 5.64454854e-01f, 5.65215528e-01f,
+        5.65976083e-01f, 5.66736519e-01f, 5.67496717e-01f, 5.68256795e-01f, 5.69016695e-01f, 5.69776475e-01f,
+        5.70536077e-01f, 5.71295500e-01f, 5.72054744e-01f, 5.72813809e-01f, 5.73572755e-01f, 5.74331462e-01f,
+        5.75090051e-01f, 5.75848401e-01f, 5.76606631e-01f, 5.77364683e-01f, 5.78122497e-01f, 5.78880191e-01f,
+        5.79637647e-01f, 5.80394924e-01f, 5.81152022e-01f, 5.81908941e-01f, 5.82665682e-01f, 5.83422184e-01f,
+        5.84178507e-01f, 5.84934652e-01f, 5.85690558e-01f, 5.86446285e-01f, 5.87201834e-01f, 5.87957144e-01f,
+        5.88712275e-01f, 5.89467168e-01f, 5.90221822e-01f, 5.90976298e-01f, 5.91730595e-01f, 5.92484653e-01f,
+        5.93238473e-01f, 5.93992054e-01f, 5.94745457e-01f, 5.95498621e-01f, 5.96251547e-01f, 5.97004294e-01f,
+        5.97756803e-01f, 5.98509014e-01f, 5.99261045e-01f, 6.00012839e-01f, 6.00764394e-01f, 6.01515710e-01f,
+        6.02266788e-01f, 6.03017628e-01f, 6.03768229e-01f, 6.04518592e-01f, 6.05268717e-01f, 6.06018543e-01f,
+        6.06768131e-01f, 6.07517540e-01f, 6.08266592e-01f, 6.09015465e-01f, 6.09764040e-01f, 6.10512376e-01f,
+        6.11260474e-01f, 6.12008274e-01f, 6.12755835e-01f, 6.13503098e-01f, 6.14250124e-01f, 6.14996850e-01f,
+        6.15743339e-01f, 6.16489530e-01f, 6.17235482e-01f, 6.17981136e-01f, 6.18726492e-01f, 6.19471610e-01f,
+        6.20216429e-01f, 6.20960951e-01f, 6.21705174e-01f, 6.22449160e-01f, 6.23192847e-01f, 6.23936236e-01f,
+        6.24679327e-01f, 6.25422120e-01f, 6.26164615e-01f, 6.26906812e-01f, 6.27648711e-01f, 6.28390312e-01f,
+        6.29131615e-01f, 6.29872620e-01f, 6.30613327e-01f, 6.31353676e-01f, 6.32093787e-01f, 6.32833540e-01f,
+        6.33572996e-01f, 6.34312093e-01f, 6.35050952e-01f, 6.35789454e-01f, 6.36527658e-01f, 6.37265503e-01f,
+        6.38003051e-01f, 6.38740242e-01f, 6.39477134e-01f, 6.40213668e-01f, 6.40949905e-01f, 6.41685843e-01f,
+        6.42421365e-01f, 6.43156588e-01f, 6.43891513e-01f, 6.44626081e-01f, 6.45360291e-01f, 6.46094143e-01f,
+        6.46827698e-01f, 6.47560835e-01f, 6.48293674e-01f, 6.49026155e-01f, 6.49758279e-01f, 6.50490105e-01f,
+        6.51221514e-01f, 6.51952565e-01f, 6.52683318e-01f, 6.53413653e-01f, 6.54143631e-01f, 6.54873252e-01f,
+        6.55602515e-01f, 6.56331420e-01f, 6.57059968e-01f, 6.57788098e-01f, 6.58515930e-01f, 6.59243345e-01f,
+        6.59970343e-01f, 6.60697043e-01f, 6.61423326e-01f, 6.62149251e-01f, 6.62874758e-01f, 6.63599908e-01f,
+        6.64324641e-01f, 6.65049016e-01f, 6.65772974e-01f, 6.66496575e-01f, 6.67219758e-01f, 6.67942584e-01f,
+        6.68664992e-01f, 6.69386983e-01f, 6.70108616e-01f, 6.70829833e-01f, 6.71550632e-01f, 6.72271073e-01f,
+        6.72991037e-01f, 6.73710644e-01f, 6.74429834e-01f, 6.75148606e-01f, 6.75866961e-01f, 6.76584899e-01f,
+        6.77302420e-01f, 6.78019583e-01f, 6.78736269e-01f, 6.79452538e-01f, 6.80168390e-01f, 6.80883825e-01f,
+        6.81598783e-01f, 6.82313383e-01f, 6.83027506e-01f, 6.83741271e-01f, 6.84454501e-01f, 6.85167372e-01f,
+        6.85879767e-01f, 6.86591744e-01f, 6.87303305e-01f, 6.88014388e-01f, 6.88725054e-01f, 6.89435244e-01f,
+        6.90145016e-01f, 6.90854311e-01f, 6.91563189e-01f, 6.92271590e-01f, 6.92979574e-01f, 6.93687081e-01f,
+        6.94394112e-01f, 6.95100725e-01f, 6.95806861e-01f, 6.96512520e-01f, 6.97217703e-01f, 6.97922468e-01f,
+        6.98626757e-01f, 6.99330568e-01f, 7.00033903e-01f, 7.00736761e-01f, 7.01439202e-01f, 7.02141106e-01f,
+        7.02842534e-01f, 7.03543544e-01f, 7.04244018e-01f, 7.04944015e-01f, 7.05643535e-01f, 7.06342578e-01f,
+        7.07041144e-01f, 7.07739234e-01f, 7.08436787e-01f, 7.09133923e-01f, 7.09830523e-01f, 7.10526586e-01f,
+        7.11222231e-01f, 7.11917341e-01f, 7.12611914e-01f, 7.13306069e-01f, 7.13999689e-01f, 7.14692771e-01f,
+        7.15385377e-01f, 7.16077447e-01f, 7.16769040e-01f, 7.17460155e-01f, 7.18150675e-01f, 7.18840718e-01f,
+        7.19530284e-01f, 7.20219314e-01f, 7.20907807e-01f, 7.21595764e-01f, 7.22283244e-01f, 7.22970188e-01f,
+        7.23656595e-01f, 7.24342465e-01f, 7.25027800e-01f, 7.25712657e-01f, 7.26396918e-01f, 7.27080703e-01f,
+        7.27763891e-01f, 7.28446603e-01f, 7.29128778e-01f, 7.29810357e-01f, 7.30491459e-01f, 7.31171966e-01f,
+        7.31851935e-01f, 7.32531369e-01f, 7.33210266e-01f, 7.33888626e-01f, 7.34566391e-01f, 7.35243678e-01f,
+        7.35920370e-01f, 7.36596465e-01f, 7.37272024e-01f, 7.37947047e-01f, 7.38621533e-01f, 7.39295423e-01f,
+        7.39968717e-01f, 7.40641475e-01f, 7.41313696e-01f, 7.41985321e-01f, 7.42656410e-01f, 7.43326902e-01f,
+        7.43996799e-01f, 7.44666159e-01f, 7.45334923e-01f, 7.46003091e-01f, 7.46670723e-01f, 7.47337699e-01f,
+        7.48004198e-01f, 7.48670042e-01f, 7.49335289e-01f, 7.50000000e-01f, 7.50664115e-01f, 7.51327634e-01f,
+        7.51990557e-01f, 7.52652884e-01f, 7.53314614e-01f, 7.53975749e-01f, 7.54636288e-01f, 7.55296171e-01f,
+        7.55955517e-01f, 7.56614268e-01f, 7.57272422e-01f, 7.57929921e-01f, 7.58586824e-01f, 7.59243131e-01f,
+        7.59898841e-01f, 7.60553896e-01f, 7.61208415e-01f, 7.61862278e-01f, 7.62515485e-01f, 7.63168097e-01f,
+        7.63820112e-01f, 7.64471531e-01f, 7.65122235e-01f, 7.65772402e-01f, 7.66421914e-01f, 7.67070770e-01f,
+        7.67719030e-01f, 7.68366694e-01f, 7.69013643e-01f, 7.69659996e-01f, 7.70305753e-01f, 7.70950854e-01f,
+        7.71595299e-01f, 7.72239089e-01f, 7.72882283e-01f, 7.73524761e-01f, 7.74166644e-01f, 7.74807930e-01f,
+        7.75448501e-01f, 7.76088417e-01f, 7.76727736e-01f, 7.77366340e-01f, 7.78004348e-01f, 7.78641701e-01f,
+        7.79278338e-01f, 7.79914379e-01f, 7.80549765e-01f, 7.81184435e-01f, 7.81818449e-01f, 7.82451868e-01f,
+        7.83084571e-01f, 7.83716619e-01f, 7.84347951e-01f, 7.84978688e-01f, 7.85608709e-01f, 7.86238074e-01f,
+        7.86866784e-01f, 7.87494779e-01f, 7.88122118e-01f, 7.88748801e-01f, 7.89374769e-01f, 7.90000021e-01f,
+        7.90624678e-01f, 7.91248620e-01f, 7.91871846e-01f, 7.92494416e-01f, 7.93116271e-01f, 7.93737411e-01f,
+        7.94357955e-01f, 7.94977725e-01f, 7.95596838e-01f, 7.96215236e-01f, 7.96832919e-01f, 7.97449946e-01f,
+        7.98066258e-01f, 7.98681855e-01f, 7.99296737e-01f, 7.99910963e-01f, 8.00524414e-01f, 8.01137209e-01f,
+        8.01749289e-01f, 8.02360654e-01f, 8.02971303e-01f, 8.03581238e-01f, 8.04190457e-01f, 8.04798961e-01f,
+        8.05406749e-01f, 8.06013823e-01f, 8.06620181e-01f, 8.07225823e-01f, 8.07830751e-01f, 8.08434904e-01f,
+        8.09038401e-01f, 8.09641123e-01f, 8.10243130e-01f, 8.10844362e-01f, 8.11444879e-01f, 8.12044740e-01f,
+        8.12643766e-01f, 8.13242137e-01f, 8.13839734e-01f, 8.14436555e-01f, 8.15032661e-01f, 8.15628052e-01f,
+        8.16222668e-01f, 8.16816568e-01f, 8.17409694e-01f, 8.18002105e-01f, 8.18593740e-01f, 8.19184661e-01f,
+        8.19774806e-01f, 8.20364177e-01f, 8.20952833e-01f, 8.21540713e-01f, 8.22127819e-01f, 8.22714210e-01f,
+        8.23299825e-01f, 8.23884666e-01f, 8.24468732e-01f, 8.25052023e-01f, 8.25634599e-01f, 8.26216400e-01f,
+        8.26797426e-01f, 8.27377677e-01f, 8.27957153e-01f, 8.28535855e-01f, 8.29113781e-01f, 8.29690933e-01f,
+        8.30267310e-01f, 8.30842912e-01f, 8.31417739e-01f, 8.31991792e-01f, 8.32565069e-01f, 8.33137512e-01f,
+        8.33709240e-01f, 8.34280133e-01f, 8.34850252e-01f, 8.35419595e-01f, 8.35988164e-01f, 8.36555898e-01f,
+        8.37122858e-01f, 8.37689042e-01f, 8.38254392e-01f, 8.38818967e-01f, 8.39382768e-01f, 8.39945734e-01f,
+        8.40507925e-01f, 8.41069281e-01f, 8.41629863e-01f, 8.42189670e-01f, 8.42748642e-01f, 8.43306780e-01f,
+        8.43864143e-01f, 8.44420671e-01f, 8.44976425e-01f, 8.45531344e-01f, 8.46085429e-01f, 8.46638739e-01f,
+        8.47191215e-01f, 8.47742856e-01f, 8.48293662e-01f, 8.48843694e-01f, 8.49392891e-01f, 8.49941254e-01f,
+        8.50488842e-01f, 8.51035535e-01f, 8.51581454e-01f, 8.52126539e-01f, 8.52670789e-01f, 8.53214204e-01f,
+        8.53756785e-01f, 8.54298532e-01f, 8.54839444e-01f, 8.55379522e-01f, 8.55918765e-01f, 8.56457174e-01f,
+        8.56994689e-01f, 8.57531428e-01f, 8.58067334e-01f, 8.58602345e-01f, 8.59136522e-01f, 8.59669924e-01f,
+        8.60202432e-01f, 8.60734046e-01f, 8.61264884e-01f, 8.61794829e-01f, 8.62323940e-01f, 8.62852156e-01f,
+        8.63379598e-01f, 8.63906085e-01f, 8.64431798e-01f, 8.64956617e-01f, 8.65480602e-01f, 8.66003692e-01f,
+        8.66525948e-01f, 8.67047310e-01f, 8.67567837e-01f, 8.68087471e-01f, 8.68606269e-01f, 8.69124174e-01f,
+        8.69641244e-01f, 8.70157421e-01f, 8.70672703e-01f, 8.71187150e-01f, 8.71700704e-01f, 8.72213423e-01f,
+        8.72725189e-01f, 8.73236120e-01f, 8.73746216e-01f, 8.74255359e-01f, 8.74763668e-01f, 8.75271082e-01f,
+        8.75777602e-01f, 8.76283228e-01f, 8.76788020e-01f, 8.77291858e-01f, 8.77794862e-01f, 8.78296912e-01f,
+        8.78798127e-01f, 8.79298449e-01f, 8.79797876e-01f, 8.80296409e-01f, 8.80793989e-01f, 8.81290734e-01f,
+        8.81786585e-01f, 8.82281482e-01f, 8.82775545e-01f, 8.83268654e-01f, 8.83760929e-01f, 8.84252250e-01f,
+        8.84742677e-01f, 8.85232151e-01f, 8.85720789e-01f, 8.86208475e-01f, 8.86695266e-01f, 8.87181163e-01f,
+        8.87666106e-01f, 8.88150156e-01f, 8.88633311e-01f, 8.89115572e-01f, 8.89596879e-01f, 8.90077233e-01f,
+        8.90556753e-01f, 8.91035318e-01f, 8.91512930e-01f, 8.91989648e-01f, 8.92465413e-01f, 8.92940283e-01f,
+        8.93414259e-01f, 8.93887281e-01f, 8.94359350e-01f, 8.94830525e-01f, 8.95300746e-01f, 8.95770073e-01f,
+        8.96238446e-01f, 8.96705866e-01f, 8.97172332e-01f, 8.97637904e-01f, 8.98102582e-01f, 8.98566246e-01f,
+        8.99029016e-01f, 8.99490833e-01f, 8.99951696e-01f, 9.00411665e-01f, 9.00870621e-01f, 9.01328683e-01f,
+        9.01785791e-01f, 9.02241945e-01f, 9.02697146e-01f, 9.03151393e-01f, 9.03604746e-01f, 9.04057086e-01f,
+        9.04508471e-01f, 9.04958963e-01f, 9.05408442e-01f, 9.05857027e-01f, 9.06304598e-01f, 9.06751275e-01f,
+        9.07196939e-01f, 9.07641649e-01f, 9.08085406e-01f, 9.08528209e-01f, 9.08970058e-01f, 9.09410954e-01f,
+        9.09850836e-01f, 9.10289824e-01f, 9.10727799e-01f, 9.11164820e-01f, 9.11600828e-01f, 9.12035942e-01f,
+        9.12470043e-01f, 9.12903190e-01f, 9.13335323e-01f, 9.13766563e-01f, 9.14196789e-01f, 9.14626002e-01f,
+        9.15054262e-01f, 9.15481567e-01f, 9.15907860e-01f, 9.16333199e-01f, 9.16757584e-01f, 9.17180955e-01f,
+        9.17603314e-01f, 9.18024719e-01f, 9.18445170e-01f, 9.18864608e-01f, 9.19283032e-01f, 9.19700503e-01f,
+        9.20116961e-01f, 9.20532465e-01f, 9.20946956e-01f, 9.21360493e-01f, 9.21773016e-01f, 9.22184527e-01f,
+        9.22595024e-01f, 9.23004568e-01f, 9.23413098e-01f, 9.23820674e-01f, 9.24227178e-01f, 9.24632728e-01f,
+        9.25037265e-01f, 9.25440848e-01f, 9.25843358e-01f, 9.26244915e-01f, 9.26645458e-01f, 9.27044988e-01f,
+        9.27443504e-01f, 9.27841008e-01f, 9.28237557e-01f, 9.28633034e-01f, 9.29027557e-01f, 9.29421008e-01f,
+        9.29813504e-01f, 9.30204928e-01f, 9.30595398e-01f, 9.30984855e-01f, 9.31373239e-01f, 9.31760669e-01f,
+        9.32147026e-01f, 9.32532430e-01f, 9.32916760e-01f, 9.33300078e-01f, 9.33682442e-01f, 9.34063733e-01f,
+        9.34444010e-01f, 9.34823215e-01f, 9.35201466e-01f, 9.35578644e-01f, 9.35954809e-01f, 9.36329961e-01f,
+        9.36704099e-01f, 9.37077165e-01f, 9.37449276e-01f, 9.37820315e-01f, 9.38190281e-01f, 9.38559294e-01f,
+        9.38927233e-01f, 9.39294100e-01f, 9.39659953e-01f, 9.40024793e-01f, 9.40388620e-01f, 9.40751374e-01f,
+        9.41113114e-01f, 9.41473782e-01f, 9.41833436e-01f, 9.42192078e-01f, 9.42549646e-01f, 9.42906141e-01f,
+        9.43261623e-01f, 9.43616092e-01f, 9.43969488e-01f, 9.44321811e-01f, 9.44673121e-01f, 9.45023358e-01f,
+        9.45372581e-01f, 9.45720732e-01f, 9.46067870e-01f, 9.46413934e-01f, 9.46758926e-01f, 9.47102904e-01f,
+        9.47445810e-01f, 9.47787642e-01f, 9.48128462e-01f, 9.48468149e-01f, 9.48806882e-01f, 9.49144483e-01f,
+        9.49481070e-01f, 9.49816585e-01f, 9.50151026e-01f, 9.50484455e-01f, 9.50816751e-01f, 9.51148033e-01f,
+        9.51478243e-01f, 9.51807380e-01f, 9.52135503e-01f, 9.52462494e-01f, 9.52788472e-01f, 9.53113377e-01f,
+        9.53437209e-01f, 9.53759909e-01f, 9.54081595e-01f, 9.54402268e-01f, 9.54721808e-01f, 9.55040276e-01f,
+        9.55357671e-01f, 9.55673993e-01f, 9.55989301e-01f, 9.56303477e-01f, 9.56616580e-01f, 9.56928611e-01f,
+        9.57239568e-01f, 9.57549453e-01f, 9.57858264e-01f, 9.58166003e-01f, 9.58472669e-01f, 9.58778262e-01f,
+        9.59082723e-01f, 9.59386170e-01f, 9.59688485e-01f, 9.59989727e-01f, 9.60289896e-01f, 9.60588992e-01f,
+        9.60886955e-01f, 9.61183906e-01f, 9.61479723e-01f, 9.61774468e-01f, 9.62068081e-01f, 9.62360680e-01f,
+        9.62652147e-01f, 9.62942541e-01f, 9.63231862e-01f, 9.63520050e-01f, 9.63807166e-01f, 9.64093208e-01f,
+        9.64378119e-01f, 9.64661956e-01f, 9.64944720e-01f, 9.65226352e-01f, 9.65506911e-01f, 9.65786397e-01f,
+        9.66064751e-01f, 9.66341972e-01f, 9.66618180e-01f, 9.66893256e-01f, 9.67167199e-01f, 9.67440069e-01f,
+        9.67711866e-01f, 9.67982531e-01f, 9.68252063e-01f, 9.68520522e-01f, 9.68787909e-01f, 9.69054163e-01f,
+        9.69319344e-01f, 9.69583392e-01f, 9.69846308e-01f, 9.70108151e-01f, 9.70368862e-01f, 9.70628500e-01f,
+        9.70887005e-01f, 9.71144438e-01f, 9.71400738e-01f, 9.71655905e-01f, 9.71910000e-01f, 9.72162962e-01f,
+        9.72414792e-01f, 9.72665548e-01f, 9.72915173e-01f, 9.73163664e-01f, 9.73411083e-01f, 9.73657370e-01f,
+        9.73902583e-01f, 9.74146605e-01f, 9.74389553e-01f, 9.74631369e-01f, 9.74872053e-01f, 9.75111663e-01f,
+        9.75350142e-01f, 9.75587487e-01f, 9.75823700e-01f, 9.76058841e-01f, 9.76292849e-01f, 9.76525664e-01f,
+        9.76757467e-01f, 9.76988077e-01f, 9.77217555e-01f, 9.77445960e-01f, 9.77673173e-01f, 9.77899313e-01f,
+        9.78124321e-01f, 9.78348196e-01f, 9.78570938e-01f, 9.78792608e-01f, 9.79013085e-01f, 9.79232430e-01f,
+        9.79450703e-01f, 9.79667842e-01f, 9.79883790e-01f, 9.80098665e-01f, 9.80312407e-01f, 9.80524957e-01f,
+        9.80736434e-01f, 9.80946779e-01f, 9.81155992e-01f, 9.81364012e-01f, 9.81570959e-01f, 9.81776774e-01f,
+        9.81981456e-01f, 9.82184947e-01f, 9.82387364e-01f, 9.82588589e-01f, 9.82788742e-01f, 9.82987702e-01f,
+        9.83185589e-01f, 9.83382285e-01f, 9.83577847e-01f, 9.83772278e-01f, 9.83965576e-01f, 9.84157741e-01f,
+        9.84348774e-01f, 9.84538615e-01f, 9.84727383e-01f, 9.84914958e-01f, 9.85101402e-01f, 9.85286713e-01f,
+        9.85470891e-01f, 9.85653937e-01f, 9.85835791e-01f, 9.86016572e-01f, 9.86196160e-01f, 9.86374617e-01f,
+        9.86551881e-01f, 9.86728072e-01f, 9.86903071e-01f, 9.87076938e-01f, 9.87249672e-01f, 9.87421215e-01f,
+        9.87591684e-01f, 9.87760961e-01f, 9.87929106e-01f, 9.88096058e-01f, 9.88261878e-01f, 9.88426566e-01f,
+        9.88590121e-01f, 9.88752484e-01f, 9.88913715e-01f, 9.89073813e-01f, 9.89232719e-01f, 9.89390492e-01f,
+        9.89547133e-01f, 9.89702582e-01f, 9.89856899e-01f, 9.90010083e-01f, 9.90162134e-01f, 9.90312994e-01f,
+        9.90462661e-01f, 9.90611196e-01f, 9.90758598e-01f, 9.90904868e-01f, 9.91049945e-01f, 9.91193891e-01f,
+        9.91336644e-01f, 9.91478264e-01f, 9.91618693e-01f, 9.91757989e-01f, 9.91896152e-01f, 9.92033124e-01f,
+        9.92168963e-01f, 9.92303610e-01f, 9.92437124e-01f, 9.92569506e-01f, 9.92700696e-01f, 9.92830694e-01f,
+        9.92959559e-01f, 9.93087292e-01f, 9.93213832e-01f, 9.93339241e-01f, 9.93463457e-01f, 9.93586540e-01f,
+        9.93708432e-01f, 9.93829131e-01f, 9.93948758e-01f, 9.94067132e-01f, 9.94184375e-01f, 9.94300485e-01f,
+        9.94415402e-01f, 9.94529188e-01f, 9.94641781e-01f, 9.94753182e-01f, 9.94863451e-01f, 9.94972587e-01f,
+        9.95080531e-01f, 9.95187283e-01f, 9.95292902e-01f, 9.95397329e-01f, 9.95500565e-01f, 9.95602667e-01f,
+        9.95703638e-01f, 9.95803416e-01f, 9.95902002e-01f, 9.95999455e-01f, 9.96095717e-01f, 9.96190846e-01f,
+        9.96284783e-01f, 9.96377528e-01f, 9.96469140e-01f, 9.96559560e-01f, 9.96648788e-01f, 9.96736884e-01f,
+        9.96823788e-01f, 9.96909559e-01f, 9.96994138e-01f, 9.97077525e-01f, 9.97159779e-01f, 9.97240841e-01f,
+        9.97320771e-01f, 9.97399509e-01f, 9.97477055e-01f, 9.97553408e-01f, 9.97628629e-01f, 9.97702718e-01f,
+        9.97775555e-01f, 9.97847259e-01f, 9.97917771e-01f, 9.97987151e-01f, 9.98055339e-01f, 9.98122334e-01f,
+        9.98188198e-01f, 9.98252869e-01f, 9.98316348e-01f, 9.98378634e-01f, 9.98439789e-01f, 9.98499751e-01f,
+        9.98558581e-01f, 9.98616219e-01f, 9.98672664e-01f, 9.98727918e-01f, 9.98782039e-01f, 9.98834968e-01f,
+        9.98886704e-01f, 9.98937309e-01f, 9.98986721e-01f, 9.99034941e-01f, 9.99081969e-01f, 9.99127865e-01f,
+        9.99172568e-01f, 9.99216080e-01f, 9.99258459e-01f, 9.99299645e-01f, 9.99339640e-01f, 9.99378443e-01f,
+        9.99416113e-01f, 9.99452591e-01f, 9.99487877e-01f, 9.99522030e-01f, 9.99554992e-01f, 9.99586761e-01f,
+        9.99617338e-01f, 9.99646783e-01f, 9.99674976e-01f, 9.99702096e-01f, 9.99727964e-01f, 9.99752700e-01f,
+        9.99776244e-01f, 9.99798596e-01f, 9.99819756e-01f, 9.99839783e-01f, 9.99858618e-01f, 9.99876261e-01f,
+        9.99892712e-01f, 9.99908030e-01f, 9.99922156e-01f, 9.99935091e-01f, 9.99946892e-01f, 9.99957502e-01f,
+        9.99966919e-01f, 9.99975145e-01f, 9.99982178e-01f, 9.99988079e-01f, 9.99992788e-01f, 9.99996305e-01f,
+        9.99998689e-01f, 9.99999881e-01f, 9.99999881e-01f, 9.99998689e-01f, 9.99996305e-01f, 9.99992788e-01f,
+        9.99988079e-01f, 9.99982178e-01f, 9.99975145e-01f, 9.99966919e-01f, 9.99957502e-01f, 9.99946892e-01f,
+        9.99935091e-01f, 9.99922156e-01f, 9.99908030e-01f, 9.99892712e-01f, 9.99876261e-01f, 9.99858618e-01f,
+        9.99839783e-01f, 9.99819756e-01f, 9.99798596e-01f, 9.99776244e-01f, 9.99752700e-01f, 9.99727964e-01f,
+        9.99702096e-01f, 9.99674976e-01f, 9.99646783e-01f, 9.99617338e-01f, 9.99586761e-01f, 9.99554992e-01f,
+        9.99522030e-01f, 9.99487877e-01f, 9.99452591e-01f, 9.99416113e-01f, 9.99378443e-01f, 9.99339640e-01f,
+        9.99299645e-01f, 9.99258459e-01f, 9.99216080e-01f, 9.99172568e-01f, 9.99127865e-01f, 9.99081969e-01f,
+        9.99034941e-01f, 9.98986721e-01f, 9.98937309e-01f, 9.98886704e-01f, 9.98834968e-01f, 9.98782039e-01f,
+        9.98727918e-01f, 9.98672664e-01f, 9.98616219e-01f, 9.98558581e-01f, 9.98499751e-01f, 9.98439789e-01f,
+        9.98378634e-01f, 9.98316348e-01f, 9.98252869e-01f, 9.98188198e-01f, 9.98122334e-01f, 9.98055339e-01f,
+        9.97987151e-01f, 9.97917771e-01f, 9.97847259e-01f, 9.97775555e-01f, 9.97702718e-01f, 9.97628629e-01f,
+        9.97553408e-01f, 9.97477055e-01f, 9.97399509e-01f, 9.97320771e-01f, 9.97240841e-01f, 9.97159779e-01f,
+        9.97077525e-01f, 9.96994138e-01f, 9.96909559e-01f, 9.96823788e-01f, 9.96736884e-01f, 9.96648788e-01f,
+        9.96559560e-01f, 9.96469140e-01f, 9.96377528e-01f, 9.96284783e-01f, 9.96190846e-01f, 9.96095717e-01f,
+        9.95999455e-01f, 9.95902002e-01f, 9.95803416e-01f, 9.95703638e-01f, 9.95602667e-01f, 9.95500565e-01f,
+        9.95397329e-01f, 9.95292902e-01f, 9.95187283e-01f, 9.95080531e-01f, 9.94972587e-01f, 9.94863451e-01f,
+        9.94753182e-01f, 9.94641781e-01f, 9.94529188e-01f, 9.94415402e-01f, 9.94300485e-01f, 9.94184375e-01f,
+        9.94067132e-01f, 9.93948758e-01f, 9.93829131e-01f, 9.93708432e-01f, 9.93586540e-01f, 9.93463457e-01f,
+        9.93339241e-01f, 9.93213832e-01f, 9.93087292e-01f, 9.92959559e-01f, 9.92830694e-01f, 9.92700696e-01f,
+        9.92569506e-01f, 9.92437124e-01f, 9.92303610e-01f, 9.92168963e-01f, 9.92033124e-01f, 9.91896152e-01f,
+        9.91757989e-01f, 9.91618693e-01f, 9.91478264e-01f, 9.91336644e-01f, 9.91193891e-01f, 9.91049945e-01f,
+        9.90904868e-01f, 9.90758598e-01f, 9.90611196e-01f, 9.90462661e-01f, 9.90312994e-01f, 9.90162134e-01f,
+        9.90010083e-01f, 9.89856899e-01f, 9.89702582e-01f, 9.89547133e-01f, 9.89390492e-01f, 9.89232719e-01f,
+        9.89073813e-01f, 9.88913715e-01f, 9.88752484e-01f, 9.88590121e-01f, 9.88426566e-01f, 9.88261878e-01f,
+        9.88096058e-01f, 9.87929106e-01f, 9.87760961e-01f, 9.87591684e-01f, 9.87421215e-01f, 9.87249672e-01f,
+        9.87076938e-01f, 9.86903071e-01f, 9.86728072e-01f, 9.86551881e-01f, 9.86374617e-01f, 9.86196160e-01f,
+        9.86016572e-01f, 9.85835791e-01f, 9.85653937e-01f, 9.85470891e-01f, 9.85286713e-01f, 9.85101402e-01f,
+        9.84914958e-01f, 9.84727383e-01f, 9.84538615e-01f, 9.84348774e-01f, 9.84157741e-01f, 9.83965576e-01f,
+        9.83772278e-01f, 9.83577847e-01f, 9.83382285e-01f, 9.83185589e-01f, 9.82987702e-01f, 9.82788742e-01f,
+        9.82588589e-01f, 9.82387364e-01f, 9.82184947e-01f, 9.81981456e-01f, 9.81776774e-01f, 9.81570959e-01f,
+        9.81364012e-01f, 9.81155992e-01f, 9.80946779e-01f, 9.80736434e-01f, 9.80524957e-01f, 9.80312407e-01f,
+        9.80098665e-01f, 9.79883790e-01f, 9.79667842e-01f, 9.79450703e-01f, 9.79232430e-01f, 9.79013085e-01f,
+        9.78792608e-01f, 9.78570938e-01f, 9.78348196e-01f, 9.78124321e-01f, 9.77899313e-01f, 9.77673173e-01f,
+        9.77445960e-01f, 9.77217555e-01f, 9.76988077e-01f, 9.76757467e-01f, 9.76525664e-01f, 9.76292849e-01f,
+        9.76058841e-01f, 9.75823700e-01f, 9.75587487e-01f, 9.75350142e-01f, 9.75111663e-01f, 9.74872053e-01f,
+        9.74631369e-01f, 9.74389553e-01f, 9.74146605e-01f, 9.73902583e-01f, 9.73657370e-01f, 9.73411083e-01f,
+        9.73163664e-01f, 9.72915173e-01f, 9.72665548e-01f, 9.72414792e-01f, 9.72162962e-01f, 9.71910000e-01f,
+        9.71655905e-01f, 9.71400738e-01f, 9.71144438e-01f, 9.70887005e-01f, 9.70628500e-01f, 9.70368862e-01f,
+        9.70108151e-01f, 9.69846308e-01f, 9.69583392e-01f, 9.69319344e-01f, 9.69054163e-01f, 9.68787909e-01f,
+        9.68520522e-01f, 9.68252063e-01f, 9.67982531e-01f, 9.67711866e-01f, 9.67440069e-01f, 9.67167199e-01f,
+        9.66893256e-01f, 9.66618180e-01f, 9.66341972e-01f, 9.66064751e-01f, 9.65786397e-01f, 9.65506911e-01f,
+        9.65226352e-01f, 9.64944720e-01f, 9.64661956e-01f, 9.64378119e-01f, 9.64093208e-01f, 9.63807166e-01f,
+        9.63520050e-01f, 9.63231862e-01f, 9.62942541e-01f, 9.62652147e-01f, 9.62360680e-01f, 9.62068081e-01f,
+        9.61774468e-01f, 9.61479723e-01f, 9.61183906e-01f, 9.60886955e-01f, 9.60588992e-01f, 9.60289896e-01f,
+        9.59989727e-01f, 9.59688485e-01f, 9.59386170e-01f, 9.59082723e-01f, 9.58778262e-01f, 9.58472669e-01f,
+        9.58166003e-01f, 9.57858264e-01f, 9.57549453e-01f, 9.57239568e-01f, 9.56928611e-01f, 9.56616580e-01f,
+        9.56303477e-01f, 9.55989301e-01f, 9.55673993e-01f, 9.55357671e-01f, 9.55040276e-01f, 9.54721808e-01f,
+        9.54402268e-01f, 9.54081595e-01f, 9.53759909e-01f, 9.53437209e-01f, 9.53113377e-01f, 9.52788472e-01f,
+        9.52462494e-01f, 9.52135503e-01f, 9.51807380e-01f, 9.51478243e-01f, 9.51148033e-01f, 9.50816751e-01f,
+        9.50484455e-01f, 9.50151026e-01f, 9.49816585e-01f, 9.49481070e-01f, 9.49144483e-01f, 9.48806882e-01f,
+        9.48468149e-01f, 9.48128462e-01f, 9.47787642e-01f, 9.47445810e-01f, 9.47102904e-01f, 9.46758926e-01f,
+        9.46413934e-01f, 9.46067870e-01f, 9.45720732e-01f, 9.45372581e-01f, 9.45023358e-01f, 9.44673121e-01f,
+        9.44321811e-01f, 9.43969488e-01f, 9.43616092e-01f, 9.43261623e-01f, 9.42906141e-01f, 9.42549646e-01f,
+        9.42192078e-01f, 9.41833436e-01f, 9.41473782e-01f, 9.41113114e-01f, 9.40751374e-01f, 9.40388620e-01f,
+        9.40024793e-01f, 9.39659953e-01f, 9.39294100e-01f, 9.38927233e-01f, 9.38559294e-01f, 9.38190281e-01f,
+        9.37820315e-01f, 9.37449276e-01f, 9.37077165e-01f, 9.36704099e-01f, 9.36329961e-01f, 9.35954809e-01f,
+        9.35578644e-01f, 9.35201466e-01f, 9.34823215e-01f, 9.34444010e-01f, 9.34063733e-01f, 9.33682442e-01f,
+        9.33300078e-01f, 9.32916760e-01f, 9.32532430e-01f, 9.32147026e-01f, 9.31760669e-01f, 9.31373239e-01f,
+        9.30984855e-01f, 9.30595398e-01f, 9.30204928e-01f, 9.29813504e-01f, 9.29421008e-01f, 9.29027557e-01f,
+        9.28633034e-01f, 9.28237557e-01f, 9.27841008e-01f, 9.27443504e-01f, 9.27044988e-01f, 9.26645458e-01f,
+        9.26244915e-01f, 9.25843358e-01f, 9.25440848e-01f, 9.25037265e-01f, 9.24632728e-01f, 9.24227178e-01f,
+        9.23820674e-01f, 9.23413098e-01f, 9.23004568e-01f, 9.22595024e-01f, 9.22184527e-01f, 9.21773016e-01f,
+        9.21360493e-01f, 9.20946956e-01f, 9.20532465e-01f, 9.20116961e-01f, 9.19700503e-01f, 9.19283032e-01f,
+        9.18864608e-01f, 9.18445170e-01f, 9.18024719e-01f, 9.17603314e-01f, 9.17180955e-01f, 9.16757584e-01f,
+        9.16333199e-01f, 9.15907860e-01f, 9.15481567e-01f, 9.15054262e-01f, 9.14626002e-01f, 9.14196789e-01f,
+        9.13766563e-01f, 9.13335323e-01f, 9.12903190e-01f, 9.12470043e-01f, 9.12035942e-01f, 9.11600828e-01f,
+        9.11164820e-01f, 9.10727799e-01f, 9.10289824e-01f, 9.09850836e-01f, 9.09410954e-01f, 9.08970058e-01f,
+        9.08528209e-01f, 9.08085406e-01f, 9.07641649e-01f, 9.07196939e-01f, 9.06751275e-01f, 9.06304598e-01f,
+        9.05857027e-01f, 9.05408442e-01f, 9.04958963e-01f, 9.04508471e-01f, 9.04057086e-01f, 9.03604746e-01f,
+        9.03151393e-01f, 9.02697146e-01f, 9.02241945e-01f, 9.01785791e-01f, 9.01328683e-01f, 9.00870621e-01f,
+        9.00411665e-01f, 8.99951696e-01f, 8.99490833e-01f, 8.99029016e-01f, 8.98566246e-01f, 8.98102582e-01f,
+        8.97637904e-01f, 8.97172332e-01f, 8.96705866e-01f, 8.96238446e-01f, 8.95770073e-01f, 8.95300746e-01f,
+        8.94830525e-01f, 8.94359350e-01f, 8.93887281e-01f, 8.93414259e-01f, 8.92940283e-01f, 8.92465413e-01f,
+        8.91989648e-01f, 8.91512930e-01f, 8.91035318e-01f, 8.90556753e-01f, 8.90077233e-01f, 8.89596879e-01f,
+        8.89115572e-01f, 8.88633311e-01f, 8.88150156e-01f, 8.87666106e-01f, 8.87181163e-01f, 8.86695266e-01f,
+        8.86208475e-01f, 8.85720789e-01f, 8.85232151e-01f, 8.84742677e-01f, 8.84252250e-01f, 8.83760929e-01f,
+        8.83268654e-01f, 8.82775545e-01f, 8.82281482e-01f, 8.81786585e-01f, 8.81290734e-01f, 8.80793989e-01f,
+        8.80296409e-01f, 8.79797876e-01f, 8.79298449e-01f, 8.78798127e-01f, 8.78296912e-01f, 8.77794862e-01f,
+        8.77291858e-01f, 8.76788020e-01f, 8.76283228e-01f, 8.75777602e-01f, 8.75271082e-01f, 8.74763668e-01f,
+        8.74255359e-01f, 8.73746216e-01f, 8.73236120e-01f, 8.72725189e-01f, 8.72213423e-01f, 8.71700704e-01f,
+        8.71187150e-01f, 8.70672703e-01f, 8.70157421e-01f, 8.69641244e-01f, 8.69124174e-01f, 8.68606269e-01f,
+        8.68087471e-01f, 8.67567837e-01f, 8.67047310e-01f, 8.66525948e-01f, 8.66003692e-01f, 8.65480602e-01f,
+        8.64956617e-01f, 8.64431798e-01f, 8.63906085e-01f, 8.63379598e-01f, 8.62852156e-01f, 8.62323940e-01f,
+        8.61794829e-01f, 8.61264884e-01f, 8.60734046e-01f, 8.60202432e-01f, 8.59669924e-01f, 8.59136522e-01f,
+        8.58602345e-01f, 8.58067334e-01f, 8.57531428e-01f, 8.56994689e-01f, 8.56457174e-01f, 8.55918765e-01f,
+        8.55379522e-01f, 8.54839444e-01f, 8.54298532e-01f, 8.53756785e-01f, 8.53214204e-01f, 8.52670789e-01f,
+        8.52126539e-01f, 8.51581454e-01f, 8.51035535e-01f, 8.50488842e-01f, 8.49941254e-01f, 8.49392891e-01f,
+        8.48843694e-01f, 8.48293662e-01f, 8.47742856e-01f, 8.47191215e-01f, 8.46638739e-01f, 8.46085429e-01f,
+        8.45531344e-01f, 8.44976425e-01f, 8.44420671e-01f, 8.43864143e-01f, 8.43306780e-01f, 8.42748642e-01f,
+        8.42189670e-01f, 8.41629863e-01f, 8.41069281e-01f, 8.40507925e-01f, 8.39945734e-01f, 8.39382768e-01f,
+        8.38818967e-01f, 8.38254392e-01f, 8.37689042e-01f, 8.37122858e-01f, 8.36555898e-01f, 8.35988164e-01f,
+        8.35419595e-01f, 8.34850252e-01f, 8.34280133e-01f, 8.33709240e-01f, 8.33137512e-01f, 8.32565069e-01f,
+        8.31991792e-01f, 8.31417739e-01f, 8.30842912e-01f, 8.30267310e-01f, 8.29690933e-01f, 8.29113781e-01f,
+        8.28535855e-01f, 8.27957153e-01f, 8.27377677e-01f, 8.26797426e-01f, 8.26216400e-01f, 8.25634599e-01f,
+        8.25052023e-01f, 8.24468732e-01f, 8.23884666e-01f, 8.23299825e-01f, 8.22714210e-01f, 8.22127819e-01f,
+        8.21540713e-01f, 8.20952833e-01f, 8.20364177e-01f, 8.19774806e-01f, 8.19184661e-01f, 8.18593740e-01f,
+        8.18002105e-01f, 8.17409694e-01f, 8.16816568e-01f, 8.16222668e-01f, 8.15628052e-01f, 8.15032661e-01f,
+        8.14436555e-01f, 8.13839734e-01f, 8.13242137e-01f, 8.12643766e-01f, 8.12044740e-01f, 8.11444879e-01f,
+        8.10844362e-01f, 8.10243130e-01f, 8.09641123e-01f, 8.09038401e-01f, 8.08434904e-01f, 8.07830751e-01f,
+        8.07225823e-01f, 8.06620181e-01f, 8.06013823e-01f, 8.05406749e-01f, 8.04798961e-01f, 8.04190457e-01f,
+        8.03581238e-01f, 8.02971303e-01f, 8.02360654e-01f, 8.01749289e-01f, 8.01137209e-01f, 8.00524414e-01f,
+        7.99910963e-01f, 7.99296737e-01f, 7.98681855e-01f, 7.98066258e-01f, 7.97449946e-01f, 7.96832919e-01f,
+        7.96215236e-01f, 7.95596838e-01f, 7.94977725e-01f, 7.94357955e-01f, 7.93737411e-01f, 7.93116271e-01f,
+        7.92494416e-01f, 7.91871846e-01f, 7.91248620e-01f, 7.90624678e-01f, 7.90000021e-01f, 7.89374769e-01f,
+        7.88748801e-01f, 7.88122118e-01f, 7.87494779e-01f, 7.86866784e-01f, 7.86238074e-01f, 7.85608709e-01f,
+        7.84978688e-01f, 7.84347951e-01f, 7.83716619e-01f, 7.83084571e-01f, 7.82451868e-01f, 7.81818449e-01f,
+        7.81184435e-01f, 7.80549765e-01f, 7.79914379e-01f, 7.79278338e-01f, 7.78641701e-01f, 7.78004348e-01f,
+        7.77366340e-01f, 7.76727736e-01f, 7.76088417e-01f, 7.75448501e-01f, 7.74807930e-01f, 7.74166644e-01f,
+        7.73524761e-01f, 7.72882283e-01f, 7.72239089e-01f, 7.71595299e-01f, 7.70950854e-01f, 7.70305753e-01f,
+        7.69659996e-01f, 7.69013643e-01f, 7.68366694e-01f, 7.67719030e-01f, 7.67070770e-01f, 7.66421914e-01f,
+        7.65772402e-01f, 7.65122235e-01f, 7.64471531e-01f, 7.63820112e-01f, 7.63168097e-01f, 7.62515485e-01f,
+        7.61862278e-01f, 7.61208415e-01f, 7.60553896e-01f, 7.59898841e-01f, 7.59243131e-01f, 7.58586824e-01f,
+        7.57929921e-01f, 7.57272422e-01f, 7.56614268e-01f, 7.55955517e-01f, 7.55296171e-01f, 7.54636288e-01f,
+        7.53975749e-01f, 7.53314614e-01f, 7.52652884e-01f, 7.51990557e-01f, 7.51327634e-01f, 7.50664115e-01f,
+        7.50000000e-01f, 7.49335289e-01f, 7.48670042e-01f, 7.48004198e-01f, 7.47337699e-01f, 7.46670723e-01f,
+        7.46003091e-01f, 7.45334923e-01f, 7.44666159e-01f, 7.43996799e-01f, 7.43326902e-01f, 7.42656410e-01f,
+        7.41985321e-01f, 7.41313696e-01f, 7.40641475e-01f, 7.39968717e-01f, 7.39295423e-01f, 7.38621533e-01f,
+        7.37947047e-01f, 7.37272024e-01f, 7.36596465e-01f, 7.35920370e-01f, 7.35243678e-01f, 7.34566391e-01f,
+        7.33888626e-01f, 7.33210266e-01f, 7.32531369e-01f, 7.31851935e-01f, 7.31171966e-01f, 7.30491459e-01f,
+        7.29810357e-01f, 7.29128778e-01f, 7.28446603e-01f, 7.27763891e-01f, 7.27080703e-01f, 7.26396918e-01f,
+        7.25712657e-01f, 7.25027800e-01f, 7.24342465e-01f, 7.23656595e-01f, 7.22970188e-01f, 7.22283244e-01f,
+        7.21595764e-01f, 7.20907807e-01f, 7.20219314e-01f, 7.19530284e-01f, 7.18840718e-01f, 7.18150675e-01f,
+        7.17460155e-01f, 7.16769040e-01f, 7.16077447e-01f, 7.15385377e-01f, 7.14692771e-01f, 7.13999689e-01f,
+        7.13306069e-01f, 7.12611914e-01f, 7.11917341e-01f, 7.11222231e-01f, 7.10526586e-01f, 7.09830523e-01f,
+        7.09133923e-01f, 7.08436787e-01f, 7.07739234e-01f, 7.07041144e-01f, 7.06342578e-01f, 7.05643535e-01f,
+        7.04944015e-01f, 7.04244018e-01f, 7.03543544e-01f, 7.02842534e-01f, 7.02141106e-01f, 7.01439202e-01f,
+        7.00736761e-01f, 7.00033903e-01f, 6.99330568e-01f, 6.98626757e-01f, 6.97922468e-01f, 6.97217703e-01f,
+        6.96512520e-01f, 6.95806861e-01f, 6.95100725e-01f, 6.94394112e-01f, 6.93687081e-01f, 6.92979574e-01f,
+        6.92271590e-01f, 6.91563189e-01f, 6.90854311e-01f, 6.90145016e-01f, 6.89435244e-01f, 6.88725054e-01f,
+        6.88014388e-01f, 6.87303305e-01f, 6.86591744e-01f, 6.85879767e-01f, 6.85167372e-01f, 6.84454501e-01f,
+        6.83741271e-01f, 6.83027506e-01f, 6.82313383e-01f, 6.81598783e-01f, 6.80883825e-01f, 6.80168390e-01f,
+        6.79452538e-01f, 6.78736269e-01f, 6.78019583e-01f, 6.77302420e-01f, 6.76584899e-01f, 6.75866961e-01f,
+        6.75148606e-01f, 6.74429834e-01f, 6.73710644e-01f, 6.72991037e-01f, 6.72271073e-01f, 6.71550632e-01f,
+        6.70829833e-01f, 6.70108616e-01f, 6.69386983e-01f, 6.68664992e-01f, 6.67942584e-01f, 6.67219758e-01f,
+        6.66496575e-01f, 6.65772974e-01f, 6.65049016e-01f, 6.64324641e-01f, 6.63599908e-01f, 6.62874758e-01f,
+        6.62149251e-01f, 6.61423326e-01f, 6.60697043e-01f, 6.59970343e-01f, 6.59243345e-01f, 6.58515930e-01f,
+        6.57788098e-01f, 6.57059968e-01f, 6.56331420e-01f, 6.55602515e-01f, 6.54873252e-01f, 6.54143631e-01f,
+        6.53413653e-01f, 6.52683318e-01f, 6.51952565e-01f, 6.51221514e-01f, 6.50490105e-01f, 6.49758279e-01f,
+        6.49026155e-01f, 6.48293674e-01f, 6.47560835e-01f, 6.46827698e-01f, 6.46094143e-01f, 6.45360291e-01f,
+        6.44626081e-01f, 6.43891513e-01f, 6.43156588e-01f, 6.42421365e-01f, 6.41685843e-01f, 6.40949905e-01f,
+        6.40213668e-01f, 6.39477134e-01f, 6.38740242e-01f, 6.38003051e-01f, 6.37265503e-01f, 6.36527658e-01f,
+        6.35789454e-01f, 6.35050952e-01f, 6.34312093e-01f, 6.33572996e-01f, 6.32833540e-01f, 6.32093787e-01f,
+        6.31353676e-01f, 6.30613327e-01f, 6.29872620e-01f, 6.29131615e-01f, 6.28390312e-01f, 6.27648711e-01f,
+        6.26906812e-01f, 6.26164615e-01f, 6.25422120e-01f, 6.24679327e-01f, 6.23936236e-01f, 6.23192847e-01f,
+        6.22449160e-01f, 6.21705174e-01f, 6.20960951e-01f, 6.20216429e-01f, 6.19471610e-01f, 6.18726492e-01f,
+        6.17981136e-01f, 6.17235482e-01f, 6.16489530e-01f, 6.15743339e-01f, 6.14996850e-01f, 6.14250124e-01f,
+        6.13503098e-01f, 6.12755835e-01f, 6.12008274e-01f, 6.11260474e-01f, 6.10512376e-01f, 6.09764040e-01f,
+        6.09015465e-01f, 6.08266592e-01f, 6.07517540e-01f, 6.06768131e-01f, 6.06018543e-01f, 6.05268717e-01f,
+        6.04518592e-01f, 6.03768229e-01f, 6.03017628e-01f, 6.02266788e-01f, 6.01515710e-01f, 6.00764394e-01f,
+        6.00012839e-01f, 5.99261045e-01f, 5.98509014e-01f, 5.97756803e-01f, 5.97004294e-01f, 5.96251547e-01f,
+        5.95498621e-01f, 5.94745457e-01f, 5.93992054e-01f, 5.93238473e-01f, 5.92484653e-01f, 5.91730595e-01f,
+        5.90976298e-01f, 5.90221822e-01f, 5.89467168e-01f, 5.88712275e-01f, 5.87957144e-01f, 5.87201834e-01f,
+        5.86446285e-01f, 5.85690558e-01f, 5.84934652e-01f, 5.84178507e-01f, 5.83422184e-01f, 5.82665682e-01f,
+        5.81908941e-01f, 5.81152022e-01f, 5.80394924e-01f, 5.79637647e-01f, 5.78880191e-01f, 5.78122497e-01f,
+        5.77364683e-01f, 5.76606631e-01f, 5.75848401e-01f, 5.75090051e-01f, 5.74331462e-01f, 5.73572755e-01f,
+        5.72813809e-01f, 5.72054744e-01f, 5.71295500e-01f, 5.70536077e-01f, 5.69776475e-01f, 5.69016695e-01f,
+        5.68256795e-01f, 5.67496717e-01f, 5.66736519e-01f, 5.65976083e-01f, 5.65215528e-01f, 5.64454854e-01f,
+        5.63694000e-01f, 5.62933028e-01f, 5.62171876e-01f, 5.61410546e-01f, 5.60649097e-01f, 5.59887528e-01f,
+        5.59125781e-01f, 5.58363914e-01f, 5.57601929e-01f, 5.56839824e-01f, 5.56077540e-01f, 5.55315137e-01f,
+        5.54552615e-01f, 5.53789914e-01f, 5.53027153e-01f, 5.52264214e-01f, 5.51501215e-01f, 5.50738037e-01f,
+        5.49974740e-01f, 5.49211383e-01f, 5.48447847e-01f, 5.47684252e-01f, 5.46920478e-01f, 5.46156645e-01f,
+        5.45392692e-01f, 5.44628620e-01f, 5.43864489e-01f, 5.43100178e-01f, 5.42335808e-01f, 5.41571319e-01f,
+        5.40806770e-01f, 5.40042102e-01f, 5.39277375e-01f, 5.38512468e-01f, 5.37747562e-01f, 5.36982536e-01f,
+        5.36217391e-01f, 5.35452187e-01f, 5.34686923e-01f, 5.33921540e-01f, 5.33156097e-01f, 5.32390535e-01f,
+        5.31624973e-01f, 5.30859292e-01f, 5.30093551e-01f, 5.29327691e-01f, 5.28561831e-01f, 5.27795851e-01f,
+        5.27029812e-01f, 5.26263714e-01f, 5.25497615e-01f, 5.24731398e-01f, 5.23965120e-01f, 5.23198783e-01f,
+        5.22432387e-01f, 5.21665990e-01f, 5.20899475e-01f, 5.20132959e-01f, 5.19366384e-01f, 5.18599749e-01f,
+        5.17833114e-01f, 5.17066360e-01f, 5.16299665e-01f, 5.15532851e-01f, 5.14766037e-01f, 5.13999164e-01f,
+        5.13232291e-01f, 5.12465358e-01f, 5.11698365e-01f, 5.10931432e-01f, 5.10164380e-01f, 5.09397388e-01f,
+        5.08630335e-01f, 5.07863224e-01f, 5.07096171e-01f, 5.06329060e-01f, 5.05561948e-01f, 5.04794776e-01f,
+        5.04027665e-01f, 5.03260493e-01f, 5.02493322e-01f, 5.01726151e-01f, 5.00958979e-01f, 5.00191808e-01f,
+        4.99424607e-01f, 4.98657435e-01f, 4.97890264e-01f, 4.97123092e-01f, 4.96355951e-01f, 4.95588779e-01f,
+        4.94821638e-01f, 4.94054526e-01f, 4.93287385e-01f, 4.92520303e-01f, 4.91753221e-01f, 4.90986139e-01f,
+        4.90219116e-01f, 4.89452094e-01f, 4.88685101e-01f, 4.87918139e-01f, 4.87151176e-01f, 4.86384273e-01f,
+        4.85617399e-01f, 4.84850556e-01f, 4.84083742e-01f, 4.83316988e-01f, 4.82550263e-01f, 4.81783569e-01f,
+        4.81016904e-01f, 4.80250299e-01f, 4.79483753e-01f, 4.78717238e-01f, 4.77950782e-01f, 4.77184385e-01f,
+        4.76418048e-01f, 4.75651741e-01f, 4.74885494e-01f, 4.74119335e-01f, 4.73353207e-01f, 4.72587138e-01f,
+        4.71821159e-01f, 4.71055239e-01f, 4.70289379e-01f, 4.69523579e-01f, 4.68757868e-01f, 4.67992246e-01f,
+        4.67226654e-01f, 4.66461182e-01f, 4.65695769e-01f, 4.64930445e-01f, 4.64165181e-01f, 4.63400036e-01f,
+        4.62634951e-01f, 4.61869955e-01f, 4.61105078e-01f, 4.60340261e-01f, 4.59575534e-01f, 4.58810925e-01f,
+        4.58046407e-01f, 4.57281977e-01f, 4.56517667e-01f, 4.55753446e-01f, 4.54989314e-01f, 4.54225332e-01f,
+        4.53461409e-01f, 4.52697635e-01f, 4.51933950e-01f, 4.51170385e-01f, 4.50406909e-01f, 4.49643582e-01f,
+        4.48880374e-01f, 4.48117286e-01f, 4.47354287e-01f, 4.46591437e-01f, 4.45828706e-01f, 4.45066124e-01f,
+        4.44303662e-01f, 4.43541318e-01f, 4.42779124e-01f, 4.42017049e-01f, 4.41255122e-01f, 4.40493315e-01f,
+        4.39731658e-01f, 4.38970149e-01f, 4.38208789e-01f, 4.37447548e-01f, 4.36686486e-01f, 4.35925543e-01f,
+        4.35164779e-01f, 4.34404165e-01f, 4.33643669e-01f, 4.32883382e-01f, 4.32123214e-01f, 4.31363225e-01f,
+        4.30603385e-01f, 4.29843724e-01f, 4.29084212e-01f, 4.28324878e-01f, 4.27565694e-01f, 4.26806688e-01f,
+        4.26047862e-01f, 4.25289214e-01f, 4.24530745e-01f, 4.23772454e-01f, 4.23014313e-01f, 4.22256380e-01f,
+        4.21498626e-01f, 4.20741051e-01f, 4.19983685e-01f, 4.19226468e-01f, 4.18469489e-01f, 4.17712659e-01f,
+        4.16956037e-01f, 4.16199625e-01f, 4.15443391e-01f, 4.14687365e-01f, 4.13931549e-01f, 4.13175911e-01f,
+        4.12420481e-01f, 4.11665291e-01f, 4.10910279e-01f, 4.10155475e-01f, 4.09400880e-01f, 4.08646524e-01f,
+        4.07892376e-01f, 4.07138437e-01f, 4.06384706e-01f, 4.05631214e-01f, 4.04877931e-01f, 4.04124856e-01f,
+        4.03372049e-01f, 4.02619451e-01f, 4.01867062e-01f, 4.01114941e-01f, 4.00363028e-01f, 3.99611354e-01f,
+        3.98859918e-01f, 3.98108721e-01f, 3.97357762e-01f, 3.96607041e-01f, 3.95856559e-01f, 3.95106316e-01f,
+        3.94356340e-01f, 3.93606603e-01f, 3.92857134e-01f, 3.92107904e-01f, 3.91358912e-01f, 3.90610218e-01f,
+        3.89861733e-01f, 3.89113545e-01f, 3.88365597e-01f, 3.87617916e-01f, 3.86870503e-01f, 3.86123359e-01f,
+        3.85376483e-01f, 3.84629846e-01f, 3.83883506e-01f, 3.83137465e-01f, 3.82391661e-01f, 3.81646156e-01f,
+        3.80900919e-01f, 3.80155951e-01f, 3.79411280e-01f, 3.78666908e-01f, 3.77922803e-01f, 3.77178967e-01f,
+        3.76435459e-01f, 3.75692219e-01f, 3.74949276e-01f, 3.74206632e-01f, 3.73464257e-01f, 3.72722208e-01f,
+        3.71980458e-01f, 3.71239007e-01f, 3.70497853e-01f, 3.69756997e-01f, 3.69016469e-01f, 3.68276238e-01f,
+        3.67536306e-01f, 3.66796702e-01f, 3.66057396e-01f, 3.65318418e-01f, 3.64579767e-01f, 3.63841414e-01f,
+        3.63103390e-01f, 3.62365693e-01f, 3.61628324e-01f, 3.60891283e-01f, 3.60154539e-01f, 3.59418154e-01f,
+        3.58682096e-01f, 3.57946366e-01f, 3.57210964e-01f, 3.56475890e-01f, 3.55741173e-01f, 3.55006784e-01f,
+        3.54272753e-01f, 3.53539050e-01f, 3.52805704e-01f, 3.52072686e-01f, 3.51340026e-01f, 3.50607723e-01f,
+        3.49875778e-01f, 3.49144161e-01f, 3.48412901e-01f, 3.47682029e-01f, 3.46951485e-01f, 3.46221328e-01f,
+        3.45491499e-01f, 3.44762057e-01f, 3.44032973e-01f, 3.43304247e-01f, 3.42575908e-01f, 3.41847926e-01f,
+        3.41120332e-01f, 3.40393096e-01f, 3.39666247e-01f, 3.38939786e-01f, 3.38213682e-01f, 3.37487966e-01f,
+        3.36762637e-01f, 3.36037695e-01f, 3.35313112e-01f, 3.34588945e-01f, 3.33865166e-01f, 3.33141774e-01f,
+        3.32418770e-01f, 3.31696153e-01f, 3.30973953e-01f, 3.30252141e-01f, 3.29530716e-01f, 3.28809708e-01f,
+        3.28089118e-01f, 3.27368915e-01f, 3.26649100e-01f, 3.25929701e-01f, 3.25210720e-01f, 3.24492157e-01f,
+        3.23774010e-01f, 3.23056281e-01f, 3.22338939e-01f, 3.21622044e-01f, 3.20905566e-01f, 3.20189506e-01f,
+        3.19473863e-01f, 3.18758637e-01f, 3.18043858e-01f, 3.17329496e-01f, 3.16615552e-01f, 3.15902054e-01f,
+        3.15189004e-01f, 3.14476371e-01f, 3.13764185e-01f, 3.13052416e-01f, 3.12341094e-01f, 3.11630219e-01f,
+        3.10919791e-01f, 3.10209811e-01f, 3.09500277e-01f, 3.08791190e-01f, 3.08082551e-01f, 3.07374358e-01f,
+        3.06666642e-01f, 3.05959344e-01f, 3.05252522e-01f, 3.04546177e-01f, 3.03840250e-01f, 3.03134829e-01f,
+        3.02429855e-01f, 3.01725328e-01f, 3.01021278e-01f, 3.00317705e-01f, 2.99614608e-01f, 2.98911959e-01f,
+        2.98209816e-01f, 2.97508121e-01f, 2.96806902e-01f, 2.96106160e-01f, 2.95405924e-01f, 2.94706166e-01f,
+        2.94006854e-01f, 2.93308049e-01f, 2.92609751e-01f, 2.91911930e-01f, 2.91214585e-01f, 2.90517747e-01f,
+        2.89821386e-01f, 2.89125532e-01f, 2.88430154e-01f, 2.87735313e-01f, 2.87040949e-01f, 2.86347091e-01f,
+        2.85653710e-01f, 2.84960866e-01f, 2.84268528e-01f, 2.83576667e-01f, 2.82885343e-01f, 2.82194525e-01f,
+        2.81504214e-01f, 2.80814439e-01f, 2.80125141e-01f, 2.79436380e-01f, 2.78748155e-01f, 2.78060436e-01f,
+        2.77373224e-01f, 2.76686579e-01f, 2.76000410e-01f, 2.75314808e-01f, 2.74629712e-01f, 2.73945153e-01f,
+        2.73261130e-01f, 2.72577643e-01f, 2.71894664e-01f, 2.71212250e-01f, 2.70530373e-01f, 2.69849032e-01f,
+        2.69168228e-01f, 2.68487960e-01f, 2.67808259e-01f, 2.67129093e-01f, 2.66450465e-01f, 2.65772402e-01f,
+        2.65094906e-01f, 2.64417917e-01f, 2.63741523e-01f, 2.63065666e-01f, 2.62390375e-01f, 2.61715651e-01f,
+        2.61041462e-01f, 2.60367841e-01f, 2.59694815e-01f, 2.59022325e-01f, 2.58350402e-01f, 2.57679075e-01f,
+        2.57008284e-01f, 2.56338090e-01f, 2.55668461e-01f, 2.54999399e-01f, 2.54330933e-01f, 2.53663033e-01f,
+        2.52995729e-01f, 2.52328992e-01f, 2.51662821e-01f, 2.50997245e-01f, 2.50332266e-01f, 2.49667883e-01f,
+        2.49004066e-01f, 2.48340860e-01f, 2.47678235e-01f, 2.47016206e-01f, 2.46354774e-01f, 2.45693937e-01f,
+        2.45033696e-01f, 2.44374067e-01f, 2.43715033e-01f, 2.43056595e-01f, 2.42398769e-01f, 2.41741553e-01f,
+        2.41084933e-01f, 2.40428925e-01f, 2.39773542e-01f, 2.39118755e-01f, 2.38464594e-01f, 2.37811044e-01f,
+        2.37158120e-01f, 2.36505806e-01f, 2.35854104e-01f, 2.35203043e-01f, 2.34552592e-01f, 2.33902767e-01f,
+        2.33253568e-01f, 2.32605010e-01f, 2.31957063e-01f, 2.31309757e-01f, 2.30663076e-01f, 2.30017036e-01f,
+        2.29371637e-01f, 2.28726864e-01f, 2.28082731e-01f, 2.27439255e-01f, 2.26796404e-01f, 2.26154193e-01f,
+        2.25512639e-01f, 2.24871725e-01f, 2.24231452e-01f, 2.23591834e-01f, 2.22952873e-01f, 2.22314566e-01f,
+        2.21676901e-01f, 2.21039891e-01f, 2.20403552e-01f, 2.19767854e-01f, 2.19132826e-01f, 2.18498453e-01f,
+        2.17864752e-01f, 2.17231706e-01f, 2.16599330e-01f, 2.15967625e-01f, 2.15336591e-01f, 2.14706212e-01f,
+        2.14076519e-01f, 2.13447496e-01f, 2.12819144e-01f, 2.12191463e-01f, 2.11564466e-01f, 2.10938156e-01f,
+        2.10312515e-01f, 2.09687561e-01f, 2.09063292e-01f, 2.08439693e-01f, 2.07816795e-01f, 2.07194582e-01f,
+        2.06573069e-01f, 2.05952227e-01f, 2.05332085e-01f, 2.04712644e-01f, 2.04093888e-01f, 2.03475833e-01f,
+        2.02858478e-01f, 2.02241823e-01f, 2.01625869e-01f, 2.01010615e-01f, 2.00396061e-01f, 1.99782223e-01f,
+        1.99169084e-01f, 1.98556647e-01f, 1.97944924e-01f, 1.97333917e-01f, 1.96723625e-01f, 1.96114048e-01f,
+        1.95505172e-01f, 1.94897026e-01f, 1.94289595e-01f, 1.93682879e-01f, 1.93076894e-01f, 1.92471623e-01f,
+        1.91867083e-01f, 1.91263258e-01f, 1.90660164e-01f, 1.90057799e-01f, 1.89456180e-01f, 1.88855276e-01f,
+        1.88255101e-01f, 1.87655658e-01f, 1.87056959e-01f, 1.86458990e-01f, 1.85861766e-01f, 1.85265288e-01f,
+        1.84669539e-01f, 1.84074536e-01f, 1.83480278e-01f, 1.82886764e-01f, 1.82293996e-01f, 1.81701973e-01f,
+        1.81110710e-01f, 1.80520177e-01f, 1.79930419e-01f, 1.79341406e-01f, 1.78753138e-01f, 1.78165644e-01f,
+        1.77578896e-01f, 1.76992908e-01f, 1.76407680e-01f, 1.75823212e-01f, 1.75239518e-01f, 1.74656585e-01f,
+        1.74074411e-01f, 1.73493013e-01f, 1.72912374e-01f, 1.72332510e-01f, 1.71753421e-01f, 1.71175092e-01f,
+        1.70597553e-01f, 1.70020774e-01f, 1.69444785e-01f, 1.68869570e-01f, 1.68295130e-01f, 1.67721480e-01f,
+        1.67148605e-01f, 1.66576520e-01f, 1.66005209e-01f, 1.65434703e-01f, 1.64864972e-01f, 1.64296031e-01f,
+        1.63727880e-01f, 1.63160518e-01f, 1.62593946e-01f, 1.62028179e-01f, 1.61463201e-01f, 1.60899028e-01f,
+        1.60335645e-01f, 1.59773067e-01f, 1.59211278e-01f, 1.58650309e-01f, 1.58090129e-01f, 1.57530755e-01f,
+        1.56972200e-01f, 1.56414434e-01f, 1.55857489e-01f, 1.55301362e-01f, 1.54746026e-01f, 1.54191524e-01f,
+        1.53637826e-01f, 1.53084934e-01f, 1.52532876e-01f, 1.51981622e-01f, 1.51431203e-01f, 1.50881588e-01f,
+        1.50332808e-01f, 1.49784848e-01f, 1.49237707e-01f, 1.48691386e-01f, 1.48145899e-01f, 1.47601247e-01f,
+        1.47057429e-01f, 1.46514431e-01f, 1.45972267e-01f, 1.45430937e-01f, 1.44890428e-01f, 1.44350767e-01f,
+        1.43811956e-01f, 1.43273965e-01f, 1.42736822e-01f, 1.42200515e-01f, 1.41665056e-01f, 1.41130447e-01f,
+        1.40596673e-01f, 1.40063748e-01f, 1.39531657e-01f, 1.39000431e-01f, 1.38470054e-01f, 1.37940526e-01f,
+        1.37411848e-01f, 1.36884019e-01f, 1.36357054e-01f, 1.35830939e-01f, 1.35305688e-01f, 1.34781286e-01f,
+        1.34257749e-01f, 1.33735076e-01f, 1.33213267e-01f, 1.32692322e-01f, 1.32172227e-01f, 1.31653011e-01f,
+        1.31134659e-01f, 1.30617172e-01f, 1.30100563e-01f, 1.29584819e-01f, 1.29069954e-01f, 1.28555954e-01f,
+        1.28042832e-01f, 1.27530575e-01f, 1.27019212e-01f, 1.26508713e-01f, 1.25999108e-01f, 1.25490367e-01f,
+        1.24982521e-01f, 1.24475554e-01f, 1.23969465e-01f, 1.23464264e-01f, 1.22959957e-01f, 1.22456528e-01f,
+        1.21953994e-01f, 1.21452346e-01f, 1.20951593e-01f, 1.20451733e-01f, 1.19952761e-01f, 1.19454689e-01f,
+        1.18957512e-01f, 1.18461229e-01f, 1.17965847e-01f, 1.17471360e-01f, 1.16977781e-01f, 1.16485097e-01f,
+        1.15993321e-01f, 1.15502447e-01f, 1.15012474e-01f, 1.14523411e-01f, 1.14035256e-01f, 1.13548011e-01f,
+        1.13061674e-01f, 1.12576246e-01f, 1.12091735e-01f, 1.11608133e-01f, 1.11125447e-01f, 1.10643677e-01f,
+        1.10162824e-01f, 1.09682888e-01f, 1.09203868e-01f, 1.08725771e-01f, 1.08248599e-01f, 1.07772343e-01f,
+        1.07297011e-01f, 1.06822602e-01f, 1.06349126e-01f, 1.05876572e-01f, 1.05404943e-01f, 1.04934253e-01f,
+        1.04464486e-01f, 1.03995644e-01f, 1.03527747e-01f, 1.03060775e-01f, 1.02594741e-01f, 1.02129638e-01f,
+        1.01665474e-01f, 1.01202250e-01f, 1.00739963e-01f, 1.00278616e-01f, 9.98182148e-02f, 9.93587524e-02f,
+        9.89002287e-02f, 9.84426513e-02f, 9.79860201e-02f, 9.75303426e-02f, 9.70756039e-02f, 9.66218188e-02f,
+        9.61689800e-02f, 9.57170874e-02f, 9.52661559e-02f, 9.48161706e-02f, 9.43671390e-02f, 9.39190686e-02f,
+        9.34719518e-02f, 9.30257887e-02f, 9.25805867e-02f, 9.21363458e-02f, 9.16930586e-02f, 9.12507400e-02f,
+        9.08093750e-02f, 9.03689787e-02f, 8.99295509e-02f, 8.94910842e-02f, 8.90535787e-02f, 8.86170492e-02f,
+        8.81814882e-02f, 8.77468884e-02f, 8.73132646e-02f, 8.68806094e-02f, 8.64489302e-02f, 8.60182270e-02f,
+        8.55884925e-02f, 8.51597413e-02f, 8.47319588e-02f, 8.43051597e-02f, 8.38793367e-02f, 8.34544897e-02f,
+        8.30306262e-02f, 8.26077461e-02f, 8.21858495e-02f, 8.17649290e-02f, 8.13449994e-02f, 8.09260532e-02f,
+        8.05080980e-02f, 8.00911263e-02f, 7.96751454e-02f, 7.92601556e-02f, 7.88461491e-02f, 7.84331411e-02f,
+        7.80211240e-02f, 7.76100978e-02f, 7.72000700e-02f, 7.67910331e-02f, 7.63829947e-02f, 7.59759545e-02f,
+        7.55699053e-02f, 7.51648620e-02f, 7.47608244e-02f, 7.43577778e-02f, 7.39557371e-02f, 7.35547021e-02f,
+        7.31546655e-02f, 7.27556422e-02f, 7.23576173e-02f, 7.19605982e-02f, 7.15645924e-02f, 7.11695924e-02f,
+        7.07756057e-02f, 7.03826249e-02f, 6.99906573e-02f, 6.95997030e-02f, 6.92097545e-02f, 6.88208267e-02f,
+        6.84329197e-02f, 6.80460185e-02f, 6.76601380e-02f, 6.72752783e-02f, 6.68914318e-02f, 6.65086061e-02f,
+        6.61268085e-02f, 6.57460243e-02f, 6.53662607e-02f, 6.49875253e-02f, 6.46098182e-02f, 6.42331243e-02f,
+        6.38574660e-02f, 6.34828284e-02f, 6.31092265e-02f, 6.27366453e-02f, 6.23650961e-02f, 6.19945787e-02f,
+        6.16250895e-02f, 6.12566359e-02f, 6.08892143e-02f, 6.05228245e-02f, 6.01574704e-02f, 5.97931519e-02f,
+        5.94298691e-02f, 5.90676256e-02f, 5.87064177e-02f, 5.83462492e-02f, 5.79871200e-02f, 5.76290339e-02f,
+        5.72719872e-02f, 5.69159836e-02f, 5.65610230e-02f, 5.62071055e-02f, 5.58542348e-02f, 5.55024073e-02f,
+        5.51516265e-02f, 5.48018925e-02f, 5.44532090e-02f, 5.41055724e-02f, 5.37589863e-02f, 5.34134544e-02f,
+        5.30689694e-02f, 5.27255386e-02f, 5.23831584e-02f, 5.20418324e-02f, 5.17015643e-02f, 5.13623469e-02f,
+        5.10241874e-02f, 5.06870858e-02f, 5.03510423e-02f, 5.00160567e-02f, 4.96821329e-02f, 4.93492670e-02f,
+        4.90174592e-02f, 4.86867167e-02f, 4.83570360e-02f, 4.80284207e-02f, 4.77008671e-02f, 4.73743789e-02f,
+        4.70489562e-02f, 4.67245989e-02f, 4.64013070e-02f, 4.60790880e-02f, 4.57579345e-02f, 4.54378501e-02f,
+        4.51188348e-02f, 4.48008925e-02f, 4.44840230e-02f, 4.41682264e-02f, 4.38534990e-02f, 4.35398482e-02f,
+        4.32272702e-02f, 4.29157689e-02f, 4.26053442e-02f, 4.22959961e-02f, 4.19877246e-02f, 4.16805334e-02f,
+        4.13744189e-02f, 4.10693847e-02f, 4.07654308e-02f, 4.04625572e-02f, 4.01607677e-02f, 3.98600586e-02f,
+        3.95604335e-02f, 3.92618924e-02f, 3.89644392e-02f, 3.86680663e-02f, 3.83727811e-02f, 3.80785838e-02f,
+        3.77854742e-02f, 3.74934524e-02f, 3.72025184e-02f, 3.69126759e-02f, 3.66239212e-02f, 3.63362581e-02f,
+        3.60496901e-02f, 3.57642099e-02f, 3.54798250e-02f, 3.51965316e-02f, 3.49143334e-02f, 3.46332304e-02f,
+        3.43532227e-02f, 3.40743102e-02f, 3.37964967e-02f, 3.35197821e-02f, 3.32441628e-02f, 3.29696424e-02f,
+        3.26962210e-02f, 3.24239023e-02f, 3.21526825e-02f, 3.18825655e-02f, 3.16135474e-02f, 3.13456357e-02f,
+        3.10788266e-02f, 3.08131203e-02f, 3.05485185e-02f, 3.02850232e-02f, 3.00226323e-02f, 2.97613498e-02f,
+        2.95011718e-02f, 2.92421039e-02f, 2.89841425e-02f, 2.87272912e-02f, 2.84715481e-02f, 2.82169152e-02f,
+        2.79633943e-02f, 2.77109835e-02f, 2.74596866e-02f, 2.72094999e-02f, 2.69604269e-02f, 2.67124679e-02f,
+        2.64656227e-02f, 2.62198932e-02f, 2.59752776e-02f, 2.57317796e-02f, 2.54893973e-02f, 2.52481308e-02f,
+        2.50079837e-02f, 2.47689541e-02f, 2.45310441e-02f, 2.42942534e-02f, 2.40585823e-02f, 2.38240324e-02f,
+        2.35906020e-02f, 2.33582947e-02f, 2.31271088e-02f, 2.28970461e-02f, 2.26681046e-02f, 2.24402882e-02f,
+        2.22135969e-02f, 2.19880305e-02f, 2.17635874e-02f, 2.15402730e-02f, 2.13180836e-02f, 2.10970212e-02f,
+        2.08770856e-02f, 2.06582788e-02f, 2.04405989e-02f, 2.02240497e-02f, 2.00086311e-02f, 1.97943393e-02f,
+        1.95811801e-02f, 1.93691514e-02f, 1.91582553e-02f, 1.89484898e-02f, 1.87398568e-02f, 1.85323581e-02f,
+        1.83259919e-02f, 1.81207601e-02f, 1.79166626e-02f, 1.77136995e-02f, 1.75118726e-02f, 1.73111819e-02f,
+        1.71116274e-02f, 1.69132091e-02f, 1.67159289e-02f, 1.65197849e-02f, 1.63247809e-02f, 1.61309149e-02f,
+        1.59381870e-02f, 1.57466009e-02f, 1.55561529e-02f, 1.53668458e-02f, 1.51786804e-02f, 1.49916559e-02f,
+        1.48057733e-02f, 1.46210333e-02f, 1.44374352e-02f, 1.42549807e-02f, 1.40736699e-02f, 1.38935028e-02f,
+        1.37144802e-02f, 1.35366032e-02f, 1.33598708e-02f, 1.31842839e-02f, 1.30098425e-02f, 1.28365485e-02f,
+        1.26644019e-02f, 1.24934018e-02f, 1.23235490e-02f, 1.21548455e-02f, 1.19872894e-02f, 1.18208826e-02f,
+        1.16556250e-02f, 1.14915175e-02f, 1.13285594e-02f, 1.11667523e-02f, 1.10060964e-02f, 1.08465906e-02f,
+        1.06882369e-02f, 1.05310353e-02f, 1.03749866e-02f, 1.02200899e-02f, 1.00663463e-02f, 9.91375651e-03f,
+        9.76231974e-03f, 9.61203780e-03f, 9.46290977e-03f, 9.31493659e-03f, 9.16811917e-03f, 9.02245753e-03f,
+        8.87795072e-03f, 8.73460062e-03f, 8.59240722e-03f, 8.45137052e-03f, 8.31149146e-03f, 8.17277003e-03f,
+        8.03520530e-03f, 7.89880008e-03f, 7.76355295e-03f, 7.62946438e-03f, 7.49653531e-03f, 7.36476574e-03f,
+        7.23415567e-03f, 7.10470602e-03f, 6.97641633e-03f, 6.84928754e-03f, 6.72332011e-03f, 6.59851357e-03f,
+        6.47486886e-03f, 6.35238551e-03f, 6.23106491e-03f, 6.11090660e-03f, 5.99191105e-03f, 5.87407826e-03f,
+        5.75740915e-03f, 5.64190326e-03f, 5.52756153e-03f, 5.41438349e-03f, 5.30237006e-03f, 5.19152172e-03f,
+        5.08183753e-03f, 4.97331889e-03f, 4.86596581e-03f, 4.75977780e-03f, 4.65475628e-03f, 4.55090078e-03f,
+        4.44821175e-03f, 4.34668921e-03f, 4.24633361e-03f, 4.14714497e-03f, 4.04912420e-03f, 3.95227037e-03f,
+        3.85658466e-03f, 3.76206706e-03f, 3.66871781e-03f, 3.57653690e-03f, 3.48552456e-03f, 3.39568127e-03f,
+        3.30700725e-03f, 3.21950228e-03f, 3.13316705e-03f, 3.04800156e-03f, 2.96400604e-03f, 2.88118050e-03f,
+        2.79952539e-03f, 2.71904096e-03f, 2.63972720e-03f, 2.56158412e-03f, 2.48461240e-03f, 2.40881182e-03f,
+        2.33418262e-03f, 2.26072525e-03f, 2.18843948e-03f, 2.11732578e-03f, 2.04738416e-03f, 1.97861483e-03f,
+        1.91101816e-03f, 1.84459391e-03f, 1.77934254e-03f, 1.71526405e-03f, 1.65235868e-03f, 1.59062655e-03f,
+        1.53006776e-03f, 1.47068244e-03f, 1.41247094e-03f, 1.35543314e-03f, 1.29956927e-03f, 1.24487944e-03f,
+        1.19136390e-03f, 1.13902253e-03f, 1.08785566e-03f, 1.03786343e-03f, 9.89045831e-04f, 9.41403036e-04f,
+        8.94935103e-04f, 8.49642209e-04f, 8.05524469e-04f, 7.62581942e-04f, 7.20814744e-04f, 6.80222933e-04f,
+        6.40806684e-04f, 6.02565997e-04f, 5.65501105e-04f, 5.29611949e-04f, 4.94898646e-04f, 4.61361342e-04f,
+        4.29000065e-04f, 3.97814874e-04f, 3.67805915e-04f, 3.38973186e-04f, 3.11316777e-04f, 2.84836773e-04f,
+        2.59533204e-04f, 2.35406173e-04f, 2.12455692e-04f, 1.90681836e-04f, 1.70084662e-04f, 1.50664200e-04f,
+        1.32420522e-04f, 1.15353643e-04f, 9.94636139e-05f, 8.47504780e-05f, 7.12142646e-05f, 5.88550065e-05f,
+        4.76727328e-05f, 3.76674689e-05f, 2.88392421e-05f, 2.11880688e-05f, 1.47139681e-05f, 9.41695635e-06f,
+        5.29704494e-06f, 2.35424454e-06f, 5.88561477e-07f, 0.00000000e+00f
+    };
+    static const float cbwindow4096[4096] = {
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 2.35424454e-06f,
+        9.41695635e-06f, 2.11880688e-05f, 3.76674689e-05f, 5.88550065e-05f, 8.47504780e-05f, 1.15353643e-04f,
+        1.50664200e-04f, 1.90681836e-04f, 2.35406173e-04f, 2.84836773e-04f, 3.38973186e-04f, 3.97814874e-04f,
+        4.61361342e-04f, 5.29611949e-04f, 6.02565997e-04f, 6.80222933e-04f, 7.62581942e-04f, 8.49642209e-04f,
+        9.41403036e-04f, 1.03786343e-03f, 1.13902253e-03f, 1.24487944e-03f, 1.35543314e-03f, 1.47068244e-03f,
+        1.59062655e-03f, 1.71526405e-03f, 1.84459391e-03f, 1.97861483e-03f, 2.11732578e-03f, 2.26072525e-03f,
+        2.40881182e-03f, 2.56158412e-03f, 2.71904096e-03f, 2.88118050e-03f, 3.04800156e-03f, 3.21950228e-03f,
+        3.39568127e-03f, 3.57653690e-03f, 3.76206706e-03f, 3.95227037e-03f, 4.14714497e-03f, 4.34668921e-03f,
+        4.55090078e-03f, 4.75977780e-03f, 4.97331889e-03f, 5.19152172e-03f, 5.41438349e-03f, 5.64190326e-03f,
+        5.87407826e-03f, 6.11090660e-03f, 6.35238551e-03f, 6.59851357e-03f, 6.84928754e-03f, 7.10470602e-03f,
+        7.36476574e-03f, 7.62946438e-03f, 7.89880008e-03f, 8.17277003e-03f, 8.45137052e-03f, 8.73460062e-03f,
+        9.02245753e-03f, 9.31493659e-03f, 9.61203780e-03f, 9.91375651e-03f, 1.02200899e-02f, 1.05310353e-02f,
+        1.08465906e-02f, 1.11667523e-02f, 1.14915175e-02f, 1.18208826e-02f, 1.21548455e-02f, 1.24934018e-02f,
+        1.28365485e-02f, 1.31842839e-02f, 1.35366032e-02f, 1.38935028e-02f, 1.42549807e-02f, 1.46210333e-02f,
+        1.49916559e-02f, 1.53668458e-02f, 1.57466009e-02f, 1.61309149e-02f, 1.65197849e-02f, 1.69132091e-02f,
+        1.73111819e-02f, 1.77136995e-02f, 1.81207601e-02f, 1.85323581e-02f, 1.89484898e-02f, 1.93691514e-02f,
+        1.97943393e-02f, 2.02240497e-02f, 2.06582788e-02f, 2.10970212e-02f, 2.15402730e-02f, 2.19880305e-02f,
+        2.24402882e-02f, 2.28970461e-02f, 2.33582947e-02f, 2.38240324e-02f, 2.42942534e-02f, 2.47689541e-02f,
+        2.52481308e-02f, 2.57317796e-02f, 2.62198932e-02f, 2.67124679e-02f, 2.72094999e-02f, 2.77109835e-02f,
+        2.82169152e-02f, 2.87272912e-02f, 2.92421039e-02f, 2.97613498e-02f, 3.02850232e-02f, 3.08131203e-02f,
+        3.13456357e-02f, 3.18825655e-02f, 3.24239023e-02f, 3.29696424e-02f, 3.35197821e-02f, 3.40743102e-02f,
+        3.46332304e-02f, 3.51965316e-02f, 3.57642099e-02f, 3.63362581e-02f, 3.69126759e-02f, 3.74934524e-02f,
+        3.80785838e-02f, 3.86680663e-02f, 3.92618924e-02f, 3.98600586e-02f, 4.04625572e-02f, 4.10693847e-02f,
+        4.16805334e-02f, 4.22959961e-02f, 4.29157689e-02f, 4.35398482e-02f, 4.41682264e-02f, 4.48008925e-02f,
+        4.54378501e-02f, 4.60790880e-02f, 4.67245989e-02f, 4.73743789e-02f, 4.80284207e-02f, 4.86867167e-02f,
+        4.93492670e-02f, 5.00160567e-02f, 5.06870858e-02f, 5.13623469e-02f, 5.20418324e-02f, 5.27255386e-02f,
+        5.34134544e-02f, 5.41055724e-02f, 5.48018925e-02f, 5.55024073e-02f, 5.62071055e-02f, 5.69159836e-02f,
+        5.76290339e-02f, 5.83462492e-02f, 5.90676256e-02f, 5.97931519e-02f, 6.05228245e-02f, 6.12566359e-02f,
+        6.19945787e-02f, 6.27366453e-02f, 6.34828284e-02f, 6.42331243e-02f, 6.49875253e-02f, 6.57460243e-02f,
+        6.65086061e-02f, 6.72752783e-02f, 6.80460185e-02f, 6.88208267e-02f, 6.95997030e-02f, 7.03826249e-02f,
+        7.11695924e-02f, 7.19605982e-02f, 7.27556422e-02f, 7.35547021e-02f, 7.43577778e-02f, 7.51648620e-02f,
+        7.59759545e-02f, 7.67910331e-02f, 7.76100978e-02f, 7.84331411e-02f, 7.92601556e-02f, 8.00911263e-02f,
+        8.09260532e-02f, 8.17649290e-02f, 8.26077461e-02f, 8.34544897e-02f, 8.43051597e-02f, 8.51597413e-02f,
+        8.60182270e-02f, 8.68806094e-02f, 8.77468884e-02f, 8.86170492e-02f, 8.94910842e-02f, 9.03689787e-02f,
+        9.12507400e-02f, 9.21363458e-02f, 9.30257887e-02f, 9.39190686e-02f, 9.48161706e-02f, 9.57170874e-02f,
+        9.66218188e-02f, 9.75303426e-02f, 9.84426513e-02f, 9.93587524e-02f, 1.00278616e-01f, 1.01202250e-01f,
+        1.02129638e-01f, 1.03060775e-01f, 1.03995644e-01f, 1.04934253e-01f, 1.05876572e-01f, 1.06822602e-01f,
+        1.07772343e-01f, 1.08725771e-01f, 1.09682888e-01f, 1.10643677e-01f, 1.11608133e-01f, 1.12576246e-01f,
+        1.13548011e-01f, 1.14523411e-01f, 1.15502447e-01f, 1.16485097e-01f, 1.17471360e-01f, 1.18461229e-01f,
+        1.19454689e-01f, 1.20451733e-01f, 1.21452346e-01f, 1.22456528e-01f, 1.23464264e-01f, 1.24475554e-01f,
+        1.25490367e-01f, 1.26508713e-01f, 1.27530575e-01f, 1.28555954e-01f, 1.29584819e-01f, 1.30617172e-01f,
+        1.31653011e-01f, 1.32692322e-01f, 1.33735076e-01f, 1.34781286e-01f, 1.35830939e-01f, 1.36884019e-01f,
+        1.37940526e-01f, 1.39000431e-01f, 1.40063748e-01f, 1.41130447e-01f, 1.42200515e-01f, 1.43273965e-01f,
+        1.44350767e-01f, 1.45430937e-01f, 1.46514431e-01f, 1.47601247e-01f, 1.48691386e-01f, 1.49784848e-01f,
+        1.50881588e-01f, 1.51981622e-01f, 1.53084934e-01f, 1.54191524e-01f, 1.55301362e-01f, 1.56414434e-01f,
+        1.57530755e-01f, 1.58650309e-01f, 1.59773067e-01f, 1.60899028e-01f, 1.62028179e-01f, 1.63160518e-01f,
+        1.64296031e-01f, 1.65434703e-01f, 1.66576520e-01f, 1.67721480e-01f, 1.68869570e-01f, 1.70020774e-01f,
+        1.71175092e-01f, 1.72332510e-01f, 1.73493013e-01f, 1.74656585e-01f, 1.75823212e-01f, 1.76992908e-01f,
+        1.78165644e-01f, 1.79341406e-01f, 1.80520177e-01f, 1.81701973e-01f, 1.82886764e-01f, 1.84074536e-01f,
+        1.85265288e-01f, 1.86458990e-01f, 1.87655658e-01f, 1.88855276e-01f, 1.90057799e-01f, 1.91263258e-01f,
+        1.92471623e-01f, 1.93682879e-01f, 1.94897026e-01f, 1.96114048e-01f, 1.97333917e-01f, 1.98556647e-01f,
+        1.99782223e-01f, 2.01010615e-01f, 2.02241823e-01f, 2.03475833e-01f, 2.04712644e-01f, 2.05952227e-01f,
+        2.07194582e-01f, 2.08439693e-01f, 2.09687561e-01f, 2.10938156e-01f, 2.12191463e-01f, 2.13447496e-01f,
+        2.14706212e-01f, 2.15967625e-01f, 2.17231706e-01f, 2.18498453e-01f, 2.19767854e-01f, 2.21039891e-01f,
+        2.22314566e-01f, 2.23591834e-01f, 2.24871725e-01f, 2.26154193e-01f, 2.27439255e-01f, 2.28726864e-01f,
+        2.30017036e-01f, 2.31309757e-01f, 2.32605010e-01f, 2.33902767e-01f, 2.35203043e-01f, 2.36505806e-01f,
+        2.37811044e-01f, 2.39118755e-01f, 2.40428925e-01f, 2.41741553e-01f, 2.43056595e-01f, 2.44374067e-01f,
+        2.45693937e-01f, 2.47016206e-01f, 2.48340860e-01f, 2.49667883e-01f, 2.50997245e-01f, 2.52328992e-01f,
+        2.53663033e-01f, 2.54999399e-01f, 2.56338090e-01f, 2.57679075e-01f, 2.59022325e-01f, 2.60367841e-01f,
+        2.61715651e-01f, 2.63065666e-01f, 2.64417917e-01f, 2.65772402e-01f, 2.67129093e-01f, 2.68487960e-01f,
+        2.69849032e-01f, 2.71212250e-01f, 2.72577643e-01f, 2.73945153e-01f, 2.75314808e-01f, 2.76686579e-01f,
+        2.78060436e-01f, 2.79436380e-01f, 2.80814439e-01f, 2.82194525e-01f, 2.83576667e-01f, 2.84960866e-01f,
+        2.86347091e-01f, 2.87735313e-01f, 2.89125532e-01f, 2.90517747e-01f, 2.91911930e-01f, 2.93308049e-01f,
+        2.94706166e-01f, 2.96106160e-01f, 2.97508121e-01f, 2.98911959e-01f, 3.00317705e-01f, 3.01725328e-01f,
+        3.03134829e-01f, 3.04546177e-01f, 3.05959344e-01f, 3.07374358e-01f, 3.08791190e-01f, 3.10209811e-01f,
+        3.11630219e-01f, 3.13052416e-01f, 3.14476371e-01f, 3.15902054e-01f, 3.17329496e-01f, 3.18758637e-01f,
+        3.20189506e-01f, 3.21622044e-01f, 3.23056281e-01f, 3.24492157e-01f, 3.25929701e-01f, 3.27368915e-01f,
+        3.28809708e-01f, 3.30252141e-01f, 3.31696153e-01f, 3.33141774e-01f, 3.34588945e-01f, 3.36037695e-01f,
+        3.37487966e-01f, 3.38939786e-01f, 3.40393096e-01f, 3.41847926e-01f, 3.43304247e-01f, 3.44762057e-01f,
+        3.46221328e-01f, 3.47682029e-01f, 3.49144161e-01f, 3.50607723e-01f, 3.52072686e-01f, 3.53539050e-01f,
+        3.55006784e-01f, 3.56475890e-01f, 3.57946366e-01f, 3.59418154e-01f, 3.60891283e-01f, 3.62365693e-01f,
+        3.63841414e-01f, 3.65318418e-01f, 3.66796702e-01f, 3.68276238e-01f, 3.69756997e-01f, 3.71239007e-01f,
+        3.72722208e-01f, 3.74206632e-01f, 3.75692219e-01f, 3.77178967e-01f, 3.78666908e-01f, 3.80155951e-01f,
+        3.81646156e-01f, 3.83137465e-01f, 3.84629846e-01f, 3.86123359e-01f, 3.87617916e-01f, 3.89113545e-01f,
+        3.90610218e-01f, 3.92107904e-01f, 3.93606603e-01f, 3.95106316e-01f, 3.96607041e-01f, 3.98108721e-01f,
+        3.99611354e-01f, 4.01114941e-01f, 4.02619451e-01f, 4.04124856e-01f, 4.05631214e-01f, 4.07138437e-01f,
+        4.08646524e-01f, 4.10155475e-01f, 4.11665291e-01f, 4.13175911e-01f, 4.14687365e-01f, 4.16199625e-01f,
+        4.17712659e-01f, 4.19226468e-01f, 4.20741051e-01f, 4.22256380e-01f, 4.23772454e-01f, 4.25289214e-01f,
+        4.26806688e-01f, 4.28324878e-01f, 4.29843724e-01f, 4.31363225e-01f, 4.32883382e-01f, 4.34404165e-01f,
+        4.35925543e-01f, 4.37447548e-01f, 4.38970149e-01f, 4.40493315e-01f, 4.42017049e-01f, 4.43541318e-01f,
+        4.45066124e-01f, 4.46591437e-01f, 4.48117286e-01f, 4.49643582e-01f, 4.51170385e-01f, 4.52697635e-01f,
+        4.54225332e-01f, 4.55753446e-01f, 4.57281977e-01f, 4.58810925e-01f, 4.60340261e-01f, 4.61869955e-01f,
+        4.63400036e-01f, 4.64930445e-01f, 4.66461182e-01f, 4.67992246e-01f, 4.69523579e-01f, 4.71055239e-01f,
+        4.72587138e-01f, 4.74119335e-01f, 4.75651741e-01f, 4.77184385e-01f, 4.78717238e-01f, 4.80250299e-01f,
+        4.81783569e-01f, 4.83316988e-01f, 4.84850556e-01f, 4.86384273e-01f, 4.87918139e-01f, 4.89452094e-01f,
+        4.90986139e-01f, 4.92520303e-01f, 4.94054526e-01f, 4.95588779e-01f, 4.97123092e-01f, 4.98657435e-01f,
+        5.00191808e-01f, 5.01726151e-01f, 5.03260493e-01f, 5.04794776e-01f, 5.06329060e-01f, 5.07863224e-01f,
+        5.09397388e-01f, 5.10931432e-01f, 5.12465358e-01f, 5.13999164e-01f, 5.15532851e-01f, 5.17066360e-01f,
+        5.18599749e-01f, 5.20132959e-01f, 5.21665990e-01f, 5.23198783e-01f, 5.24731398e-01f, 5.26263714e-01f,
+        5.27795851e-01f, 5.29327691e-01f, 5.30859292e-01f, 5.32390535e-01f, 5.33921540e-01f, 5.35452187e-01f,
+        5.36982536e-01f, 5.38512468e-01f, 5.40042102e-01f, 5.41571319e-01f, 5.43100178e-01f, 5.44628620e-01f,
+        5.46156645e-01f, 5.47684252e-01f, 5.49211383e-01f, 5.50738037e-01f, 5.52264214e-01f, 5.53789914e-01f,
+        5.55315137e-01f, 5.56839824e-01f, 5.58363914e-01f, 5.59887528e-01f, 5.61410546e-01f, 5.62933028e-01f,
+        5.64454854e-01f, 5.65976083e-01f, 5.67496717e-01f, 5.69016695e-01f, 5.70536077e-01f, 5.72054744e-01f,
+        5.73572755e-01f, 5.75090051e-01f, 5.76606631e-01f, 5.78122497e-01f, 5.79637647e-01f, 5.81152022e-01f,
+        5.82665682e-01f, 5.84178507e-01f, 5.85690558e-01f, 5.87201834e-01f, 5.88712275e-01f, 5.90221822e-01f,
+        5.91730595e-01f, 5.93238473e-01f, 5.94745457e-01f, 5.96251547e-01f, 5.97756803e-01f, 5.99261045e-01f,
+        6.00764394e-01f, 6.02266788e-01f, 6.03768229e-01f, 6.05268717e-01f, 6.06768131e-01f, 6.08266592e-01f,
+        6.09764040e-01f, 6.11260474e-01f, 6.12755835e-01f, 6.14250124e-01f, 6.15743339e-01f, 6.17235482e-01f,
+        6.18726492e-01f, 6.20216429e-01f, 6.21705174e-01f, 6.23192847e-01f, 6.24679327e-01f, 6.26164615e-01f,
+        6.27648711e-01f, 6.29131615e-01f, 6.30613327e-01f, 6.32093787e-01f, 6.33572996e-01f, 6.35050952e-01f,
+        6.36527658e-01f, 6.38003051e-01f, 6.39477134e-01f, 6.40949905e-01f, 6.42421365e-01f, 6.43891513e-01f,
+        6.45360291e-01f, 6.46827698e-01f, 6.48293674e-01f, 6.49758279e-01f, 6.51221514e-01f, 6.52683318e-01f,
+        6.54143631e-01f, 6.55602515e-01f, 6.57059968e-01f, 6.58515930e-01f, 6.59970343e-01f, 6.61423326e-01f,
+        6.62874758e-01f, 6.64324641e-01f, 6.65772974e-01f, 6.67219758e-01f, 6.68664992e-01f, 6.70108616e-01f,
+        6.71550632e-01f, 6.72991037e-01f, 6.74429834e-01f, 6.75866961e-01f, 6.77302420e-01f, 6.78736269e-01f,
+        6.80168390e-01f, 6.81598783e-01f, 6.83027506e-01f, 6.84454501e-01f, 6.85879767e-01f, 6.87303305e-01f,
+        6.88725054e-01f, 6.90145016e-01f, 6.91563189e-01f, 6.92979574e-01f, 6.94394112e-01f, 6.95806861e-01f,
+        6.97217703e-01f, 6.98626757e-01f, 7.00033903e-01f, 7.01439202e-01f, 7.02842534e-01f, 7.04244018e-01f,
+        7.05643535e-01f, 7.07041144e-01f, 7.08436787e-01f, 7.09830523e-01f, 7.11222231e-01f, 7.12611914e-01f,
+        7.13999689e-01f, 7.15385377e-01f, 7.16769040e-01f, 7.18150675e-01f, 7.19530284e-01f, 7.20907807e-01f,
+        7.22283244e-01f, 7.23656595e-01f, 7.25027800e-01f, 7.26396918e-01f, 7.27763891e-01f, 7.29128778e-01f,
+        7.30491459e-01f, 7.31851935e-01f, 7.33210266e-01f, 7.34566391e-01f, 7.35920370e-01f, 7.37272024e-01f,
+        7.38621533e-01f, 7.39968717e-01f, 7.41313696e-01f, 7.42656410e-01f, 7.43996799e-01f, 7.45334923e-01f,
+        7.46670723e-01f, 7.48004198e-01f, 7.49335289e-01f, 7.50664115e-01f, 7.51990557e-01f, 7.53314614e-01f,
+        7.54636288e-01f, 7.55955517e-01f, 7.57272422e-01f, 7.58586824e-01f, 7.59898841e-01f, 7.61208415e-01f,
+        7.62515485e-01f, 7.63820112e-01f, 7.65122235e-01f, 7.66421914e-01f, 7.67719030e-01f, 7.69013643e-01f,
+        7.70305753e-01f, 7.71595299e-01f, 7.72882283e-01f, 7.74166644e-01f, 7.75448501e-01f, 7.76727736e-01f,
+        7.78004348e-01f, 7.79278338e-01f, 7.80549765e-01f, 7.81818449e-01f, 7.83084571e-01f, 7.84347951e-01f,
+        7.85608709e-01f, 7.86866784e-01f, 7.88122118e-01f, 7.89374769e-01f, 7.90624678e-01f, 7.91871846e-01f,
+        7.93116271e-01f, 7.94357955e-01f, 7.95596838e-01f, 7.96832919e-01f, 7.98066258e-01f, 7.99296737e-01f,
+        8.00524414e-01f, 8.01749289e-01f, 8.02971303e-01f, 8.04190457e-01f, 8.05406749e-01f, 8.06620181e-01f,
+        8.07830751e-01f, 8.09038401e-01f, 8.10243130e-01f, 8.11444879e-01f, 8.12643766e-01f, 8.13839734e-01f,
+        8.15032661e-01f, 8.16222668e-01f, 8.17409694e-01f, 8.18593740e-01f, 8.19774806e-01f, 8.20952833e-01f,
+        8.22127819e-01f, 8.23299825e-01f, 8.24468732e-01f, 8.25634599e-01f, 8.26797426e-01f, 8.27957153e-01f,
+        8.29113781e-01f, 8.30267310e-01f, 8.31417739e-01f, 8.32565069e-01f, 8.33709240e-01f, 8.34850252e-01f,
+        8.35988164e-01f, 8.37122858e-01f, 8.38254392e-01f, 8.39382768e-01f, 8.40507925e-01f, 8.41629863e-01f,
+        8.42748642e-01f, 8.43864143e-01f, 8.44976425e-01f, 8.46085429e-01f, 8.47191215e-01f, 8.48293662e-01f,
+        8.49392891e-01f, 8.50488842e-01f, 8.51581454e-01f, 8.52670789e-01f, 8.53756785e-01f, 8.54839444e-01f,
+        8.55918765e-01f, 8.56994689e-01f, 8.58067334e-01f, 8.59136522e-01f, 8.60202432e-01f, 8.61264884e-01f,
+        8.62323940e-01f, 8.63379598e-01f, 8.64431798e-01f, 8.65480602e-01f, 8.66525948e-01f, 8.67567837e-01f,
+        8.68606269e-01f, 8.69641244e-01f, 8.70672703e-01f, 8.71700704e-01f, 8.72725189e-01f, 8.73746216e-01f,
+        8.74763668e-01f, 8.75777602e-01f, 8.76788020e-01f, 8.77794862e-01f, 8.78798127e-01f, 8.79797876e-01f,
+        8.80793989e-01f, 8.81786585e-01f, 8.82775545e-01f, 8.83760929e-01f, 8.84742677e-01f, 8.85720789e-01f,
+        8.86695266e-01f, 8.87666106e-01f, 8.88633311e-01f, 8.89596879e-01f, 8.90556753e-01f, 8.91512930e-01f,
+        8.92465413e-01f, 8.93414259e-01f, 8.94359350e-01f, 8.95300746e-01f, 8.96238446e-01f, 8.97172332e-01f,
+        8.98102582e-01f, 8.99029016e-01f, 8.99951696e-01f, 9.00870621e-01f, 9.01785791e-01f, 9.02697146e-01f,
+        9.03604746e-01f, 9.04508471e-01f, 9.05408442e-01f, 9.06304598e-01f, 9.07196939e-01f, 9.08085406e-01f,
+        9.08970058e-01f, 9.09850836e-01f, 9.10727799e-01f, 9.11600828e-01f, 9.12470043e-01f, 9.13335323e-01f,
+        9.14196789e-01f, 9.15054262e-01f, 9.15907860e-01f, 9.16757584e-01f, 9.17603314e-01f, 9.18445170e-01f,
+        9.19283032e-01f, 9.20116961e-01f, 9.20946956e-01f, 9.21773016e-01f, 9.22595024e-01f, 9.23413098e-01f,
+        9.24227178e-01f, 9.25037265e-01f, 9.25843358e-01f, 9.26645458e-01f, 9.27443504e-01f, 9.28237557e-01f,
+        9.29027557e-01f, 9.29813504e-01f, 9.30595398e-01f, 9.31373239e-01f, 9.32147026e-01f, 9.32916760e-01f,
+        9.33682442e-01f, 9.34444010e-01f, 9.35201466e-01f, 9.35954809e-01f, 9.36704099e-01f, 9.37449276e-01f,
+        9.38190281e-01f, 9.38927233e-01f, 9.39659953e-01f, 9.40388620e-01f, 9.41113114e-01f, 9.41833436e-01f,
+        9.42549646e-01f, 9.43261623e-01f, 9.43969488e-01f, 9.44673121e-01f, 9.45372581e-01f, 9.46067870e-01f,
+        9.46758926e-01f, 9.47445810e-01f, 9.48128462e-01f, 9.48806882e-01f, 9.49481070e-01f, 9.50151026e-01f,
+        9.50816751e-01f, 9.51478243e-01f, 9.52135503e-01f, 9.52788472e-01f, 9.53437209e-01f, 9.54081595e-01f,
+        9.54721808e-01f, 9.55357671e-01f, 9.55989301e-01f, 9.56616580e-01f, 9.57239568e-01f, 9.57858264e-01f,
+        9.58472669e-01f, 9.59082723e-01f, 9.59688485e-01f, 9.60289896e-01f, 9.60886955e-01f, 9.61479723e-01f,
+        9.62068081e-01f, 9.62652147e-01f, 9.63231862e-01f, 9.63807166e-01f, 9.64378119e-01f, 9.64944720e-01f,
+        9.65506911e-01f, 9.66064751e-01f, 9.66618180e-01f, 9.67167199e-01f, 9.67711866e-01f, 9.68252063e-01f,
+        9.68787909e-01f, 9.69319344e-01f, 9.69846308e-01f, 9.70368862e-01f, 9.70887005e-01f, 9.71400738e-01f,
+        9.71910000e-01f, 9.72414792e-01f, 9.72915173e-01f, 9.73411083e-01f, 9.73902583e-01f, 9.74389553e-01f,
+        9.74872053e-01f, 9.75350142e-01f, 9.75823700e-01f, 9.76292849e-01f, 9.76757467e-01f, 9.77217555e-01f,
+        9.77673173e-01f, 9.78124321e-01f, 9.78570938e-01f, 9.79013085e-01f, 9.79450703e-01f, 9.79883790e-01f,
+        9.80312407e-01f, 9.80736434e-01f, 9.81155992e-01f, 9.81570959e-01f, 9.81981456e-01f, 9.82387364e-01f,
+        9.82788742e-01f, 9.83185589e-01f, 9.83577847e-01f, 9.83965576e-01f, 9.84348774e-01f, 9.84727383e-01f,
+        9.85101402e-01f, 9.85470891e-01f, 9.85835791e-01f, 9.86196160e-01f, 9.86551881e-01f, 9.86903071e-01f,
+        9.87249672e-01f, 9.87591684e-01f, 9.87929106e-01f, 9.88261878e-01f, 9.88590121e-01f, 9.88913715e-01f,
+        9.89232719e-01f, 9.89547133e-01f, 9.89856899e-01f, 9.90162134e-01f, 9.90462661e-01f, 9.90758598e-01f,
+        9.91049945e-01f, 9.91336644e-01f, 9.91618693e-01f, 9.91896152e-01f, 9.92168963e-01f, 9.92437124e-01f,
+        9.92700696e-01f, 9.92959559e-01f, 9.93213832e-01f, 9.93463457e-01f, 9.93708432e-01f, 9.93948758e-01f,
+        9.94184375e-01f, 9.94415402e-01f, 9.94641781e-01f, 9.94863451e-01f, 9.95080531e-01f, 9.95292902e-01f,
+        9.95500565e-01f, 9.95703638e-01f, 9.95902002e-01f, 9.96095717e-01f, 9.96284783e-01f, 9.96469140e-01f,
+        9.96648788e-01f, 9.96823788e-01f, 9.96994138e-01f, 9.97159779e-01f, 9.97320771e-01f, 9.97477055e-01f,
+        9.97628629e-01f, 9.97775555e-01f, 9.97917771e-01f, 9.98055339e-01f, 9.98188198e-01f, 9.98316348e-01f,
+        9.98439789e-01f, 9.98558581e-01f, 9.98672664e-01f, 9.98782039e-01f, 9.98886704e-01f, 9.98986721e-01f,
+        9.99081969e-01f, 9.99172568e-01f, 9.99258459e-01f, 9.99339640e-01f, 9.99416113e-01f, 9.99487877e-01f,
+        9.99554992e-01f, 9.99617338e-01f, 9.99674976e-01f, 9.99727964e-01f, 9.99776244e-01f, 9.99819756e-01f,
+        9.99858618e-01f, 9.99892712e-01f, 9.99922156e-01f, 9.99946892e-01f, 9.99966919e-01f, 9.99982178e-01f,
+        9.99992788e-01f, 9.99998689e-01f, 9.99999881e-01f, 9.99996305e-01f, 9.99988079e-01f, 9.99975145e-01f,
+        9.99957502e-01f, 9.99935091e-01f, 9.99908030e-01f, 9.99876261e-01f, 9.99839783e-01f, 9.99798596e-01f,
+        9.99752700e-01f, 9.99702096e-01f, 9.99646783e-01f, 9.99586761e-01f, 9.99522030e-01f, 9.99452591e-01f,
+        9.99378443e-01f, 9.99299645e-01f, 9.99216080e-01f, 9.99127865e-01f, 9.99034941e-01f, 9.98937309e-01f,
+        9.98834968e-01f, 9.98727918e-01f, 9.98616219e-01f, 9.98499751e-01f, 9.98378634e-01f, 9.98252869e-01f,
+        9.98122334e-01f, 9.97987151e-01f, 9.97847259e-01f, 9.97702718e-01f, 9.97553408e-01f, 9.97399509e-01f,
+        9.97240841e-01f, 9.97077525e-01f, 9.96909559e-01f, 9.96736884e-01f, 9.96559560e-01f, 9.96377528e-01f,
+        9.96190846e-01f, 9.95999455e-01f, 9.95803416e-01f, 9.95602667e-01f, 9.95397329e-01f, 9.95187283e-01f,
+        9.94972587e-01f, 9.94753182e-01f, 9.94529188e-01f, 9.94300485e-01f, 9.94067132e-01f, 9.93829131e-01f,
+        9.93586540e-01f, 9.93339241e-01f, 9.93087292e-01f, 9.92830694e-01f, 9.92569506e-01f, 9.92303610e-01f,
+        9.92033124e-01f, 9.91757989e-01f, 9.91478264e-01f, 9.91193891e-01f, 9.90904868e-01f, 9.90611196e-01f,
+        9.90312994e-01f, 9.90010083e-01f, 9.89702582e-01f, 9.89390492e-01f, 9.89073813e-01f, 9.88752484e-01f,
+        9.88426566e-01f, 9.88096058e-01f, 9.87760961e-01f, 9.87421215e-01f, 9.87076938e-01f, 9.86728072e-01f,
+        9.86374617e-01f, 9.86016572e-01f, 9.85653937e-01f, 9.85286713e-01f, 9.84914958e-01f, 9.84538615e-01f,
+        9.84157741e-01f, 9.83772278e-01f, 9.83382285e-01f, 9.82987702e-01f, 9.82588589e-01f, 9.82184947e-01f,
+        9.81776774e-01f, 9.81364012e-01f, 9.80946779e-01f, 9.80524957e-01f, 9.80098665e-01f, 9.79667842e-01f,
+        9.79232430e-01f, 9.78792608e-01f, 9.78348196e-01f, 9.77899313e-01f, 9.77445960e-01f, 9.76988077e-01f,
+        9.76525664e-01f, 9.76058841e-01f, 9.75587487e-01f, 9.75111663e-01f, 9.74631369e-01f, 9.74146605e-01f,
+        9.73657370e-01f, 9.73163664e-01f, 9.72665548e-01f, 9.72162962e-01f, 9.71655905e-01f, 9.71144438e-01f,
+        9.70628500e-01f, 9.70108151e-01f, 9.69583392e-01f, 9.69054163e-01f, 9.68520522e-01f, 9.67982531e-01f,
+        9.67440069e-01f, 9.66893256e-01f, 9.66341972e-01f, 9.65786397e-01f, 9.65226352e-01f, 9.64661956e-01f,
+        9.64093208e-01f, 9.63520050e-01f, 9.62942541e-01f, 9.62360680e-01f, 9.61774468e-01f, 9.61183906e-01f,
+        9.60588992e-01f, 9.59989727e-01f, 9.59386170e-01f, 9.58778262e-01f, 9.58166003e-01f, 9.57549453e-01f,
+        9.56928611e-01f, 9.56303477e-01f, 9.55673993e-01f, 9.55040276e-01f, 9.54402268e-01f, 9.53759909e-01f,
+        9.53113377e-01f, 9.52462494e-01f, 9.51807380e-01f, 9.51148033e-01f, 9.50484455e-01f, 9.49816585e-01f,
+        9.49144483e-01f, 9.48468149e-01f, 9.47787642e-01f, 9.47102904e-01f, 9.46413934e-01f, 9.45720732e-01f,
+        9.45023358e-01f, 9.44321811e-01f, 9.43616092e-01f, 9.42906141e-01f, 9.42192078e-01f, 9.41473782e-01f,
+        9.40751374e-01f, 9.40024793e-01f, 9.39294100e-01f, 9.38559294e-01f, 9.37820315e-01f, 9.37077165e-01f,
+        9.36329961e-01f, 9.35578644e-01f, 9.34823215e-01f, 9.34063733e-01f, 9.33300078e-01f, 9.32532430e-01f,
+        9.31760669e-01f, 9.30984855e-01f, 9.30204928e-01f, 9.29421008e-01f, 9.28633034e-01f, 9.27841008e-01f,
+        9.27044988e-01f, 9.26244915e-01f, 9.25440848e-01f, 9.24632728e-01f, 9.23820674e-01f, 9.23004568e-01f,
+        9.22184527e-01f, 9.21360493e-01f, 9.20532465e-01f, 9.19700503e-01f, 9.18864608e-01f, 9.18024719e-01f,
+        9.17180955e-01f, 9.16333199e-01f, 9.15481567e-01f, 9.14626002e-01f, 9.13766563e-01f, 9.12903190e-01f,
+        9.12035942e-01f, 9.11164820e-01f, 9.10289824e-01f, 9.09410954e-01f, 9.08528209e-01f, 9.07641649e-01f,
+        9.06751275e-01f, 9.05857027e-01f, 9.04958963e-01f, 9.04057086e-01f, 9.03151393e-01f, 9.02241945e-01f,
+        9.01328683e-01f, 9.00411665e-01f, 8.99490833e-01f, 8.98566246e-01f, 8.97637904e-01f, 8.96705866e-01f,
+        8.95770073e-01f, 8.94830525e-01f, 8.93887281e-01f, 8.92940283e-01f, 8.91989648e-01f, 8.91035318e-01f,
+        8.90077233e-01f, 8.89115572e-01f, 8.88150156e-01f, 8.87181163e-01f, 8.86208475e-01f, 8.85232151e-01f,
+        8.84252250e-01f, 8.83268654e-01f, 8.82281482e-01f, 8.81290734e-01f, 8.80296409e-01f, 8.79298449e-01f,
+        8.78296912e-01f, 8.77291858e-01f, 8.76283228e-01f, 8.75271082e-01f, 8.74255359e-01f, 8.73236120e-01f,
+        8.72213423e-01f, 8.71187150e-01f, 8.70157421e-01f, 8.69124174e-01f, 8.68087471e-01f, 8.67047310e-01f,
+        8.66003692e-01f, 8.64956617e-01f, 8.63906085e-01f, 8.62852156e-01f, 8.61794829e-01f, 8.60734046e-01f,
+        8.59669924e-01f, 8.58602345e-01f, 8.57531428e-01f, 8.56457174e-01f, 8.55379522e-01f, 8.54298532e-01f,
+        8.53214204e-01f, 8.52126539e-01f, 8.51035535e-01f, 8.49941254e-01f, 8.48843694e-01f, 8.47742856e-01f,
+        8.46638739e-01f, 8.45531344e-01f, 8.44420671e-01f, 8.43306780e-01f, 8.42189670e-01f, 8.41069281e-01f,
+        8.39945734e-01f, 8.38818967e-01f, 8.37689042e-01f, 8.36555898e-01f, 8.35419595e-01f, 8.34280133e-01f,
+        8.33137512e-01f, 8.31991792e-01f, 8.30842912e-01f, 8.29690933e-01f, 8.28535855e-01f, 8.27377677e-01f,
+        8.26216400e-01f, 8.25052023e-01f, 8.23884666e-01f, 8.22714210e-01f, 8.21540713e-01f, 8.20364177e-01f,
+        8.19184661e-01f, 8.18002105e-01f, 8.16816568e-01f, 8.15628052e-01f, 8.14436555e-01f, 8.13242137e-01f,
+        8.12044740e-01f, 8.10844362e-01f, 8.09641123e-01f, 8.08434904e-01f, 8.07225823e-01f, 8.06013823e-01f,
+        8.04798961e-01f, 8.03581238e-01f, 8.02360654e-01f, 8.01137209e-01f, 7.99910963e-01f, 7.98681855e-01f,
+        7.97449946e-01f, 7.96215236e-01f, 7.94977725e-01f, 7.93737411e-01f, 7.92494416e-01f, 7.91248620e-01f,
+        7.90000021e-01f, 7.88748801e-01f, 7.87494779e-01f, 7.86238074e-01f, 7.84978688e-01f, 7.83716619e-01f,
+        7.82451868e-01f, 7.81184435e-01f, 7.79914379e-01f, 7.78641701e-01f, 7.77366340e-01f, 7.76088417e-01f,
+        7.74807930e-01f, 7.73524761e-01f, 7.72239089e-01f, 7.70950854e-01f, 7.69659996e-01f, 7.68366694e-01f,
+        7.67070770e-01f, 7.65772402e-01f, 7.64471531e-01f, 7.63168097e-01f, 7.61862278e-01f, 7.60553896e-01f,
+        7.59243131e-01f, 7.57929921e-01f, 7.56614268e-01f, 7.55296171e-01f, 7.53975749e-01f, 7.52652884e-01f,
+        7.51327634e-01f, 7.50000000e-01f, 7.48670042e-01f, 7.47337699e-01f, 7.46003091e-01f, 7.44666159e-01f,
+        7.43326902e-01f, 7.41985321e-01f, 7.40641475e-01f, 7.39295423e-01f, 7.37947047e-01f, 7.36596465e-01f,
+        7.35243678e-01f, 7.33888626e-01f, 7.32531369e-01f, 7.31171966e-01f, 7.29810357e-01f, 7.28446603e-01f,
+        7.27080703e-01f, 7.25712657e-01f, 7.24342465e-01f, 7.22970188e-01f, 7.21595764e-01f, 7.20219314e-01f,
+        7.18840718e-01f, 7.17460155e-01f, 7.16077447e-01f, 7.14692771e-01f, 7.13306069e-01f, 7.11917341e-01f,
+        7.10526586e-01f, 7.09133923e-01f, 7.07739234e-01f, 7.06342578e-01f, 7.04944015e-01f, 7.03543544e-01f,
+        7.02141106e-01f, 7.00736761e-01f, 6.99330568e-01f, 6.97922468e-01f, 6.96512520e-01f, 6.95100725e-01f,
+        6.93687081e-01f, 6.92271590e-01f, 6.90854311e-01f, 6.89435244e-01f, 6.88014388e-01f, 6.86591744e-01f,
+        6.85167372e-01f, 6.83741271e-01f, 6.82313383e-01f, 6.80883825e-01f, 6.79452538e-01f, 6.78019583e-01f,
+        6.76584899e-01f, 6.75148606e-01f, 6.73710644e-01f, 6.72271073e-01f, 6.70829833e-01f, 6.69386983e-01f,
+        6.67942584e-01f, 6.66496575e-01f, 6.65049016e-01f, 6.63599908e-01f, 6.62149251e-01f, 6.60697043e-01f,
+        6.59243345e-01f, 6.57788098e-01f, 6.56331420e-01f, 6.54873252e-01f, 6.53413653e-01f, 6.51952565e-01f,
+        6.50490105e-01f, 6.49026155e-01f, 6.47560835e-01f, 6.46094143e-01f, 6.44626081e-01f, 6.43156588e-01f,
+        6.41685843e-01f, 6.40213668e-01f, 6.38740242e-01f, 6.37265503e-01f, 6.35789454e-01f, 6.34312093e-01f,
+        6.32833540e-01f, 6.31353676e-01f, 6.29872620e-01f, 6.28390312e-01f, 6.26906812e-01f, 6.25422120e-01f,
+        6.23936236e-01f, 6.22449160e-01f, 6.20960951e-01f, 6.19471610e-01f, 6.17981136e-01f, 6.16489530e-01f,
+        6.14996850e-01f, 6.13503098e-01f, 6.12008274e-01f, 6.10512376e-01f, 6.09015465e-01f, 6.07517540e-01f,
+        6.06018543e-01f, 6.04518592e-01f, 6.03017628e-01f, 6.01515710e-01f, 6.00012839e-01f, 5.98509014e-01f,
+        5.97004294e-01f, 5.95498621e-01f, 5.93992054e-01f, 5.92484653e-01f, 5.90976298e-01f, 5.89467168e-01f,
+        5.87957144e-01f, 5.86446285e-01f, 5.84934652e-01f, 5.83422184e-01f, 5.81908941e-01f, 5.80394924e-01f,
+        5.78880191e-01f, 5.77364683e-01f, 5.75848401e-01f, 5.74331462e-01f, 5.72813809e-01f, 5.71295500e-01f,
+        5.69776475e-01f, 5.68256795e-01f, 5.66736519e-01f, 5.65215528e-01f, 5.63694000e-01f, 5.62171876e-01f,
+        5.60649097e-01f, 5.59125781e-01f, 5.57601929e-01f, 5.56077540e-01f, 5.54552615e-01f, 5.53027153e-01f,
+        5.51501215e-01f, 5.49974740e-01f, 5.48447847e-01f, 5.46920478e-01f, 5.45392692e-01f, 5.43864489e-01f,
+        5.42335808e-01f, 5.40806770e-01f, 5.39277375e-01f, 5.37747562e-01f, 5.36217391e-01f, 5.34686923e-01f,
+        5.33156097e-01f, 5.31624973e-01f, 5.30093551e-01f, 5.28561831e-01f, 5.27029812e-01f, 5.25497615e-01f,
+        5.23965120e-01f, 5.22432387e-01f, 5.20899475e-01f, 5.19366384e-01f, 5.17833114e-01f, 5.16299665e-01f,
+        5.14766037e-01f, 5.13232291e-01f, 5.11698365e-01f, 5.10164380e-01f, 5.08630335e-01f, 5.07096171e-01f,
+        5.05561948e-01f, 5.04027665e-01f, 5.02493322e-01f, 5.00958979e-01f, 4.99424607e-01f, 4.97890264e-01f,
+        4.96355951e-01f, 4.94821638e-01f, 4.93287385e-01f, 4.91753221e-01f, 4.90219116e-01f, 4.88685101e-01f,
+        4.87151176e-01f, 4.85617399e-01f, 4.84083742e-01f, 4.82550263e-01f, 4.81016904e-01f, 4.79483753e-01f,
+        4.77950782e-01f, 4.76418048e-01f, 4.74885494e-01f, 4.73353207e-01f, 4.71821159e-01f, 4.70289379e-01f,
+        4.68757868e-01f, 4.67226654e-01f, 4.65695769e-01f, 4.64165181e-01f, 4.62634951e-01f, 4.61105078e-01f,
+        4.59575534e-01f, 4.58046407e-01f, 4.56517667e-01f, 4.54989314e-01f, 4.53461409e-01f, 4.51933950e-01f,
+        4.50406909e-01f, 4.48880374e-01f, 4.47354287e-01f, 4.45828706e-01f, 4.44303662e-01f, 4.42779124e-01f,
+        4.41255122e-01f, 4.39731658e-01f, 4.38208789e-01f, 4.36686486e-01f, 4.35164779e-01f, 4.33643669e-01f,
+        4.32123214e-01f, 4.30603385e-01f, 4.29084212e-01f, 4.27565694e-01f, 4.26047862e-01f, 4.24530745e-01f,
+        4.23014313e-01f, 4.21498626e-01f, 4.19983685e-01f, 4.18469489e-01f, 4.16956037e-01f, 4.15443391e-01f,
+        4.13931549e-01f, 4.12420481e-01f, 4.10910279e-01f, 4.09400880e-01f, 4.07892376e-01f, 4.06384706e-01f,
+        4.04877931e-01f, 4.03372049e-01f, 4.01867062e-01f, 4.00363028e-01f, 3.98859918e-01f, 3.97357762e-01f,
+        3.95856559e-01f, 3.94356340e-01f, 3.92857134e-01f, 3.91358912e-01f, 3.89861733e-01f, 3.88365597e-01f,
+        3.86870503e-01f, 3.85376483e-01f, 3.83883506e-01f, 3.82391661e-01f, 3.80900919e-01f, 3.79411280e-01f,
+        3.77922803e-01f, 3.76435459e-01f, 3.74949276e-01f, 3.73464257e-01f, 3.71980458e-01f, 3.70497853e-01f,
+        3.69016469e-01f, 3.67536306e-01f, 3.66057396e-01f, 3.64579767e-01f, 3.63103390e-01f, 3.61628324e-01f,
+        3.60154539e-01f, 3.58682096e-01f, 3.57210964e-01f, 3.55741173e-01f, 3.54272753e-01f, 3.52805704e-01f,
+        3.51340026e-01f, 3.49875778e-01f, 3.48412901e-01f, 3.46951485e-01f, 3.45491499e-01f, 3.44032973e-01f,
+        3.42575908e-01f, 3.41120332e-01f, 3.39666247e-01f, 3.38213682e-01f, 3.36762637e-01f, 3.35313112e-01f,
+        3.33865166e-01f, 3.32418770e-01f, 3.30973953e-01f, 3.29530716e-01f, 3.28089118e-01f, 3.26649100e-01f,
+        3.25210720e-01f, 3.23774010e-01f, 3.22338939e-01f, 3.20905566e-01f, 3.19473863e-01f, 3.18043858e-01f,
+        3.16615552e-01f, 3.15189004e-01f, 3.13764185e-01f, 3.12341094e-01f, 3.10919791e-01f, 3.09500277e-01f,
+        3.08082551e-01f, 3.06666642e-01f, 3.05252522e-01f, 3.03840250e-01f, 3.02429855e-01f, 3.01021278e-01f,
+        2.99614608e-01f, 2.98209816e-01f, 2.96806902e-01f, 2.95405924e-01f, 2.94006854e-01f, 2.92609751e-01f,
+        2.91214585e-01f, 2.89821386e-01f, 2.88430154e-01f, 2.87040949e-01f, 2.85653710e-01f, 2.84268528e-01f,
+        2.82885343e-01f, 2.81504214e-01f, 2.80125141e-01f, 2.78748155e-01f, 2.77373224e-01f, 2.76000410e-01f,
+        2.74629712e-01f, 2.73261130e-01f, 2.71894664e-01f, 2.70530373e-01f, 2.69168228e-01f, 2.67808259e-01f,
+        2.66450465e-01f, 2.65094906e-01f, 2.63741523e-01f, 2.62390375e-01f, 2.61041462e-01f, 2.59694815e-01f,
+        2.58350402e-01f, 2.57008284e-01f, 2.55668461e-01f, 2.54330933e-01f, 2.52995729e-01f, 2.51662821e-01f,
+        2.50332266e-01f, 2.49004066e-01f, 2.47678235e-01f, 2.46354774e-01f, 2.45033696e-01f, 2.43715033e-01f,
+        2.42398769e-01f, 2.41084933e-01f, 2.39773542e-01f, 2.38464594e-01f, 2.37158120e-01f, 2.35854104e-01f,
+        2.34552592e-01f, 2.33253568e-01f, 2.31957063e-01f, 2.30663076e-01f, 2.29371637e-01f, 2.28082731e-01f,
+        2.26796404e-01f, 2.25512639e-01f, 2.24231452e-01f, 2.22952873e-01f, 2.21676901e-01f, 2.20403552e-01f,
+        2.19132826e-01f, 2.17864752e-01f, 2.16599330e-01f, 2.15336591e-01f, 2.14076519e-01f, 2.12819144e-01f,
+        2.11564466e-01f, 2.10312515e-01f, 2.09063292e-01f, 2.07816795e-01f, 2.06573069e-01f, 2.05332085e-01f,
+        2.04093888e-01f, 2.02858478e-01f, 2.01625869e-01f, 2.00396061e-01f, 1.99169084e-01f, 1.97944924e-01f,
+        1.96723625e-01f, 1.95505172e-01f, 1.94289595e-01f, 1.93076894e-01f, 1.91867083e-01f, 1.90660164e-01f,
+        1.89456180e-01f, 1.88255101e-01f, 1.87056959e-01f, 1.85861766e-01f, 1.84669539e-01f, 1.83480278e-01f,
+        1.82293996e-01f, 1.81110710e-01f, 1.79930419e-01f, 1.78753138e-01f, 1.77578896e-01f, 1.76407680e-01f,
+        1.75239518e-01f, 1.74074411e-01f, 1.72912374e-01f, 1.71753421e-01f, 1.70597553e-01f, 1.69444785e-01f,
+        1.68295130e-01f, 1.67148605e-01f, 1.66005209e-01f, 1.64864972e-01f, 1.63727880e-01f, 1.62593946e-01f,
+        1.61463201e-01f, 1.60335645e-01f, 1.59211278e-01f, 1.58090129e-01f, 1.56972200e-01f, 1.55857489e-01f,
+        1.54746026e-01f, 1.53637826e-01f, 1.52532876e-01f, 1.51431203e-01f, 1.50332808e-01f, 1.49237707e-01f,
+        1.48145899e-01f, 1.47057429e-01f, 1.45972267e-01f, 1.44890428e-01f, 1.43811956e-01f, 1.42736822e-01f,
+        1.41665056e-01f, 1.40596673e-01f, 1.39531657e-01f, 1.38470054e-01f, 1.37411848e-01f, 1.36357054e-01f,
+        1.35305688e-01f, 1.34257749e-01f, 1.33213267e-01f, 1.32172227e-01f, 1.31134659e-01f, 1.30100563e-01f,
+        1.29069954e-01f, 1.28042832e-01f, 1.27019212e-01f, 1.25999108e-01f, 1.24982521e-01f, 1.23969465e-01f,
+        1.22959957e-01f, 1.21953994e-01f, 1.20951593e-01f, 1.19952761e-01f, 1.18957512e-01f, 1.17965847e-01f,
+        1.16977781e-01f, 1.15993321e-01f, 1.15012474e-01f, 1.14035256e-01f, 1.13061674e-01f, 1.12091735e-01f,
+        1.11125447e-01f, 1.10162824e-01f, 1.09203868e-01f, 1.08248599e-01f, 1.07297011e-01f, 1.06349126e-01f,
+        1.05404943e-01f, 1.04464486e-01f, 1.03527747e-01f, 1.02594741e-01f, 1.01665474e-01f, 1.00739963e-01f,
+        9.98182148e-02f, 9.89002287e-02f, 9.79860201e-02f, 9.70756039e-02f, 9.61689800e-02f, 9.52661559e-02f,
+        9.43671390e-02f, 9.34719518e-02f, 9.25805867e-02f, 9.16930586e-02f, 9.08093750e-02f, 8.99295509e-02f,
+        8.90535787e-02f, 8.81814882e-02f, 8.73132646e-02f, 8.64489302e-02f, 8.55884925e-02f, 8.47319588e-02f,
+        8.38793367e-02f, 8.30306262e-02f, 8.21858495e-02f, 8.13449994e-02f, 8.05080980e-02f, 7.96751454e-02f,
+        7.88461491e-02f, 7.80211240e-02f, 7.72000700e-02f, 7.63829947e-02f, 7.55699053e-02f, 7.47608244e-02f,
+        7.39557371e-02f, 7.31546655e-02f, 7.23576173e-02f, 7.15645924e-02f, 7.07756057e-02f, 6.99906573e-02f,
+        6.92097545e-02f, 6.84329197e-02f, 6.76601380e-02f, 6.68914318e-02f, 6.61268085e-02f, 6.53662607e-02f,
+        6.46098182e-02f, 6.38574660e-02f, 6.31092265e-02f, 6.23650961e-02f, 6.16250895e-02f, 6.08892143e-02f,
+        6.01574704e-02f, 5.94298691e-02f, 5.87064177e-02f, 5.79871200e-02f, 5.72719872e-02f, 5.65610230e-02f,
+        5.58542348e-02f, 5.51516265e-02f, 5.44532090e-02f, 5.37589863e-02f, 5.30689694e-02f, 5.23831584e-02f,
+        5.17015643e-02f, 5.10241874e-02f, 5.03510423e-02f, 4.96821329e-02f, 4.90174592e-02f, 4.83570360e-02f,
+        4.77008671e-02f, 4.70489562e-02f, 4.64013070e-02f, 4.57579345e-02f, 4.51188348e-02f, 4.44840230e-02f,
+        4.38534990e-02f, 4.32272702e-02f, 4.26053442e-02f, 4.19877246e-02f, 4.13744189e-02f, 4.07654308e-02f,
+        4.01607677e-02f, 3.95604335e-02f, 3.89644392e-02f, 3.83727811e-02f, 3.77854742e-02f, 3.72025184e-02f,
+        3.66239212e-02f, 3.60496901e-02f, 3.54798250e-02f, 3.49143334e-02f, 3.43532227e-02f, 3.37964967e-02f,
+        3.32441628e-02f, 3.26962210e-02f, 3.21526825e-02f, 3.16135474e-02f, 3.10788266e-02f, 3.05485185e-02f,
+        3.00226323e-02f, 2.95011718e-02f, 2.89841425e-02f, 2.84715481e-02f, 2.79633943e-02f, 2.74596866e-02f,
+        2.69604269e-02f, 2.64656227e-02f, 2.59752776e-02f, 2.54893973e-02f, 2.50079837e-02f, 2.45310441e-02f,
+        2.40585823e-02f, 2.35906020e-02f, 2.31271088e-02f, 2.26681046e-02f, 2.22135969e-02f, 2.17635874e-02f,
+        2.13180836e-02f, 2.08770856e-02f, 2.04405989e-02f, 2.00086311e-02f, 1.95811801e-02f, 1.91582553e-02f,
+        1.87398568e-02f, 1.83259919e-02f, 1.79166626e-02f, 1.75118726e-02f, 1.71116274e-02f, 1.67159289e-02f,
+        1.63247809e-02f, 1.59381870e-02f, 1.55561529e-02f, 1.51786804e-02f, 1.48057733e-02f, 1.44374352e-02f,
+        1.40736699e-02f, 1.37144802e-02f, 1.33598708e-02f, 1.30098425e-02f, 1.26644019e-02f, 1.23235490e-02f,
+        1.19872894e-02f, 1.16556250e-02f, 1.13285594e-02f, 1.10060964e-02f, 1.06882369e-02f, 1.03749866e-02f,
+        1.00663463e-02f, 9.76231974e-03f, 9.46290977e-03f, 9.16811917e-03f, 8.87795072e-03f, 8.59240722e-03f,
+        8.31149146e-03f, 8.03520530e-03f, 7.76355295e-03f, 7.49653531e-03f, 7.23415567e-03f, 6.97641633e-03f,
+        6.72332011e-03f, 6.47486886e-03f, 6.23106491e-03f, 5.99191105e-03f, 5.75740915e-03f, 5.52756153e-03f,
+        5.30237006e-03f, 5.08183753e-03f, 4.86596581e-03f, 4.65475628e-03f, 4.44821175e-03f, 4.24633361e-03f,
+        4.04912420e-03f, 3.85658466e-03f, 3.66871781e-03f, 3.48552456e-03f, 3.30700725e-03f, 3.13316705e-03f,
+        2.96400604e-03f, 2.79952539e-03f, 2.63972720e-03f, 2.48461240e-03f, 2.33418262e-03f, 2.18843948e-03f,
+        2.04738416e-03f, 1.91101816e-03f, 1.77934254e-03f, 1.65235868e-03f, 1.53006776e-03f, 1.41247094e-03f,
+        1.29956927e-03f, 1.19136390e-03f, 1.08785566e-03f, 9.89045831e-04f, 8.94935103e-04f, 8.05524469e-04f,
+        7.20814744e-04f, 6.40806684e-04f, 5.65501105e-04f, 4.94898646e-04f, 4.29000065e-04f, 3.67805915e-04f,
+        3.11316777e-04f, 2.59533204e-04f, 2.12455692e-04f, 1.70084662e-04f, 1.32420522e-04f, 9.94636139e-05f,
+        7.12142646e-05f, 4.76727328e-05f, 2.88392421e-05f, 1.47139681e-05f, 5.29704494e-06f, 5.88561477e-07f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f
+    };
+    static const float acwinv4096[4096] = {
+        1.00000000e+00f, 1.00000167e+00f, 1.00000632e+00f, 1.00001431e+00f, 1.00002527e+00f, 1.00003934e+00f,
+        1.00005651e+00f, 1.00007701e+00f, 1.00010049e+00f, 1.00012720e+00f, 1.00015700e+00f, 1.00018990e+00f,
+        1.00022614e+00f, 1.00026536e+00f, 1.00030780e+00f, 1.00035334e+00f, 1.00040185e+00f, 1.00045371e+00f,
+        1.00050867e+00f, 1.00056672e+00f, 1.00062799e+00f, 1.00069237e+00f, 1.00075984e+00f, 1.00083053e+00f,
+        1.00090444e+00f, 1.00098133e+00f, 1.00106144e+00f, 1.00114477e+00f, 1.00123119e+00f, 1.00132072e+00f,
+        1.00141358e+00f, 1.00150955e+00f, 1.00160861e+00f, 1.00171077e+00f, 1.00181603e+00f, 1.00192451e+00f,
+        1.00203609e+00f, 1.00215089e+00f, 1.00226891e+00f, 1.00239003e+00f, 1.00251436e+00f, 1.00264180e+00f,
+        1.00277269e+00f, 1.00290620e+00f, 1.00304329e+00f, 1.00318348e+00f, 1.00332689e+00f, 1.00347316e+00f,
+        1.00362277e+00f, 1.00377572e+00f, 1.00393176e+00f, 1.00409091e+00f, 1.00425315e+00f, 1.00441873e+00f,
+        1.00458741e+00f, 1.00475931e+00f, 1.00493419e+00f, 1.00511241e+00f, 1.00529397e+00f, 1.00547850e+00f,
+        1.00566638e+00f, 1.00585747e+00f, 1.00605166e+00f, 1.00624895e+00f, 1.00644958e+00f, 1.00665355e+00f,
+        1.00686061e+00f, 1.00707066e+00f, 1.00728416e+00f, 1.00750089e+00f, 1.00772059e+00f, 1.00794375e+00f,
+        1.00816989e+00f, 1.00839937e+00f, 1.00863218e+00f, 1.00886798e+00f, 1.00910711e+00f, 1.00934958e+00f,
+        1.00959527e+00f, 1.00984406e+00f, 1.01009619e+00f, 1.01035154e+00f, 1.01061010e+00f, 1.01087177e+00f,
+        1.01113677e+00f, 1.01140511e+00f, 1.01167667e+00f, 1.01195121e+00f, 1.01222932e+00f, 1.01251078e+00f,
+        1.01279545e+00f, 1.01308334e+00f, 1.01337433e+00f, 1.01366866e+00f, 1.01396644e+00f, 1.01426733e+00f,
+        1.01457143e+00f, 1.01487875e+00f, 1.01518977e+00f, 1.01550376e+00f, 1.01582086e+00f, 1.01614153e+00f,
+        1.01646543e+00f, 1.01679254e+00f, 1.01712322e+00f, 1.01745701e+00f, 1.01779437e+00f, 1.01813459e+00f,
+        1.01847839e+00f, 1.01882565e+00f, 1.01917613e+00f, 1.01952970e+00f, 1.01988685e+00f, 1.02024710e+00f,
+        1.02061093e+00f, 1.02097797e+00f, 1.02134836e+00f, 1.02172196e+00f, 1.02209914e+00f, 1.02247953e+00f,
+        1.02286363e+00f, 1.02325058e+00f, 1.02364135e+00f, 1.02403522e+00f, 1.02443266e+00f, 1.02483332e+00f,
+        1.02523744e+00f, 1.02564490e+00f, 1.02605569e+00f, 1.02646983e+00f, 1.02688766e+00f, 1.02730858e+00f,
+        1.02773309e+00f, 1.02816093e+00f, 1.02859223e+00f, 1.02902687e+00f, 1.02946496e+00f, 1.02990651e+00f,
+        1.03035164e+00f, 1.03079987e+00f, 1.03125167e+00f, 1.03170717e+00f, 1.03216600e+00f, 1.03262818e+00f,
+        1.03309393e+00f, 1.03356302e+00f, 1.03403568e+00f, 1.03451180e+00f, 1.03499138e+00f, 1.03547454e+00f,
+        1.03596091e+00f, 1.03645098e+00f, 1.03694451e+00f, 1.03744161e+00f, 1.03794217e+00f, 1.03844631e+00f,
+        1.03895390e+00f, 1.03946519e+00f, 1.03997970e+00f, 1.04049802e+00f, 1.04101968e+00f, 1.04154503e+00f,
+        1.04207373e+00f, 1.04260623e+00f, 1.04314220e+00f, 1.04368198e+00f, 1.04422498e+00f, 1.04477155e+00f,
+        1.04532194e+00f, 1.04587591e+00f, 1.04643333e+00f, 1.04699433e+00f, 1.04755902e+00f, 1.04812741e+00f,
+        1.04869938e+00f, 1.04927480e+00f, 1.04985392e+00f, 1.05043674e+00f, 1.05102336e+00f, 1.05161333e+00f,
+        1.05220711e+00f, 1.05280471e+00f, 1.05340564e+00f, 1.05401039e+00f, 1.05461895e+00f, 1.05523098e+00f,
+        1.05584693e+00f, 1.05646634e+00f, 1.05708957e+00f, 1.05771661e+00f, 1.05834723e+00f, 1.05898166e+00f,
+        1.05961978e+00f, 1.06026149e+00f, 1.06090724e+00f, 1.06155670e+00f, 1.06220984e+00f, 1.06286681e+00f,
+        1.06352735e+00f, 1.06419182e+00f, 1.06485999e+00f, 1.06553209e+00f, 1.06620812e+00f, 1.06688762e+00f,
+        1.06757128e+00f, 1.06825840e+00f, 1.06894958e+00f, 1.06964457e+00f, 1.07034338e+00f, 1.07104611e+00f,
+        1.07175255e+00f, 1.07246280e+00f, 1.07317722e+00f, 1.07389534e+00f, 1.07461739e+00f, 1.07534337e+00f,
+        1.07607305e+00f, 1.07680690e+00f, 1.07754469e+00f, 1.07828617e+00f, 1.07903183e+00f, 1.07978129e+00f,
+        1.08053470e+00f, 1.08129215e+00f, 1.08205354e+00f, 1.08281887e+00f, 1.08358824e+00f, 1.08436155e+00f,
+        1.08513892e+00f, 1.08592021e+00f, 1.08670568e+00f, 1.08749509e+00f, 1.08828855e+00f, 1.08908606e+00f,
+        1.08988774e+00f, 1.09069324e+00f, 1.09150279e+00f, 1.09231663e+00f, 1.09313464e+00f, 1.09395671e+00f,
+        1.09478259e+00f, 1.09561288e+00f, 1.09644711e+00f, 1.09728551e+00f, 1.09812808e+00f, 1.09897482e+00f,
+        1.09982562e+00f, 1.10068059e+00f, 1.10153985e+00f, 1.10240328e+00f, 1.10327089e+00f, 1.10414267e+00f,
+        1.10501873e+00f, 1.10589910e+00f, 1.10678375e+00f, 1.10767233e+00f, 1.10856545e+00f, 1.10946274e+00f,
+        1.11036420e+00f, 1.11127007e+00f, 1.11218023e+00f, 1.11309469e+00f, 1.11401355e+00f, 1.11493647e+00f,
+        1.11586368e+00f, 1.11679554e+00f, 1.11773169e+00f, 1.11867201e+00f, 1.11961699e+00f, 1.12056637e+00f,
+        1.12152004e+00f, 1.12247801e+00f, 1.12344050e+00f, 1.12440741e+00f, 1.12537873e+00f, 1.12635458e+00f,
+        1.12733483e+00f, 1.12831962e+00f, 1.12930870e+00f, 1.13030243e+00f, 1.13130069e+00f, 1.13230336e+00f,
+        1.13331091e+00f, 1.13432252e+00f, 1.13533902e+00f, 1.13635993e+00f, 1.13738549e+00f, 1.13841569e+00f,
+        1.13945019e+00f, 1.14048958e+00f, 1.14153361e+00f, 1.14258206e+00f, 1.14363527e+00f, 1.14469314e+00f,
+        1.14575577e+00f, 1.14682305e+00f, 1.14789474e+00f, 1.14897120e+00f, 1.15005291e+00f, 1.15113866e+00f,
+        1.15222943e+00f, 1.15332520e+00f, 1.15442562e+00f, 1.15553057e+00f, 1.15664053e+00f, 1.15775537e+00f,
+        1.15887499e+00f, 1.15999925e+00f, 1.16112840e+00f, 1.16226244e+00f, 1.16340125e+00f, 1.16454518e+00f,
+        1.16569388e+00f, 1.16684747e+00f, 1.16800606e+00f, 1.16916943e+00f, 1.17033792e+00f, 1.17151153e+00f,
+        1.17268991e+00f, 1.17387319e+00f, 1.17506146e+00f, 1.17625487e+00f, 1.17745328e+00f, 1.17865670e+00f,
+        1.17986536e+00f, 1.18107903e+00f, 1.18229759e+00f, 1.18352151e+00f, 1.18475020e+00f, 1.18598437e+00f,
+        1.18722343e+00f, 1.18846774e+00f, 1.18971729e+00f, 1.19097209e+00f, 1.19223201e+00f, 1.19349718e+00f,
+        1.19476748e+00f, 1.19604301e+00f, 1.19732392e+00f, 1.19861007e+00f, 1.19990158e+00f, 1.20119834e+00f,
+        1.20250034e+00f, 1.20380771e+00f, 1.20512056e+00f, 1.20643878e+00f, 1.20776248e+00f, 1.20909142e+00f,
+        1.21042562e+00f, 1.21176541e+00f, 1.21311092e+00f, 1.21446157e+00f, 1.21581769e+00f, 1.21717942e+00f,
+        1.21854687e+00f, 1.21991956e+00f, 1.22129786e+00f, 1.22268164e+00f, 1.22407103e+00f, 1.22546613e+00f,
+        1.22686696e+00f, 1.22827327e+00f, 1.22968554e+00f, 1.23110271e+00f, 1.23252606e+00f, 1.23395503e+00f,
+        1.23538983e+00f, 1.23683035e+00f, 1.23827648e+00f, 1.23972845e+00f, 1.24118638e+00f, 1.24264991e+00f,
+        1.24411929e+00f, 1.24559450e+00f, 1.24707568e+00f, 1.24856246e+00f, 1.25005555e+00f, 1.25155413e+00f,
+        1.25305915e+00f, 1.25456989e+00f, 1.25608647e+00f, 1.25760913e+00f, 1.25913799e+00f, 1.26067233e+00f,
+        1.26221311e+00f, 1.26375973e+00f, 1.26531255e+00f, 1.26687157e+00f, 1.26843691e+00f, 1.27000809e+00f,
+        1.27158558e+00f, 1.27316928e+00f, 1.27475893e+00f, 1.27635515e+00f, 1.27795732e+00f, 1.27956581e+00f,
+        1.28118050e+00f, 1.28280151e+00f, 1.28442907e+00f, 1.28606272e+00f, 1.28770280e+00f, 1.28934944e+00f,
+        1.29100239e+00f, 1.29266167e+00f, 1.29432750e+00f, 1.29599965e+00f, 1.29767835e+00f, 1.29936361e+00f,
+        1.30105555e+00f, 1.30275381e+00f, 1.30445862e+00f, 1.30617034e+00f, 1.30788851e+00f, 1.30961323e+00f,
+        1.31134462e+00f, 1.31308270e+00f, 1.31482756e+00f, 1.31657887e+00f, 1.31833744e+00f, 1.32010245e+00f,
+        1.32187438e+00f, 1.32365322e+00f, 1.32543874e+00f, 1.32723129e+00f, 1.32903075e+00f, 1.33083689e+00f,
+        1.33265007e+00f, 1.33447015e+00f, 1.33629692e+00f, 1.33813131e+00f, 1.33997226e+00f, 1.34182060e+00f,
+        1.34367573e+00f, 1.34553814e+00f, 1.34740758e+00f, 1.34928429e+00f, 1.35116804e+00f, 1.35305929e+00f,
+        1.35495722e+00f, 1.35686290e+00f, 1.35877538e+00f, 1.36069548e+00f, 1.36262321e+00f, 1.36455774e+00f,
+        1.36649990e+00f, 1.36844957e+00f, 1.37040651e+00f, 1.37237072e+00f, 1.37434256e+00f, 1.37632227e+00f,
+        1.37830889e+00f, 1.38030338e+00f, 1.38230562e+00f, 1.38431537e+00f, 1.38633275e+00f, 1.38835776e+00f,
+        1.39039040e+00f, 1.39243090e+00f, 1.39447939e+00f, 1.39653516e+00f, 1.39859879e+00f, 1.40067017e+00f,
+        1.40274990e+00f, 1.40483713e+00f, 1.40693247e+00f, 1.40903556e+00f, 1.41114676e+00f, 1.41326594e+00f,
+        1.41539323e+00f, 1.41752839e+00f, 1.41967165e+00f, 1.42182350e+00f, 1.42398310e+00f, 1.42615080e+00f,
+        1.42832696e+00f, 1.43051112e+00f, 1.43270350e+00f, 1.43490481e+00f, 1.43711388e+00f, 1.43933129e+00f,
+        1.44155729e+00f, 1.44379139e+00f, 1.44603431e+00f, 1.44828582e+00f, 1.45054519e+00f, 1.45281386e+00f,
+        1.45509052e+00f, 1.45737636e+00f, 1.45967031e+00f, 1.46197331e+00f, 1.46428502e+00f, 1.46660507e+00f,
+        1.46893418e+00f, 1.47127211e+00f, 1.47361887e+00f, 1.47597420e+00f, 1.47833848e+00f, 1.48071194e+00f,
+        1.48309457e+00f, 1.48548579e+00f, 1.48788631e+00f, 1.49029565e+00f, 1.49271429e+00f, 1.49514198e+00f,
+        1.49757886e+00f, 1.50002491e+00f, 1.50248051e+00f, 1.50494492e+00f, 1.50741887e+00f, 1.50990212e+00f,
+        1.51239491e+00f, 1.51489687e+00f, 1.51740837e+00f, 1.51992965e+00f, 1.52245986e+00f, 1.52500010e+00f,
+        1.52754986e+00f, 1.53010952e+00f, 1.53267825e+00f, 1.53525734e+00f, 1.53784561e+00f, 1.54044402e+00f,
+        1.54305232e+00f, 1.54567003e+00f, 1.54829800e+00f, 1.55093598e+00f, 1.55358386e+00f, 1.55624163e+00f,
+        1.55890977e+00f, 1.56158769e+00f, 1.56427574e+00f, 1.56697416e+00f, 1.56968284e+00f, 1.57240164e+00f,
+        1.57513034e+00f, 1.57787001e+00f, 1.58062005e+00f, 1.58338034e+00f, 1.58615124e+00f, 1.58893228e+00f,
+        1.59172404e+00f, 1.59452629e+00f, 1.59733951e+00f, 1.60016286e+00f, 1.60299742e+00f, 1.60584247e+00f,
+        1.60869849e+00f, 1.61156511e+00f, 1.61444283e+00f, 1.61733162e+00f, 1.62023115e+00f, 1.62314188e+00f,
+        1.62606323e+00f, 1.62899590e+00f, 1.63194001e+00f, 1.63489485e+00f, 1.63786101e+00f, 1.64083886e+00f,
+        1.64382768e+00f, 1.64682794e+00f, 1.64983964e+00f, 1.65286303e+00f, 1.65589750e+00f, 1.65894389e+00f,
+        1.66200161e+00f, 1.66507089e+00f, 1.66815209e+00f, 1.67124557e+00f, 1.67435026e+00f, 1.67746675e+00f,
+        1.68059564e+00f, 1.68373585e+00f, 1.68688846e+00f, 1.69005322e+00f, 1.69323003e+00f, 1.69641852e+00f,
+        1.69961953e+00f, 1.70283294e+00f, 1.70605803e+00f, 1.70929587e+00f, 1.71254623e+00f, 1.71580911e+00f,
+        1.71908391e+00f, 1.72237206e+00f, 1.72567236e+00f, 1.72898531e+00f, 1.73231101e+00f, 1.73564911e+00f,
+        1.73900068e+00f, 1.74236453e+00f, 1.74574220e+00f, 1.74913204e+00f, 1.75253546e+00f, 1.75595129e+00f,
+        1.75938058e+00f, 1.76282310e+00f, 1.76627910e+00f, 1.76974797e+00f, 1.77323043e+00f, 1.77672648e+00f,
+        1.78023553e+00f, 1.78375852e+00f, 1.78729546e+00f, 1.79084516e+00f, 1.79440916e+00f, 1.79798698e+00f,
+        1.80157852e+00f, 1.80518377e+00f, 1.80880284e+00f, 1.81243622e+00f, 1.81608379e+00f, 1.81974506e+00f,
+        1.82342076e+00f, 1.82711077e+00f, 1.83081532e+00f, 1.83453393e+00f, 1.83826661e+00f, 1.84201419e+00f,
+        1.84577656e+00f, 1.84955263e+00f, 1.85334396e+00f, 1.85715055e+00f, 1.86097109e+00f, 1.86480665e+00f,
+        1.86865747e+00f, 1.87252319e+00f, 1.87640429e+00f, 1.88030005e+00f, 1.88421142e+00f, 1.88813758e+00f,
+        1.89207900e+00f, 1.89603639e+00f, 1.90000892e+00f, 1.90399718e+00f, 1.90800107e+00f, 1.91202021e+00f,
+        1.91605556e+00f, 1.92010689e+00f, 1.92417359e+00f, 1.92825651e+00f, 1.93235517e+00f, 1.93646979e+00f,
+        1.94060099e+00f, 1.94474816e+00f, 1.94891191e+00f, 1.95309222e+00f, 1.95728874e+00f, 1.96150184e+00f,
+        1.96573102e+00f, 1.96997786e+00f, 1.97424042e+00f, 1.97852015e+00f, 1.98281682e+00f, 1.98713076e+00f,
+        1.99146187e+00f, 1.99580956e+00f, 2.00017476e+00f, 2.00455689e+00f, 2.00895691e+00f, 2.01337409e+00f,
+        2.01780891e+00f, 2.02226114e+00f, 2.02673054e+00f, 2.03121901e+00f, 2.03572440e+00f, 2.04024816e+00f,
+        2.04478979e+00f, 2.04934883e+00f, 2.05392671e+00f, 2.05852222e+00f, 2.06313658e+00f, 2.06776953e+00f,
+        2.07242084e+00f, 2.07709026e+00f, 2.08177876e+00f, 2.08648610e+00f, 2.09121251e+00f, 2.09595728e+00f,
+        2.10072112e+00f, 2.10550451e+00f, 2.11030650e+00f, 2.11512852e+00f, 2.11996913e+00f, 2.12482905e+00f,
+        2.12970877e+00f, 2.13460851e+00f, 2.13952756e+00f, 2.14446688e+00f, 2.14942527e+00f, 2.15440440e+00f,
+        2.15940332e+00f, 2.16442275e+00f, 2.16946173e+00f, 2.17452216e+00f, 2.17960238e+00f, 2.18470311e+00f,
+        2.18982458e+00f, 2.19496679e+00f, 2.20012999e+00f, 2.20531392e+00f, 2.21051908e+00f, 2.21574569e+00f,
+        2.22099328e+00f, 2.22626185e+00f, 2.23155236e+00f, 2.23686457e+00f, 2.24219799e+00f, 2.24755263e+00f,
+        2.25293016e+00f, 2.25832987e+00f, 2.26375079e+00f, 2.26919460e+00f, 2.27465963e+00f, 2.28014731e+00f,
+        2.28565836e+00f, 2.29119086e+00f, 2.29674697e+00f, 2.30232525e+00f, 2.30792713e+00f, 2.31355143e+00f,
+        2.31919956e+00f, 2.32487035e+00f, 2.33056450e+00f, 2.33628201e+00f, 2.34202433e+00f, 2.34778929e+00f,
+        2.35357785e+00f, 2.35939121e+00f, 2.36522770e+00f, 2.37108874e+00f, 2.37697458e+00f, 2.38288403e+00f,
+        2.38881826e+00f, 2.39477706e+00f, 2.40076065e+00f, 2.40676904e+00f, 2.41280246e+00f, 2.41886115e+00f,
+        2.42494559e+00f, 2.43105435e+00f, 2.43718910e+00f, 2.44334984e+00f, 2.44953609e+00f, 2.45574808e+00f,
+        2.46198583e+00f, 2.46824980e+00f, 2.47454047e+00f, 2.48085642e+00f, 2.48719954e+00f, 2.49356961e+00f,
+        2.49996614e+00f, 2.50638890e+00f, 2.51283979e+00f, 2.51931739e+00f, 2.52582264e+00f, 2.53235483e+00f,
+        2.53891468e+00f, 2.54550219e+00f, 2.55211806e+00f, 2.55876184e+00f, 2.56543303e+00f, 2.57213330e+00f,
+        2.57886100e+00f, 2.58561802e+00f, 2.59240341e+00f, 2.59921813e+00f, 2.60606122e+00f, 2.61293340e+00f,
+        2.61983562e+00f, 2.62676644e+00f, 2.63372684e+00f, 2.64071751e+00f, 2.64773798e+00f, 2.65478897e+00f,
+        2.66186905e+00f, 2.66898012e+00f, 2.67612100e+00f, 2.68329310e+00f, 2.69049597e+00f, 2.69772792e+00f,
+        2.70499325e+00f, 2.71228886e+00f, 2.71961665e+00f, 2.72697520e+00f, 2.73436666e+00f, 2.74178863e+00f,
+        2.74924326e+00f, 2.75673056e+00f, 2.76425052e+00f, 2.77180171e+00f, 2.77938652e+00f, 2.78700471e+00f,
+        2.79465461e+00f, 2.80233812e+00f, 2.81005549e+00f, 2.81780529e+00f, 2.82558990e+00f, 2.83340883e+00f,
+        2.84126115e+00f, 2.84914684e+00f, 2.85706806e+00f, 2.86502337e+00f, 2.87301493e+00f, 2.88103986e+00f,
+        2.88910031e+00f, 2.89719701e+00f, 2.90532851e+00f, 2.91349578e+00f, 2.92169905e+00f, 2.92993784e+00f,
+        2.93821383e+00f, 2.94652557e+00f, 2.95487428e+00f, 2.96325946e+00f, 2.97168255e+00f, 2.98014212e+00f,
+        2.98863888e+00f, 2.99717474e+00f, 3.00574684e+00f, 3.01435757e+00f, 3.02300620e+00f, 3.03169370e+00f,
+        3.04041982e+00f, 3.04918551e+00f, 3.05798960e+00f, 3.06683326e+00f, 3.07571602e+00f, 3.08463740e+00f,
+        3.09360027e+00f, 3.10260248e+00f, 3.11164641e+00f, 3.12072968e+00f, 3.12985277e+00f, 3.13901758e+00f,
+        3.14822364e+00f, 3.15747166e+00f, 3.16676092e+00f, 3.17609215e+00f, 3.18546510e+00f, 3.19488120e+00f,
+        3.20433855e+00f, 3.21383953e+00f, 3.22338343e+00f, 3.23296928e+00f, 3.24259996e+00f, 3.25227380e+00f,
+        3.26199174e+00f, 3.27175474e+00f, 3.28156209e+00f, 3.29141235e+00f, 3.30130839e+00f, 3.31124926e+00f,
+        3.32123733e+00f, 3.33126974e+00f, 3.34134674e+00f, 3.35147214e+00f, 3.36164236e+00f, 3.37186003e+00f,
+        3.38212490e+00f, 3.39243460e+00f, 3.40279484e+00f, 3.41320109e+00f, 3.42365623e+00f, 3.43415785e+00f,
+        3.44470930e+00f, 3.45530915e+00f, 3.46595883e+00f, 3.47665477e+00f, 3.48740387e+00f, 3.49820065e+00f,
+        3.50905013e+00f, 3.51994896e+00f, 3.53089619e+00f, 3.54189610e+00f, 3.55294657e+00f, 3.56404805e+00f,
+        3.57520199e+00f, 3.58640790e+00f, 3.59766698e+00f, 3.60897708e+00f, 3.62034130e+00f, 3.63175941e+00f,
+        3.64323044e+00f, 3.65475392e+00f, 3.66633391e+00f, 3.67796755e+00f, 3.68965459e+00f, 3.70139837e+00f,
+        3.71319795e+00f, 3.72505212e+00f, 3.73696160e+00f, 3.74892807e+00f, 3.76095200e+00f, 3.77303314e+00f,
+        3.78516889e+00f, 3.79736614e+00f, 3.80961919e+00f, 3.82193041e+00f, 3.83429933e+00f, 3.84672904e+00f,
+        3.85921788e+00f, 3.87176609e+00f, 3.88437557e+00f, 3.89704466e+00f, 3.90977192e+00f, 3.92256355e+00f,
+        3.93541384e+00f, 3.94832802e+00f, 3.96130180e+00f, 3.97433972e+00f, 3.98744059e+00f, 4.00060463e+00f,
+        4.01383066e+00f, 4.02712202e+00f, 4.04047728e+00f, 4.05389690e+00f, 4.06738234e+00f, 4.08093452e+00f,
+        4.09454918e+00f, 4.10823345e+00f, 4.12198067e+00f, 4.13579845e+00f, 4.14967966e+00f, 4.16363001e+00f,
+        4.17764950e+00f, 4.19173431e+00f, 4.20589161e+00f, 4.22011805e+00f, 4.23441362e+00f, 4.24877787e+00f,
+        4.26321268e+00f, 4.27772141e+00f, 4.29230022e+00f, 4.30694866e+00f, 4.32167244e+00f, 4.33646822e+00f,
+        4.35133696e+00f, 4.36627960e+00f, 4.38129473e+00f, 4.39638424e+00f, 4.41154766e+00f, 4.42678785e+00f,
+        4.44210243e+00f, 4.45749521e+00f, 4.47296429e+00f, 4.48850965e+00f, 4.50413322e+00f, 4.51983452e+00f,
+        4.53561544e+00f, 4.55147409e+00f, 4.56741333e+00f, 4.58343172e+00f, 4.59952974e+00f, 4.61570930e+00f,
+        4.63197041e+00f, 4.64831114e+00f, 4.66473722e+00f, 4.68124628e+00f, 4.69783783e+00f, 4.71451187e+00f,
+        4.73127222e+00f, 4.74811792e+00f, 4.76504803e+00f, 4.78206158e+00f, 4.79916620e+00f, 4.81635571e+00f,
+        4.83363342e+00f, 4.85099936e+00f, 4.86845064e+00f, 4.88599300e+00f, 4.90362549e+00f, 4.92134619e+00f,
+        4.93916130e+00f, 4.95706558e+00f, 4.97506142e+00f, 4.99315166e+00f, 5.01133442e+00f, 5.02961016e+00f,
+        5.04798079e+00f, 5.06644440e+00f, 5.08500671e+00f, 5.10366535e+00f, 5.12241650e+00f, 5.14126873e+00f,
+        5.16021633e+00f, 5.17926264e+00f, 5.19841051e+00f, 5.21765423e+00f, 5.23699999e+00f, 5.25644636e+00f,
+        5.27599287e+00f, 5.29564142e+00f, 5.31539297e+00f, 5.33524752e+00f, 5.35521269e+00f, 5.37527704e+00f,
+        5.39544725e+00f, 5.41572523e+00f, 5.43611002e+00f, 5.45659971e+00f, 5.47719717e+00f, 5.49790573e+00f,
+        5.51872158e+00f, 5.53964901e+00f, 5.56068659e+00f, 5.58183622e+00f, 5.60309601e+00f, 5.62447166e+00f,
+        5.64596176e+00f, 5.66756201e+00f, 5.68928003e+00f, 5.71111536e+00f, 5.73306847e+00f, 5.75513506e+00f,
+        5.77732420e+00f, 5.79963160e+00f, 5.82205486e+00f, 5.84460068e+00f, 5.86726761e+00f, 5.89005518e+00f,
+        5.91296911e+00f, 5.93600416e+00f, 5.95916605e+00f, 5.98245049e+00f, 6.00586319e+00f, 6.02940035e+00f,
+        6.05306530e+00f, 6.07686090e+00f, 6.10078526e+00f, 6.12484264e+00f, 6.14902687e+00f, 6.17334700e+00f,
+        6.19779301e+00f, 6.22238159e+00f, 6.24709988e+00f, 6.27194786e+00f, 6.29693937e+00f, 6.32206440e+00f,
+        6.34733057e+00f, 6.37273645e+00f, 6.39828539e+00f, 6.42396641e+00f, 6.44979477e+00f, 6.47577047e+00f,
+        6.50188541e+00f, 6.52814341e+00f, 6.55454588e+00f, 6.58110046e+00f, 6.60779953e+00f, 6.63464880e+00f,
+        6.66164637e+00f, 6.68879128e+00f, 6.71609259e+00f, 6.74354410e+00f, 6.77114964e+00f, 6.79890442e+00f,
+        6.82682037e+00f, 6.85489416e+00f, 6.88312578e+00f, 6.91151762e+00f, 6.94006777e+00f, 6.96877766e+00f,
+        6.99765158e+00f, 7.02668953e+00f, 7.05588913e+00f, 7.08525419e+00f, 7.11478424e+00f, 7.14448357e+00f,
+        7.17434883e+00f, 7.20439243e+00f, 7.23459959e+00f, 7.26498318e+00f, 7.29553986e+00f, 7.32627296e+00f,
+        7.35717535e+00f, 7.38826132e+00f, 7.41952610e+00f, 7.45096445e+00f, 7.48258829e+00f, 7.51439810e+00f,
+        7.54639101e+00f, 7.57856464e+00f, 7.61092567e+00f, 7.64346838e+00f, 7.67620420e+00f, 7.70913172e+00f,
+        7.74224854e+00f, 7.77555943e+00f, 7.80906248e+00f, 7.84275436e+00f, 7.87664747e+00f, 7.91074371e+00f,
+        7.94503450e+00f, 7.97952652e+00f, 8.01422596e+00f, 8.04912567e+00f, 8.08422852e+00f, 8.11954403e+00f,
+        8.15505505e+00f, 8.19077873e+00f, 8.22672367e+00f, 8.26286507e+00f, 8.29923630e+00f, 8.33581352e+00f,
+        8.37261295e+00f, 8.40962696e+00f, 8.44685268e+00f, 8.48431873e+00f, 8.52200508e+00f, 8.55991077e+00f,
+        8.59803391e+00f, 8.63640404e+00f, 8.67499161e+00f, 8.71380806e+00f, 8.75285912e+00f, 8.79214096e+00f,
+        8.83167171e+00f, 8.87143517e+00f, 8.91143417e+00f, 8.95168018e+00f, 8.99216652e+00f, 9.03289890e+00f,
+        9.07387638e+00f, 9.11509705e+00f, 9.15658665e+00f, 9.19831657e+00f, 9.24030590e+00f, 9.28255463e+00f,
+        9.32504082e+00f, 9.36780739e+00f, 9.41081905e+00f, 9.45410061e+00f, 9.49764252e+00f, 9.54146194e+00f,
+        9.58553886e+00f, 9.62989712e+00f, 9.67452145e+00f, 9.71943378e+00f, 9.76461506e+00f, 9.81008053e+00f,
+        9.85582542e+00f, 9.90185928e+00f, 9.94816017e+00f, 9.99476528e+00f, 1.00416555e+01f, 1.00888472e+01f,
+        1.01363173e+01f, 1.01840820e+01f, 1.02321539e+01f, 1.02805328e+01f, 1.03291988e+01f, 1.03781977e+01f,
+        1.04274817e+01f, 1.04770851e+01f, 1.05269842e+01f, 1.05772314e+01f, 1.06277714e+01f, 1.06786327e+01f,
+        1.07298212e+01f, 1.07813540e+01f, 1.08331852e+01f, 1.08853674e+01f, 1.09378538e+01f, 1.09906874e+01f,
+        1.10438623e+01f, 1.10973721e+01f, 1.11512260e+01f, 1.12054348e+01f, 1.12599716e+01f, 1.13148737e+01f,
+        1.13701220e+01f, 1.14257278e+01f, 1.14816990e+01f, 1.15380201e+01f, 1.15947037e+01f, 1.16517897e+01f,
+        1.17092056e+01f, 1.17670116e+01f, 1.18251848e+01f, 1.18837175e+01f, 1.19426661e+01f, 1.20019608e+01f,
+        1.20616894e+01f, 1.21217899e+01f, 1.21822739e+01f, 1.22431440e+01f, 1.23044395e+01f, 1.23661184e+01f,
+        1.24282265e+01f, 1.24907017e+01f, 1.25536404e+01f, 1.26169786e+01f, 1.26807194e+01f, 1.27449064e+01f,
+        1.28094940e+01f, 1.28745155e+01f, 1.29399786e+01f, 1.30058556e+01f, 1.30721893e+01f, 1.31389799e+01f,
+        1.32061958e+01f, 1.32738657e+01f, 1.33419762e+01f, 1.34105740e+01f, 1.34796219e+01f, 1.35491304e+01f,
+        1.36191235e+01f, 1.36895723e+01f, 1.37604818e+01f, 1.38318968e+01f, 1.39037733e+01f, 1.39761333e+01f,
+        1.40490093e+01f, 1.41223764e+01f, 1.41962204e+01f, 1.42705812e+01f, 1.43454704e+01f, 1.44208803e+01f,
+        1.44967642e+01f, 1.45731745e+01f, 1.46501131e+01f, 1.47275934e+01f, 1.48056068e+01f, 1.48841696e+01f,
+        1.49632177e+01f, 1.50428400e+01f, 1.51230259e+01f, 1.52037563e+01f, 1.52850533e+01f, 1.53669205e+01f,
+        1.54493380e+01f, 1.55323486e+01f, 1.56159372e+01f, 1.57000914e+01f, 1.57848301e+01f, 1.58701925e+01f,
+        1.59561481e+01f, 1.60427036e+01f, 1.61298599e+01f, 1.62176533e+01f, 1.63060493e+01f, 1.63950748e+01f,
+        1.64846973e+01f, 1.65749588e+01f, 1.66658955e+01f, 1.67574673e+01f, 1.68497124e+01f, 1.69425545e+01f,
+        1.70360851e+01f, 1.71302814e+01f, 1.72251587e+01f, 1.73207169e+01f, 1.74169846e+01f, 1.75139084e+01f,
+        1.76115456e+01f, 1.77098770e+01f, 1.78088894e+01f, 1.79086514e+01f, 1.80091171e+01f, 1.81103172e+01f,
+        1.82122307e+01f, 1.83148899e+01f, 1.84182758e+01f, 1.85224438e+01f, 1.86274090e+01f, 1.87330799e+01f,
+        1.88395538e+01f, 1.89467888e+01f, 1.90548267e+01f, 1.91636715e+01f, 1.92733021e+01f, 1.93837852e+01f,
+        1.94949856e+01f, 1.96070919e+01f, 1.97199612e+01f, 1.98337116e+01f, 1.99482651e+01f, 2.00636845e+01f,
+        2.01799278e+01f, 2.02970715e+01f, 2.04151039e+01f, 2.05339870e+01f, 2.06537781e+01f, 2.07744598e+01f,
+        2.08960743e+01f, 2.10185852e+01f, 2.11420460e+01f, 2.12663975e+01f, 2.13916550e+01f, 2.15179482e+01f,
+        2.16451168e+01f, 2.17732239e+01f, 2.19023609e+01f, 2.20324287e+01f, 2.21634846e+01f, 2.22956161e+01f,
+        2.24287434e+01f, 2.25628109e+01f, 2.26980209e+01f, 2.28342171e+01f, 2.29714413e+01f, 2.31097069e+01f,
+        2.32490273e+01f, 2.33895016e+01f, 2.35310249e+01f, 2.36736355e+01f, 2.38173447e+01f, 2.39620762e+01f,
+        2.41080494e+01f, 2.42551193e+01f, 2.44033451e+01f, 2.45526752e+01f, 2.47031765e+01f, 2.48548946e+01f,
+        2.50078316e+01f, 2.51619053e+01f, 2.53172894e+01f, 2.54737434e+01f, 2.56315289e+01f, 2.57905807e+01f,
+        2.59508553e+01f, 2.61124001e+01f, 2.62751770e+01f, 2.64393272e+01f, 2.66046448e+01f, 2.67713966e+01f,
+        2.69394455e+01f, 2.71088600e+01f, 2.72796631e+01f, 2.74517326e+01f, 2.76252289e+01f, 2.78001022e+01f,
+        2.79764614e+01f, 2.81541233e+01f, 2.83332748e+01f, 2.85139446e+01f, 2.86960659e+01f, 2.88796997e+01f,
+        2.90646610e+01f, 2.92512035e+01f, 2.94392643e+01f, 2.96288147e+01f, 2.98199387e+01f, 3.00127010e+01f,
+        3.02070122e+01f, 3.04028091e+01f, 3.06003056e+01f, 3.07995148e+01f, 3.10001907e+01f, 3.12025909e+01f,
+        3.14067268e+01f, 3.16125813e+01f, 3.18200226e+01f, 3.20292473e+01f, 3.22402077e+01f, 3.24528351e+01f,
+        3.26673355e+01f, 3.28835869e+01f, 3.31017036e+01f, 3.33216934e+01f, 3.35434875e+01f, 3.37671432e+01f,
+        3.39926033e+01f, 3.42200775e+01f, 3.44494324e+01f, 3.46807365e+01f, 3.49140511e+01f, 3.51492767e+01f,
+        3.53865013e+01f, 3.56257362e+01f, 3.58670502e+01f, 3.61102562e+01f, 3.63558960e+01f, 3.66032677e+01f,
+        3.68529549e+01f, 3.71046753e+01f, 3.73588562e+01f, 3.76149712e+01f, 3.78733711e+01f, 3.81338120e+01f,
+        3.83968925e+01f, 3.86619606e+01f, 3.89296951e+01f, 3.91995735e+01f, 3.94716415e+01f, 3.97463493e+01f,
+        4.00229378e+01f, 4.03024635e+01f, 4.05843506e+01f, 4.08686104e+01f, 4.11553726e+01f, 4.14447823e+01f,
+        4.17367401e+01f, 4.20313263e+01f, 4.23283195e+01f, 4.26280251e+01f, 4.29305725e+01f, 4.32357407e+01f,
+        4.35434685e+01f, 4.38541565e+01f, 4.41674461e+01f, 4.44838333e+01f, 4.48027496e+01f, 4.51244087e+01f,
+        4.54492798e+01f, 4.57772026e+01f, 4.61076965e+01f, 4.64417458e+01f, 4.67785454e+01f, 4.71183243e+01f,
+        4.74610596e+01f, 4.78072739e+01f, 4.81563644e+01f, 4.85086746e+01f, 4.88644180e+01f, 4.92235413e+01f,
+        4.95855408e+01f, 4.99510155e+01f, 5.03198090e+01f, 5.06921501e+01f, 5.10681190e+01f, 5.14474449e+01f,
+        5.18304214e+01f, 5.22165375e+01f, 5.26065826e+01f, 5.30000992e+01f, 5.33973961e+01f, 5.37985077e+01f,
+        5.42032356e+01f, 5.46120224e+01f, 5.50242577e+01f, 5.54411774e+01f, 5.58613625e+01f, 5.62860718e+01f,
+        5.67138405e+01f, 5.71460190e+01f, 5.75829201e+01f, 5.80232124e+01f, 5.84682503e+01f, 5.89175491e+01f,
+        5.93707886e+01f, 5.98285637e+01f, 6.02909317e+01f, 6.07576408e+01f, 6.12288704e+01f, 6.17041359e+01f,
+        6.21846924e+01f, 6.26698265e+01f, 6.31594124e+01f, 6.36541328e+01f, 6.41530685e+01f, 6.46574707e+01f,
+        6.51665878e+01f, 6.56804352e+01f, 6.61992264e+01f, 6.67240677e+01f, 6.72534332e+01f, 6.77881622e+01f,
+        6.83280258e+01f, 6.88733597e+01f, 6.94245834e+01f, 6.99801331e+01f, 7.05423737e+01f, 7.11100998e+01f,
+        7.16831589e+01f, 7.22623138e+01f, 7.28468933e+01f, 7.34373627e+01f, 7.40337830e+01f, 7.46368713e+01f,
+        7.52444611e+01f, 7.58595123e+01f, 7.64810944e+01f, 7.71084518e+01f, 7.77423477e+01f, 7.83827286e+01f,
+        7.90297623e+01f, 7.96831512e+01f, 8.03435974e+01f, 8.10111618e+01f, 8.16843491e+01f, 8.23650436e+01f,
+        8.30522385e+01f, 8.37473679e+01f, 8.44496994e+01f, 8.51590118e+01f, 8.58753662e+01f, 8.66002884e+01f,
+        8.73322449e+01f, 8.80725250e+01f, 8.88199768e+01f, 8.95755920e+01f, 9.03386612e+01f, 9.11102219e+01f,
+        9.18892059e+01f, 9.26773605e+01f, 9.34739380e+01f, 9.42784958e+01f, 9.50912781e+01f, 9.59134369e+01f,
+        9.67443695e+01f, 9.75831833e+01f, 9.84328308e+01f, 9.92901535e+01f, 1.00157356e+02f, 1.01033348e+02f,
+        1.01920258e+02f, 1.02815735e+02f, 1.03721306e+02f, 1.04637321e+02f, 1.05561691e+02f, 1.06498024e+02f,
+        1.07442627e+02f, 1.08398300e+02f, 1.09363747e+02f, 1.10341721e+02f, 1.11328468e+02f, 1.12327759e+02f,
+        1.13337242e+02f, 1.14358269e+02f, 1.15390724e+02f, 1.16435257e+02f, 1.17489807e+02f, 1.18558044e+02f,
+        1.19638214e+02f, 1.20728981e+02f, 1.21834503e+02f, 1.22952049e+02f, 1.24078972e+02f, 1.25223297e+02f,
+        1.26377190e+02f, 1.27546097e+02f, 1.28726929e+02f, 1.29922455e+02f, 1.31129120e+02f, 1.32351440e+02f,
+        1.33589676e+02f, 1.34839005e+02f, 1.36104568e+02f, 1.37385483e+02f, 1.38680405e+02f, 1.39991028e+02f,
+        1.41316727e+02f, 1.42657272e+02f, 1.44011108e+02f, 1.45384598e+02f, 1.46770844e+02f, 1.48175049e+02f,
+        1.49597473e+02f, 1.51032990e+02f, 1.52489365e+02f, 1.53960922e+02f, 1.55451553e+02f, 1.56956635e+02f,
+        1.58483170e+02f, 1.60028488e+02f, 1.61589706e+02f, 1.63173218e+02f, 1.64774048e+02f, 1.66393387e+02f,
+        1.68032516e+02f, 1.69693985e+02f, 1.71371109e+02f, 1.73068634e+02f, 1.74790390e+02f, 1.76531891e+02f,
+        1.78292023e+02f, 1.80077286e+02f, 1.81884201e+02f, 1.83710312e+02f, 1.85565247e+02f, 1.87437073e+02f,
+        1.89334229e+02f, 1.91254166e+02f, 1.93198624e+02f, 1.95167892e+02f, 1.97163803e+02f, 1.99183594e+02f,
+        2.01225906e+02f, 2.03295746e+02f, 2.05391846e+02f, 2.07514465e+02f, 2.09662231e+02f, 2.11842438e+02f,
+        2.14046585e+02f, 2.16276642e+02f, 2.18534668e+02f, 2.20830658e+02f, 2.23153625e+02f, 2.25499695e+02f,
+        2.27883255e+02f, 2.30294540e+02f, 2.32742325e+02f, 2.35218521e+02f, 2.37725510e+02f, 2.40258972e+02f,
+        2.42832947e+02f, 2.45438736e+02f, 2.48079025e+02f, 2.50751755e+02f, 2.53469925e+02f, 2.56205933e+02f,
+        2.58990967e+02f, 2.61823608e+02f, 2.64671570e+02f, 2.67573608e+02f, 2.70507996e+02f, 2.73483673e+02f,
+        2.76501251e+02f, 2.79555084e+02f, 2.82648529e+02f, 2.85782043e+02f, 2.88975800e+02f, 2.92197632e+02f,
+        2.95467834e+02f, 2.98783691e+02f, 3.02145752e+02f, 3.05550964e+02f, 3.08999634e+02f, 3.12503754e+02f,
+        3.16056488e+02f, 3.19654388e+02f, 3.23306061e+02f, 3.27016632e+02f, 3.30761139e+02f, 3.34570190e+02f,
+        3.38422455e+02f, 3.42336487e+02f, 3.46308746e+02f, 3.50325500e+02f, 3.54411591e+02f, 3.58548096e+02f,
+        3.62750916e+02f, 3.67015961e+02f, 3.71322205e+02f, 3.75702606e+02f, 3.80158936e+02f, 3.84657501e+02f,
+        3.89233734e+02f, 3.93895447e+02f, 3.98588104e+02f, 4.03380951e+02f, 4.08204376e+02f, 4.13131012e+02f,
+        4.18101532e+02f, 4.23171783e+02f, 4.28315430e+02f, 4.33533417e+02f, 4.38834167e+02f, 4.44211182e+02f,
+        4.49673431e+02f, 4.55189301e+02f, 4.60816833e+02f, 4.66516083e+02f, 4.72295959e+02f, 4.78175415e+02f,
+        4.84156555e+02f, 4.90212708e+02f, 4.96363617e+02f, 5.02590485e+02f, 5.08944611e+02f, 5.15366516e+02f,
+        5.21898376e+02f, 5.28542480e+02f, 5.35289551e+02f, 5.42152649e+02f, 5.49062195e+02f, 5.56150146e+02f,
+        5.63297363e+02f, 5.70565979e+02f, 5.78011353e+02f, 5.85517273e+02f, 5.93164795e+02f, 6.00914246e+02f,
+        6.08809937e+02f, 6.16825073e+02f, 6.24960938e+02f, 6.33170837e+02f, 6.41599365e+02f, 6.50154480e+02f,
+        6.58820007e+02f, 6.67648865e+02f, 6.76553650e+02f, 6.85699280e+02f, 6.94961182e+02f, 7.04338623e+02f,
+        7.13891541e+02f, 7.23707153e+02f, 7.33561096e+02f, 7.43621155e+02f, 7.53825439e+02f, 7.64151184e+02f,
+        7.74716064e+02f, 7.85356384e+02f, 7.96368774e+02f, 8.07512817e+02f, 8.18760071e+02f, 8.30215393e+02f,
+        8.41911316e+02f, 8.53825623e+02f, 8.65962646e+02f, 8.78112427e+02f, 8.90765747e+02f, 9.03464417e+02f,
+        9.16396912e+02f, 9.29567627e+02f, 9.42981079e+02f, 9.56641724e+02f, 9.70479431e+02f, 9.84530579e+02f,
+        9.98875610e+02f, 1.01352228e+03f, 1.02839478e+03f, 1.04358032e+03f, 1.05890906e+03f, 1.07460291e+03f,
+        1.09057996e+03f, 1.10679565e+03f, 1.12350085e+03f, 1.14035620e+03f, 1.15756506e+03f, 1.17524658e+03f,
+        1.19274097e+03f, 1.21088062e+03f, 1.22946045e+03f, 1.24824756e+03f, 1.26729858e+03f, 1.28700586e+03f,
+        1.30686047e+03f, 1.32712720e+03f, 1.34781580e+03f, 1.36871277e+03f, 1.39019116e+03f, 1.41203711e+03f,
+        1.43441724e+03f, 1.45718042e+03f, 1.48006824e+03f, 1.50341675e+03f, 1.52732825e+03f, 1.55191687e+03f,
+        1.57701367e+03f, 1.60262939e+03f, 1.62845825e+03f, 1.65491528e+03f, 1.68190918e+03f, 1.70933337e+03f,
+        1.73742676e+03f, 1.76608716e+03f, 1.79506836e+03f, 1.82528137e+03f, 1.85543359e+03f, 1.88659839e+03f,
+        1.91824329e+03f, 1.95051392e+03f, 1.98326331e+03f, 2.01680786e+03f, 2.05150684e+03f, 2.08586279e+03f,
+        2.12192603e+03f, 2.15814697e+03f, 2.19543433e+03f, 2.23363623e+03f, 2.27257495e+03f, 2.31204541e+03f,
+        2.35269116e+03f, 2.39365234e+03f, 2.43653662e+03f, 2.47976318e+03f, 2.52353833e+03f, 2.56836230e+03f,
+        2.61317822e+03f, 2.66042920e+03f, 2.70883691e+03f, 2.75752734e+03f, 2.80768628e+03f, 2.85840454e+03f,
+        2.91132593e+03f, 2.96379761e+03f, 3.01783350e+03f, 3.07387646e+03f, 3.13243018e+03f, 3.19001880e+03f,
+        3.25186499e+03f, 3.31266333e+03f, 3.37396777e+03f, 3.43899365e+03f, 3.50510962e+03f, 3.57077441e+03f,
+        3.63894653e+03f, 3.70922583e+03f, 3.78056763e+03f, 3.85352710e+03f, 3.92997168e+03f, 4.00504272e+03f,
+        4.08436328e+03f, 4.16550928e+03f, 4.24851025e+03f, 4.33488574e+03f, 4.42095898e+03f, 4.50971094e+03f,
+        4.59789453e+03f, 4.69396973e+03f, 4.78593848e+03f, 4.88537402e+03f, 4.98310107e+03f, 5.08481787e+03f,
+        5.18970264e+03f, 5.30012158e+03f, 5.40952002e+03f, 5.51989404e+03f, 5.63612842e+03f, 5.75868115e+03f,
+        5.87705615e+03f, 6.00756396e+03f, 6.13501025e+03f, 6.26798145e+03f, 6.40032520e+03f, 6.54347949e+03f,
+        6.68074268e+03f, 6.82759229e+03f, 6.97910645e+03f, 7.13142822e+03f, 7.28843506e+03f, 7.45251074e+03f,
+        7.61952686e+03f, 7.78937402e+03f, 7.96696582e+03f, 8.14229102e+03f, 8.32826172e+03f, 8.51715527e+03f,
+        8.71481738e+03f, 8.92187207e+03f, 9.12574512e+03f, 9.33222461e+03f, 9.54102344e+03f, 9.77074805e+03f,
+        9.99987207e+03f, 1.02441689e+04f, 1.04831992e+04f, 1.07336514e+04f, 1.10011709e+04f, 1.12621660e+04f,
+        1.15411367e+04f, 1.18287148e+04f, 1.21193047e+04f, 1.24184004e+04f, 1.27197568e+04f, 1.30361025e+04f,
+        1.33756934e+04f, 1.37409492e+04f, 1.40635430e+04f, 1.44264209e+04f, 1.47737383e+04f, 1.51838730e+04f,
+        1.55691064e+04f, 1.59845469e+04f, 1.63799990e+04f, 1.67731191e+04f, 1.72562949e+04f, 1.77430723e+04f,
+        1.81789590e+04f, 1.86506133e+04f, 1.92058613e+04f, 1.97330801e+04f, 2.02573887e+04f, 2.08620879e+04f,
+        2.14124922e+04f, 2.19927266e+04f, 2.25849902e+04f, 2.32314648e+04f, 2.38480371e+04f, 2.45940156e+04f,
+        2.52353848e+04f, 2.59914023e+04f, 2.67087891e+04f, 2.74969160e+04f, 2.83969277e+04f, 2.91875605e+04f,
+        3.00593535e+04f, 3.10230293e+04f, 3.19285254e+04f, 3.28884688e+04f, 3.37713789e+04f, 3.47030039e+04f,
+        3.59938164e+04f, 3.69451953e+04f, 3.81207227e+04f, 3.93119961e+04f, 4.07114531e+04f, 4.20730430e+04f,
+        4.32296875e+04f, 4.45304062e+04f, 4.61645469e+04f, 4.74710898e+04f, 4.92361602e+04f, 5.08276289e+04f,
+        5.25254219e+04f, 5.44581797e+04f, 5.59103984e+04f, 5.78383438e+04f, 5.99039961e+04f, 6.19696484e+04f,
+        6.40195391e+04f, 6.63843750e+04f, 6.85549766e+04f, 7.14763594e+04f, 7.35663125e+04f, 7.64731875e+04f,
+        7.91184844e+04f, 8.16872656e+04f, 8.52870469e+04f, 8.95362266e+04f, 9.21599922e+04f, 9.56641797e+04f,
+        9.78975781e+04f, 1.01450312e+05f, 1.06158984e+05f, 1.09389906e+05f, 1.12823664e+05f, 1.18677727e+05f,
+        1.23331758e+05f, 1.29689062e+05f, 1.33119984e+05f, 1.39775984e+05f, 1.42952719e+05f, 1.48873828e+05f,
+        1.56271297e+05f, 1.65524203e+05f, 1.72326562e+05f, 1.78437422e+05f, 1.84997641e+05f, 1.95036250e+05f,
+        2.02900625e+05f, 2.13217609e+05f, 2.22652016e+05f, 2.28724344e+05f, 2.39615984e+05f, 2.51596781e+05f,
+        2.59378125e+05f, 2.79551969e+05f, 2.92554406e+05f, 3.03128656e+05f, 3.22559969e+05f, 3.44653125e+05f,
+        3.59423969e+05f, 3.81207219e+05f, 3.87071969e+05f, 4.05801250e+05f, 4.33787531e+05f, 4.41397875e+05f,
+        4.57448688e+05f, 5.03193562e+05f, 5.13462781e+05f, 5.59103938e+05f, 5.85108812e+05f, 6.13650688e+05f,
+        6.45119938e+05f, 6.28991938e+05f, 6.98879938e+05f, 7.62414438e+05f, 7.86239938e+05f, 8.38656000e+05f,
+        7.86239938e+05f, 9.67679875e+05f, 0.00000000e+00f, 0.00000000e+00f, 9.67679875e+05f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+        0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 9.67679875e+05f, 8.98559938e+05f, 9.67679875e+05f,
+        8.38656000e+05f, 7.86239938e+05f, 7.18847938e+05f, 6.45119938e+05f, 6.45119938e+05f, 6.28991938e+05f,
+        5.59103938e+05f, 5.46949500e+05f, 5.24159969e+05f, 5.13462781e+05f, 4.65919969e+05f, 4.49279969e+05f,
+        4.26435219e+05f, 4.12453719e+05f, 3.87071969e+05f, 3.75517594e+05f, 3.49439969e+05f, 3.39995656e+05f,
+        3.10613312e+05f, 3.06825344e+05f, 2.92554406e+05f, 2.73474750e+05f, 2.62079984e+05f, 2.49105703e+05f,
+        2.39615984e+05f, 2.32959984e+05f, 2.20698938e+05f, 2.09664000e+05f, 2.02900625e+05f, 1.93535984e+05f,
+        1.89170516e+05f, 1.82316500e+05f, 1.69997828e+05f, 1.65524203e+05f, 1.57247984e+05f, 1.49759984e+05f,
+        1.44595859e+05f, 1.38239984e+05f, 1.32419359e+05f, 1.27069086e+05f, 1.23331758e+05f, 1.19240172e+05f,
+        1.13331891e+05f, 1.09867586e+05f, 1.06158984e+05f, 1.01450312e+05f, 9.82799922e+04f, 9.49421797e+04f,
+        9.14897422e+04f, 8.82795703e+04f, 8.49989141e+04f, 8.19533516e+04f, 7.93680703e+04f, 7.62414453e+04f,
+        7.37820469e+04f, 7.10725391e+04f, 6.87422891e+04f, 6.63843750e+04f, 6.41828477e+04f, 6.21226641e+04f,
+        5.99039961e+04f, 5.77056836e+04f, 5.61599961e+04f, 5.43405586e+04f, 5.26353086e+04f, 5.09305234e+04f,
+        4.91399961e+04f, 4.76509023e+04f, 4.61645469e+04f, 4.44517266e+04f, 4.33040938e+04f, 4.19327969e+04f,
+        4.07114531e+04f, 3.94352344e+04f, 3.82947930e+04f, 3.69995273e+04f, 3.60453867e+04f, 3.47990000e+04f,
+        3.38167734e+04f, 3.28455312e+04f, 3.18880586e+04f, 3.09467148e+04f, 2.99876973e+04f, 2.91875605e+04f,
+        2.83649141e+04f, 2.74668965e+04f, 2.67371719e+04f, 2.59378125e+04f, 2.52607207e+04f, 2.45699980e+04f,
+        2.38480371e+04f, 2.31886445e+04f, 2.25647344e+04f, 2.19160957e+04f, 2.13942832e+04f, 2.08275469e+04f,
+        2.02573887e+04f, 1.97330801e+04f, 1.91619785e+04f, 1.86783066e+04f, 1.81921035e+04f, 1.77180840e+04f,
+        1.72681387e+04f, 1.68179668e+04f, 1.63799990e+04f, 1.59845469e+04f, 1.55691064e+04f, 1.51747148e+04f,
+        1.47824199e+04f, 1.44098965e+04f, 1.40714092e+04f, 1.37334482e+04f, 1.33756934e+04f, 1.30496250e+04f,
+        1.27197568e+04f, 1.24245322e+04f, 1.21251455e+04f, 1.18231572e+04f, 1.15464336e+04f, 1.12722568e+04f,
+        1.10059834e+04f, 1.07519990e+04f, 1.04963193e+04f, 1.02566973e+04f, 1.00118096e+04f, 9.78595020e+03f,
+        9.55914844e+03f, 9.34609082e+03f, 9.12905566e+03f, 8.92503711e+03f, 8.71783691e+03f, 8.52581445e+03f,
+        8.33101855e+03f, 8.14492627e+03f, 7.96696582e+03f, 7.78937402e+03f, 7.61952686e+03f, 7.45471973e+03f,
+        7.29266064e+03f, 7.13345020e+03f, 6.98104248e+03f, 6.82944580e+03f, 6.68429297e+03f, 6.54347949e+03f,
+        6.40358301e+03f, 6.26954346e+03f, 6.13351465e+03f, 6.00756396e+03f, 5.88255273e+03f, 5.76131885e+03f,
+        5.63865479e+03f, 5.52110547e+03f, 5.41068311e+03f, 5.29900586e+03f, 5.19184424e+03f, 5.08584570e+03f,
+        4.98408838e+03f, 4.88347803e+03f, 4.78775977e+03f, 4.69309424e+03f, 4.59873486e+03f, 4.50971094e+03f,
+        4.42018262e+03f, 4.33339258e+03f, 4.24922803e+03f, 4.16550928e+03f, 4.08436328e+03f, 4.00631812e+03f,
+        3.92997168e+03f, 3.85352710e+03f, 3.78113599e+03f, 3.70922583e+03f, 3.63947314e+03f, 3.57077441e+03f,
+        3.50364526e+03f, 3.43899365e+03f, 3.37487305e+03f, 3.31266333e+03f, 3.25144458e+03f, 3.19163745e+03f,
+        3.13321021e+03f, 3.07537915e+03f, 3.01964453e+03f, 2.96484546e+03f, 2.91132593e+03f, 2.85937915e+03f,
+        2.80799976e+03f, 2.75813184e+03f, 2.70912866e+03f, 2.66127344e+03f, 2.61453589e+03f, 2.56862451e+03f,
+        2.52353833e+03f, 2.48000781e+03f, 2.43630078e+03f, 2.39433569e+03f, 2.35269116e+03f, 2.31225781e+03f,
+        2.27278027e+03f, 2.23343799e+03f, 2.19581763e+03f, 2.15851733e+03f, 2.12210522e+03f, 2.08638184e+03f,
+        2.05133936e+03f, 2.01713135e+03f, 1.98341968e+03f, 1.95051392e+03f, 1.91853564e+03f, 1.88688147e+03f,
+        1.85543359e+03f, 1.82541382e+03f, 1.79545264e+03f, 1.76608716e+03f, 1.73754688e+03f, 1.70968176e+03f,
+        1.68202161e+03f, 1.65491528e+03f, 1.62845825e+03f, 1.60252722e+03f, 1.57711255e+03f, 1.55220422e+03f,
+        1.52788477e+03f, 1.50368628e+03f, 1.48032935e+03f, 1.45709607e+03f, 1.43449902e+03f, 1.41235413e+03f,
+        1.39026782e+03f, 1.36871277e+03f, 1.34781580e+03f, 1.32712720e+03f, 1.30692834e+03f, 1.28700586e+03f,
+        1.26748999e+03f, 1.24837146e+03f, 1.22946045e+03f, 1.21088062e+03f, 1.19296716e+03f, 1.17508179e+03f,
+        1.15761841e+03f, 1.14040784e+03f, 1.12360120e+03f, 1.10703918e+03f, 1.09076904e+03f, 1.07474060e+03f,
+        1.05904272e+03f, 1.04362366e+03f, 1.02843677e+03f, 1.01364484e+03f, 9.98954956e+02f, 9.84646118e+02f,
+        9.70516785e+02f, 9.56641724e+02f, 9.43087097e+02f, 9.29670654e+02f, 9.16463684e+02f, 9.03496887e+02f,
+        8.90765747e+02f, 8.78265686e+02f, 8.66022278e+02f, 8.53883545e+02f, 8.41911316e+02f, 8.30297607e+02f,
+        8.18840027e+02f, 8.07564697e+02f, 7.96419189e+02f, 7.85454468e+02f, 7.74763794e+02f, 7.64197632e+02f,
+        7.53848022e+02f, 7.43599121e+02f, 7.33561096e+02f, 7.23707153e+02f, 7.13871216e+02f, 7.04397766e+02f,
+        6.94999573e+02f, 6.85736694e+02f, 6.76608215e+02f, 6.67648865e+02f, 6.58854553e+02f, 6.50154480e+02f,
+        6.41615723e+02f, 6.33234619e+02f, 6.24960938e+02f, 6.16825073e+02f, 6.08795166e+02f, 6.00942932e+02f,
+        5.93164795e+02f, 5.85544556e+02f, 5.78024658e+02f, 5.70591858e+02f, 5.63309998e+02f, 5.56125549e+02f,
+        5.49074219e+02f, 5.42129272e+02f, 5.35300903e+02f, 5.28575745e+02f, 5.21930847e+02f, 5.15377075e+02f,
+        5.08934357e+02f, 5.02600464e+02f, 4.96353790e+02f, 4.90203186e+02f, 4.84147217e+02f, 4.78157257e+02f,
+        4.72287079e+02f, 4.66507416e+02f, 4.60816833e+02f, 4.55197540e+02f, 4.49673431e+02f, 4.44211182e+02f,
+        4.38841766e+02f, 4.33548370e+02f, 4.28315430e+02f, 4.23193146e+02f, 4.18115417e+02f, 4.13124207e+02f,
+        4.08224274e+02f, 4.03374512e+02f, 3.98588104e+02f, 3.93889282e+02f, 3.89245758e+02f, 3.84663361e+02f,
+        3.80153198e+02f, 3.75708221e+02f, 3.71327698e+02f, 3.66999908e+02f, 3.62740448e+02f, 3.58553223e+02f,
+        3.54416565e+02f, 3.50335297e+02f, 3.46303986e+02f, 3.42322510e+02f, 3.38417877e+02f, 3.34552399e+02f,
+        3.30748108e+02f, 3.27003876e+02f, 3.23293610e+02f, 3.19646301e+02f, 3.16060486e+02f, 3.12499878e+02f,
+        3.08999634e+02f, 3.05547272e+02f, 3.02142120e+02f, 2.98783691e+02f, 2.95464355e+02f, 2.92190857e+02f,
+        2.88969147e+02f, 2.85782043e+02f, 2.82654907e+02f, 2.79555084e+02f, 2.76501251e+02f, 2.73489624e+02f,
+        2.70510895e+02f, 2.67579285e+02f, 2.64679901e+02f, 2.61820892e+02f, 2.58996307e+02f, 2.56218964e+02f,
+        2.53469925e+02f, 2.50756729e+02f, 2.48086365e+02f, 2.45445923e+02f, 2.42835281e+02f, 2.40258972e+02f,
+        2.37721008e+02f, 2.35216324e+02f, 2.32740189e+02f, 2.30294540e+02f, 2.27879120e+02f, 2.25501724e+02f,
+        2.23151627e+02f, 2.20838409e+02f, 2.18540375e+02f, 2.16282211e+02f, 2.14046585e+02f, 2.11845993e+02f,
+        2.09667465e+02f, 2.07517899e+02f, 2.05393509e+02f, 2.03299026e+02f, 2.01229126e+02f, 1.99183594e+02f,
+        1.97166901e+02f, 1.95170914e+02f, 1.93201599e+02f, 1.91258545e+02f, 1.89337082e+02f, 1.87434280e+02f,
+        1.85563873e+02f, 1.83711655e+02f, 1.81882889e+02f, 1.80077286e+02f, 1.78292023e+02f, 1.76530640e+02f,
+        1.74791595e+02f, 1.73069809e+02f, 1.71371109e+02f, 1.69691696e+02f, 1.68031403e+02f, 1.66392288e+02f,
+        1.64769714e+02f, 1.63171112e+02f, 1.61590729e+02f, 1.60027466e+02f, 1.58484161e+02f, 1.56959564e+02f,
+        1.55451553e+02f, 1.53961868e+02f, 1.52491211e+02f, 1.51035248e+02f, 1.49595703e+02f, 1.48175476e+02f,
+        1.46771698e+02f, 1.45384186e+02f, 1.44011108e+02f, 1.42655655e+02f, 1.41313965e+02f, 1.39990250e+02f,
+        1.38679657e+02f, 1.37385483e+02f, 1.36104202e+02f, 1.34840088e+02f, 1.33589676e+02f, 1.32352478e+02f,
+        1.31130829e+02f, 1.29922455e+02f, 1.28727249e+02f, 1.27545761e+02f, 1.26378784e+02f, 1.25222687e+02f,
+        1.24080811e+02f, 1.22951454e+02f, 1.21834801e+02f, 1.20730721e+02f, 1.19639641e+02f, 1.18558884e+02f,
+        1.17491455e+02f, 1.16435524e+02f, 1.15391518e+02f, 1.14359047e+02f, 1.13338272e+02f, 1.12328766e+02f,
+        1.11328964e+02f, 1.10341721e+02f, 1.09365654e+02f, 1.08398064e+02f, 1.07441933e+02f, 1.06496674e+02f,
+        1.05560806e+02f, 1.04636238e+02f, 1.03720024e+02f, 1.02815941e+02f, 1.01919640e+02f, 1.01033760e+02f,
+        1.00157356e+02f, 9.92901535e+01f, 9.84324493e+01f, 9.75843201e+01f, 9.67436142e+01f, 9.59128876e+01f,
+        9.50909195e+01f, 9.42777939e+01f, 9.34732437e+01f, 9.26771851e+01f, 9.18888702e+01f, 9.11098938e+01f,
+        9.03388214e+01f, 8.95746384e+01f, 8.88196564e+01f, 8.80725250e+01f, 8.73328552e+01f, 8.66004333e+01f,
+        8.58763885e+01f, 8.51591644e+01f, 8.44501266e+01f, 8.37479324e+01f, 8.30538788e+01f, 8.23650436e+01f,
+        8.16839523e+01f, 8.10103836e+01f, 8.03433380e+01f, 7.96832809e+01f, 7.90295105e+01f, 7.83821106e+01f,
+        7.77419815e+01f, 7.71086884e+01f, 7.64809723e+01f, 7.58595123e+01f, 7.52452469e+01f, 7.46365356e+01f,
+        7.40338898e+01f, 7.34371490e+01f, 7.28468933e+01f, 7.22620010e+01f, 7.16829529e+01f, 7.11101990e+01f,
+        7.05424728e+01f, 6.99812088e+01f, 6.94246826e+01f, 6.88740158e+01f, 6.83281174e+01f, 6.77882538e+01f,
+        6.72535248e+01f, 6.67241592e+01f, 6.61995773e+01f, 6.56804352e+01f, 6.51663361e+01f, 6.46573944e+01f,
+        6.41533966e+01f, 6.36539726e+01f, 6.31594124e+01f, 6.26698265e+01f, 6.21845398e+01f, 6.17044411e+01f,
+        6.12285728e+01f, 6.07571259e+01f, 6.02902832e+01f, 5.98280716e+01f, 5.93705788e+01f, 5.89172020e+01f,
+        5.84679146e+01f, 5.80230789e+01f, 5.75824661e+01f, 5.71458931e+01f, 5.67135239e+01f, 5.62851295e+01f,
+        5.58609886e+01f, 5.54408760e+01f, 5.50239601e+01f, 5.46119652e+01f, 5.42033501e+01f, 5.37982178e+01f,
+        5.33975105e+01f, 5.30001564e+01f, 5.26066399e+01f, 5.22166481e+01f, 5.18302078e+01f, 5.14473381e+01f,
+        5.10680656e+01f, 5.06924553e+01f, 5.03202629e+01f, 4.99511642e+01f, 4.95855904e+01f, 4.92235909e+01f,
+        4.88644180e+01f, 4.85088577e+01f, 4.81564102e+01f, 4.78072281e+01f, 4.74610176e+01f, 4.71182404e+01f,
+        4.67784157e+01f, 4.64418755e+01f, 4.61080780e+01f, 4.57774506e+01f, 4.54495697e+01f, 4.51247330e+01f,
+        4.48026695e+01f, 4.44836769e+01f, 4.41676025e+01f, 4.38540802e+01f, 4.35435829e+01f, 4.32358131e+01f,
+        4.29306107e+01f, 4.26280975e+01f, 4.23283195e+01f, 4.20312576e+01f, 4.17367058e+01f, 4.14448547e+01f,
+        4.11554070e+01f, 4.08686104e+01f, 4.05842514e+01f, 4.03023643e+01f, 4.00232544e+01f, 3.97460670e+01f,
+        3.94715462e+01f, 3.91994209e+01f, 3.89294853e+01f, 3.86620827e+01f, 3.83968925e+01f, 3.81340141e+01f,
+        3.78733978e+01f, 3.76148338e+01f, 3.73586655e+01f, 3.71047020e+01f, 3.68528748e+01f, 3.66032410e+01f,
+        3.63556023e+01f, 3.61101799e+01f, 3.58668976e+01f, 3.56255341e+01f, 3.53863258e+01f, 3.51489601e+01f,
+        3.49137878e+01f, 3.46806183e+01f, 3.44493141e+01f, 3.42199364e+01f, 3.39925346e+01f, 3.37670517e+01f,
+        3.35434189e+01f, 3.33216286e+01f, 3.31017036e+01f, 3.28835030e+01f, 3.26673546e+01f, 3.24527740e+01f,
+        3.22401047e+01f, 3.20291862e+01f, 3.18199425e+01f, 3.16125412e+01f, 3.14066887e+01f, 3.12026863e+01f,
+        3.10002308e+01f, 3.07994022e+01f, 3.06003056e+01f, 3.04028645e+01f, 3.02069778e+01f, 3.00127201e+01f,
+        2.98199730e+01f, 2.96288662e+01f, 2.94392452e+01f, 2.92511520e+01f, 2.90645924e+01f, 2.88795700e+01f,
+        2.86960506e+01f, 2.85139771e+01f, 2.83332901e+01f, 2.81541996e+01f, 2.79764614e+01f, 2.78002262e+01f,
+        2.76252747e+01f, 2.74517918e+01f, 2.72796497e+01f, 2.71088428e+01f, 2.69394875e+01f, 2.67714825e+01f,
+        2.66046448e+01f, 2.64392872e+01f, 2.62752171e+01f, 2.61123199e+01f, 2.59508419e+01f, 2.57905922e+01f,
+        2.56315289e+01f, 2.54737701e+01f, 2.53172283e+01f, 2.51619053e+01f, 2.50078049e+01f, 2.48549328e+01f,
+        2.47032375e+01f, 2.45526867e+01f, 2.44032860e+01f, 2.42551079e+01f, 2.41080379e+01f, 2.39620762e+01f,
+        2.38172646e+01f, 2.36735363e+01f, 2.35309582e+01f, 2.33894253e+01f, 2.32489834e+01f, 2.31097069e+01f,
+        2.29714622e+01f, 2.28342075e+01f, 2.26980000e+01f, 2.25628719e+01f, 2.24287529e+01f, 2.22956161e+01f,
+        2.21635342e+01f, 2.20324478e+01f, 2.19023399e+01f, 2.17732334e+01f, 2.16451073e+01f, 2.15178852e+01f,
+        2.13916550e+01f, 2.12663784e+01f, 2.11420460e+01f, 2.10185947e+01f, 2.08960991e+01f, 2.07744846e+01f,
+        2.06537857e+01f, 2.05340366e+01f, 2.04151020e+01f, 2.02971020e+01f, 2.01799450e+01f, 2.00637035e+01f,
+        1.99482670e+01f, 1.98336811e+01f, 1.97199421e+01f, 1.96070385e+01f, 1.94949856e+01f, 1.93837471e+01f,
+        1.92733059e+01f, 1.91637115e+01f, 1.90548763e+01f, 1.89468384e+01f, 1.88395863e+01f, 1.87331219e+01f,
+        1.86273956e+01f, 1.85224953e+01f, 1.84183197e+01f, 1.83148899e+01f, 1.82122040e+01f, 1.81103077e+01f,
+        1.80090981e+01f, 1.79085979e+01f, 1.78088646e+01f, 1.77098331e+01f, 1.76114941e+01f, 1.75138855e+01f,
+        1.74169502e+01f, 1.73207130e+01f, 1.72251587e+01f, 1.71302700e+01f, 1.70360909e+01f, 1.69425621e+01f,
+        1.68496914e+01f, 1.67574787e+01f, 1.66659050e+01f, 1.65749702e+01f, 1.64847050e+01f, 1.63950481e+01f,
+        1.63060303e+01f, 1.62176495e+01f, 1.61298599e+01f, 1.60427151e+01f, 1.59561672e+01f, 1.58702040e+01f,
+        1.57848558e+01f, 1.57001209e+01f, 1.56159515e+01f, 1.55323448e+01f, 1.54493675e+01f, 1.53669510e+01f,
+        1.52850895e+01f, 1.52037964e+01f, 1.51230593e+01f, 1.50428543e+01f, 1.49632359e+01f, 1.48841496e+01f,
+        1.48056021e+01f, 1.47276258e+01f, 1.46501398e+01f, 1.45731888e+01f, 1.44967642e+01f, 1.44208727e+01f,
+        1.43454781e+01f, 1.42706051e+01f, 1.41962519e+01f, 1.41223841e+01f, 1.40490255e+01f, 1.39761610e+01f,
+        1.39037848e+01f, 1.38318901e+01f, 1.37604971e+01f, 1.36895714e+01f, 1.36191235e+01f, 1.35491657e+01f,
+        1.34796476e+01f, 1.34106045e+01f, 1.33420181e+01f, 1.32738848e+01f, 1.32062025e+01f, 1.31390009e+01f,
+        1.30722141e+01f, 1.30058966e+01f, 1.29399757e+01f, 1.28745260e+01f, 1.28095102e+01f, 1.27449160e+01f,
+        1.26807337e+01f, 1.26169777e+01f, 1.25536404e+01f, 1.24907389e+01f, 1.24282246e+01f, 1.23661337e+01f,
+        1.23044319e+01f, 1.22431507e+01f, 1.21822739e+01f, 1.21217842e+01f, 1.20616875e+01f, 1.20019913e+01f,
+        1.19426651e+01f, 1.18837318e+01f, 1.18251753e+01f, 1.17669954e+01f, 1.17091904e+01f, 1.16517696e+01f,
+        1.15947075e+01f, 1.15380268e+01f, 1.14816990e+01f, 1.14257259e+01f, 1.13701267e+01f, 1.13148785e+01f,
+        1.12599764e+01f, 1.12054348e+01f, 1.11512289e+01f, 1.10973825e+01f, 1.10438623e+01f, 1.09906969e+01f,
+        1.09378538e+01f, 1.08853588e+01f, 1.08331833e+01f, 1.07813492e+01f, 1.07298288e+01f, 1.06786528e+01f,
+        1.06277800e+01f, 1.05772276e+01f, 1.05270004e+01f, 1.04770842e+01f, 1.04274855e+01f, 1.03782043e+01f,
+        1.03292208e+01f, 1.02805443e+01f, 1.02321634e+01f, 1.01840935e+01f, 1.01363134e+01f, 1.00888357e+01f,
+        1.00416565e+01f, 9.99475384e+00f, 9.94816017e+00f, 9.90184975e+00f, 9.85582638e+00f, 9.81008148e+00f,
+        9.76461411e+00f, 9.71943474e+00f, 9.67452908e+00f, 9.62989712e+00f, 9.58554554e+00f, 9.54146671e+00f,
+        9.49764347e+00f, 9.45409393e+00f, 9.41082096e+00f, 9.36778927e+00f, 9.32503605e+00f, 9.28253365e+00f,
+        9.24029636e+00f, 9.19831181e+00f, 9.15658092e+00f, 9.11510468e+00f, 9.07387829e+00f, 9.03289604e+00f,
+        8.99216652e+00f, 8.95168209e+00f, 8.91143990e+00f, 8.87143898e+00f, 8.83166981e+00f, 8.79214859e+00f,
+        8.75285912e+00f, 8.71379852e+00f, 8.67498016e+00f, 8.63638973e+00f, 8.59802914e+00f, 8.55990219e+00f,
+        8.52200222e+00f, 8.48431683e+00f, 8.44686317e+00f, 8.40962601e+00f, 8.37261486e+00f, 8.33581638e+00f,
+        8.29923439e+00f, 8.26286983e+00f, 8.22672367e+00f, 8.19078445e+00f, 8.15505409e+00f, 8.11953640e+00f,
+        8.08422947e+00f, 8.04912472e+00f, 8.01422310e+00f, 7.97953606e+00f, 7.94504118e+00f, 7.91074276e+00f,
+        7.87665415e+00f, 7.84276152e+00f, 7.80906248e+00f, 7.77556133e+00f, 7.74225187e+00f, 7.70913458e+00f,
+        7.67620707e+00f, 7.64346981e+00f, 7.61092186e+00f, 7.57856131e+00f, 7.54639101e+00f, 7.51440239e+00f,
+        7.48259306e+00f, 7.45097542e+00f, 7.41953039e+00f, 7.38827181e+00f, 7.35718393e+00f, 7.32628059e+00f,
+        7.29554558e+00f, 7.26498938e+00f, 7.23460674e+00f, 7.20439911e+00f, 7.17435551e+00f, 7.14448452e+00f,
+        7.11478949e+00f, 7.08525133e+00f, 7.05588913e+00f, 7.02668667e+00f, 6.99764776e+00f, 6.96877718e+00f,
+        6.94006681e+00f, 6.91151476e+00f, 6.88312769e+00f, 6.85489607e+00f, 6.82682419e+00f, 6.79890776e+00f,
+        6.77114677e+00f, 6.74354219e+00f, 6.71608925e+00f, 6.68878841e+00f, 6.66163969e+00f, 6.63464260e+00f,
+        6.60779619e+00f, 6.58109617e+00f, 6.55454350e+00f, 6.52814102e+00f, 6.50188398e+00f, 6.47576809e+00f,
+        6.44979668e+00f, 6.42397070e+00f, 6.39828539e+00f, 6.37273884e+00f, 6.34733582e+00f, 6.32206964e+00f,
+        6.29693985e+00f, 6.27195215e+00f, 6.24709797e+00f, 6.22237682e+00f, 6.19779587e+00f, 6.17334557e+00f,
+        6.14902544e+00f, 6.12484264e+00f, 6.10078716e+00f, 6.07686424e+00f, 6.05306816e+00f, 6.02940178e+00f,
+        6.00586319e+00f, 5.98245287e+00f, 5.95916843e+00f, 5.93600655e+00f, 5.91297102e+00f, 5.89005518e+00f,
+        5.86726713e+00f, 5.84459829e+00f, 5.82205677e+00f, 5.79962921e+00f, 5.77732182e+00f, 5.75514078e+00f,
+        5.73307037e+00f, 5.71112108e+00f, 5.68928528e+00f, 5.66756678e+00f, 5.64596081e+00f, 5.62447500e+00f,
+        5.60309935e+00f, 5.58183575e+00f, 5.56068611e+00f, 5.53964710e+00f, 5.51872301e+00f, 5.49790192e+00f,
+        5.47719526e+00f, 5.45659542e+00f, 5.43610477e+00f, 5.41572237e+00f, 5.39544487e+00f, 5.37527561e+00f,
+        5.35520983e+00f, 5.33525133e+00f, 5.31539583e+00f, 5.29564190e+00f, 5.27599239e+00f, 5.25644445e+00f,
+        5.23699808e+00f, 5.21765375e+00f, 5.19840860e+00f, 5.17926121e+00f, 5.16021538e+00f, 5.14126873e+00f,
+        5.12241697e+00f, 5.10366678e+00f, 5.08501101e+00f, 5.06644726e+00f, 5.04798317e+00f, 5.02961445e+00f,
+        5.01133871e+00f, 4.99315453e+00f, 4.97506666e+00f, 4.95706940e+00f, 4.93916464e+00f, 4.92135191e+00f,
+        4.90363073e+00f, 4.88599491e+00f, 4.86845255e+00f, 4.85099840e+00f, 4.83363295e+00f, 4.81635714e+00f,
+        4.79916859e+00f, 4.78206301e+00f, 4.76504803e+00f, 4.74811840e+00f, 4.73127317e+00f, 4.71451426e+00f,
+        4.69783974e+00f, 4.68124723e+00f, 4.66473961e+00f, 4.64831495e+00f, 4.63197041e+00f, 4.61570930e+00f,
+        4.59953022e+00f, 4.58342981e+00f, 4.56741285e+00f, 4.55147648e+00f, 4.53561544e+00f, 4.51983786e+00f,
+        4.50413418e+00f, 4.48851156e+00f, 4.47296524e+00f, 4.45749712e+00f, 4.44210625e+00f, 4.42678881e+00f,
+        4.41154766e+00f, 4.39638281e+00f, 4.38129473e+00f, 4.36627769e+00f, 4.35133600e+00f, 4.33646727e+00f,
+        4.32167244e+00f, 4.30695152e+00f, 4.29229975e+00f, 4.27772141e+00f, 4.26321411e+00f, 4.24877882e+00f,
+        4.23441362e+00f, 4.22011757e+00f, 4.20589161e+00f, 4.19173670e+00f, 4.17764807e+00f, 4.16362906e+00f,
+        4.14967775e+00f, 4.13579369e+00f, 4.12197876e+00f, 4.10822964e+00f, 4.09454679e+00f, 4.08093262e+00f,
+        4.06738234e+00f, 4.05389643e+00f, 4.04047728e+00f, 4.02712250e+00f, 4.01383162e+00f, 4.00060415e+00f,
+        3.98743963e+00f, 3.97433925e+00f, 3.96130228e+00f, 3.94832659e+00f, 3.93541384e+00f, 3.92256308e+00f,
+        3.90977240e+00f, 3.89704299e+00f, 3.88437462e+00f, 3.87176776e+00f, 3.85922003e+00f, 3.84672976e+00f,
+        3.83430195e+00f, 3.82193089e+00f, 3.80961990e+00f, 3.79736662e+00f, 3.78517222e+00f, 3.77303386e+00f,
+        3.76095295e+00f, 3.74893069e+00f, 3.73696327e+00f, 3.72505140e+00f, 3.71319747e+00f, 3.70139718e+00f,
+        3.68965507e+00f, 3.67796779e+00f, 3.66633439e+00f, 3.65475607e+00f, 3.64323044e+00f, 3.63175917e+00f,
+        3.62034225e+00f, 3.60897875e+00f, 3.59766722e+00f, 3.58640909e+00f, 3.57520199e+00f, 3.56404877e+00f,
+        3.55294776e+00f, 3.54189348e+00f, 3.53089547e+00f, 3.51994658e+00f, 3.50904870e+00f, 3.49820161e+00f,
+        3.48740387e+00f, 3.47665763e+00f, 3.46595836e+00f, 3.45530915e+00f, 3.44470930e+00f, 3.43415952e+00f,
+        3.42365623e+00f, 3.41320276e+00f, 3.40279508e+00f, 3.39243770e+00f, 3.38212442e+00f, 3.37185979e+00f,
+        3.36164284e+00f, 3.35147095e+00f, 3.34134698e+00f, 3.33126974e+00f, 3.32123780e+00f, 3.31125093e+00f,
+        3.30130959e+00f, 3.29141331e+00f, 3.28156304e+00f, 3.27175570e+00f, 3.26199412e+00f, 3.25227523e+00f,
+        3.24260139e+00f, 3.23297048e+00f, 3.22338319e+00f, 3.21383953e+00f, 3.20433927e+00f, 3.19488096e+00f,
+        3.18546557e+00f, 3.17609406e+00f, 3.16676235e+00f, 3.15747190e+00f, 3.14822507e+00f, 3.13901949e+00f,
+        3.12985396e+00f, 3.12072873e+00f, 3.11164570e+00f, 3.10260367e+00f, 3.09360147e+00f, 3.08463836e+00f,
+        3.07571554e+00f, 3.06683230e+00f, 3.05799055e+00f, 3.04918694e+00f, 3.04042125e+00f, 3.03169513e+00f,
+        3.02300811e+00f, 3.01435924e+00f, 3.00574851e+00f, 2.99717569e+00f, 2.98864055e+00f, 2.98014331e+00f,
+        2.97168398e+00f, 2.96326137e+00f, 2.95487547e+00f, 2.94652653e+00f, 2.93821526e+00f, 2.92993832e+00f,
+        2.92169976e+00f, 2.91349554e+00f, 2.90532827e+00f, 2.89719748e+00f, 2.88910103e+00f, 2.88104010e+00f,
+        2.87301397e+00f, 2.86502433e+00f, 2.85706878e+00f, 2.84914732e+00f, 2.84126115e+00f, 2.83340836e+00f,
+        2.82558966e+00f, 2.81780529e+00f, 2.81005430e+00f, 2.80233693e+00f, 2.79465389e+00f, 2.78700328e+00f,
+        2.77938581e+00f, 2.77180171e+00f, 2.76425052e+00f, 2.75673056e+00f, 2.74924493e+00f, 2.74179029e+00f,
+        2.73436713e+00f, 2.72697639e+00f, 2.71961761e+00f, 2.71229053e+00f, 2.70499444e+00f, 2.69772959e+00f,
+        2.69049573e+00f, 2.68329263e+00f, 2.67612123e+00f, 2.66897941e+00f, 2.66186810e+00f, 2.65478802e+00f,
+        2.64773774e+00f, 2.64071774e+00f, 2.63372755e+00f, 2.62676716e+00f, 2.61983562e+00f, 2.61293411e+00f,
+        2.60606194e+00f, 2.59921861e+00f, 2.59240389e+00f, 2.58561778e+00f, 2.57886052e+00f, 2.57213235e+00f,
+        2.56543326e+00f, 2.55876088e+00f, 2.55211759e+00f, 2.54550314e+00f, 2.53891540e+00f, 2.53235579e+00f,
+        2.52582359e+00f, 2.51931834e+00f, 2.51284027e+00f, 2.50639009e+00f, 2.49996638e+00f, 2.49356961e+00f,
+        2.48719954e+00f, 2.48085642e+00f, 2.47454047e+00f, 2.46824908e+00f, 2.46198535e+00f, 2.45574689e+00f,
+        2.44953489e+00f, 2.44334984e+00f, 2.43718910e+00f, 2.43105435e+00f, 2.42494488e+00f, 2.41886163e+00f,
+        2.41280365e+00f, 2.40676975e+00f, 2.40076065e+00f, 2.39477777e+00f, 2.38881826e+00f, 2.38288450e+00f,
+        2.37697458e+00f, 2.37108850e+00f, 2.36522770e+00f, 2.35939121e+00f, 2.35357809e+00f, 2.34778905e+00f,
+        2.34202480e+00f, 2.33628321e+00f, 2.33056521e+00f, 2.32487082e+00f, 2.31919980e+00f, 2.31355190e+00f,
+        2.30792761e+00f, 2.30232620e+00f, 2.29674792e+00f, 2.29119205e+00f, 2.28565884e+00f, 2.28014803e+00f,
+        2.27465987e+00f, 2.26919341e+00f, 2.26375055e+00f, 2.25832939e+00f, 2.25293040e+00f, 2.24755335e+00f,
+        2.24219799e+00f, 2.23686409e+00f, 2.23155189e+00f, 2.22626209e+00f, 2.22099352e+00f, 2.21574569e+00f,
+        2.21051955e+00f, 2.20531440e+00f, 2.20012999e+00f, 2.19496679e+00f, 2.18982458e+00f, 2.18470311e+00f,
+        2.17960191e+00f, 2.17452240e+00f, 2.16946220e+00f, 2.16442299e+00f, 2.15940356e+00f, 2.15440440e+00f,
+        2.14942503e+00f, 2.14446640e+00f, 2.13952780e+00f, 2.13460851e+00f, 2.12970853e+00f, 2.12482882e+00f,
+        2.11996818e+00f, 2.11512756e+00f, 2.11030626e+00f, 2.10550356e+00f, 2.10072041e+00f, 2.09595728e+00f,
+        2.09121180e+00f, 2.08648610e+00f, 2.08177900e+00f, 2.07709074e+00f, 2.07242060e+00f, 2.06776929e+00f,
+        2.06313658e+00f, 2.05852270e+00f, 2.05392671e+00f, 2.04934907e+00f, 2.04478884e+00f, 2.04024720e+00f,
+        2.03572416e+00f, 2.03121805e+00f, 2.02673101e+00f, 2.02226114e+00f, 2.01780868e+00f, 2.01337409e+00f,
+        2.00895691e+00f, 2.00455737e+00f, 2.00017476e+00f, 1.99580956e+00f, 1.99146187e+00f, 1.98713124e+00f,
+        1.98281729e+00f, 1.97852039e+00f, 1.97424066e+00f, 1.96997786e+00f, 1.96573150e+00f, 1.96150148e+00f,
+        1.95728874e+00f, 1.95309258e+00f, 1.94891286e+00f, 1.94474840e+00f, 1.94060171e+00f, 1.93647003e+00f,
+        1.93235517e+00f, 1.92825651e+00f, 1.92417383e+00f, 1.92010689e+00f, 1.91605592e+00f, 1.91202080e+00f,
+        1.90800107e+00f, 1.90399694e+00f, 1.90000939e+00f, 1.89603674e+00f, 1.89207947e+00f, 1.88813794e+00f,
+        1.88421142e+00f, 1.88030028e+00f, 1.87640393e+00f, 1.87252343e+00f, 1.86865783e+00f, 1.86480701e+00f,
+        1.86097121e+00f, 1.85715032e+00f, 1.85334432e+00f, 1.84955263e+00f, 1.84577620e+00f, 1.84201336e+00f,
+        1.83826625e+00f, 1.83453250e+00f, 1.83081448e+00f, 1.82711053e+00f, 1.82342041e+00f, 1.81974506e+00f,
+        1.81608331e+00f, 1.81243598e+00f, 1.80880284e+00f, 1.80518365e+00f, 1.80157828e+00f, 1.79798675e+00f,
+        1.79440892e+00f, 1.79084539e+00f, 1.78729498e+00f, 1.78375852e+00f, 1.78023553e+00f, 1.77672589e+00f,
+        1.77323043e+00f, 1.76974797e+00f, 1.76627898e+00f, 1.76282334e+00f, 1.75938094e+00f, 1.75595129e+00f,
+        1.75253546e+00f, 1.74913216e+00f, 1.74574220e+00f, 1.74236524e+00f, 1.73900092e+00f, 1.73564982e+00f,
+        1.73231101e+00f, 1.72898531e+00f, 1.72567236e+00f, 1.72237182e+00f, 1.71908391e+00f, 1.71580911e+00f,
+        1.71254635e+00f, 1.70929575e+00f, 1.70605850e+00f, 1.70283294e+00f, 1.69961953e+00f, 1.69641852e+00f,
+        1.69322968e+00f, 1.69005322e+00f, 1.68688846e+00f, 1.68373585e+00f, 1.68059540e+00f, 1.67746663e+00f,
+        1.67435026e+00f, 1.67124569e+00f, 1.66815257e+00f, 1.66507161e+00f, 1.66200185e+00f, 1.65894413e+00f,
+        1.65589821e+00f, 1.65286338e+00f, 1.64984012e+00f, 1.64682806e+00f, 1.64382780e+00f, 1.64083886e+00f,
+        1.63786125e+00f, 1.63489485e+00f, 1.63194001e+00f, 1.62899590e+00f, 1.62606323e+00f, 1.62314141e+00f,
+        1.62023091e+00f, 1.61733127e+00f, 1.61444283e+00f, 1.61156523e+00f, 1.60869825e+00f, 1.60584259e+00f,
+        1.60299742e+00f, 1.60016310e+00f, 1.59733927e+00f, 1.59452641e+00f, 1.59172392e+00f, 1.58893192e+00f,
+        1.58615077e+00f, 1.58337986e+00f, 1.58061981e+00f, 1.57787001e+00f, 1.57513070e+00f, 1.57240152e+00f,
+        1.56968296e+00f, 1.56697428e+00f, 1.56427610e+00f, 1.56158805e+00f, 1.55890989e+00f, 1.55624199e+00f,
+        1.55358422e+00f, 1.55093646e+00f, 1.54829836e+00f, 1.54567063e+00f, 1.54305220e+00f, 1.54044390e+00f,
+        1.53784609e+00f, 1.53525698e+00f, 1.53267825e+00f, 1.53010917e+00f, 1.52754998e+00f, 1.52500010e+00f,
+        1.52246022e+00f, 1.51992965e+00f, 1.51740837e+00f, 1.51489699e+00f, 1.51239502e+00f, 1.50990212e+00f,
+        1.50741875e+00f, 1.50494480e+00f, 1.50248015e+00f, 1.50002456e+00f, 1.49757898e+00f, 1.49514174e+00f,
+        1.49271429e+00f, 1.49029601e+00f, 1.48788631e+00f, 1.48548627e+00f, 1.48309457e+00f, 1.48071241e+00f,
+        1.47833896e+00f, 1.47597432e+00f, 1.47361887e+00f, 1.47127199e+00f, 1.46893430e+00f, 1.46660495e+00f,
+        1.46428454e+00f, 1.46197307e+00f, 1.45967031e+00f, 1.45737600e+00f, 1.45509040e+00f, 1.45281363e+00f,
+        1.45054543e+00f, 1.44828558e+00f, 1.44603431e+00f, 1.44379187e+00f, 1.44155729e+00f, 1.43933153e+00f,
+        1.43711364e+00f, 1.43490458e+00f, 1.43270385e+00f, 1.43051124e+00f, 1.42832696e+00f, 1.42615116e+00f,
+        1.42398322e+00f, 1.42182350e+00f, 1.41967201e+00f, 1.41752875e+00f, 1.41539347e+00f, 1.41326630e+00f,
+        1.41114724e+00f, 1.40903580e+00f, 1.40693271e+00f, 1.40483737e+00f, 1.40275025e+00f, 1.40067065e+00f,
+        1.39859903e+00f, 1.39653528e+00f, 1.39447927e+00f, 1.39243102e+00f, 1.39039052e+00f, 1.38835764e+00f,
+        1.38633251e+00f, 1.38431537e+00f, 1.38230574e+00f, 1.38030374e+00f, 1.37830901e+00f, 1.37632227e+00f,
+        1.37434256e+00f, 1.37237096e+00f, 1.37040687e+00f, 1.36844957e+00f, 1.36650014e+00f, 1.36455774e+00f,
+        1.36262298e+00f, 1.36069572e+00f, 1.35877573e+00f, 1.35686290e+00f, 1.35495734e+00f, 1.35305929e+00f,
+        1.35116804e+00f, 1.34928429e+00f, 1.34740770e+00f, 1.34553814e+00f, 1.34367561e+00f, 1.34182048e+00f,
+        1.33997250e+00f, 1.33813131e+00f, 1.33629704e+00f, 1.33446980e+00f, 1.33264971e+00f, 1.33083630e+00f,
+        1.32903039e+00f, 1.32723093e+00f, 1.32543850e+00f, 1.32365310e+00f, 1.32187438e+00f, 1.32010257e+00f,
+        1.31833756e+00f, 1.31657934e+00f, 1.31482756e+00f, 1.31308270e+00f, 1.31134462e+00f, 1.30961323e+00f,
+        1.30788827e+00f, 1.30617034e+00f, 1.30445862e+00f, 1.30275357e+00f, 1.30105555e+00f, 1.29936349e+00f,
+        1.29767859e+00f, 1.29599965e+00f, 1.29432774e+00f, 1.29266191e+00f, 1.29100239e+00f, 1.28934956e+00f,
+        1.28770304e+00f, 1.28606272e+00f, 1.28442907e+00f, 1.28280175e+00f, 1.28118062e+00f, 1.27956581e+00f,
+        1.27795732e+00f, 1.27635515e+00f, 1.27475893e+00f, 1.27316892e+00f, 1.27158558e+00f, 1.27000821e+00f,
+        1.26843703e+00f, 1.26687181e+00f, 1.26531291e+00f, 1.26375985e+00f, 1.26221323e+00f, 1.26067233e+00f,
+        1.25913799e+00f, 1.25760913e+00f, 1.25608671e+00f, 1.25457001e+00f, 1.25305915e+00f, 1.25155437e+00f,
+        1.25005555e+00f, 1.24856269e+00f, 1.24707556e+00f, 1.24559450e+00f, 1.24411929e+00f, 1.24265003e+00f,
+        1.24118638e+00f, 1.23972845e+00f, 1.23827648e+00f, 1.23683035e+00f, 1.23539007e+00f, 1.23395526e+00f,
+        1.23252606e+00f, 1.23110306e+00f, 1.22968543e+00f, 1.22827291e+00f, 1.22686696e+00f, 1.22546601e+00f,
+        1.22407115e+00f, 1.22268188e+00f, 1.22129786e+00f, 1.21991992e+00f, 1.21854687e+00f, 1.21717966e+00f,
+        1.21581793e+00f, 1.21446192e+00f, 1.21311116e+00f, 1.21176565e+00f, 1.21042585e+00f, 1.20909178e+00f,
+        1.20776224e+00f, 1.20643890e+00f, 1.20512080e+00f, 1.20380795e+00f, 1.20250046e+00f, 1.20119846e+00f,
+        1.19990170e+00f, 1.19861054e+00f, 1.19732428e+00f, 1.19604313e+00f, 1.19476783e+00f, 1.19349730e+00f,
+        1.19223237e+00f, 1.19097233e+00f, 1.18971765e+00f, 1.18846822e+00f, 1.18722355e+00f, 1.18598449e+00f,
+        1.18475044e+00f, 1.18352127e+00f, 1.18229783e+00f, 1.18107903e+00f, 1.17986548e+00f, 1.17865705e+00f,
+        1.17745364e+00f, 1.17625487e+00f, 1.17506158e+00f, 1.17387319e+00f, 1.17268980e+00f, 1.17151153e+00f,
+        1.17033815e+00f, 1.16916955e+00f, 1.16800606e+00f, 1.16684747e+00f, 1.16569400e+00f, 1.16454542e+00f,
+        1.16340160e+00f, 1.16226268e+00f, 1.16112864e+00f, 1.15999925e+00f, 1.15887499e+00f, 1.15775537e+00f,
+        1.15664065e+00f, 1.15553081e+00f, 1.15442562e+00f, 1.15332544e+00f, 1.15222991e+00f, 1.15113890e+00f,
+        1.15005291e+00f, 1.14897156e+00f, 1.14789474e+00f, 1.14682281e+00f, 1.14575577e+00f, 1.14469337e+00f,
+        1.14363527e+00f, 1.14258230e+00f, 1.14153361e+00f, 1.14048970e+00f, 1.13945043e+00f, 1.13841569e+00f,
+        1.13738561e+00f, 1.13635993e+00f, 1.13533902e+00f, 1.13432276e+00f, 1.13331079e+00f, 1.13230336e+00f,
+        1.13130069e+00f, 1.13030267e+00f, 1.12930906e+00f, 1.12831962e+00f, 1.12733495e+00f, 1.12635469e+00f,
+        1.12537885e+00f, 1.12440777e+00f, 1.12344062e+00f, 1.12247825e+00f, 1.12152052e+00f, 1.12056684e+00f,
+        1.11961722e+00f, 1.11867249e+00f, 1.11773157e+00f, 1.11679554e+00f, 1.11586392e+00f, 1.11493635e+00f,
+        1.11401320e+00f, 1.11309457e+00f, 1.11218023e+00f, 1.11127007e+00f, 1.11036432e+00f, 1.10946274e+00f,
+        1.10856545e+00f, 1.10767257e+00f, 1.10678375e+00f, 1.10589910e+00f, 1.10501873e+00f, 1.10414255e+00f,
+        1.10327089e+00f, 1.10240328e+00f, 1.10153985e+00f, 1.10068047e+00f, 1.09982562e+00f, 1.09897482e+00f,
+        1.09812808e+00f, 1.09728563e+00f, 1.09644711e+00f, 1.09561276e+00f, 1.09478271e+00f, 1.09395683e+00f,
+        1.09313476e+00f, 1.09231675e+00f, 1.09150302e+00f, 1.09069324e+00f, 1.08988774e+00f, 1.08908606e+00f,
+        1.08828855e+00f, 1.08749509e+00f, 1.08670568e+00f, 1.08592045e+00f, 1.08513904e+00f, 1.08436167e+00f,
+        1.08358836e+00f, 1.08281910e+00f, 1.08205366e+00f, 1.08129227e+00f, 1.08053470e+00f, 1.07978141e+00f,
+        1.07903206e+00f, 1.07828653e+00f, 1.07754469e+00f, 1.07680702e+00f, 1.07607329e+00f, 1.07534349e+00f,
+        1.07461786e+00f, 1.07389569e+00f, 1.07317746e+00f, 1.07246327e+00f, 1.07175291e+00f, 1.07104623e+00f,
+        1.07034349e+00f, 1.06964481e+00f, 1.06894982e+00f, 1.06825864e+00f, 1.06757128e+00f, 1.06688774e+00f,
+        1.06620812e+00f, 1.06553233e+00f, 1.06486022e+00f, 1.06419158e+00f, 1.06352723e+00f, 1.06286669e+00f,
+        1.06220996e+00f, 1.06155670e+00f, 1.06090724e+00f, 1.06026149e+00f, 1.05961990e+00f, 1.05898190e+00f,
+        1.05834734e+00f, 1.05771661e+00f, 1.05708969e+00f, 1.05646646e+00f, 1.05584681e+00f, 1.05523098e+00f,
+        1.05461895e+00f, 1.05401027e+00f, 1.05340564e+00f, 1.05280447e+00f, 1.05220711e+00f, 1.05161333e+00f,
+        1.05102336e+00f, 1.05043674e+00f, 1.04985392e+00f, 1.04927480e+00f, 1.04869938e+00f, 1.04812741e+00f,
+        1.04755890e+00f, 1.04699433e+00f, 1.04643321e+00f, 1.04587555e+00f, 1.04532182e+00f, 1.04477155e+00f,
+        1.04422498e+00f, 1.04368198e+00f, 1.04314232e+00f, 1.04260647e+00f, 1.04207397e+00f, 1.04154515e+00f,
+        1.04101968e+00f, 1.04049790e+00f, 1.03997970e+00f, 1.03946519e+00f, 1.03895390e+00f, 1.03844643e+00f,
+        1.03794217e+00f, 1.03744149e+00f, 1.03694463e+00f, 1.03645086e+00f, 1.03596115e+00f, 1.03547454e+00f,
+        1.03499138e+00f, 1.03451192e+00f, 1.03403580e+00f, 1.03356302e+00f, 1.03309405e+00f, 1.03262806e+00f,
+        1.03216600e+00f, 1.03170717e+00f, 1.03125191e+00f, 1.03079987e+00f, 1.03035164e+00f, 1.02990639e+00f,
+        1.02946496e+00f, 1.02902663e+00f, 1.02859223e+00f, 1.02816093e+00f, 1.02773309e+00f, 1.02730870e+00f,
+        1.02688777e+00f, 1.02646995e+00f, 1.02605569e+00f, 1.02564466e+00f, 1.02523732e+00f, 1.02483320e+00f,
+        1.02443266e+00f, 1.02403522e+00f, 1.02364135e+00f, 1.02325058e+00f, 1.02286351e+00f, 1.02247965e+00f,
+        1.02209938e+00f, 1.02172196e+00f, 1.02134836e+00f, 1.02097785e+00f, 1.02061081e+00f, 1.02024710e+00f,
+        1.01988685e+00f, 1.01952970e+00f, 1.01917589e+00f, 1.01882541e+00f, 1.01847839e+00f, 1.01813459e+00f,
+        1.01779413e+00f, 1.01745689e+00f, 1.01712310e+00f, 1.01679242e+00f, 1.01646543e+00f, 1.01614153e+00f,
+        1.01582086e+00f, 1.01550376e+00f, 1.01518977e+00f, 1.01487887e+00f, 1.01457143e+00f, 1.01426733e+00f,
+        1.01396644e+00f, 1.01366866e+00f, 1.01337433e+00f, 1.01308334e+00f, 1.01279545e+00f, 1.01251090e+00f,
+        1.01222956e+00f, 1.01195145e+00f, 1.01167691e+00f, 1.01140511e+00f, 1.01113689e+00f, 1.01087201e+00f,
+        1.01061022e+00f, 1.01035154e+00f, 1.01009619e+00f, 1.00984418e+00f, 1.00959527e+00f, 1.00934982e+00f,
+        1.00910711e+00f, 1.00886810e+00f, 1.00863230e+00f, 1.00839937e+00f, 1.00817001e+00f, 1.00794375e+00f,
+        1.00772059e+00f, 1.00750089e+00f, 1.00728416e+00f, 1.00707078e+00f, 1.00686061e+00f, 1.00665355e+00f,
+        1.00644970e+00f, 1.00624895e+00f, 1.00605166e+00f, 1.00585747e+00f, 1.00566649e+00f, 1.00547862e+00f,
+        1.00529397e+00f, 1.00511253e+00f, 1.00493419e+00f, 1.00475931e+00f, 1.00458741e+00f, 1.00441885e+00f,
+        1.00425327e+00f, 1.00409091e+00f, 1.00393176e+00f, 1.00377572e+00f, 1.00362289e+00f, 1.00347328e+00f,
+        1.00332677e+00f, 1.00318336e+00f, 1.00304329e+00f, 1.00290632e+00f, 1.00277245e+00f, 1.00264192e+00f,
+        1.00251436e+00f, 1.00239003e+00f, 1.00226891e+00f, 1.00215089e+00f, 1.00203609e+00f, 1.00192451e+00f,
+        1.00181592e+00f, 1.00171065e+00f, 1.00160861e+00f, 1.00150955e+00f, 1.00141358e+00f, 1.00132072e+00f,
+        1.00123119e+00f, 1.00114477e+00f, 1.00106144e+00f, 1.00098133e+00f, 1.00090444e+00f, 1.00083053e+00f,
+        1.00076008e+00f, 1.00069249e+00f, 1.00062799e+00f, 1.00056684e+00f, 1.00050890e+00f, 1.00045383e+00f,
+        1.00040185e+00f, 1.00035346e+00f, 1.00030792e+00f, 1.00026548e+00f, 1.00022614e+00f, 1.00019002e+00f,
+        1.00015700e+00f, 1.00012720e+00f, 1.00010061e+00f, 1.00007701e+00f, 1.00005662e+00f, 1.00003922e+00f,
+        1.00002515e+00f, 1.00001431e+00f, 1.00000644e+00f, 1.00000167e+00f
+    };
+
+    static const ShifterTables tables[generatedTableCount] = {
+        { 1024, 1, hannwindow1024, cbwindow1024live, acwinv1024live, {} },
+        { 2048, 1, hannwindow2048, cbwindow2048live, acwinv2048live, {} },
+        { 2048, 0, hannwindow2048, cbwindow2048, acwinv2048, {} },
+        { 4096, 0, hannwindow4096, cbwindow4096, acwinv4096, {} }
+    };
+    return tables;
+}
+
+#endif
@@ -0,0 +1,172 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+#ifndef __GRAINPOOL__
+#define __GRAINPOOL__
+#include <math.h>
+
+#define GRAINPOOL_MAXGRAINS 8 // Upper bound on grains per pool
+
+// A two-period grain cut around a pitch mark, stored already windowed
+struct GrainDescriptor
+{
+    unsigned long mark; // sample clock at the centre of the grain
+    unsigned long length; // grain length in samples (two periods)
+    float* data; // windowed samples, in the owner's storage
+};
+
+// Fixed-capacity ring of grains. The owner hands prepare() storage for
+// numGrains * maxLength samples, so acquiring a grain on the audio thread just
+// recycles the oldest slot.
+class GrainPool
+{
+public:
+
+    void prepare(int numGrains, unsigned long maxLength, float* storage)
+    {
+        capacity = (numGrains < GRAINPOOL_MAXGRAINS) ? numGrains : GRAINPOOL_MAXGRAINS;
+        maxlen = maxLength;
+        for (int i = 0; i < capacity; i++) {
+            grains[i].data = storage + i * maxlen;
+        }
+        clear();
+    }
+
+    void clear()
+    {
+        for (int i = 0; i < capacity; i++) {
+            grains[i].mark = 0;
+            grains[i].length = 0;
+        }
+        head = 0;
+        count = 0;
+    }
+
+    GrainDescriptor& acquire()
+    {
+        head = (head + 1) % capacity;
+        if (count < capacity) {
+            count++;
+        }
+        return grains[head];
+    }
+
+    // Grain whose centre lies closest to the given sample clock, or null if empty
+    const GrainDescriptor* nearest(unsigned long mark) const
+    {
+        const GrainDescriptor* best = nullptr;
+        unsigned long bestdist = 0;
+        unsigned long dist;
+
+        for (int i = 0; i < count; i++) {
+            const GrainDescriptor& g = grains[(head + capacity - i) % capacity];
+            dist = (g.mark > mark) ? g.mark - mark : mark - g.mark;
+            if (best == nullptr || dist < bestdist) {
+                best = &g;
+                bestdist = dist;
+            }
+        }
+        return best;
+    }
+
+    unsigned long getMaxLength() const
+    {
+        return maxlen;
+    }
+
+private:
+    GrainDescriptor grains[GRAINPOOL_MAXGRAINS];
+    int capacity = 0;
+    unsigned long maxlen = 0;
+    int head = 0;
+    int count = 0;
+};
+
+#define GRAINWINDOW_RESOLUTION 4096 // Steps of the shared half-Hann table
+
+// Rising half of a Hann window sampled at GRAINWINDOW_RESOLUTION + 1 points,
+// plus one guard sample. Built once, on first use, and shared by every shifter.
+inline const float* halfHannTable()
+{
+    struct Table
+    {
+        float samples[GRAINWINDOW_RESOLUTION + 2];
+
+        Table()
+        {
+            for (int i = 0; i <= GRAINWINDOW_RESOLUTION; i++) {
+                samples[i] = -0.5 * cos(M_PI * i / GRAINWINDOW_RESOLUTION) + 0.5;
+            }
+            samples[GRAINWINDOW_RESOLUTION + 1] = 1;
+        }
+    };
+    static const Table table;
+    return table.samples;
+}
+
+// The periodic Hann window for the current grain length. A new length is
+// interpolated from halfHannTable() into the owner's storage of maxLength
+// samples, so a change of pitch costs one pass of multiply-adds over the
+// window and no cos(); a sustained note reuses it every grain.
+class GrainWindowCache
+{
+public:
+
+    // Not realtime safe the first time, which builds the shared table
+    void prepare(unsigned long maxLength, float* windowStorage)
+    {
+        halfhann = halfHannTable();
+        maxlen = maxLength;
+        storage = windowStorage;
+        clear();
+    }
+
+    // Forgets the window; the next get() rebuilds it
+    void clear()
+    {
+        length = 0;
+    }
+
+    const float* get(unsigned long windowLength)
+    {
+        unsigned long ti, half;
+        float pos, step, frac;
+        int i;
+
+        if (windowLength > maxlen) {
+            windowLength = maxlen;
+        }
+        if (windowLength == length) {
+            return storage;
+        }
+
+        // The second half mirrors the first
+        half = windowLength / 2;
+        step = (float)GRAINWINDOW_RESOLUTION / half;
+        for (ti = 0; ti <= half && ti < windowLength; ti++) {
+            pos = ti * step;
+            i = (int)pos;
+            frac = pos - i;
+            storage[ti] = halfhann[i] + frac * (halfhann[i + 1] - halfhann[i]);
+        }
+        for (; ti < windowLength; ti++) {
+            storage[ti] = storage[windowLength - ti];
+        }
+        length = windowLength;
+        return storage;
+    }
+
+private:
+    const float* halfhann = nullptr;
+    float* storage = nullptr;
+    unsigned long maxlen = 0;
+    unsigned long length = 0;
+};
+
+#endif
@@ -0,0 +1,119 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+#ifndef __LOADGOVERNOR__
+#define __LOADGOVERNOR__
+#include <algorithm>
+#include <atomic>
+#include "PitchShifter.h"
+
+// Per-instance CPU load governor. update() is told how long each block took to
+// process against how long it lasts, and keeps the last windowblocks of those
+// ratios. When the second highest of them crosses stepdownload, the quality
+// tier limit drops one below the tier that was running. It comes back one tier
+// at a time once that percentile has stayed under stepupload for
+// stepupseconds. After every step the window starts over, so each decision is
+// made on blocks that ran at the current tier.
+//
+// Realtime safe. The transition counters can be read from any thread.
+class LoadGovernor
+{
+public:
+    static const int windowblocks = 32;
+    static constexpr float stepdownload = 0.7f;
+    static constexpr float stepupload = 0.35f;
+    static constexpr double stepupseconds = 3.0;
+
+    // Lifts the limit and forgets the load history; the counters keep counting
+    void reset()
+    {
+        limit.store (PitchShifter::QualityHQ);
+        count = 0;
+        head = 0;
+        calmseconds = 0;
+    }
+
+    // requestedTier is what the user asked for, so the governor only steps up
+    // while it is holding the shifters below it
+    void update(double elapsedSeconds, double blockSeconds, int requestedTier)
+    {
+        int tier = std::min (requestedTier, limit.load (std::memory_order_relaxed));
+        float high;
+
+        if (blockSeconds <= 0) {
+            return;
+        }
+        loads[head] = (float)(elapsedSeconds / blockSeconds);
+        head = (head + 1) % windowblocks;
+        if (count < windowblocks) {
+            count++;
+            return;
+        }
+
+        std::copy (loads, loads + windowblocks, sorted);
+        std::nth_element (sorted, sorted + windowblocks - 2, sorted + windowblocks);
+        high = sorted[windowblocks - 2];
+        percentile.store (high, std::memory_order_relaxed);
+
+        if (high > stepdownload && tier > PitchShifter::QualityEco) {
+            limit.store (tier - 1);
+            stepsdown++;
+            count = 0;
+            calmseconds = 0;
+        }
+        else if (high < stepupload && tier < requestedTier) {
+            calmseconds += blockSeconds;
+            if (calmseconds >= stepupseconds) {
+                limit.store (tier + 1);
+                stepsup++;
+                count = 0;
+                calmseconds = 0;
+            }
+        }
+        else {
+            calmseconds = 0;
+        }
+    }
+
+    // Highest tier the shifters may run at
+    int getTierLimit() const
+    {
+        return limit.load (std::memory_order_relaxed);
+    }
+
+    // Second highest load in the last full window, as a fraction of the block duration
+    float getLoadPercentile() const
+    {
+        return percentile.load (std::memory_order_relaxed);
+    }
+
+    int getStepsDown() const
+    {
+        return stepsdown.load (std::memory_order_relaxed);
+    }
+
+    int getStepsUp() const
+    {
+        return stepsup.load (std::memory_order_relaxed);
+    }
+
+private:
+    float loads[windowblocks]; // ring of recent load ratios
+    float sorted[windowblocks]; // scratch for the percentile
+    int count = 0; // ratios in the ring since the last step
+    int head = 0;
+    double calmseconds = 0; // time spent under stepupload while held down
+
+    std::atomic<int> limit { PitchShifter::QualityHQ };
+    std::atomic<float> percentile { 0 };
+    std::atomic<int> stepsdown { 0 };
+    std::atomic<int> stepsup { 0 };
+};
+
+#endif
@@ -0,0 +1,72 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+#ifndef __PITCHHISTORY__
+#define __PITCHHISTORY__
+#include <atomic>
+
+// What the shifter decided on one analysis hop
+struct PitchRecord
+{
+    float pitch; // detected pitch as a MIDI note, fractional
+    float target; // note the correction is heading for, same scale
+    float confidence; // 0 to 1; voiced from the shifter's threshold up
+    float correction; // semitones of correction applied, after amount and before shift
+};
+
+// Wait-free single-producer single-consumer ring of PitchRecords. The audio
+// thread push()es one per hop and never waits; if the reader has fallen a whole
+// ring behind, the record is dropped and counted instead. Any other thread can
+// pop() them at its own pace.
+class PitchHistory
+{
+public:
+    static const unsigned int capacity = 1024; // power of two, several seconds of hops
+
+    // Producer only
+    bool push(const PitchRecord& record)
+    {
+        unsigned int w = writepos.load (std::memory_order_relaxed);
+
+        if (w - readpos.load (std::memory_order_acquire) >= capacity) {
+            dropped.fetch_add (1, std::memory_order_relaxed);
+            return false;
+        }
+        records[w & (capacity - 1)] = record;
+        writepos.store (w + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only. False when there is nothing new.
+    bool pop(PitchRecord& record)
+    {
+        unsigned int r = readpos.load (std::memory_order_relaxed);
+
+        if (r == writepos.load (std::memory_order_acquire)) {
+            return false;
+        }
+        record = records[r & (capacity - 1)];
+        readpos.store (r + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Records the producer had to drop because the ring was full
+    int getNumDropped() const
+    {
+        return dropped.load (std::memory_order_relaxed);
+    }
+
+private:
+    PitchRecord records[capacity];
+    alignas(64) std::atomic<unsigned int> writepos { 0 };
+    alignas(64) std::atomic<unsigned int> readpos { 0 };
+    std::atomic<int> dropped { 0 };
+};
+
+#endif
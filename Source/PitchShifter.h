@@ -12,125 +12,305 @@
 #include "fftsetup.h"
 #include "mayer_fft.c"
 #include "Scales.h"
+#include "GrainPool.h"
+#include "DspTableCache.h"
+#include "AlignedArena.h"
+#include "PitchHistory.h"
+#include "SpectrumSnapshot.h"
 #include <math.h>
 
 #define L2SC (float)3.32192809488736218171
+#define LPC_MAXORDER 32 // Upper bound on the formant envelope order
+#define LPC_HISTORY 16 // Envelope sets kept to line the synthesis filter up with the grains
+#define MAX_LINKED_CHANNELS 8 // Channels that can share one analysis
+#define MAX_VOICES 8 // Shifter voices (lead plus harmonies) that can share one analysis
+#define MAX_CBSIZE 4096 // Analysis buffer size at the highest sample rates
+#define LIVE_PEAKFRACTION 0.95f // How close to the best peak live tracking's period has to score
 
 class PitchShifter
 {
 public:
     
-    unsigned long originalSampleRate;
-    unsigned long fs; // Sample rate
+    enum ShifterModes{
+        ShifterOLA=0, // resampled N-length grains, the original shifter
+        ShifterPSOLA // two-period grains at pitch marks, no resampling
+    };
+    
+    enum HarmonyModes{
+        HarmonyOff=0, // lead voice only
+        HarmonyScale, // voices sit a number of scale steps from the corrected lead
+        HarmonyMidi // voices sing the MIDI notes assigned to them
+    };
+    
+    enum LatencyModes{
+        LatencyStandard=0, // full-size analysis, grains centred N/2 behind and ahead (N - 1 samples)
+        LatencyLive // short analysis, PSOLA grains from the most recent periods only (about 12ms)
+    };
+    
+    // Same buffers and latency in every tier, so they switch while running
+    enum QualityTiers{
+        QualityEco=0, // pitch analysis every half window, nearest-sample grains
+        QualityStandard, // analysis every quarter window, nearest-sample grains (the original)
+        QualityHQ // analysis every eighth window, interpolated OLA grains, sub-sample pitch periods
+    };
+    
+    // Continuous parameters that can change part way through a block
+    enum AutomationParameters{
+        AutomateMix=0,
+        AutomateShift,
+        AutomateTune,
+        AutomateAmount,
+        AutomateGlide,
+        NumAutomationParameters
+    };
+    
+    // A setter call at a sample offset into the block
+    struct ParameterEvent
+    {
+        int sampleOffset;
+        int parameter; // one of AutomationParameters
+        float value;
+    };
     
+    unsigned long originalSampleRate = 0;
+    unsigned long fs = 0; // Sample rate
+    
+    // Cheap: nothing is allocated until the host calls init()
     PitchShifter()
     {
-        init(fs);
-        
         //By default we have root of C and scale is Chromatic
         setScale(scales.NoteC, scales.Chromatic);
     }
     
     ~PitchShifter()
     {
-        fft_des(fmembvars);
     };
     
+    // Back to silence and no pitch history, as init() leaves it. Doesn't allocate;
+    // the cost is clearing the buffers.
     void Reset()
     {
-        unsigned long sr = fs;
+        if (fmembvars == nullptr) {
+            return;
+        }
+        
+        arena.clear();
+        for (int c = 0; c < numchannels; c++) {
+            channels[c].grainpool.clear();
+        }
+        grainwindows.clear();
+        
+        cBufferWriteIndex = 0;
+        cbord = 0;
+        
+        aref = 440;
+        qualityactive = quality;
+        applyQuality();
+        pperiod = pmax;
+        pitch = 0;
+        conf = 0;
+        lrshift = 0;
+        ptarget = 0;
+        sptarget = 0;
+        wasvoiced = 0;
+        persistamt = 0;
+        
+        // Smoothed parameters start at their targets
+        shiftcur = fShift;
+        amountcur = fAmount;
+        mixcur = fMix;
+        mixstep = 0;
+        mixtarget = fMix;
+        
+        phprd = phprdd;
+        phinc = (float)1/(phprd * fs);
+        phasein = 0;
+        
+        prevvoices = 1;
+        for (int v = 0; v < MAX_VOICES; v++) {
+            voices[v].phincfact = 1;
+            voices[v].phincstep = 0;
+            voices[v].phaseout = 0;
+            voices[v].fragsize = 0;
+            voices[v].lrshift = 0;
+            voices[v].active = (v == 0);
+        }
+        
+        resetFormantState();
+        formantactive = false;
+        psolamark = 0;
+        psoladue = 0;
+        sampleclock = 0;
+        analysisstage = AnalysisIdle;
         
-        if( fs != sr) init(sr);
+        // Already at identity settings means starting straight on the fast path
+        identitygain = isIdentity() ? 0 : 1;
+        identityhold = 0;
+        identityidle = false;
     }
     
-    void ProcessFloatReplacing(const float** inputs, float** outputs, int nFrames)
+    // Linked processing of the numchannels channels given to init(). Pitch is analysed
+    // once on the channel average and every channel is shifted with the same grain
+    // schedule, so each extra channel only adds its overlap-add work. Inputs and
+    // outputs may point at the same buffers.
+    void ProcessFloatReplacing(const float* const* inputs, float* const* outputs, int nFrames)
     {
-        const float* in1 = inputs[0];
-        float* out1 = outputs[0];
-        float* out2 = outputs[1];
-        float fPersist = glidepersist;
-
-        aref = (float)440 * pow(2, fTune / 12);
-
+        process(inputs, outputs, nFrames);
+    }
+    
+    // Double-precision I/O for hosts that offer it. The engine itself runs in float.
+    void ProcessDoubleReplacing(const double* const* inputs, double* const* outputs, int nFrames)
+    {
+        process(inputs, outputs, nFrames);
+    }
+    
+    // As below, with each event applied just before the sample at its offset.
+    // Events must be in order of offset; the block is processed in pieces
+    // between them, so nothing is allocated.
+    template <typename SampleType>
+    void process(const SampleType* const* inputs, SampleType* const* outputs, int nFrames,
+                 const ParameterEvent* events, int numEvents)
+    {
+        const SampleType* segmentin[MAX_LINKED_CHANNELS];
+        SampleType* segmentout[MAX_LINKED_CHANNELS];
+        int s = 0, end, i = 0;
+        
+        while (s < nFrames) {
+            while (i < numEvents && events[i].sampleOffset <= s) {
+                applyEvent(events[i++]);
+            }
+            end = (i < numEvents && events[i].sampleOffset < nFrames) ? events[i].sampleOffset : nFrames;
+            for (int c = 0; c < numchannels; c++) {
+                segmentin[c] = inputs[c] + s;
+                segmentout[c] = outputs[c] + s;
+            }
+            process(segmentin, segmentout, end - s);
+            s = end;
+        }
+        // Anything stamped past the block still lands before the next one
+        while (i < numEvents) {
+            applyEvent(events[i++]);
+        }
+    }
+    
+    template <typename SampleType>
+    void process(const SampleType* const* inputs, SampleType* const* outputs, int nFrames)
+    {
+        // Settings that leave the signal alone skip the shifter altogether, once
+        // the output has faded over to the delayed dry signal
+        bool identity = isIdentity();
+        if (identity && identitygain == 0) {
+            processIdentity(inputs, outputs, nFrames);
+            return;
+        }
+        if (identityidle) {
+            resumeFromIdentity();
+        }
+        bool identityfade = identity || identitygain < 1;
+        float identitystep = (float)noverlap / cbsize;
+        
+        // cbsize is a power of two, so every "% N" below is an "& mask"
         unsigned long N = cbsize;
-        unsigned long Nf = corrsize;
+        unsigned long mask = cbmask;
 
-        long int ti, ti2, ti3;
+        long int ti, ti2, ti3, ti4;
+        long int wq = 0, wr = 0, wstep = 0, wrem = 0;
         float tf, tf2, tf3;
+        int c, v;
+
+        // Mono analyses its own input, wider buses analyse the channel average
+        const float* abuf = (numchannels > 1) ? circularBuffer : channels[0].cbin;
+        float chgain = (float)1 / numchannels;
+
+        // Voices dropped since the last block must not replay their pending grains later
+        int nvoices = (harmonymode == HarmonyOff) ? 1 : numvoices;
+        if (nvoices < prevvoices) {
+            for (c = 0; c < numchannels; c++) {
+                for (ti = nvoices * N; ti < (long)(prevvoices * N); ti++) {
+                    channels[c].cbo[ti] = 0;
+                }
+            }
+        }
+        prevvoices = nvoices;
+        // MIDI voices without a note only play out what they already placed
+        for (v = 0; v < nvoices; v++) {
+            voices[v].active = (v == 0 || harmonymode == HarmonyScale || voices[v].note >= 0);
+        }
+        // Voices out of use keep their rate until a hop gives them a new one
+        for (v = nvoices; v < MAX_VOICES; v++) {
+            voices[v].phincstep = 0;
+        }
+        // A mix change between hop boundaries ramps to its target by the next one
+        if (fMix != mixtarget) {
+            mixtarget = fMix;
+            mixstep = (fMix - mixcur) / (N / noverlap - (cBufferWriteIndex & hopmask));
+        }
+
+        // Live tracking has no look-ahead, which only the PSOLA shifter can work with
+        bool psola = (shiftermode == ShifterPSOLA || latencymode == LatencyLive);
+
+        // Residual buffer is stale if formant preservation was just switched on
+        if (formantpreserve != formantactive) {
+            resetFormantState();
+            formantactive = formantpreserve;
+        }
 
         for (int s = 0; s < nFrames; ++s)
         {
-            // Load data into circular buffer
-            tf = (float)in1[s];
-            circularBuffer[cBufferWriteIndex] = tf;
+            // Load data into circular buffers
+            tf = 0;
+            for (c = 0; c < numchannels; c++) {
+                ChannelState& ch = channels[c];
+                tf2 = (float)inputs[c][s];
+                ch.cbin[cBufferWriteIndex] = tf2;
+                if (formantactive) {
+                    ch.cbres[cBufferWriteIndex] = formantWhiten(ch.lpcwstate, tf2);
+                }
+                tf += tf2;
+            }
+            if (numchannels > 1) {
+                circularBuffer[cBufferWriteIndex] = tf * chgain;
+            }
             cBufferWriteIndex++;
             if (cBufferWriteIndex >= N) {
                 cBufferWriteIndex = 0;
             }
+            sampleclock++;
 
             // ********************
             // * Low-rate section *
             // ********************
 
-            // Every N/noverlap samples, run pitch estimation / correction code
-            if ((cBufferWriteIndex) % (N / noverlap) == 0)
+            // Every N/noverlap samples, act on the last analysis and start the next
+            if ((cBufferWriteIndex & hopmask) == 0)
             {
-                // ---- Obtain autocovariance ----
+                // ---- Quality tier ----
 
-                // Window and fill FFT buffer
-                ti2 = (long)cBufferWriteIndex;
-                for (ti = 0; ti < (long)N; ti++) {
-                    ffttime[ti] = (float)(circularBuffer[(ti2 - ti) % N] * cbwindow[ti]);
+                // A new tier takes over on a hop boundary that every tier shares,
+                // so the mix ramp below always spans exactly one hop
+                if (quality != qualityactive && (cBufferWriteIndex & (N / 2 - 1)) == 0) {
+                    qualityactive = quality;
+                    applyQuality();
                 }
 
-                // Calculate FFT
-                fft_forward(fmembvars, ffttime.data(), fftfreqre.data(), fftfreqim.data());
+                // ---- Parameter smoothing ----
 
-                // Remove DC
-                fftfreqre[0] = 0;
-                fftfreqim[0] = 0;
-
-                // Take magnitude squared
-                for (ti = 1; ti < (long)Nf; ti++) {
-                    fftfreqre[ti] = (fftfreqre[ti]) * (fftfreqre[ti]) + (fftfreqim[ti]) * (fftfreqim[ti]);
-                    fftfreqim[ti] = 0;
-                }
+                // Shift and amount approach their targets once per hop, mix ramps
+                // linearly over the coming hop. Steady parameters leave all three exact.
+                shiftcur = shiftcur + (fShift - shiftcur) * smoothcoef;
+                amountcur = amountcur + (fAmount - amountcur) * smoothcoef;
+                mixstep = (fMix - mixcur) / (N / noverlap);
+                mixtarget = fMix;
 
-                // Calculate IFFT
-                fft_inverse(fmembvars, fftfreqre.data(), fftfreqim.data(), ffttime.data());
-
-                // Normalize
-                for (ti = 1; ti < (long)N; ti++) {
-                    ffttime[ti] = ffttime[ti] / ffttime[0];
-                }
-                ffttime[0] = 1;
-
-                // ---- END Obtain autocovariance ----
-
-                // ---- Calculate pitch and confidence ----
-
-                // Calculate pitch period
-                tf2 = 0;
-                pperiod = pmin;
-                for (ti = nmin; ti < (long)nmax; ti++) {
-                    ti2 = ti - 1;
-                    ti3 = ti + 1;
-                    if (ti2 < 0) ti2 = 0;
-                    if (ti3 > (long)Nf) ti3 = Nf;
-                    tf = ffttime[ti];
+                // ---- Publish the analysis ----
 
-                    if (tf > ffttime[ti2] && tf >= ffttime[ti3] && tf > tf2) {
-                        tf2 = tf;
-                        conf = tf * acwinv[ti];
-                        pperiod = (float)ti / fs;
-                    }
+                // The stages below finished the window that ended one hop ago; its
+                // envelope takes over from here, like its pitch does below
+                if (formantpending) {
+                    lpchead = (lpchead + 1) % LPC_HISTORY;
+                    formantpending = false;
                 }
 
-                // Convert to semitones
-                pitch = (float)-12 * log10((float)aref * pperiod) * L2SC;
-
-                // ---- END Calculate pitch and confidence ----
-
                 // ---- Determine pitch target ----
 
                 // If voiced
@@ -173,14 +353,12 @@ public:
                     // Glide on circular scale
                     tf3 = (float)ptarget - sptarget;
                     tf3 = tf3 - (float)12 * floorf(tf3 / 12 + 0.5);
-                    tf2 = (fGlide > 0) ? (1 - pow((float)1 / 24, (float)N * 1000 / (noverlap * fs * fGlide))) : 1;
-                    sptarget = sptarget + tf3 * tf2;
+                    sptarget = sptarget + tf3 * glidecoef;
                 }
                 // If not voiced
                 else {
                     wasvoiced = 0;
-                    tf = (fPersist > 0) ? pow((float)1 / 2, (float)N * 1000 / (noverlap * fs * fPersist)) : 0;
-                    persistamt = persistamt * tf; // Persist amount decays exponentially
+                    persistamt = persistamt * persistcoef; // Persist amount decays exponentially
                 }
                 // END If voiced
 
@@ -192,14 +370,56 @@ public:
                 if (conf < vthresh) {
                     tf = 0;
                 }
-                lrshift = fShift + fAmount * tf; // Add in pitch shift slider
+                lrshift = shiftcur + amountcur * tf; // Add in pitch shift slider
+
+                if (history != nullptr) {
+                    history->push ({ 69 + pitch, 69 + pitch + tf, conf, amountcur * tf });
+                }
+                if (spectrum != nullptr && spectrum->isEnabled()) {
+                    // The bands came from this same analysis, in its forward stage
+                    SpectrumSnapshot& ss = spectrum->getWriteBuffer();
+                    ss.fundamental = (float)1 / pperiod;
+                    ss.target = ss.fundamental * (float)pow(2, tf / 12);
+                    ss.confidence = conf;
+                    spectrum->publish();
+                }
 
                 // ---- Compute variables for pitch shifter that depend on pitch ----
-                phincfact = (float)pow(2, lrshift / 12);
+                // Each voice's rate glides to its new value over the coming hop
+                voices[0].phincstep = ((float)pow(2, lrshift / 12) - voices[0].phincfact) / (N / noverlap);
                 if (conf >= vthresh) {
                     phinc = (float)1 / (pperiod * fs);
                     phprd = pperiod * 2;
                 }
+
+                // ---- Harmony voices ----
+                for (v = 1; v < nvoices; v++) {
+                    Voice& vo = voices[v];
+                    if (harmonymode == HarmonyMidi) {
+                        // Keep the last shift through unvoiced frames
+                        if (vo.note >= 0 && conf >= vthresh) {
+                            vo.lrshift = (float)(vo.note - 69) - pitch;
+                        }
+                    }
+                    else {
+                        vo.lrshift = lrshift + scaleStepsToSemitones(ptarget, vo.interval);
+                    }
+                    if (vo.lrshift > 24) vo.lrshift = 24;
+                    if (vo.lrshift < -24) vo.lrshift = -24;
+                    vo.phincstep = ((float)pow(2, vo.lrshift / 12) - vo.phincfact) / (N / noverlap);
+                }
+
+                // ---- Start analysing the window that ends here ----
+                analysisbase = cBufferWriteIndex;
+                analysisstage = AnalysisWindow;
+                analysisstep = 0;
+                analysispass = 0;
+            }
+
+            // The analysis runs in steps spread evenly over the hop, each FFT one
+            // hartley pass at a time, so no single block pays for a whole transform
+            if (analysisstage < AnalysisIdle && (cBufferWriteIndex & hopmask) >= analysisstep * stagespacing) {
+                runAnalysisStage(abuf);
             }
             // ************************
             // * END Low-Rate Section *
@@ -211,42 +431,137 @@ public:
 
             // Pitch shifter (overlap-add, pitch synchronous)
             phasein = phasein + phinc;
-            phaseout = phaseout + phinc * phincfact;
+
+            // PSOLA cuts a grain at each of the signal's own pitch marks as it comes due
+            if (psola && (long)(sampleclock - psolamark) >= psoladue) {
+                capturePsolaGrains(abuf);
+            }
 
             // When input phase resets, take a snippet from N/2 samples in the past
             if (phasein >= 1) {
                 phasein = phasein - 1;
-                ti2 = cBufferWriteIndex - (long int)N / 2;
-                for (ti = -((long int)N) / 2; ti < (long int)N / 2; ti++) {
-                    frag[ti % N] = circularBuffer[(ti + ti2) % N];
+                if (!psola) {
+                    ti2 = cBufferWriteIndex - (long int)N / 2;
+                    for (c = 0; c < numchannels; c++) {
+                        ChannelState& ch = channels[c];
+                        // Grains are cut from the whitened residual when preserving formants
+                        const float* src = formantactive ? ch.cbres : ch.cbin;
+                        for (ti = -((long int)N) / 2; ti < (long int)N / 2; ti++) {
+                            ch.frag[ti & mask] = src[(ti + ti2) & mask];
+                        }
+                    }
+                }
+            }
+
+            // Every voice reads the same grain captures at its own output rate
+            for (v = 0; v < nvoices; v++) {
+                Voice& vo = voices[v];
+                if (!vo.active) {
+                    continue;
+                }
+                vo.phincfact = vo.phincfact + vo.phincstep;
+                vo.phaseout = vo.phaseout + phinc * vo.phincfact;
+
+                // PSOLA: overlap-add the grain nearest the analysis centre at the output mark
+                if (vo.phaseout >= 1 && psola) {
+                    vo.phaseout = vo.phaseout - 1;
+                    placePsolaGrains(v * N);
+                }
+
+                // When output phase resets, put a snippet N/2 samples in the future
+                if (vo.phaseout >= 1) {
+                    vo.fragsize = vo.fragsize * 2;
+                    if (vo.fragsize >= N) {
+                        vo.fragsize = N;
+                    }
+                    vo.phaseout = vo.phaseout - 1;
+                    ti2 = cbord + N / 2;
+                    ti3 = (long int)(((float)vo.fragsize) / vo.phincfact);
+                    // The window index ti * N / ti3 (truncated) is stepped as a floored
+                    // quotient and remainder, so there's one division per grain
+                    if (ti3 > 1) {
+                        wstep = (long int)N / ti3;
+                        wrem = (long int)N % ti3;
+                        wq = (-ti3 / 2) * (long int)N / ti3;
+                        wr = (-ti3 / 2) * (long int)N % ti3;
+                        if (wr < 0) {
+                            wr += ti3;
+                            wq--;
+                        }
+                    }
+                    for (ti = -ti3 / 2; ti < (ti3 / 2); ti++) {
+                        tf = hannwindow[(long int)N / 2 + wq + ((ti < 0 && wr != 0) ? 1 : 0)];
+                        wq += wstep;
+                        wr += wrem;
+                        if (wr >= ti3) {
+                            wr -= ti3;
+                            wq++;
+                        }
+                        if (grainlerp) {
+                            // Linear interpolation between the two nearest fragment samples
+                            tf3 = vo.phincfact * ti;
+                            ti4 = (long int)floorf(tf3);
+                            tf3 = tf3 - ti4;
+                            for (c = 0; c < numchannels; c++) {
+                                ChannelState& ch = channels[c];
+                                float* cbo = ch.cbo + v * N;
+                                tf2 = ch.frag[ti4 & mask];
+                                tf2 = tf2 + tf3 * (ch.frag[(ti4 + 1) & mask] - tf2);
+                                cbo[(ti + ti2) & mask] = cbo[(ti + ti2) & mask] + tf2 * tf;
+                            }
+                        }
+                        else {
+                            for (c = 0; c < numchannels; c++) {
+                                ChannelState& ch = channels[c];
+                                float* cbo = ch.cbo + v * N;
+                                cbo[(ti + ti2) & mask] = cbo[(ti + ti2) & mask] + ch.frag[((int)(vo.phincfact * ti)) & mask] * tf;
+                            }
+                        }
+                    }
+                    vo.fragsize = 0;
                 }
+                vo.fragsize++;
             }
 
-            // When output phase resets, put a snippet N/2 samples in the future
-            if (phaseout >= 1) {
-                fragsize = fragsize * 2;
-                if (fragsize >= N) {
-                    fragsize = N;
-                }
-                phaseout = phaseout - 1;
-                ti2 = cbord + N / 2;
-                ti3 = (long int)(((float)fragsize) / phincfact);
-                for (ti = -ti3 / 2; ti < (ti3 / 2); ti++) {
-                    tf = hannwindow[(long int)N / 2 + ti * (long int)N / ti3];
-                    cbo[(ti + ti2) % N] = cbo[(ti + ti2) % N] + frag[((int)(phincfact * ti)) % N] * tf;
-                    cbonorm[(ti + ti2) % N] = cbonorm[(ti + ti2) % N] + tf;
-                }
-                fragsize = 0;
+            // Get output signal from each channel's buffers, summing the voices
+            ti2 = (cBufferWriteIndex + N - 1 - latencysamples) & mask; // dry signal read index, lined up with the wet
+            mixcur = mixcur + mixstep;
+            
+            // Over a hop into or out of the identity fast path; coming out, the output
+            // stays dry until the shifter has fresh pitch and grains again
+            if (identityfade) {
+                if (identity) {
+                    identitygain = (identitygain > identitystep) ? identitygain - identitystep : 0;
+                }
+                else if (identityhold > 0) {
+                    identityhold--;
+                }
+                else {
+                    identitygain = (identitygain < 1 - identitystep) ? identitygain + identitystep : 1;
+                }
+            }
+            for (c = 0; c < numchannels; c++) {
+                ChannelState& ch = channels[c];
+                tf = 0;
+                for (v = 0; v < nvoices; v++) {
+                    tf += voices[v].level * ch.cbo[v * N + cbord];
+                    ch.cbo[v * N + cbord] = 0; // erase for next cycle
+                }
+
+                // Put the original envelope back on the shifted residual
+                if (formantactive) {
+                    tf = formantColour(ch.lpccstate, tf);
+                }
+
+                // Write audio to output of plugin
+                if (identityfade) {
+                    tf2 = (float)((double)mixcur * tf + (1.0 - mixcur) * ch.cbin[ti2]);
+                    outputs[c][s] = (SampleType)(ch.cbin[ti2] + identitygain * (tf2 - ch.cbin[ti2]));
+                }
+                else {
+                    outputs[c][s] = (SampleType)((double)mixcur * tf + (1.0 - mixcur) * ch.cbin[ti2]);
+                }
             }
-            fragsize++;
-
-            // Get output signal from buffer and normalize
-            tf = cbonorm[cbord];
-            tf = (tf > 0.5) ? (float)1 / tf : 1;
-            tf = tf * cbo[cbord]; // read buffer
-            tf = cbo[cbord];
-            cbo[cbord] = 0; // erase for next cycle
-            cbonorm[cbord] = 0;
             cbord++;
             if (cbord >= N) {
                 cbord = 0;
@@ -255,10 +570,6 @@ public:
             // *********************
             // * END Pitch Shifter *
             // *********************
-
-            // Write audio to output of plugin
-            out1[s] = (double)fMix * tf + (1.0 - fMix) * circularBuffer[(cBufferWriteIndex - N + 1) % N];
-            out2[s] = (double)fMix * tf + (1.0 - fMix) * circularBuffer[(cBufferWriteIndex - N + 1) % N];
         }
     }
 
@@ -562,97 +873,121 @@ public:
 //        }
 //    }
     
-    void init(unsigned long sr)
+    // maxVoices sets how many harmony voices can later be switched on without allocating
+    // Not realtime safe. Every buffer is carved from one aligned arena, which the
+    // first init() makes big enough for these channels and voices at any sample
+    // rate. It's only reallocated for more channels or voices, and calling init()
+    // again with the same arguments just resets the state, which clears the
+    // buffers in use.
+    void init(unsigned long sr, int numChannels = 1, int maxVoices = 1, int latencyMode = LatencyStandard)
     {
-        originalSampleRate = sr;
         unsigned long ti;
+        float tf;
         
+        numChannels = (numChannels < 1) ? 1 : (numChannels > MAX_LINKED_CHANNELS ? MAX_LINKED_CHANNELS : numChannels);
+        maxVoices = (maxVoices < 1) ? 1 : (maxVoices > MAX_VOICES ? MAX_VOICES : maxVoices);
+        if (fmembvars != nullptr && sr == fs && numChannels == numchannels && maxVoices == allocvoices && latencyMode == latencymode) {
+            Reset();
+            return;
+        }
+        
+        originalSampleRate = sr;
         fs = sr;
-        aref = 440;
+        latencymode = latencyMode;
         
+        // Live tracking analyses half the buffer and gives up the lowest notes, so
+        // two periods always fit in its window
         if (fs >=88200) {
-            cbsize = 4096;
+            cbsize = (latencymode == LatencyLive) ? MAX_CBSIZE / 2 : MAX_CBSIZE;
         }
         else {
-            cbsize = 2048;
+            cbsize = (latencymode == LatencyLive) ? 1024 : 2048;
         }
         corrsize = cbsize / 2 + 1;
         
-        pmax = 1/(float)70;
+        pmax = 1/(float)((latencymode == LatencyLive) ? 140 : 70);
         pmin = 1/(float)700;
         
-        pperiod = pmax;
-        
         nmax = (unsigned long)(fs * pmax);
         if (nmax > corrsize) {
             nmax = corrsize;
         }
         nmin = (unsigned long)(fs * pmin);
         
-        circularBuffer.resize (cbsize);
-        cbo.resize (cbsize);
-        cbonorm.resize (cbsize);
+        for (ti = 0; ti <= SPECTRUM_BANDS; ti++) {
+            spectrumedges[ti] = (long)(SpectrumSnapshot::getBandFrequency ((float)ti) * cbsize / fs + 0.5);
+        }
         
-        cBufferWriteIndex = 0;
-        cbord = 0;
+        numchannels = numChannels;
+        allocvoices = maxVoices;
+        if (numvoices > allocvoices) {
+            numvoices = allocvoices;
+        }
+        
+        cbmask = cbsize - 1;
         
-        hannwindow.resize (cbsize);
-        for (ti=0; ti<cbsize; ti++) {
-            hannwindow[ti] = -0.5*cos(2*M_PI*ti/(cbsize - 1)) + 0.5;
+        // Windows and the window autocorrelation are shared by every shifter of this
+        // size and mode. Live tracking's buffer is short for its lowest periods, so
+        // it analyses most of it rather than the middle half.
+        ti = (latencymode == LatencyLive) ? DspTableCache::WindowLiveHann : DspTableCache::WindowHalfHann;
+        if (tables == nullptr || tables->cbsize != cbsize || tables->windowType != (int)ti) {
+            tables = DspTableCache::acquire (cbsize, (int)ti);
+            hannwindow = tables->hannwindow;
+            cbwindow = tables->cbwindow;
+            acwinv = tables->acwinv;
         }
         
-        cbwindow.resize (cbsize);
-        for (ti=0; ti<(cbsize / 2); ti++) {
-            cbwindow[ti+cbsize/4] = -0.5*cos(4*M_PI*ti/(cbsize - 1)) + 0.5;
+        // A sine of amplitude A peaks at A/2 times the window's sum in the FFT
+        tf = 0;
+        for (ti = 0; ti < cbsize; ti++) {
+            tf += cbwindow[ti];
         }
+        spectrumscale = (float)4 / (tf * tf);
         
-        noverlap = 4;
+        glidepersist = 100;
         
-        fmembvars = fft_con (cbsize);
+        vthresh = 0.8;
         
-        ffttime.resize (cbsize);
-        fftfreqre.resize (cbsize);
-        fftfreqim.resize (cbsize);
+        phprdd = 0.01;
         
-        acwinv.resize (cbsize);
-        for (ti=0; ti<cbsize; ti++) {
-            ffttime[ti] = cbwindow[ti];
+        // Voice 0 is the corrected lead, the rest default to stacked thirds
+        for (int v = 0; v < MAX_VOICES; v++) {
+            voices[v].interval = 2 * v;
+            voices[v].note = -1;
+            voices[v].level = 1;
         }
-        fft_forward(fmembvars, cbwindow.data(), fftfreqre.data(), fftfreqim.data());
-        for (ti=0; ti<corrsize; ti++) {
-            fftfreqre[ti] = (fftfreqre[ti])*(fftfreqre[ti]) + (fftfreqim[ti])*(fftfreqim[ti]);
-            fftfreqim[ti] = 0;
+        
+        // Envelope order grows with bandwidth, one pole pair per ~1kHz up to LPC_MAXORDER
+        lpcorder = 2 + (int)(fs / 2000);
+        if (lpcorder > LPC_MAXORDER) {
+            lpcorder = LPC_MAXORDER;
         }
-        fft_inverse(fmembvars, fftfreqre.data(), fftfreqim.data(), ffttime.data());
-        for (ti=1; ti<cbsize; ti++) {
-            acwinv[ti] = ffttime[ti]/ffttime[0];
-            if (acwinv[ti] > 0.000001) {
-                acwinv[ti] = (float)1/acwinv[ti];
-            }
-            else {
-                acwinv[ti] = 0;
-            }
+        // Gaussian lag window widens the formant bandwidths so pitch harmonics don't leak in
+        for (ti=0; ti<=LPC_MAXORDER; ti++) {
+            tf = 2 * M_PI * 60 * ti / fs;
+            lpclagwin[ti] = exp(-0.5 * tf * tf);
         }
-        acwinv[0] = 1;
         
-        lrshift = 0;
-        ptarget = 0;
-        sptarget = 0;
-        wasvoiced = 0;
-        persistamt = 0;
-        
-        glidepersist = 100;
-        
-        vthresh = 0.8;
+        // Grains span two periods and must fit behind the analysis centre. Live
+        // tracking caps them at 3/16 of its window (~4ms a side), so lower voices
+        // get grains shorter than two periods rather than more latency.
+        psolamaxperiod = nmax;
+        if (psolamaxperiod > cbsize / 2 - 1) {
+            psolamaxperiod = cbsize / 2 - 1;
+        }
+        if (latencymode == LatencyLive && psolamaxperiod > cbsize * 3 / 16) {
+            psolamaxperiod = cbsize * 3 / 16;
+        }
+        // A grain is placed as soon as its first half can still be heard, and taken
+        // from the analysis centre. Marks can only be cut once a period and a
+        // quarter old, so live tracking keeps its centre half a period behind that
+        // or the grain nearest it would often not have been cut yet.
+        grainlead = (latencymode == LatencyLive) ? psolamaxperiod : cbsize / 2;
+        grainlag = (latencymode == LatencyLive) ? psolamaxperiod * 7 / 4 + 1 : cbsize / 2;
+        latencysamples = grainlag + grainlead - 1;
         
-        phprdd = 0.01;
-        phprd = phprdd;
-        phinc = (float)1/(phprd * fs);
-        phincfact = 1;
-        phasein = 0;
-        phaseout = 0;
-        frag.resize (cbsize);
-        fragsize = 0;
+        carveBuffers();
+        Reset();
     }
     
     void setMixAmount(float mixAmt){
@@ -663,12 +998,55 @@ public:
     }
     void setTuneAmount(float tuneAmt){
         fTune = tuneAmt;
+        updateCoefficients();
     }
     void setAmountAmount(float amtAmt){
         fAmount = amtAmt;
     }
     void setGlideAmount(float glideAmt){
         fGlide = glideAmt;
+        updateCoefficients();
+    }
+    void setFormantPreservation(bool preserve){
+        formantpreserve = preserve;
+    }
+    void setShifterMode(int mode){
+        shiftermode = mode;
+    }
+    void setHarmonyMode(int mode){
+        harmonymode = mode;
+    }
+    // Host bypass: the delayed dry signal, faded to like any other identity setting
+    void setBypassed(bool bypass){
+        bypassed = bypass;
+    }
+    // Ring that each analysis hop's pitch, target, confidence and correction
+    // are pushed onto, or nullptr for none. Only one shifter may feed a ring.
+    void setPitchHistory(PitchHistory* h){
+        history = h;
+    }
+    // Triple buffer that each hop's spectrum, decimated to bands, is published
+    // to while it is enabled, or nullptr for none. Only one shifter may feed it.
+    void setSpectrum(SpectrumBuffer* s){
+        spectrum = s;
+    }
+    // Realtime safe; the audio thread switches over within half a window
+    void setQuality(int tier){
+        quality = (tier < QualityEco) ? QualityEco : (tier > QualityHQ ? QualityHQ : tier);
+    }
+    // Voice count includes the lead, and is limited to the maxVoices given to init()
+    void setNumVoices(int n){
+        numvoices = (n < 1) ? 1 : (n > allocvoices ? allocvoices : n);
+    }
+    void setVoiceInterval(int voice, int scaleSteps){
+        if (voice > 0 && voice < MAX_VOICES) voices[voice].interval = scaleSteps;
+    }
+    // MIDI note for a harmony voice in HarmonyMidi mode, -1 to release it
+    void setVoiceNote(int voice, int midiNote){
+        if (voice > 0 && voice < MAX_VOICES) voices[voice].note = midiNote;
+    }
+    void setVoiceLevel(int voice, float level){
+        if (voice >= 0 && voice < MAX_VOICES) voices[voice].level = level;
     }
     
     void setScale(int root, int scale){
@@ -681,6 +1059,28 @@ public:
       }
     }
     
+    // Everything the setters above give another shifter, bar its history and
+    // spectrum outputs; for one that missed some of them while it was busy
+    void copySettings(const PitchShifter& other){
+        setMixAmount(other.fMix);
+        setShiftAmount(other.fShift);
+        setTuneAmount(other.fTune);
+        setAmountAmount(other.fAmount);
+        setGlideAmount(other.fGlide);
+        setFormantPreservation(other.formantpreserve);
+        setShifterMode(other.shiftermode);
+        setHarmonyMode(other.harmonymode);
+        setBypassed(other.bypassed);
+        setQuality(other.quality);
+        setNumVoices(other.numvoices);
+        for (int v = 0; v < MAX_VOICES; v++) {
+            voices[v].interval = other.voices[v].interval;
+            voices[v].note = other.voices[v].note;
+            voices[v].level = other.voices[v].level;
+        }
+        setScale(other.fRoot, other.fScale);
+    }
+    
     float getMixAmount(){
         return fMix;
     }
@@ -702,16 +1102,581 @@ public:
     int getRoot(){
         return fRoot;
     }
+    int getNumChannels(){
+        return numchannels;
+    }
+    bool getFormantPreservation(){
+        return formantpreserve;
+    }
+    int getShifterMode(){
+        return shiftermode;
+    }
+    int getHarmonyMode(){
+        return harmonymode;
+    }
+    int getQuality(){
+        return quality;
+    }
+    bool getBypassed(){
+        return bypassed;
+    }
+    int getNumVoices(){
+        return numvoices;
+    }
+    int getMaxVoices(){
+        return allocvoices;
+    }
+    // Bytes this instance owns: the object and its arena. The window tables are
+    // shared and not counted.
+    size_t getMemoryFootprint(){
+        return sizeof(PitchShifter) + arena.getSize();
+    }
+    int getLatencyMode(){
+        return latencymode;
+    }
+    // Delay of the output, wet and dry alike, for the mode given to init()
+    int getLatencySamples(){
+        return (int)latencysamples;
+    }
+    int getVoiceNote(int voice){
+        return (voice > 0 && voice < MAX_VOICES) ? voices[voice].note : -1;
+    }
+    
+    // Multiply-adds formant preservation should take per analysis hop, worked
+    // out from the envelope order and hop size (the fit, plus the whitening and
+    // synthesis filters over one hop of samples) rather than measured;
+    // Tools/QualityBenchmark times it. 0 while preservation is off.
+    unsigned long getFormantCostEstimate(){
+        return formantcost;
+    }
+    
+    // Samples between analysis hops at the running quality tier
+    int getHopSize(){
+        return (int)(cbsize / noverlap);
+    }
+    
+    // How far behind the hop boundary that publishes a pitch (to the PitchHistory,
+    // say) the centre of the window it was measured on lies
+    int getAnalysisLag(){
+        return (int)(cbsize / noverlap + cbsize / 2);
+    }
     
     //TODO: implement getKey
     
     //TODO: implement getScale
     
 private:
+    // Arena bytes carveBuffers() takes for buffers of n samples and grains of
+    // grainlen, with the current channels and voices
+    size_t layoutBytes(unsigned long n, unsigned long grainlen)
+    {
+        size_t perchannel = 3 * AlignedArena::footprint (n) + AlignedArena::footprint (allocvoices * n)
+                          + AlignedArena::footprint (4 * grainlen);
+        size_t shared = ((numchannels > 1) ? AlignedArena::footprint (n) : 0)
+                      + 2 * AlignedArena::footprint (n) + 2 * AlignedArena::footprint (n / 2 + 1)
+                      + AlignedArena::footprint (grainlen);
+        
+        return numchannels * perchannel + shared;
+    }
+    
+    // Lays every buffer out in the arena, each channel's together, and points
+    // the FFT routine's scratch there too
+    void carveBuffers()
+    {
+        unsigned long grainlen = 2 * psolamaxperiod;
+        
+        // Grains are at most two of the longest periods, which is under half the
+        // buffer, so this is the most any rate needs
+        arena.grow (layoutBytes (MAX_CBSIZE, MAX_CBSIZE - 2));
+        arena.reserve (layoutBytes (cbsize, grainlen));
+        for (int c = 0; c < numchannels; c++) {
+            ChannelState& ch = channels[c];
+            ch.cbin = arena.carve (cbsize);
+            ch.cbres = arena.carve (cbsize);
+            ch.cbo = arena.carve (allocvoices * cbsize);
+            ch.frag = arena.carve (cbsize);
+            ch.grainpool.prepare (4, grainlen, arena.carve (4 * grainlen));
+        }
+        
+        // Channel average for analysis, only used with more than one channel
+        circularBuffer = (numchannels > 1) ? arena.carve (cbsize) : nullptr;
+        ffttime = arena.carve (cbsize);
+        fftfreqre = arena.carve (corrsize);
+        fftfreqim = arena.carve (corrsize);
+        fftvars.nfft = (int)cbsize;
+        fftvars.numfreqs = (int)corrsize;
+        fftvars.fft_data = arena.carve (cbsize);
+        fmembvars = &fftvars;
+        fftpasses = fft_passes (fmembvars);
+        grainwindows.prepare (grainlen, arena.carve (grainlen));
+    }
+    
+    void applyEvent(const ParameterEvent& event)
+    {
+        switch (event.parameter) {
+            case AutomateMix: setMixAmount(event.value); break;
+            case AutomateShift: setShiftAmount(event.value); break;
+            case AutomateTune: setTuneAmount(event.value); break;
+            case AutomateAmount: setAmountAmount(event.value); break;
+            case AutomateGlide: setGlideAmount(event.value); break;
+        }
+    }
+    
+    // Fully dry, bypassed, or only the lead at its own pitch: the output would be
+    // the input, delayed
+    bool isIdentity()
+    {
+        return bypassed || fMix == 0
+            || (fAmount == 0 && fShift == 0 && voices[0].level == 1 && (harmonymode == HarmonyOff || numvoices == 1));
+    }
+    
+    // The delayed dry signal by block copies through each channel's input buffer,
+    // which keeps its history for when the shifter starts again. Chunks are
+    // staged in ffttime, since the outputs may be the inputs.
+    template <typename SampleType>
+    void processIdentity(const SampleType* const* inputs, SampleType* const* outputs, int nFrames)
+    {
+        unsigned long latency = latencysamples;
+        unsigned long ti, ti2, n;
+        
+        if (!identityidle) {
+            enterIdentity();
+        }
+        
+        for (int s = 0; s < nFrames; s += (int)n) {
+            n = ((unsigned long)(nFrames - s) < cbsize) ? (unsigned long)(nFrames - s) : cbsize;
+            ti2 = cBufferWriteIndex + cbsize - latency; // read index of the first output
+            for (int c = 0; c < numchannels; c++) {
+                ChannelState& ch = channels[c];
+                const SampleType* in = inputs[c] + s;
+                SampleType* out = outputs[c] + s;
+                for (ti = 0; ti < n; ti++) {
+                    ffttime[ti] = (float)in[ti];
+                }
+                // Outputs further than the latency into the chunk come from the chunk itself
+                for (ti = 0; ti < n && ti < latency; ti++) {
+                    out[ti] = (SampleType)ch.cbin[(ti2 + ti) & cbmask];
+                }
+                for (; ti < n; ti++) {
+                    out[ti] = (SampleType)ffttime[ti - latency];
+                }
+                for (ti = 0; ti < n; ti++) {
+                    ch.cbin[(cBufferWriteIndex + ti) & cbmask] = ffttime[ti];
+                }
+            }
+            cBufferWriteIndex = (cBufferWriteIndex + n) & cbmask;
+            cbord = (cbord + n) & cbmask;
+            sampleclock += n;
+        }
+    }
+    
+    // Stops the shifter where it is. Its grains are dropped, since they'd play
+    // out at the wrong time later, and the smoothed parameters land on their targets.
+    void enterIdentity()
+    {
+        for (int c = 0; c < numchannels; c++) {
+            memset(channels[c].cbo, 0, allocvoices * cbsize * sizeof(float));
+        }
+        analysisstage = AnalysisIdle;
+        shiftcur = fShift;
+        amountcur = fAmount;
+        mixcur = fMix;
+        mixstep = 0;
+        mixtarget = fMix;
+        identityidle = true;
+    }
+    
+    // Rebuilds what the fast path doesn't keep (the channel average and the
+    // whitened residual) and holds the output dry until two analyses have
+    // published and the first new grains have reached the read pointer
+    void resumeFromIdentity()
+    {
+        unsigned long ti;
+        float tf;
+        float chgain = (float)1 / numchannels;
+        
+        if (numchannels > 1) {
+            for (ti = 0; ti < cbsize; ti++) {
+                tf = 0;
+                for (int c = 0; c < numchannels; c++) {
+                    tf += channels[c].cbin[ti];
+                }
+                circularBuffer[ti] = tf * chgain;
+            }
+        }
+        resetFormantState();
+        identityhold = (long)(grainlag + 2 * (cbsize / noverlap));
+        identityidle = false;
+    }
+    
+    // Hop size and everything derived from it for the tier in qualityactive
+    void applyQuality()
+    {
+        noverlap = (qualityactive == QualityEco) ? 2 : (qualityactive == QualityHQ) ? 8 : 4;
+        grainlerp = (qualityactive == QualityHQ);
+        subsampleperiod = (qualityactive == QualityHQ);
+        hopmask = cbsize / noverlap - 1;
+        stagespacing = cbsize / noverlap / (2 * fftpasses + AnalysisIdle - 2);
+        
+        // ~30ms time constant per hop for the smoothed parameters
+        smoothcoef = 1 - exp(-(double)(cbsize / noverlap) / (0.03 * fs));
+        updateCoefficients();
+        latencyhops = (latencysamples + cbsize / noverlap / 2) / (cbsize / noverlap);
+    }
+    
+    // One step of the pitch analysis of the window that ended at analysisbase:
+    // a whole stage, or one hartley pass of the forward or inverse FFT.
+    // Results are left in ffttime, pitch, pperiod and conf (and the next slot of
+    // lpchist) for the next hop boundary to act on.
+    void runAnalysisStage(const float* abuf)
+    {
+        unsigned long N = cbsize;
+        unsigned long Nf = corrsize;
+        long int ti, ti2, ti3, ti4;
+        float tf, tf2;
+        
+        float* fftdata = fmembvars->fft_data;
+        
+        analysisstep++;
+        switch (analysisstage) {
+            case AnalysisWindow:
+                // Window straight into the FFT buffer
+                for (ti = 0; ti < (long)N; ti++) {
+                    fftdata[ti] = (float)(abuf[(analysisbase - ti) & cbmask] * cbwindow[ti]);
+                }
+                break;
+                
+            case AnalysisForward:
+            case AnalysisInverse:
+                fft_pass(fmembvars, analysispass++);
+                if (analysispass < fftpasses) {
+                    return;
+                }
+                analysispass = 0;
+                break;
+                
+            case AnalysisSpectrum:
+                fft_unpack_forward(fmembvars, fftfreqre, fftfreqim);
+                
+                // Remove DC
+                fftfreqre[0] = 0;
+                fftfreqim[0] = 0;
+                
+                // Take magnitude squared
+                for (ti = 1; ti < (long)Nf; ti++) {
+                    fftfreqre[ti] = (fftfreqre[ti]) * (fftfreqre[ti]) + (fftfreqim[ti]) * (fftfreqim[ti]);
+                    fftfreqim[ti] = 0;
+                }
+                
+                // Peak of each display band, before the inverse FFT reuses the spectrum
+                if (spectrum != nullptr && spectrum->isEnabled()) {
+                    SpectrumSnapshot& ss = spectrum->getWriteBuffer();
+                    for (ti = 0; ti < SPECTRUM_BANDS; ti++) {
+                        tf = 0;
+                        ti3 = (spectrumedges[ti + 1] > spectrumedges[ti]) ? spectrumedges[ti + 1] : spectrumedges[ti] + 1;
+                        for (ti2 = spectrumedges[ti]; ti2 < ti3 && ti2 < (long)Nf; ti2++) {
+                            tf = (fftfreqre[ti2] > tf) ? fftfreqre[ti2] : tf;
+                        }
+                        ss.bands[ti] = tf * spectrumscale;
+                    }
+                }
+                fft_pack_inverse(fmembvars, fftfreqre, fftfreqim);
+                break;
+                
+            case AnalysisPitch:
+                // Normalize the inverse FFT
+                for (ti = 1; ti < (long)N; ti++) {
+                    ffttime[ti] = fftdata[ti] / fftdata[0];
+                }
+                ffttime[0] = 1;
+                
+                // Fit an all-pole envelope to the autocovariance, no extra FFT needed
+                if (formantactive) {
+                    updateFormantEnvelope();
+                }
+                
+                // Calculate pitch period. Live tracking's window holds only a few
+                // periods, so the raw peaks fall away fast enough for a formant's
+                // short lag to outscore the period; it ranks them unbiased instead.
+                // No peak at all, as below the floor, is unvoiced.
+                tf2 = 0;
+                pperiod = pmin;
+                ti4 = 0;
+                conf = 0;
+                for (ti = nmin; ti < (long)nmax; ti++) {
+                    ti2 = ti - 1;
+                    ti3 = ti + 1;
+                    if (ti2 < 0) ti2 = 0;
+                    if (ti3 > (long)Nf) ti3 = Nf;
+                    tf = ffttime[ti];
+                    
+                    if (tf > ffttime[ti2] && tf >= ffttime[ti3] && (latencymode == LatencyLive ? tf * acwinv[ti] : tf) > tf2) {
+                        tf2 = (latencymode == LatencyLive) ? tf * acwinv[ti] : tf;
+                        conf = tf * acwinv[ti];
+                        pperiod = (float)ti / fs;
+                        ti4 = ti;
+                    }
+                }
+                
+                // Unbiased, every multiple of the period scores about the same, so
+                // the first peak nearly as good as the best is the period
+                if (latencymode == LatencyLive) {
+                    for (ti = nmin; ti < ti4; ti++) {
+                        tf = ffttime[ti];
+                        if (tf > ffttime[ti - 1] && tf >= ffttime[ti + 1] && tf * acwinv[ti] >= LIVE_PEAKFRACTION * tf2) {
+                            conf = tf * acwinv[ti];
+                            pperiod = (float)ti / fs;
+                            ti4 = ti;
+                            break;
+                        }
+                    }
+                }
+                
+                // Parabola through the peak and its neighbours for a sub-sample period
+                if (subsampleperiod && ti4 > 0 && ti4 < (long)Nf) {
+                    tf = ffttime[ti4 - 1] - 2 * ffttime[ti4] + ffttime[ti4 + 1];
+                    if (tf < 0) {
+                        pperiod = ((float)ti4 + (float)0.5 * (ffttime[ti4 - 1] - ffttime[ti4 + 1]) / tf) / fs;
+                    }
+                }
+                
+                // Convert to semitones
+                pitch = (float)-12 * log10((float)aref * pperiod) * L2SC;
+                break;
+        }
+        analysisstage++;
+    }
+    
+    // Everything that only changes with tune, glide or the sample rate, so blocks
+    // and hops with steady parameters don't pay for pow()
+    void updateCoefficients()
+    {
+        unsigned long N = cbsize;
+        
+        aref = (float)440 * pow(2, fTune / 12);
+        glidecoef = (fGlide > 0) ? (1 - pow((float)1 / 24, (float)N * 1000 / (noverlap * fs * fGlide))) : 1;
+        persistcoef = (glidepersist > 0) ? pow((float)1 / 2, (float)N * 1000 / (noverlap * fs * glidepersist)) : 0;
+    }
+    
+    // Levinson-Durbin on the normalized autocovariance in ffttime, yielding reflection
+    // coefficients for the lattice filters. Cost is bounded by LPC_MAXORDER^2 per hop.
+    void updateFormantEnvelope()
+    {
+        int p = lpcorder;
+        float a[LPC_MAXORDER + 1];
+        float tmp[LPC_MAXORDER + 1];
+        float* k = lpchist[(lpchead + 1) % LPC_HISTORY]; // published at the next hop boundary
+        float err = 1.0001f; // r[0] is 1 after normalization, plus a little white noise
+        float acc;
+        int i, j;
+        
+        for (i = 0; i < p; i++) {
+            k[i] = 0;
+        }
+        formantpending = true;
+        formantcost = (unsigned long)(p * p + 4 * p * (cbsize / noverlap));
+        
+        // Silent frames normalize to NaN; leave the envelope flat
+        if (!(fabs(ffttime[1]) <= 1)) {
+            return;
+        }
+        
+        a[0] = 1;
+        for (i = 1; i <= p; i++) {
+            acc = ffttime[i] * lpclagwin[i];
+            for (j = 1; j < i; j++) {
+                acc += a[j] * ffttime[i - j] * lpclagwin[i - j];
+            }
+            k[i - 1] = -acc / err;
+            if (k[i - 1] > 0.999f) k[i - 1] = 0.999f;
+            if (k[i - 1] < -0.999f) k[i - 1] = -0.999f;
+            for (j = 1; j < i; j++) {
+                tmp[j] = a[j] + k[i - 1] * a[i - j];
+            }
+            for (j = 1; j < i; j++) {
+                a[j] = tmp[j];
+            }
+            a[i] = k[i - 1];
+            err = err * (1 - k[i - 1] * k[i - 1]);
+        }
+    }
+    
+    // Lattice FIR A(z): strips the current envelope from an input sample
+    float formantWhiten(float* state, float x)
+    {
+        const float* k = lpchist[lpchead];
+        float f = x;
+        float b = x;
+        float bold, fn;
+        
+        for (int i = 0; i < lpcorder; i++) {
+            bold = state[i];
+            state[i] = b;
+            fn = f + k[i] * bold;
+            b = bold + k[i] * f;
+            f = fn;
+        }
+        return f;
+    }
+    
+    // Lattice all-pole 1/A(z), using the envelope that whitened the samples now leaving
+    // the output buffer (getLatencySamples() ago, to the nearest hop)
+    float formantColour(float* state, float e)
+    {
+        const float* k = lpchist[(lpchead + LPC_HISTORY - latencyhops) % LPC_HISTORY];
+        float f = e;
+        
+        for (int i = lpcorder; i >= 1; i--) {
+            f = f - k[i - 1] * state[i - 1];
+            if (i < lpcorder) {
+                state[i] = state[i - 1] + k[i - 1] * f;
+            }
+        }
+        state[0] = f;
+        return f;
+    }
+    
+    // Cut a two-period grain around the next pitch mark from every channel. Marks are
+    // found on the analysis signal: one period after the last, snapped to the signal
+    // peak. Each is cut when it reaches the cut age, half a period short of the
+    // analysis centre (grainlag samples ago), so the marks either side of the centre
+    // are always in the pool; a chain that has lost its place, as after a reset or
+    // the identity fast path, starts again there.
+    void capturePsolaGrains(const float* abuf)
+    {
+        long N = (long)cbsize;
+        long P = (long)(1 / phinc + 0.5);
+        long cut, age, lo, hi, best, j;
+        const float* win;
+        
+        if (P > (long)psolamaxperiod) P = (long)psolamaxperiod;
+        if (P < 2) P = 2;
+        
+        // Every candidate needs a whole period after it
+        cut = (long)grainlag - P / 2;
+        if (cut < P + P / 4 + 1) {
+            cut = P + P / 4 + 1;
+        }
+        age = (long)(sampleclock - psolamark) - P;
+        if (age > cut + P / 2) {
+            age = cut;
+        }
+        lo = age - P / 4;
+        hi = age + P / 4;
+        if (lo < P + 1) lo = P + 1;
+        if (hi > N - P) hi = N - P;
+        
+        best = lo;
+        for (age = lo; age <= hi; age++) {
+            if (abuf[(sampleclock - age) & cbmask] > abuf[(sampleclock - best) & cbmask]) {
+                best = age;
+            }
+        }
+        psolamark = sampleclock - best;
+        psoladue = P + cut;
+        
+        win = grainwindows.get (2 * P);
+        for (int c = 0; c < numchannels; c++) {
+            ChannelState& ch = channels[c];
+            // Grains are cut from the whitened residual when preserving formants
+            const float* src = formantactive ? ch.cbres : ch.cbin;
+            GrainDescriptor& g = ch.grainpool.acquire();
+            g.mark = psolamark;
+            g.length = 2 * P;
+            for (j = 0; j < 2 * P; j++) {
+                g.data[j] = src[(psolamark - P + j) & cbmask] * win[j];
+            }
+        }
+    }
+    
+    // Output side of PSOLA: the grain nearest the analysis centre is added centred
+    // grainlead samples ahead of the read pointer, which keeps the same latency as
+    // the OLA shifter in standard mode
+    // cbooffset selects the voice's slice of each channel's output buffer
+    void placePsolaGrains(unsigned long cbooffset)
+    {
+        unsigned long ti2, j;
+        
+        for (int c = 0; c < numchannels; c++) {
+            ChannelState& ch = channels[c];
+            const GrainDescriptor* g = ch.grainpool.nearest (sampleclock - grainlag);
+            if (g == nullptr) {
+                continue;
+            }
+            float* cbo = ch.cbo + cbooffset;
+            ti2 = cbord + grainlead - g->length / 2;
+            for (j = 0; j < g->length; j++) {
+                cbo[(ti2 + j) & cbmask] += g->data[j];
+            }
+        }
+    }
+    
+    // Walk the current scale from the lead's target note (0 = A) by the given number
+    // of enabled notes and return the distance in semitones
+    float scaleStepsToSemitones(int note, int steps)
+    {
+        int dir = (steps < 0) ? -1 : 1;
+        int semis = 0;
+        int guard = 12 * (steps * dir + 1);
+        
+        while (steps != 0 && guard-- > 0) {
+            semis += dir;
+            if (fNotes[((note + semis) % 12 + 12 + 9) % 12] > 0) {
+                steps -= dir;
+            }
+        }
+        return (float)semis;
+    }
+    
+    void resetFormantState()
+    {
+        for (int i = 0; i < LPC_HISTORY; i++) {
+            for (int j = 0; j < LPC_MAXORDER; j++) {
+                lpchist[i][j] = 0;
+            }
+        }
+        lpchead = 0;
+        formantpending = false;
+        formantcost = 0;
+        for (int c = 0; c < numchannels; c++) {
+            ChannelState& ch = channels[c];
+            for (int j = 0; j < LPC_MAXORDER; j++) {
+                ch.lpcwstate[j] = 0;
+                ch.lpccstate[j] = 0;
+            }
+            // Until the residual buffer refills, grains come from the plain signal
+            for (unsigned long ti = 0; ti < cbsize; ti++) {
+                ch.cbres[ti] = ch.cbin[ti];
+            }
+        }
+    }
+    
 //    void SetScale();
     
 //    bool scales[8][12];
     
+    // ---- Hot state ----
+    // Scalars the sample loop touches outside the buffers, together on the first
+    // two cache lines of the object
+    alignas(64) unsigned long cBufferWriteIndex = 0;
+    unsigned long cbord = 0;
+    unsigned long sampleclock = 0; // samples processed since init, congruent to cBufferWriteIndex mod N
+    unsigned long cbsize = 0; // size of circular buffer
+    unsigned long cbmask = 0; // cbsize - 1, since cbsize is always a power of two
+    unsigned long hopmask = 0; // cbsize / noverlap - 1
+    unsigned long grainlag = 0; // age of the analysis centre
+    unsigned long grainlead = 0; // lead of the synthesis centre over the read pointer
+    unsigned long latencysamples = 0; // getLatencySamples(), grainlag + grainlead - 1
+    unsigned long psolamark = 0; // sample clock of the last analysis pitch mark
+    long psoladue = 0; // age of psolamark at which the next mark is cut
+    float phinc = 0; // input phase increment
+    float phasein = 0;
+    float mixcur = 1.0f; // smoothed fMix
+    float mixstep = 0; // per-sample mix increment for the current hop
+    float mixtarget = 1.0f; // fMix that mixstep is heading for
+    int numchannels = 1;
+    bool formantactive = false; // what formant preservation the audio thread is currently doing
+    
     // parameters
     float fMix = 1.0f; //This is our scaling factor of how much total effect is applied here from 0 -> 1
     //side note, if we place it at 100, it is very loud and creepy autoTuned like a monster
@@ -728,6 +1693,15 @@ private:
     
     int fRoot;
     
+    // Smoothed copies of the parameters above, as the audio path uses them
+    // (mixcur and mixstep are with the hot state)
+    float shiftcur = 0;
+    float amountcur = 1.0f;
+    float smoothcoef; // per-hop one-pole coefficient for shift and amount
+    
+    float glidecoef; // per-hop step of the smoothed target towards the note
+    float persistcoef; // per-hop decay of persistamt while unvoiced
+    
     int fScale;
     
     enum ScaleNames{
@@ -761,28 +1735,58 @@ private:
         NoteB
     };
     
-    fft_vars* fmembvars; // member variables for fft routine
+    fft_vars* fmembvars = nullptr; // member variables for fft routine
     
     Scales scales = Scales();
     
-    unsigned long cbsize; // size of circular buffer
     unsigned long corrsize; // cbsize/2 + 1
-    unsigned long cBufferWriteIndex;
-    unsigned long cbord;
-    std::vector<float> circularBuffer; // circular input buffer
-    std::vector<float> cbo; // circular output buffer
-    std::vector<float> cbonorm; // circular output buffer used to normalize signal
     
-    std::vector<float> cbwindow; // hann of length N/2, zeros for the rest
-    std::vector<float> acwinv; // inverse of autocorrelation of window
-    std::vector<float> hannwindow; // length-N hann
-    int noverlap;
+    // Per-channel state. The analysis and grain schedule are shared. Buffers
+    // point into the arena.
+    struct ChannelState
+    {
+        float* cbin; // circular input buffer
+        float* cbres; // circular buffer of the whitened input
+        float* cbo; // circular output buffers, one slice of cbsize per voice
+        float* frag; // windowed fragment of speech
+        GrainPool grainpool; // recent PSOLA analysis grains
+        float lpcwstate[LPC_MAXORDER]; // whitening lattice state
+        float lpccstate[LPC_MAXORDER]; // synthesis lattice state
+    };
+    
+    ChannelState channels[MAX_LINKED_CHANNELS];
+    float* circularBuffer = nullptr; // circular buffer of the channel average
     
-    std::vector<float> ffttime;
-    std::vector<float> fftfreqre;
-    std::vector<float> fftfreqim;
+    // Every sample buffer above and below, in one block sized for the current layout
+    AlignedArena arena;
+    
+    std::shared_ptr<const ShifterTables> tables; // shared, read-only
+    const float* cbwindow = nullptr; // hann of length N/2, zeros for the rest
+    const float* acwinv = nullptr; // inverse of autocorrelation of window
+    const float* hannwindow = nullptr; // length-N hann
+    int noverlap = 4;
+    
+    float* ffttime = nullptr; // cbsize
+    float* fftfreqre = nullptr; // corrsize, only the non-negative frequencies are used
+    float* fftfreqim = nullptr; // corrsize
+    fft_vars fftvars; // FFT scratch in the arena; fmembvars points here once initialised
     
     // VARIABLES FOR LOW-RATE SECTION
+    // Stages of one hop's analysis, in the order they run
+    enum AnalysisStages{
+        AnalysisWindow=0, // window the newest half of the buffer
+        AnalysisForward, // forward FFT, one step per hartley pass
+        AnalysisSpectrum, // power spectrum, display bands, packed for the inverse
+        AnalysisInverse, // inverse FFT to the autocovariance, one step per pass
+        AnalysisPitch, // normalization, formant envelope, peak search, pitch and confidence
+        AnalysisIdle // all done until the next hop boundary
+    };
+    int analysisstage = AnalysisIdle; // next stage to run
+    int analysispass = 0; // next hartley pass of the FFT stage in progress
+    int fftpasses = 0; // hartley passes per FFT of cbsize points
+    unsigned long analysisstep = 0; // steps run so far this hop
+    unsigned long analysisbase = 0; // write index at the end of the window being analysed
+    unsigned long stagespacing = 0; // samples between steps
     float aref; // A tuning reference (Hz)
     float pperiod; // Pitch period (seconds)
     float pitch; // Pitch (semitones)
@@ -805,13 +1809,60 @@ private:
     // VARIABLES FOR PITCH SHIFTER
     float phprd; // phase period
     float phprdd; // default (unvoiced) phase period
-    float phinc; // input phase increment
-    float phincfact; // factor determining output phase increment
-    float phasein;
-    float phaseout;
-    std::vector<float> frag; // windowed fragment of speech
-    unsigned long fragsize; // size of fragment in samples
     
+    // Output side of the shifter, one per voice. Voice 0 is the corrected lead.
+    // Per-sample fields come first.
+    struct Voice
+    {
+        float phincfact; // factor determining output phase increment
+        float phincstep; // per-sample change of phincfact over the current hop
+        float phaseout;
+        unsigned long fragsize; // size of fragment in samples
+        float level; // output gain
+        bool active; // places new grains this block
+        float lrshift; // shift for this voice (harmonies only)
+        int interval; // scale steps from the lead in HarmonyScale mode
+        int note; // MIDI note in HarmonyMidi mode, -1 when released
+    };
+    
+    Voice voices[MAX_VOICES];
+    int harmonymode = HarmonyOff;
+    int numvoices = 1; // voices in use, including the lead
+    int allocvoices = 1; // voices with output buffers allocated
+    int prevvoices = 1; // voices processed in the previous block
+    
+    // VARIABLES FOR FORMANT PRESERVATION
+    bool formantpreserve = false; // requested by the setter
+    int lpcorder; // order of the all-pole envelope
+    float lpclagwin[LPC_MAXORDER + 1]; // lag window applied to the autocovariance
+    float lpchist[LPC_HISTORY][LPC_MAXORDER]; // reflection coefficients, one set per hop
+    int lpchead; // most recent set in lpchist
+    bool formantpending; // the slot after lpchead holds an envelope waiting for the hop boundary
+    unsigned long formantcost; // estimated multiply-adds per hop, see getFormantCostEstimate()
+    
+    // VARIABLES FOR TD-PSOLA
+    int shiftermode = ShifterOLA;
+    unsigned long psolamaxperiod; // longest period a grain may span
+    int latencymode = LatencyStandard;
+    int latencyhops; // hops between whitening a sample and colouring it again
+    GrainWindowCache grainwindows; // Hann window for the current grain length
+    
+    // VARIABLES FOR QUALITY TIERS
+    int quality = QualityStandard; // requested by the setter
+    int qualityactive = QualityStandard; // what the audio thread is currently running
+    bool grainlerp = false; // interpolate OLA fragment reads
+    bool subsampleperiod = false; // refine the autocorrelation peak between lags
+    
+    // VARIABLES FOR THE IDENTITY FAST PATH
+    bool bypassed = false; // host bypass, treated like fMix == 0
+    float identitygain = 1; // weight of the shifter's output against the delayed dry signal
+    long identityhold = 0; // samples the output stays dry after leaving the fast path
+    bool identityidle = false; // on the fast path: analysis and shifter stopped
+    
+    PitchHistory* history = nullptr; // not owned
+    SpectrumBuffer* spectrum = nullptr; // not owned
+    long spectrumedges[SPECTRUM_BANDS + 1]; // first FFT bin of each display band
+    float spectrumscale; // power of a full-scale sine's peak bin, inverted
     
 };
 
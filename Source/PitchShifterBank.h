@@ -0,0 +1,563 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+#ifndef __PITCHSHIFTERBANK__
+#define __PITCHSHIFTERBANK__
+#include "PitchShifter.h"
+#include <math.h>
+#include <vector>
+
+// K independent mono correction streams in one object, for servers running
+// many voices at once. Runs the same detector and overlap-add shifter as
+// PitchShifter with its defaults (ShifterOLA, lead voice only, no formant
+// preservation). Formant preservation, PSOLA and harmonies still need a
+// PitchShifter per stream.
+//
+// The per-stream scalars (phasein, phaseout, phinc, sptarget, ...) are stored
+// as arrays of K, and the circular buffers are interleaved sample by sample, so
+// each per-sample step is a loop over K adjacent lanes the compiler can
+// vectorize. All streams advance in lockstep, so their analysis hops land on the
+// same sample and are batched into one K-frame Hartley transform whose
+// butterflies also run across the lanes.
+//
+// Grains are read straight from a 2N input ring instead of being copied into a
+// fragment buffer on every input period, which keeps the captured samples
+// alive until the next capture.
+//
+// Construction doesn't allocate; call init() with the sample rate before
+// processing.
+template <int K>
+class PitchShifterBank
+{
+public:
+
+    static const int numStreams = K;
+
+    PitchShifterBank()
+    {
+        // Same defaults as PitchShifter: root of C, chromatic, fully wet
+        for (int k = 0; k < K; k++) {
+            fMix[k] = 1.0f;
+            fShift[k] = 0;
+            fTune[k] = 0.0f;
+            fAmount[k] = 1.0f;
+            fGlide[k] = 1.0f;
+            setScale(k, scales.NoteC, scales.Chromatic);
+        }
+    }
+
+    // inputs[k] and outputs[k] belong to stream k and may point at the same buffer
+    void ProcessFloatReplacing(const float* const* inputs, float* const* outputs, int nFrames)
+    {
+        const unsigned long N = cbsize;
+        const unsigned long ringmask = 2 * N - 1;
+        const unsigned long hopmask = N / noverlap - 1;
+        unsigned long dryIdx;
+        int k;
+
+        for (int s = 0; s < nFrames; ++s)
+        {
+            // Load data into the interleaved input ring
+            float* in = cbin.data() + cBufferWriteIndex * K;
+            for (k = 0; k < K; k++) {
+                in[k] = inputs[k][s];
+            }
+            cBufferWriteIndex = (cBufferWriteIndex + 1) & ringmask;
+
+            // Every N/noverlap samples, analyse all streams together
+            if ((cBufferWriteIndex & hopmask) == 0) {
+                analyse();
+            }
+
+            // When input phase resets, remember where the snippet N/2 samples
+            // in the past starts
+            for (k = 0; k < K; k++) {
+                bool reset = phasein[k] + phinc[k] >= 1;
+                phasein[k] = phasein[k] + phinc[k] - (reset ? 1.0f : 0.0f);
+                fragpos[k] = reset ? cBufferWriteIndex : fragpos[k];
+            }
+
+            for (k = 0; k < K; k++) {
+                phaseout[k] = phaseout[k] + phinc[k] * phincfact[k];
+            }
+            // When output phase resets, put a snippet N/2 samples in the future
+            for (k = 0; k < K; k++) {
+                if (phaseout[k] >= 1) {
+                    placeGrain(k);
+                }
+                fragsize[k]++;
+            }
+
+            // Output, then erase for next cycle. The dry sample is the one
+            // written latencysamples before the newest, in step with the wet.
+            dryIdx = ((cBufferWriteIndex - 1 - latencysamples) & ringmask) * K;
+            float* out = cbo.data() + cbord * K;
+            for (k = 0; k < K; k++) {
+                outputs[k][s] = (double)fMix[k] * out[k] + (1.0 - fMix[k]) * cbin[dryIdx + k];
+                out[k] = 0;
+            }
+            cbord++;
+            if (cbord >= N) {
+                cbord = 0;
+            }
+        }
+    }
+
+    void init(unsigned long sr)
+    {
+        unsigned long ti, h, j;
+        int k;
+
+        fs = sr;
+
+        if (fs >= 88200) {
+            cbsize = 4096;
+        }
+        else {
+            cbsize = 2048;
+        }
+        corrsize = cbsize / 2 + 1;
+        noverlap = 4;
+        latencysamples = cbsize - 1;
+
+        pmax = 1/(float)70;
+        pmin = 1/(float)700;
+        nmax = (unsigned long)(fs * pmax);
+        if (nmax > corrsize) {
+            nmax = corrsize;
+        }
+        nmin = (unsigned long)(fs * pmin);
+
+        cbin.assign (2 * cbsize * K, 0.0f);
+        cbo.assign (cbsize * K, 0.0f);
+        ffttime.assign (cbsize * K, 0.0f);
+        fftscratch.assign (cbsize * K, 0.0f);
+        cBufferWriteIndex = 0;
+        cbord = 0;
+
+        // Same shared tables as PitchShifter
+        tables = DspTableCache::acquire (cbsize);
+        hannwindow = tables->hannwindow;
+        cbwindow = tables->cbwindow;
+        acwinv = tables->acwinv;
+
+        // Bit reversal and per-stage cas twiddles for the batched transform.
+        // Stage h (half length) keeps its twiddles at [h - 1, 2h - 1).
+        fhtbitrev.resize (cbsize);
+        for (ti=0, j=0; ti<cbsize; ti++) {
+            fhtbitrev[ti] = j;
+            for (h = cbsize >> 1; h > 0 && (j & h); h >>= 1) {
+                j ^= h;
+            }
+            j |= h;
+        }
+        fhtcos.resize (cbsize);
+        fhtsin.resize (cbsize);
+        for (h=1; h<cbsize; h*=2) {
+            for (j=0; j<h; j++) {
+                fhtcos[h - 1 + j] = cos(M_PI * j / h);
+                fhtsin[h - 1 + j] = sin(M_PI * j / h);
+            }
+        }
+
+        vthresh = 0.8;
+        phprdd = 0.01;
+
+        for (k = 0; k < K; k++) {
+            pperiod[k] = pmax;
+            pitch[k] = 0;
+            conf[k] = 0;
+            lrshift[k] = 0;
+            ptarget[k] = 0;
+            sptarget[k] = 0;
+            wasvoiced[k] = 0;
+            persistamt[k] = 0;
+            glidepersist[k] = 100;
+            phinc[k] = (float)1/(phprdd * fs);
+            phincfact[k] = 1;
+            phasein[k] = 0;
+            phaseout[k] = 0;
+            fragsize[k] = 0;
+            fragpos[k] = 0;
+            updateCoefficients(k);
+        }
+    }
+
+    void setMixAmount(int stream, float mixAmt){
+        fMix[stream] = mixAmt;
+    }
+    void setShiftAmount(int stream, float shiftAmt){
+        fShift[stream] = shiftAmt;
+    }
+    void setTuneAmount(int stream, float tuneAmt){
+        fTune[stream] = tuneAmt;
+        updateCoefficients(stream);
+    }
+    void setAmountAmount(int stream, float amtAmt){
+        fAmount[stream] = amtAmt;
+    }
+    void setGlideAmount(int stream, float glideAmt){
+        fGlide[stream] = glideAmt;
+        updateCoefficients(stream);
+    }
+    void setScale(int stream, int root, int scale){
+        int sc[12];
+        scales.makeScale(root, scale, sc);
+        for (int i = 0; i < 12; i++) {
+            fNotes[stream][i] = sc[i];
+        }
+    }
+
+    // Last detected pitch of a stream in semitones relative to A, and its confidence
+    float getPitch(int stream){
+        return pitch[stream];
+    }
+    float getConfidence(int stream){
+        return conf[stream];
+    }
+
+    // Delay of the output behind the input, the same for every stream
+    int getLatencySamples(){
+        return (int)latencysamples;
+    }
+
+    int getHopSize(){
+        return (int)(cbsize / noverlap);
+    }
+
+    // How far behind the hop boundary that updates getPitch() the centre of the
+    // window it was measured on lies
+    int getAnalysisLag(){
+        return (int)(cbsize / 2);
+    }
+
+private:
+    // As PitchShifter::updateCoefficients(), for one stream. The glide and
+    // persist rates depend on the hop, so init() redoes them for every stream.
+    void updateCoefficients(int k)
+    {
+        const unsigned long N = cbsize;
+
+        aref[k] = (float)440 * pow(2, fTune[k] / 12);
+        if (fs == 0) {
+            return;
+        }
+        glidecoef[k] = (fGlide[k] > 0) ? (1 - pow((float)1 / 24, (float)N * 1000 / (noverlap * fs * fGlide[k]))) : 1;
+        persistcoef[k] = (glidepersist[k] > 0) ? pow((float)1 / 2, (float)N * 1000 / (noverlap * fs * glidepersist[k])) : 0;
+    }
+
+    // Autocovariance of every stream from one batched transform, then the
+    // vectorized peak pick and the per-stream correction
+    void analyse()
+    {
+        const unsigned long N = cbsize;
+        const unsigned long ringmask = 2 * N - 1;
+        float best[K], cf[K], r0[K], pw[K];
+        int period[K];
+        unsigned long ti;
+        int k;
+
+        // Window and fill, newest sample first as in PitchShifter. Lane loops
+        // below keep their operands in locals so they vectorize despite the
+        // rows possibly aliasing.
+        for (ti = 0; ti < N; ti++) {
+            const float* in = cbin.data() + ((cBufferWriteIndex - ti) & ringmask) * K;
+            float* row = ffttime.data() + ti * K;
+            const float w = cbwindow[ti];
+            for (k = 0; k < K; k++) {
+                pw[k] = in[k] * w;
+            }
+            for (k = 0; k < K; k++) {
+                row[k] = pw[k];
+            }
+        }
+
+        batchFht();
+
+        // Power spectrum without DC. P is even, so its Hartley transform is the
+        // autocovariance up to a scale that the normalization removes.
+        for (k = 0; k < K; k++) {
+            fftscratch[k] = 0;
+        }
+        for (ti = 1; ti < N; ti++) {
+            const float* a = ffttime.data() + ti * K;
+            const float* b = ffttime.data() + (N - ti) * K;
+            float* p = fftscratch.data() + ti * K;
+            for (k = 0; k < K; k++) {
+                pw[k] = 0.5f * (a[k] * a[k] + b[k] * b[k]);
+            }
+            for (k = 0; k < K; k++) {
+                p[k] = pw[k];
+            }
+        }
+        std::swap (ffttime, fftscratch);
+        batchFht();
+
+        // Normalize the lags the peak picker looks at
+        for (k = 0; k < K; k++) {
+            r0[k] = ffttime[k];
+            ffttime[k] = 1;
+            best[k] = 0;
+            cf[k] = conf[k];
+            period[k] = -1;
+        }
+        for (ti = 1; ti <= nmax; ti++) {
+            float* row = ffttime.data() + ti * K;
+            for (k = 0; k < K; k++) {
+                row[k] = row[k] / r0[k];
+            }
+        }
+
+        // Highest local maximum in the lag range, all streams at once
+        for (ti = nmin; ti < nmax; ti++) {
+            const float* prev = ffttime.data() + (ti - 1) * K;
+            const float* cur = ffttime.data() + ti * K;
+            const float* next = ffttime.data() + (ti + 1) * K;
+            const float wi = acwinv[ti];
+            for (k = 0; k < K; k++) {
+                bool peak = cur[k] > prev[k] && cur[k] >= next[k] && cur[k] > best[k];
+                best[k] = peak ? cur[k] : best[k];
+                cf[k] = peak ? cur[k] * wi : cf[k];
+                period[k] = peak ? (int)ti : period[k];
+            }
+        }
+
+        for (k = 0; k < K; k++) {
+            conf[k] = cf[k];
+            pperiod[k] = (period[k] < 0) ? pmin : (float)period[k] / fs;
+            correctStream(k);
+        }
+    }
+
+    // PitchShifter's pitch target, glide and shift, for one stream
+    void correctStream(int k)
+    {
+        float tf, tf2, tf3;
+        int ti;
+
+        // Convert to semitones
+        pitch[k] = (float)-12 * log10((float)aref[k] * pperiod[k]) * L2SC;
+
+        if (conf[k] >= vthresh) {
+            // Nearest note of the scale, A-based
+            tf = -1;
+            tf3 = 0;
+            for (ti = 0; ti < 12; ti++) {
+                tf2 = fNotes[k][(ti + 9) % 12];
+                tf2 = tf2 - (float)fabs((pitch[k] - (float)ti) / 6 - 2 * floorf(((pitch[k] - (float)ti) / 12 + 0.5)));
+                if (tf2 >= tf) {
+                    tf3 = (float)ti;
+                    tf = tf2;
+                }
+            }
+            ptarget[k] = tf3;
+
+            // Glide persist
+            if (wasvoiced[k] == 0) {
+                wasvoiced[k] = 1;
+                tf = persistamt[k];
+                sptarget[k] = (1 - tf) * ptarget[k] + tf * sptarget[k];
+                persistamt[k] = 1;
+            }
+
+            // Glide on circular scale
+            tf3 = (float)ptarget[k] - sptarget[k];
+            tf3 = tf3 - (float)12 * floorf(tf3 / 12 + 0.5);
+            sptarget[k] = sptarget[k] + tf3 * glidecoef[k];
+        }
+        else {
+            wasvoiced[k] = 0;
+            persistamt[k] = persistamt[k] * persistcoef[k];
+        }
+
+        // Never do more than +- 6 semitones of correction
+        tf = sptarget[k] - pitch[k];
+        tf = tf - (float)12 * floorf(tf / 12 + 0.5);
+        if (conf[k] < vthresh) {
+            tf = 0;
+        }
+        lrshift[k] = fShift[k] + fAmount[k] * tf;
+
+        phincfact[k] = (float)pow(2, lrshift[k] / 12);
+        if (conf[k] >= vthresh) {
+            phinc[k] = (float)1 / (pperiod[k] * fs);
+        }
+    }
+
+    // Overlap-adds the stream's latest snippet, resampled by phincfact
+    void placeGrain(int k)
+    {
+        const unsigned long N = cbsize;
+        const unsigned long ringmask = 2 * N - 1;
+        const unsigned long base = fragpos[k] - N / 2;
+        long int ti, ti2, ti3;
+        float tf;
+
+        fragsize[k] = fragsize[k] * 2;
+        if (fragsize[k] >= N) {
+            fragsize[k] = N;
+        }
+        phaseout[k] = phaseout[k] - 1;
+        ti2 = cbord + N / 2;
+        ti3 = (long int)(((float)fragsize[k]) / phincfact[k]);
+        for (ti = -ti3 / 2; ti < (ti3 / 2); ti++) {
+            tf = hannwindow[(long int)N / 2 + ti * (long int)N / ti3];
+            unsigned long o = ((unsigned long)(ti + ti2) & (N - 1)) * K + k;
+            unsigned long i = ((base + (unsigned long)(long int)(phincfact[k] * ti)) & ringmask) * K + k;
+            cbo[o] = cbo[o] + cbin[i] * tf;
+        }
+        fragsize[k] = 0;
+    }
+
+    // In-place radix-2 Hartley transform of K interleaved frames in ffttime.
+    // Each stage combines the half transforms E and O of a block as
+    // H[j] = E[j] + cos*O[j] + sin*O[h-j], doing j and h-j together so the
+    // four rows involved are read once. Every butterfly is a K-lane vector
+    // operation, and the early stages run block by block to stay in cache.
+    void batchFht()
+    {
+        const unsigned long N = cbsize;
+        const unsigned long block = (N < 256) ? N : 256;
+        float* x = ffttime.data();
+        unsigned long ti, b;
+        int k;
+
+        for (ti = 0; ti < N; ti++) {
+            if (fhtbitrev[ti] > ti) {
+                float* r0 = x + ti * K;
+                float* r1 = x + fhtbitrev[ti] * K;
+                for (k = 0; k < K; k++) {
+                    std::swap (r0[k], r1[k]);
+                }
+            }
+        }
+
+        for (b = 0; b < N; b += block) {
+            fhtStages(x + b * K, block, 1, block);
+        }
+        fhtStages(x, N, block, N);
+    }
+
+    // (e, o) = (e + t, e - t) on one row pair, t = o by default. Results are
+    // staged and stored row by row, since the compiler cannot prove the rows
+    // don't alias and would otherwise keep the lanes scalar.
+    static void butterfly(float* e, float* o, const float* t = nullptr)
+    {
+        float sum[K], diff[K];
+        int k;
+
+        for (k = 0; k < K; k++) {
+            float tk = (t != nullptr) ? t[k] : o[k];
+            sum[k] = e[k] + tk;
+            diff[k] = e[k] - tk;
+        }
+        for (k = 0; k < K; k++) {
+            e[k] = sum[k];
+        }
+        for (k = 0; k < K; k++) {
+            o[k] = diff[k];
+        }
+    }
+
+    // Stages with half lengths from hfirst up to (excluding) hend over n rows
+    void fhtStages(float* x, unsigned long n, unsigned long hfirst, unsigned long hend)
+    {
+        unsigned long h, b, j;
+        int k;
+
+        for (h = hfirst; h < hend; h *= 2) {
+            for (b = 0; b < n; b += 2 * h) {
+                float* e = x + b * K;
+                float* o = x + (b + h) * K;
+
+                // j = 0 and j = h/2 only need adds
+                butterfly(e, o);
+                if (h < 2) {
+                    continue;
+                }
+                butterfly(e + (h / 2) * K, o + (h / 2) * K);
+
+                for (j = 1; j < h / 2; j++) {
+                    const float c = fhtcos[h - 1 + j];
+                    const float sn = fhtsin[h - 1 + j];
+                    float* e1 = e + j * K;
+                    float* e2 = e + (h - j) * K;
+                    float* o1 = o + j * K;
+                    float* o2 = o + (h - j) * K;
+                    float t1[K], t2[K];
+                    for (k = 0; k < K; k++) {
+                        t1[k] = c * o1[k] + sn * o2[k];
+                        t2[k] = sn * o1[k] - c * o2[k];
+                    }
+                    butterfly(e1, o1, t1);
+                    butterfly(e2, o2, t2);
+                }
+            }
+        }
+    }
+
+    Scales scales = Scales();
+
+    unsigned long fs = 0; // 0 until init()
+    unsigned long cbsize = 0; // size of circular buffer
+    unsigned long corrsize; // cbsize/2 + 1
+    unsigned long cBufferWriteIndex; // into the 2N input ring
+    unsigned long cbord;
+    unsigned long latencysamples; // N - 1, as PitchShifter's standard mode
+    int noverlap = 4;
+
+    std::vector<float> cbin; // interleaved input ring, 2N x K
+    std::vector<float> cbo; // interleaved output ring, N x K
+    std::vector<float> ffttime; // interleaved analysis frames, N x K
+    std::vector<float> fftscratch;
+    std::shared_ptr<const ShifterTables> tables; // shared, read-only
+    const float* cbwindow = nullptr; // hann of length N/2, zeros for the rest
+    const float* acwinv = nullptr; // inverse of autocorrelation of window
+    const float* hannwindow = nullptr; // length-N hann
+    std::vector<unsigned long> fhtbitrev;
+    std::vector<float> fhtcos;
+    std::vector<float> fhtsin;
+
+    float vthresh; // Voiced speech threshold
+    float pmax; // Maximum allowable pitch period (seconds)
+    float pmin; // Minimum allowable pitch period (seconds)
+    unsigned long nmax; // Maximum period index for pitch prd est
+    unsigned long nmin; // Minimum period index for pitch prd est
+    float phprdd; // default (unvoiced) phase period
+
+    // Parameters, one lane per stream
+    float fMix[K];
+    float fShift[K];
+    float fTune[K];
+    float fAmount[K];
+    float fGlide[K];
+    float fNotes[K][12];
+
+    // Per-stream state, structure of arrays
+    float aref[K]; // A tuning reference (Hz)
+    float pperiod[K]; // Pitch period (seconds)
+    float pitch[K]; // Pitch (semitones)
+    float conf[K]; // Confidence of pitch period estimate
+    float lrshift[K]; // Shift prescribed by low-rate section
+    int ptarget[K]; // Pitch target, between 0 and 11
+    float sptarget[K]; // Smoothed pitch target
+    int wasvoiced[K];
+    float persistamt[K];
+    float glidepersist[K];
+    float glidecoef[K]; // per-hop step of the smoothed target towards the note
+    float persistcoef[K]; // per-hop decay of persistamt while unvoiced
+    float phinc[K]; // input phase increment
+    float phincfact[K]; // factor determining output phase increment
+    float phasein[K];
+    float phaseout[K];
+    unsigned long fragsize[K]; // size of fragment in samples
+    unsigned long fragpos[K]; // input ring index at the last capture
+};
+
+#endif
@@ -15,11 +15,20 @@ AutoPitchCorrectionAudioProcessorEditor::AutoPitchCorrectionAudioProcessorEditor
 {
     // Make sure that before the constructor has finished, you've set the
     // editor's size to whatever you need it to be.
-    setSize (400, 300);
+    setSize (600, 450);
+    
+    // The shifter only decimates its spectrum while someone is looking
+    audioProcessor.getSpectrum().setEnabled (true);
+    
+    // Hops arrive at 40 to 200 Hz; the history holds seconds of them, so a
+    // slower redraw than that never loses any
+    startTimerHz (30);
 }
 
 AutoPitchCorrectionAudioProcessorEditor::~AutoPitchCorrectionAudioProcessorEditor()
 {
+    stopTimer();
+    audioProcessor.getSpectrum().setEnabled (false);
 }
 
 //==============================================================================
@@ -30,11 +39,139 @@ void AutoPitchCorrectionAudioProcessorEditor::paint (juce::Graphics& g)
 
     g.setColour (juce::Colours::white);
     g.setFont (15.0f);
-    g.drawFittedText ("AutoTune", getLocalBounds(), juce::Justification::centred, 1);
+    g.drawFittedText ("AutoTune", getLocalBounds().removeFromTop (graphArea.getY()), juce::Justification::centred, 1);
+    
+    if (g.clipRegionIntersects (spectrumArea))
+        paintSpectrum (g);
+    
+    if (! g.clipRegionIntersects (graphArea))
+        return;
+    
+    g.setColour (juce::Colours::black);
+    g.fillRect (graphArea);
+    
+    // A line per C, labelled with its octave
+    g.setFont (11.0f);
+    for (float note = lowestNote; note <= highestNote; note += 12.0f)
+    {
+        auto y = noteToY (note);
+        g.setColour (juce::Colours::darkgrey);
+        g.drawHorizontalLine ((int) y, (float) graphArea.getX(), (float) graphArea.getRight());
+        g.drawText ("C" + juce::String ((int) note / 12 - 1), graphArea.getX() + 2, (int) y - 13, 30, 12, juce::Justification::left);
+    }
+    
+    // Target and detected pitch, oldest on the left; unvoiced hops break both
+    juce::Path target, detected;
+    bool drawing = false;
+    auto xStep = (float) graphArea.getWidth() / (float) (curveLength - 1);
+    
+    for (int i = 0; i < curveLength; ++i)
+    {
+        const auto& r = curve[(size_t) ((curveHead + i) % curveLength)];
+        auto x = (float) graphArea.getX() + (float) i * xStep;
+        
+        if (r.confidence < voicedConfidence)
+        {
+            drawing = false;
+            continue;
+        }
+        
+        if (drawing)
+        {
+            target.lineTo (x, noteToY (r.target));
+            detected.lineTo (x, noteToY (r.pitch));
+        }
+        else
+        {
+            target.startNewSubPath (x, noteToY (r.target));
+            detected.startNewSubPath (x, noteToY (r.pitch));
+            drawing = true;
+        }
+    }
+    
+    g.saveState();
+    g.reduceClipRegion (graphArea);
+    g.setColour (juce::Colours::limegreen.withAlpha (0.6f));
+    g.strokePath (target, juce::PathStrokeType (3.0f));
+    g.setColour (juce::Colours::white);
+    g.strokePath (detected, juce::PathStrokeType (1.5f));
+    g.restoreState();
 }
 
 void AutoPitchCorrectionAudioProcessorEditor::resized()
 {
     // This is generally where you'll want to lay out the positions of any
     // subcomponents in your editor..
+    auto area = getLocalBounds().reduced (10).withTrimmedTop (20);
+    spectrumArea = area.removeFromBottom (area.getHeight() / 3);
+    area.removeFromBottom (10);
+    graphArea = area;
+}
+
+void AutoPitchCorrectionAudioProcessorEditor::timerCallback()
+{
+    auto& history = audioProcessor.getPitchHistory();
+    PitchRecord record;
+    bool changed = false;
+    
+    while (history.pop (record))
+    {
+        curve[(size_t) curveHead] = record;
+        curveHead = (curveHead + 1) % curveLength;
+        changed = true;
+    }
+    
+    // The curve scrolls, so the whole graph moves; the title doesn't
+    if (changed)
+        repaint (graphArea);
+    
+    if (auto* newest = audioProcessor.getSpectrum().read())
+    {
+        spectrum = *newest;
+        repaint (spectrumArea);
+    }
+}
+
+void AutoPitchCorrectionAudioProcessorEditor::paintSpectrum (juce::Graphics& g)
+{
+    g.setColour (juce::Colours::black);
+    g.fillRect (spectrumArea);
+    
+    // Band levels in dB, each drawn across its own width
+    juce::Path levels;
+    auto bottom = (float) spectrumArea.getBottom();
+    levels.startNewSubPath ((float) spectrumArea.getX(), bottom);
+    
+    for (int b = 0; b < SPECTRUM_BANDS; ++b)
+    {
+        auto db = juce::jmax (spectrumFloorDb, 10.0f * std::log10 (juce::jmax (spectrum.bands[b], 1.0e-12f)));
+        auto y = juce::jmap (db, spectrumFloorDb, 0.0f, bottom, (float) spectrumArea.getY());
+        levels.lineTo (frequencyToX (SpectrumSnapshot::getBandFrequency ((float) b)), y);
+        levels.lineTo (frequencyToX (SpectrumSnapshot::getBandFrequency ((float) b + 1.0f)), y);
+    }
+    
+    levels.lineTo ((float) spectrumArea.getRight(), bottom);
+    levels.closeSubPath();
+    g.setColour (juce::Colours::skyblue.withAlpha (0.7f));
+    g.fillPath (levels);
+    
+    // Detected fundamental and where the correction is taking it
+    if (spectrum.confidence >= voicedConfidence)
+    {
+        g.setColour (juce::Colours::limegreen);
+        g.drawVerticalLine ((int) frequencyToX (spectrum.target), (float) spectrumArea.getY(), bottom);
+        g.setColour (juce::Colours::white);
+        g.drawVerticalLine ((int) frequencyToX (spectrum.fundamental), (float) spectrumArea.getY(), bottom);
+    }
+}
+
+float AutoPitchCorrectionAudioProcessorEditor::noteToY (float note) const
+{
+    return juce::jmap (note, lowestNote, highestNote, (float) graphArea.getBottom(), (float) graphArea.getY());
+}
+
+float AutoPitchCorrectionAudioProcessorEditor::frequencyToX (float hz) const
+{
+    auto proportion = std::log (hz / SPECTRUM_MINHZ) / std::log (SPECTRUM_MAXHZ / SPECTRUM_MINHZ);
+    return juce::jmap (juce::jlimit (0.0f, 1.0f, proportion), (float) spectrumArea.getX(), (float) spectrumArea.getRight());
 }
@@ -14,7 +14,8 @@
 //==============================================================================
 /**
 */
-class AutoPitchCorrectionAudioProcessorEditor  : public juce::AudioProcessorEditor
+class AutoPitchCorrectionAudioProcessorEditor  : public juce::AudioProcessorEditor,
+                                                 private juce::Timer
 {
 public:
     AutoPitchCorrectionAudioProcessorEditor (AutoPitchCorrectionAudioProcessor&);
@@ -25,9 +26,34 @@ public:
     void resized() override;
 
 private:
+    // Drains the processor's pitch history into the curve and picks up the
+    // newest spectrum, repainting only the views that changed
+    void timerCallback() override;
+    
+    void paintSpectrum (juce::Graphics& g);
+    float noteToY (float note) const;
+    float frequencyToX (float hz) const;
+    
+    // Hops on screen, about six seconds at the standard tier
+    static constexpr int curveLength = 512;
+    // Pitch range of the graph as MIDI notes, C2 to C6
+    static constexpr float lowestNote = 36.0f;
+    static constexpr float highestNote = 84.0f;
+    // PitchShifter's voiced threshold; quieter or noisier hops aren't drawn
+    static constexpr float voicedConfidence = 0.8f;
+    // Level range of the spectrum
+    static constexpr float spectrumFloorDb = -96.0f;
+    
     // This reference is provided as a quick way for your editor to
     // access the processor object that created it.
     AutoPitchCorrectionAudioProcessor& audioProcessor;
+    
+    std::array<PitchRecord, curveLength> curve {}; // ring, oldest at curveHead
+    int curveHead = 0;
+    juce::Rectangle<int> graphArea;
+    
+    SpectrumSnapshot spectrum {}; // copy of the newest one published
+    juce::Rectangle<int> spectrumArea;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AutoPitchCorrectionAudioProcessorEditor)
 };
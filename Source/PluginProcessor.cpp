@@ -20,15 +20,103 @@ AutoPitchCorrectionAudioProcessor::AutoPitchCorrectionAudioProcessor()
                       #endif
                        .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
                      #endif
-                       )
+                       ),
+#else
+     :
 #endif
+       parameters (*this, nullptr, "Parameters", createParameterLayout())
 {
+    mixParameter         = parameters.getRawParameterValue ("mix");
+    shiftParameter       = parameters.getRawParameterValue ("shift");
+    tuneParameter        = parameters.getRawParameterValue ("tune");
+    amountParameter      = parameters.getRawParameterValue ("amount");
+    glideParameter       = parameters.getRawParameterValue ("glide");
+    rootParameter        = parameters.getRawParameterValue ("root");
+    scaleParameter       = parameters.getRawParameterValue ("scale");
+    formantParameter     = parameters.getRawParameterValue ("formant");
+    shifterModeParameter = parameters.getRawParameterValue ("shifterMode");
+    harmonyModeParameter = parameters.getRawParameterValue ("harmonyMode");
+    voicesParameter      = parameters.getRawParameterValue ("voices");
+    channelModeParameter = parameters.getRawParameterValue ("channelMode");
+    latencyParameter     = parameters.getRawParameterValue ("latency");
+    qualityParameter     = parameters.getRawParameterValue ("quality");
+    renderHQParameter    = parameters.getRawParameterValue ("renderHQ");
+    adaptiveParameter    = parameters.getRawParameterValue ("adaptive");
+    
+    correctionEngine.setPitchHistory (&pitchHistory);
+    correctionEngine.setSpectrum (&spectrum);
 }
 
 AutoPitchCorrectionAudioProcessor::~AutoPitchCorrectionAudioProcessor()
 {
 }
 
+//==============================================================================
+juce::AudioProcessorValueTreeState::ParameterLayout AutoPitchCorrectionAudioProcessor::createParameterLayout()
+{
+    juce::AudioProcessorValueTreeState::ParameterLayout layout;
+    
+    //Amount of pitch correction how much you want it?
+    layout.add (std::make_unique<juce::AudioParameterFloat> (juce::ParameterID { "amount", 1 }, "Amount",
+                                                             juce::NormalisableRange<float> (0.0f, 100.0f, 1.0f), 100.0f,
+                                                             juce::AudioParameterFloatAttributes().withLabel ("%")));
+    
+    //control how much pitch slide from one note to the next 0 -> 1000ms
+    layout.add (std::make_unique<juce::AudioParameterFloat> (juce::ParameterID { "glide", 1 }, "Glide",
+                                                             juce::NormalisableRange<float> (0.0f, 1000.0f, 0.01f), 0.0f,
+                                                             juce::AudioParameterFloatAttributes().withLabel ("ms")));
+    
+    //This is our scaling factor of how much total effect is applied
+    layout.add (std::make_unique<juce::AudioParameterFloat> (juce::ParameterID { "mix", 1 }, "Mix",
+                                                             juce::NormalisableRange<float> (0.0f, 100.0f, 1.0f), 100.0f,
+                                                             juce::AudioParameterFloatAttributes().withLabel ("%")));
+    
+    // Easy This transposes from -12 to +12 semitones, step size of 1
+    layout.add (std::make_unique<juce::AudioParameterFloat> (juce::ParameterID { "shift", 1 }, "Shift",
+                                                             juce::NormalisableRange<float> (-12.0f, 12.0f, 1.0f), 0.0f,
+                                                             juce::AudioParameterFloatAttributes().withLabel ("st")));
+    
+    // This is -100 -> +100 cents transposed
+    layout.add (std::make_unique<juce::AudioParameterFloat> (juce::ParameterID { "tune", 1 }, "Tune",
+                                                             juce::NormalisableRange<float> (-100.0f, 100.0f, 1.0f), 0.0f,
+                                                             juce::AudioParameterFloatAttributes().withLabel ("cents")));
+    
+    // Key and scale the correction snaps to, in Scales' order
+    layout.add (std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { "root", 1 }, "Root",
+                                                              juce::StringArray { "C", "Db", "D", "Eb", "E", "F", "Gb", "G", "Ab", "A", "Bb", "B" }, 0));
+    layout.add (std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { "scale", 1 }, "Scale",
+                                                              juce::StringArray { "Chromatic", "Major", "Minor", "Dorian", "Mixolydian", "Lydian", "Phrygian",
+                                                                                  "Locrian", "Harmonic Minor", "Melodic Minor", "Major Pentatonic",
+                                                                                  "Minor Pentatonic", "Minor Blues" }, 0));
+    
+    layout.add (std::make_unique<juce::AudioParameterBool> (juce::ParameterID { "formant", 1 }, "Formant Preservation", false));
+    
+    layout.add (std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { "shifterMode", 1 }, "Shifter",
+                                                              juce::StringArray { "Overlap-Add", "PSOLA" }, PitchShifter::ShifterOLA));
+    
+    layout.add (std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { "harmonyMode", 1 }, "Harmony",
+                                                              juce::StringArray { "Off", "Scale", "MIDI" }, PitchShifter::HarmonyOff));
+    layout.add (std::make_unique<juce::AudioParameterInt> (juce::ParameterID { "voices", 1 }, "Voices", 1, MAX_VOICES, 1));
+    
+    // Wide buses ignore this and are always independent
+    layout.add (std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { "channelMode", 1 }, "Channels",
+                                                              juce::StringArray { "Linked", "Independent" }, CorrectionEngine::ChannelsLinked));
+    
+    // Live trades the lowest notes and the OLA shifter for about 12ms of latency
+    layout.add (std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { "latency", 1 }, "Latency",
+                                                              juce::StringArray { "Standard", "Live" }, PitchShifter::LatencyStandard));
+    
+    // Analysis rate, grain interpolation and pitch detector; switches without a re-prepare
+    layout.add (std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { "quality", 1 }, "Quality",
+                                                              juce::StringArray { "Eco", "Standard", "HQ" }, PitchShifter::QualityStandard));
+    layout.add (std::make_unique<juce::AudioParameterBool> (juce::ParameterID { "renderHQ", 1 }, "HQ When Rendering", true));
+    
+    // Lets the load governor drop to cheaper tiers when blocks near their deadline
+    layout.add (std::make_unique<juce::AudioParameterBool> (juce::ParameterID { "adaptive", 1 }, "Adapt To CPU Load", true));
+    
+    return layout;
+}
+
 //==============================================================================
 const juce::String AutoPitchCorrectionAudioProcessor::getName() const
 {
@@ -64,7 +152,11 @@ bool AutoPitchCorrectionAudioProcessor::isMidiEffect() const
 
 double AutoPitchCorrectionAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    // Grains reach about half the latency past the input that made them
+    if (getSampleRate() <= 0)
+        return 0.0;
+    
+    return (getLatencySamples() + 1) / 2 / getSampleRate();
 }
 
 int AutoPitchCorrectionAudioProcessor::getNumPrograms()
@@ -96,13 +188,21 @@ void AutoPitchCorrectionAudioProcessor::prepareToPlay (double sampleRate, int sa
 {
     // Use this method as the place to do any pre-playback
     // initialisation that you need..
-    pitchShifter.init (sampleRate);
+    preparedLatencyMode = (int) latencyParameter->load();
+    correctionEngine.prepare (sampleRate, getTotalNumInputChannels(), MAX_VOICES, preparedLatencyMode);
+    setLatencySamples (correctionEngine.getLatencySamples());
+    
+    // The shifters are new, so hand them every parameter on the first block
+    parametersApplied = false;
+    loadGovernor.reset();
+    correctionEngine.forEachShifter ([this] (PitchShifter& s) { s.setBypassed (shiftersBypassed); });
 }
 
 void AutoPitchCorrectionAudioProcessor::releaseResources()
 {
     // When playback stops, you can use this as an opportunity to free up any
     // spare memory, etc.
+    correctionEngine.release();
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -112,12 +212,10 @@ bool AutoPitchCorrectionAudioProcessor::isBusesLayoutSupported (const BusesLayou
     juce::ignoreUnused (layouts);
     return true;
   #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
-    // Some plugin hosts, such as certain GarageBand versions, will only
-    // load plugins that support stereo bus layouts.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Up to MAX_LINKED_CHANNELS channels can share one analysis; wider buses
+    // up to MAX_INDEPENDENT_CHANNELS are corrected channel by channel.
+    auto numChannels = layouts.getMainOutputChannelSet().size();
+    if (numChannels < 1 || numChannels > MAX_INDEPENDENT_CHANNELS)
         return false;
 
     // This checks if the input layout matches the output layout
@@ -132,8 +230,30 @@ bool AutoPitchCorrectionAudioProcessor::isBusesLayoutSupported (const BusesLayou
 #endif
 
 void AutoPitchCorrectionAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processSamples (buffer, midiMessages, false);
+}
+
+void AutoPitchCorrectionAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processSamples (buffer, midiMessages, false);
+}
+
+void AutoPitchCorrectionAudioProcessor::processBlockBypassed (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processSamples (buffer, midiMessages, true);
+}
+
+void AutoPitchCorrectionAudioProcessor::processBlockBypassed (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processSamples (buffer, midiMessages, true);
+}
+
+template <typename SampleType>
+void AutoPitchCorrectionAudioProcessor::processSamples (juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages, bool bypassed)
 {
     juce::ScopedNoDenormals noDenormals;
+    auto blockStartTicks = juce::Time::getHighResolutionTicks();
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
     
@@ -146,26 +266,194 @@ void AutoPitchCorrectionAudioProcessor::processBlock (juce::AudioBuffer<float>&
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
     
-    // This is the place where you'd normally do the guts of your plugin's
-    // audio processing...
-    // Make sure to reset the state if your inner loop is processing
-    // the samples and the outer loop is handling the channels.
-    // Alternatively, you can process the samples with the channels
-    // interleaved by keeping the same state.
-    //    for (int channel = 0; channel < totalNumInputChannels; ++channel)
-    //    {
-    //        auto* channelData = buffer.getWritePointer (channel);
-    const float* input = buffer.getReadPointer (0);
-    float* output1 = buffer.getWritePointer(0);
-    float* output2 = buffer.getWritePointer(1);
-    int numSamples = buffer.getNumSamples();
+    // The latency mode can't change under the audio thread; ask for a re-prepare
+    if ((int) latencyParameter->load() != preparedLatencyMode)
+        triggerAsyncUpdate();
+    
+    // One read of every parameter per block. The shifters only hear about it,
+    // and only recompute their coefficients, when something actually changed.
+    // The host gives us one value per block, so continuous parameters ramp from
+    // the last block's value to this one's through timestamped events, and
+    // automation stays smooth however large the blocks are.
+    auto snapshot = readParameters();
+    int numAutomationEvents = 0;
+    
+    if (! parametersApplied || snapshot != appliedParameters)
+    {
+        if (parametersApplied)
+            numAutomationEvents = scheduleAutomation (appliedParameters, snapshot, buffer.getNumSamples());
+        
+        applyParameters (snapshot);
+        appliedParameters = snapshot;
+        parametersApplied = true;
+    }
+    
+    // Bypassed shifters fade to the delayed dry signal and then just copy it,
+    // keeping their input history so they can fade back in
+    if (bypassed != shiftersBypassed)
+    {
+        correctionEngine.forEachShifter ([bypassed] (PitchShifter& s) { s.setBypassed (bypassed); });
+        shiftersBypassed = bypassed;
+    }
     
-    std::vector<const float*> inputs = { reinterpret_cast<const float*>(input)};
-    std::vector<float*> outputs = { reinterpret_cast<float*>(output1), reinterpret_cast<float*>(output2)};
+    // Harmony voices follow incoming notes when the shifter is in HarmonyMidi mode
+    for (const auto metadata : midiMessages)
+    {
+        auto message = metadata.getMessage();
+        
+        if (message.isNoteOn())
+            assignHarmonyNote (message.getNoteNumber());
+        else if (message.isNoteOff())
+            releaseHarmonyNote (message.getNoteNumber());
+    }
     
-    pitchShifter.ProcessFloatReplacing (inputs.data(), outputs.data(), numSamples);
+    // Linked: one pitch analysis on the channel average drives every channel.
+    // Independent: one shifter per channel, spread over the worker pool.
+    jassert (buffer.getNumChannels() >= correctionEngine.getNumChannels());
+    
+    correctionEngine.process (buffer.getArrayOfWritePointers(), buffer.getNumSamples(), automationEvents.data(), numAutomationEvents);
+    
+    // Offline renders have no deadline to keep
+    if (! isNonRealtime() && adaptiveParameter->load() >= 0.5f)
+    {
+        auto elapsed = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - blockStartTicks);
+        loadGovernor.update (elapsed, buffer.getNumSamples() / getSampleRate(), (int) qualityParameter->load());
+    }
+    else
+    {
+        loadGovernor.reset();
+    }
+}
+
+void AutoPitchCorrectionAudioProcessor::handleAsyncUpdate()
+{
+    if ((int) latencyParameter->load() == preparedLatencyMode || getSampleRate() <= 0)
+        return;
+    
+    suspendProcessing (true);
+    prepareToPlay (getSampleRate(), getBlockSize());
+    suspendProcessing (false);
+}
+
+bool AutoPitchCorrectionAudioProcessor::ParameterSnapshot::operator!= (const ParameterSnapshot& other) const
+{
+    return mix != other.mix || shift != other.shift || tune != other.tune || amount != other.amount
+        || glide != other.glide || root != other.root || scale != other.scale || formant != other.formant
+        || shifterMode != other.shifterMode || harmonyMode != other.harmonyMode
+        || numVoices != other.numVoices || channelMode != other.channelMode || quality != other.quality;
 }
 
+AutoPitchCorrectionAudioProcessor::ParameterSnapshot AutoPitchCorrectionAudioProcessor::readParameters() const
+{
+    ParameterSnapshot snapshot;
+    
+    snapshot.mix         = mixParameter->load() / 100.0f;
+    snapshot.shift       = shiftParameter->load();
+    snapshot.tune        = tuneParameter->load() / 100.0f;
+    snapshot.amount      = amountParameter->load() / 100.0f;
+    snapshot.glide       = glideParameter->load();
+    snapshot.root        = (int) rootParameter->load();
+    snapshot.scale       = (int) scaleParameter->load();
+    snapshot.formant     = formantParameter->load() >= 0.5f;
+    snapshot.shifterMode = (int) shifterModeParameter->load();
+    snapshot.harmonyMode = (int) harmonyModeParameter->load();
+    snapshot.numVoices   = (int) voicesParameter->load();
+    snapshot.channelMode = (int) channelModeParameter->load();
+    
+    // Offline renders can afford the top tier whatever the session runs at.
+    // Live, the load governor may be holding the shifters below the chosen tier.
+    if (isNonRealtime() && renderHQParameter->load() >= 0.5f)
+        snapshot.quality = PitchShifter::QualityHQ;
+    else if (adaptiveParameter->load() >= 0.5f)
+        snapshot.quality = juce::jmin ((int) qualityParameter->load(), loadGovernor.getTierLimit());
+    else
+        snapshot.quality = (int) qualityParameter->load();
+    
+    return snapshot;
+}
+
+void AutoPitchCorrectionAudioProcessor::applyParameters (const ParameterSnapshot& snapshot)
+{
+    correctionEngine.setChannelMode (snapshot.channelMode);
+    
+    // Mix, shift and amount are smoothed inside the shifters
+    correctionEngine.forEachShifter ([&snapshot] (PitchShifter& s)
+    {
+        s.setMixAmount (snapshot.mix);
+        s.setShiftAmount (snapshot.shift);
+        s.setAmountAmount (snapshot.amount);
+        s.setTuneAmount (snapshot.tune);
+        s.setGlideAmount (snapshot.glide);
+        s.setScale (snapshot.root, snapshot.scale);
+        s.setFormantPreservation (snapshot.formant);
+        s.setShifterMode (snapshot.shifterMode);
+        s.setHarmonyMode (snapshot.harmonyMode);
+        s.setNumVoices (snapshot.numVoices);
+        s.setQuality (snapshot.quality);
+    });
+}
+
+int AutoPitchCorrectionAudioProcessor::scheduleAutomation (const ParameterSnapshot& from, const ParameterSnapshot& to, int numSamples)
+{
+    // In PitchShifter::AutomationParameters order
+    const float fromValues[] = { from.mix, from.shift, from.tune, from.amount, from.glide };
+    const float toValues[]   = { to.mix, to.shift, to.tune, to.amount, to.glide };
+    auto numSteps = juce::jlimit (1, maxAutomationSteps, (numSamples + automationInterval - 1) / automationInterval);
+    int numEvents = 0;
+    
+    // applyParameters() has already set the targets; the events start over from
+    // the old values, so the first one (at offset 0) takes effect instead
+    for (int step = 0; step < numSteps; ++step)
+    {
+        for (int p = 0; p < PitchShifter::NumAutomationParameters; ++p)
+        {
+            if (fromValues[p] == toValues[p])
+                continue;
+            
+            auto& event = automationEvents[(size_t) numEvents++];
+            event.sampleOffset = step * numSamples / numSteps;
+            event.parameter    = p;
+            event.value        = fromValues[p] + (toValues[p] - fromValues[p]) * (float) (step + 1) / (float) numSteps;
+        }
+    }
+    
+    return numEvents;
+}
+
+void AutoPitchCorrectionAudioProcessor::assignHarmonyNote (int noteNumber)
+{
+    auto& lead = correctionEngine.getLeadShifter();
+    auto numVoices = lead.getNumVoices();
+    
+    // Voice 0 is the corrected lead, so harmonies start at 1
+    for (int voice = 1; voice < numVoices; ++voice)
+    {
+        if (lead.getVoiceNote (voice) < 0)
+        {
+            correctionEngine.forEachShifter ([=] (PitchShifter& s) { s.setVoiceNote (voice, noteNumber); });
+            return;
+        }
+    }
+    
+    // All voices busy: steal them in turn
+    if (numVoices > 1)
+    {
+        nextStolenVoice = 1 + (nextStolenVoice % (numVoices - 1));
+        auto voice = nextStolenVoice;
+        correctionEngine.forEachShifter ([=] (PitchShifter& s) { s.setVoiceNote (voice, noteNumber); });
+    }
+}
+
+void AutoPitchCorrectionAudioProcessor::releaseHarmonyNote (int noteNumber)
+{
+    auto& lead = correctionEngine.getLeadShifter();
+    
+    for (int voice = 1; voice < lead.getNumVoices(); ++voice)
+        if (lead.getVoiceNote (voice) == noteNumber)
+            correctionEngine.forEachShifter ([=] (PitchShifter& s) { s.setVoiceNote (voice, -1); });
+}
+
+
 //==============================================================================
 bool AutoPitchCorrectionAudioProcessor::hasEditor() const
 {
@@ -183,12 +471,19 @@ void AutoPitchCorrectionAudioProcessor::getStateInformation (juce::MemoryBlock&
     // You should use this method to store your parameters in the memory block.
     // You could do that either as raw data, or use the XML or ValueTree classes
     // as intermediaries to make it easy to save and load complex data.
+    auto state = parameters.copyState();
+    std::unique_ptr<juce::XmlElement> xml (state.createXml());
+    copyXmlToBinary (*xml, destData);
 }
 
 void AutoPitchCorrectionAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
     // You should use this method to restore your parameters from this memory block,
     // whose contents will have been created by the getStateInformation() call.
+    std::unique_ptr<juce::XmlElement> xmlState (getXmlFromBinary (data, sizeInBytes));
+    
+    if (xmlState != nullptr && xmlState->hasTagName (parameters.state.getType()))
+        parameters.replaceState (juce::ValueTree::fromXml (*xmlState));
 }
 
 //==============================================================================
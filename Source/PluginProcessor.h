@@ -9,12 +9,14 @@
 #pragma once
 
 #include <JuceHeader.h>
-#include "PitchShifter.h"
+#include "CorrectionEngine.h"
+#include "LoadGovernor.h"
 
 //==============================================================================
 /**
 */
-class AutoPitchCorrectionAudioProcessor  : public juce::AudioProcessor
+class AutoPitchCorrectionAudioProcessor  : public juce::AudioProcessor,
+                                           private juce::AsyncUpdater
 {
 public:
     //==============================================================================
@@ -30,6 +32,16 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override { return true; }
+    
+    // Delayed dry signal, so bypassing doesn't shift the track against the others
+    void processBlockBypassed (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    
+    // Re-prepares on the message thread when the latency mode changes, since
+    // that resizes the shifters and the latency reported to the host
+    void handleAsyncUpdate() override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -54,8 +66,78 @@ public:
     void getStateInformation (juce::MemoryBlock& destData) override;
     void setStateInformation (const void* data, int sizeInBytes) override;
 
+    //==============================================================================
+    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    
+    juce::AudioProcessorValueTreeState parameters;
+    
+    // Tier limit, recent load and step counters; readable from the message thread
+    const LoadGovernor& getLoadGovernor() const { return loadGovernor; }
+    
+    // The lead shifter's pitch, target, confidence and correction, one record
+    // per analysis hop; only the editor may pop from it
+    PitchHistory& getPitchHistory() { return pitchHistory; }
+    
+    // The lead shifter's analysis spectrum, published each hop while enabled;
+    // only the editor may read from it
+    SpectrumBuffer& getSpectrum() { return spectrum; }
+
 private:
-    PitchShifter pitchShifter;
+    // Every control as the audio thread sees it for one block
+    struct ParameterSnapshot
+    {
+        float mix = 1.0f, shift = 0.0f, tune = 0.0f, amount = 1.0f, glide = 0.0f;
+        int root = 0, scale = 0, shifterMode = 0, harmonyMode = 0, numVoices = 1, channelMode = 0, quality = 0;
+        bool formant = false;
+        
+        bool operator!= (const ParameterSnapshot& other) const;
+    };
+    
+    // Both processBlock() overloads; the shifters take float or double I/O natively
+    template <typename SampleType>
+    void processSamples (juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages, bool bypassed);
+    
+    ParameterSnapshot readParameters() const;
+    void applyParameters (const ParameterSnapshot& snapshot);
+    int scheduleAutomation (const ParameterSnapshot& from, const ParameterSnapshot& to, int numSamples);
+    
+    // Continuous parameters that changed since the last block ramp across this
+    // one in steps of about automationInterval samples
+    static constexpr int automationInterval = 32;
+    static constexpr int maxAutomationSteps = 64;
+    std::array<PitchShifter::ParameterEvent, maxAutomationSteps * PitchShifter::NumAutomationParameters> automationEvents;
+    
+    void assignHarmonyNote (int noteNumber);
+    void releaseHarmonyNote (int noteNumber);
+    
+    CorrectionEngine correctionEngine;
+    LoadGovernor loadGovernor;
+    PitchHistory pitchHistory;
+    SpectrumBuffer spectrum;
+    int nextStolenVoice = 0;
+    
+    std::atomic<float>* mixParameter = nullptr;
+    std::atomic<float>* shiftParameter = nullptr;
+    std::atomic<float>* tuneParameter = nullptr;
+    std::atomic<float>* amountParameter = nullptr;
+    std::atomic<float>* glideParameter = nullptr;
+    std::atomic<float>* rootParameter = nullptr;
+    std::atomic<float>* scaleParameter = nullptr;
+    std::atomic<float>* formantParameter = nullptr;
+    std::atomic<float>* shifterModeParameter = nullptr;
+    std::atomic<float>* harmonyModeParameter = nullptr;
+    std::atomic<float>* voicesParameter = nullptr;
+    std::atomic<float>* channelModeParameter = nullptr;
+    std::atomic<float>* latencyParameter = nullptr;
+    std::atomic<float>* qualityParameter = nullptr;
+    std::atomic<float>* renderHQParameter = nullptr;
+    std::atomic<float>* adaptiveParameter = nullptr;
+    
+    int preparedLatencyMode = PitchShifter::LatencyStandard;
+    
+    ParameterSnapshot appliedParameters;
+    bool parametersApplied = false;
+    bool shiftersBypassed = false;
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AutoPitchCorrectionAudioProcessor)
 };
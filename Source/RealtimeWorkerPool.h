@@ -0,0 +1,274 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+#ifndef __REALTIMEWORKERPOOL__
+#define __REALTIMEWORKERPOOL__
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+ #include <immintrin.h>
+ #define WORKER_PAUSE() _mm_pause()
+#elif defined(__aarch64__) || defined(__arm64__)
+ #define WORKER_PAUSE() __asm__ __volatile__ ("yield")
+#else
+ #define WORKER_PAUSE() std::this_thread::yield()
+#endif
+
+#if ! defined(_WIN32)
+ #include <pthread.h>
+ #include <sched.h>
+#endif
+
+// Fork/join pool for the audio callback. run() publishes a job through a single
+// atomic cursor, works on it from the calling thread as well, and spins until
+// every task has finished. The audio thread therefore never allocates, takes a
+// lock or makes a system call, and never waits on a task nobody has claimed: if
+// the workers are asleep the caller simply does all the work itself.
+//
+// Nor does it wait past its budget on a worker that was preempted. Each task
+// has its own claim/complete state, so at the deadline the caller runs every
+// task no worker has started yet and abandons the ones still running; isLate()
+// reports them, and they are skipped until their worker is done with them.
+//
+// Workers spin for spinmicros after their last task so back-to-back callbacks
+// find them awake, then back off to short sleeps.
+class RealtimeWorkerPool
+{
+public:
+    typedef void (*TaskFn)(void* context, int task);
+
+    ~RealtimeWorkerPool()
+    {
+        stop();
+    }
+
+    // Not realtime safe: creates the threads
+    void start(int numWorkers, int spinMicroseconds = 5000)
+    {
+        stop();
+        spinmicros = spinMicroseconds;
+        running.store (true);
+        for (int i = 0; i < numWorkers; i++) {
+            threads.emplace_back ([this] { workerLoop(); });
+            raisePriority (threads.back());
+        }
+    }
+
+    void stop()
+    {
+        running.store (false);
+        for (auto& t : threads) {
+            t.join();
+        }
+        threads.clear();
+    }
+
+    int getNumWorkers() const
+    {
+        return (int)threads.size();
+    }
+
+    // Runs fn(context, i) for every i in [0, numTasks) and returns once all are
+    // done, or once budgetMicroseconds (0 for no limit) have passed since the
+    // call. Returns how many tasks are late: abandoned at the deadline, or
+    // skipped because a worker was still inside them from an earlier call. The
+    // caller must leave whatever a late task touches alone until isBusy() says
+    // its worker is done. numTasks is limited to maxTasks.
+    int run(int numTasks, TaskFn fn, void* context, int budgetMicroseconds = 0)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds (budgetMicroseconds);
+        int numlate = 0;
+        int i;
+
+        if (threads.empty()) {
+            for (i = 0; i < numTasks; i++) {
+                late[i] = false;
+                fn (context, i);
+            }
+            return 0;
+        }
+
+        job++;
+        for (i = 0; i < numTasks; i++) {
+            late[i] = isBusy (i);
+            if (late[i]) {
+                numlate++;
+            }
+            else {
+                taskstate[i].store ((job << 2) | TaskFree, std::memory_order_relaxed);
+            }
+        }
+
+        taskfn.store (fn, std::memory_order_relaxed);
+        taskcontext.store (context, std::memory_order_relaxed);
+        pending.store (numTasks - numlate, std::memory_order_relaxed);
+        cursor.store ((job << 16) | ((uint64_t)numTasks << 8), std::memory_order_release);
+
+        work();
+        for (int spins = 0; pending.load (std::memory_order_acquire) > 0; spins++) {
+            if (budgetMicroseconds > 0 && (spins & 63) == 63 && std::chrono::steady_clock::now() >= deadline) {
+                numlate += finishLate (numTasks, fn, context);
+            }
+            WORKER_PAUSE();
+        }
+        return numlate;
+    }
+
+    // Whether task missed the last run(); valid until the next one
+    bool isLate(int task) const
+    {
+        return late[task];
+    }
+
+    // Whether a worker is still inside a task an earlier run() gave up on
+    bool isBusy(int task) const
+    {
+        return (taskstate[task].load (std::memory_order_acquire) & 3) == TaskAbandoned;
+    }
+
+    // Not realtime safe: sleeps until no worker is left inside an abandoned task
+    void waitForAbandonedTasks()
+    {
+        for (int i = 0; i < maxTasks; i++) {
+            while (isBusy (i)) {
+                std::this_thread::sleep_for (std::chrono::microseconds (100));
+            }
+        }
+    }
+
+    static const int maxTasks = 255;
+
+private:
+    // Low two bits of a task's state; the rest is the job it belongs to
+    enum TaskStates {
+        TaskFree = 0,
+        TaskRunning,
+        TaskDone,
+        TaskAbandoned
+    };
+
+    // A task is run by whoever moves it from free to running, and counts as
+    // finished for whoever moves it on from running, so the caller and a
+    // worker can never both run it or both account for it
+    bool claim(int task, uint64_t ofjob)
+    {
+        uint64_t expected = (ofjob << 2) | TaskFree;
+        return taskstate[task].compare_exchange_strong (expected, (ofjob << 2) | TaskRunning, std::memory_order_acquire);
+    }
+
+    void complete(int task, uint64_t ofjob)
+    {
+        uint64_t expected = (ofjob << 2) | TaskRunning;
+        if (taskstate[task].compare_exchange_strong (expected, (ofjob << 2) | TaskDone, std::memory_order_release)) {
+            pending.fetch_sub (1, std::memory_order_release);
+        }
+        else {
+            // Abandoned by the caller, which no longer counts it; hand it back
+            taskstate[task].store ((ofjob << 2) | TaskDone, std::memory_order_release);
+        }
+    }
+
+    // Past the deadline: runs the tasks workers claimed from the cursor but
+    // have not started, and abandons the ones they are inside
+    int finishLate(int numTasks, TaskFn fn, void* context)
+    {
+        int numlate = 0;
+
+        for (int i = 0; i < numTasks; i++) {
+            if (claim (i, job)) {
+                fn (context, i);
+                complete (i, job);
+                continue;
+            }
+            uint64_t expected = (job << 2) | TaskRunning;
+            if (taskstate[i].compare_exchange_strong (expected, (job << 2) | TaskAbandoned, std::memory_order_acq_rel)) {
+                late[i] = true;
+                numlate++;
+                pending.fetch_sub (1, std::memory_order_release);
+            }
+        }
+        return numlate;
+    }
+
+    // Claims tasks until the current job has none left. Job, task count and next
+    // index share one atomic, so a claim only succeeds on the job it was read
+    // from, and that job cannot finish (and have its task function replaced)
+    // while it still has unclaimed tasks.
+    bool work()
+    {
+        uint64_t c = cursor.load (std::memory_order_acquire);
+        bool didwork = false;
+
+        while ((c & 0xff) < ((c >> 8) & 0xff)) {
+            TaskFn fn = taskfn.load (std::memory_order_relaxed);
+            void* context = taskcontext.load (std::memory_order_relaxed);
+            if (cursor.compare_exchange_weak (c, c + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                int task = (int)(c & 0xff);
+                if (claim (task, c >> 16)) {
+                    fn (context, task);
+                    complete (task, c >> 16);
+                }
+                didwork = true;
+                c = cursor.load (std::memory_order_acquire);
+            }
+        }
+        return didwork;
+    }
+
+    void workerLoop()
+    {
+        auto lastwork = std::chrono::steady_clock::now();
+
+        while (running.load (std::memory_order_relaxed)) {
+            if (work()) {
+                lastwork = std::chrono::steady_clock::now();
+                continue;
+            }
+
+            if (std::chrono::steady_clock::now() - lastwork < std::chrono::microseconds (spinmicros)) {
+                for (int i = 0; i < 64; i++) {
+                    WORKER_PAUSE();
+                }
+            }
+            else {
+                std::this_thread::sleep_for (std::chrono::microseconds (200));
+            }
+        }
+    }
+
+    // Best effort: hosts usually deny SCHED_FIFO to plug-ins, in which case the
+    // workers stay at normal priority and the caller picks up their share
+    static void raisePriority(std::thread& t)
+    {
+       #if ! defined(_WIN32)
+        sched_param param;
+        param.sched_priority = sched_get_priority_min (SCHED_FIFO) + 1;
+        pthread_setschedparam (t.native_handle(), SCHED_FIFO, &param);
+       #else
+        (void)t;
+       #endif
+    }
+
+    std::vector<std::thread> threads;
+    std::atomic<bool> running { false };
+    std::atomic<uint64_t> cursor { 0 }; // (job << 16) | (tasks << 8) | next unclaimed task
+    std::atomic<int> pending { 0 }; // tasks of the current job not yet finished
+    std::atomic<uint64_t> taskstate[maxTasks] {}; // (job << 2) | TaskStates
+    bool late[maxTasks] {}; // only touched by the thread calling run()
+    std::atomic<TaskFn> taskfn { nullptr };
+    std::atomic<void*> taskcontext { nullptr };
+    uint64_t job = 0; // only touched by the thread calling run()
+    int spinmicros = 5000;
+};
+
+#endif
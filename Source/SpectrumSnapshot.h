@@ -0,0 +1,88 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+#ifndef __SPECTRUMSNAPSHOT__
+#define __SPECTRUMSNAPSHOT__
+#include <atomic>
+#include <math.h>
+
+#define SPECTRUM_BANDS 96 // log-spaced bands between SPECTRUM_MINHZ and SPECTRUM_MAXHZ
+#define SPECTRUM_MINHZ 30.0f
+#define SPECTRUM_MAXHZ 16000.0f
+
+// One hop's analysis spectrum, decimated to log-spaced bands
+struct SpectrumSnapshot
+{
+    float bands[SPECTRUM_BANDS]; // peak power in each band; a full-scale sine reads 1
+    float fundamental; // detected pitch in Hz
+    float target; // pitch the correction is heading for, in Hz
+    float confidence; // 0 to 1; voiced from the shifter's threshold up
+
+    // Lower edge of a band in Hz; band SPECTRUM_BANDS is the top edge of the last
+    static float getBandFrequency(float band)
+    {
+        return SPECTRUM_MINHZ * powf(SPECTRUM_MAXHZ / SPECTRUM_MINHZ, band / SPECTRUM_BANDS);
+    }
+};
+
+// Triple buffer handing the latest SpectrumSnapshot from the audio thread to
+// one reader. The writer fills getWriteBuffer() and publish()es it; the reader
+// gets the newest published snapshot from read(). Neither side ever waits, and
+// a reader that falls behind just skips to the newest snapshot.
+//
+// The shifter only does the decimation while the buffer is enabled, so it costs
+// nothing while no one is looking.
+class SpectrumBuffer
+{
+public:
+    void setEnabled(bool enable)
+    {
+        enabled.store (enable, std::memory_order_relaxed);
+    }
+
+    bool isEnabled() const
+    {
+        return enabled.load (std::memory_order_relaxed);
+    }
+
+    // Writer only. Stays the writer's until the next publish().
+    SpectrumSnapshot& getWriteBuffer()
+    {
+        return buffers[back];
+    }
+
+    // Writer only
+    void publish()
+    {
+        back = middle.exchange (back | freshbit, std::memory_order_acq_rel) & indexmask;
+    }
+
+    // Reader only. The newest snapshot published since the last call, valid
+    // until the next call, or nullptr if there is none.
+    const SpectrumSnapshot* read()
+    {
+        if ((middle.load (std::memory_order_relaxed) & freshbit) == 0) {
+            return nullptr;
+        }
+        front = middle.exchange (front, std::memory_order_acq_rel) & indexmask;
+        return &buffers[front];
+    }
+
+private:
+    static const int indexmask = 3;
+    static const int freshbit = 4; // middle holds a snapshot the reader hasn't seen
+
+    SpectrumSnapshot buffers[3] = {};
+    int back = 0; // writer's
+    alignas(64) std::atomic<int> middle { 1 };
+    std::atomic<bool> enabled { false };
+    alignas(64) int front = 2; // reader's
+};
+
+#endif
@@ -7,6 +7,9 @@
  *
  */
 
+#ifndef FFTSETUP_H
+#define FFTSETUP_H
+
 #include "mayer_fft.h"
 
 // Variables for FFT routine
@@ -51,11 +54,9 @@ inline void fft_forward(fft_vars* membvars, float* input, float* output_re, floa
     int ti;
     int nfft;
     int hnfft;
-    int numfreqs;
     
     nfft = membvars->nfft;
     hnfft = nfft/2;
-    numfreqs = membvars->numfreqs;
     
     for (ti=0; ti<nfft; ti++) {
         membvars->fft_data[ti] = input[ti];
@@ -72,6 +73,61 @@ inline void fft_forward(fft_vars* membvars, float* input, float* output_re, floa
     output_im[hnfft] = 0;
 }
 
+// Staged transforms, for callers that spread one over several calls. The
+// input goes in fft_data (fft_pack_inverse() puts it there for the inverse),
+// fft_pass() runs passes 0 to fft_passes() - 1 over it in order, and the
+// result is unpacked from it afterwards. The results match fft_forward() and
+// fft_inverse() exactly.
+inline int fft_passes(fft_vars* membvars)
+{
+    return mayer_fht_passes(membvars->nfft);
+}
+
+inline void fft_pass(fft_vars* membvars, int pass)
+{
+    mayer_fht_pass(membvars->fft_data, membvars->nfft, pass);
+}
+
+// The end of fft_forward(), once every pass has run over the input in fft_data
+inline void fft_unpack_forward(fft_vars* membvars, float* output_re, float* output_im)
+{
+    int ti;
+    int nfft;
+    int hnfft;
+    
+    nfft = membvars->nfft;
+    hnfft = nfft/2;
+    
+    mayer_realfft_unfold(nfft, membvars->fft_data);
+    
+    output_im[0] = 0;
+    for (ti=0; ti<hnfft; ti++) {
+        output_re[ti] = membvars->fft_data[ti];
+        output_im[ti+1] = membvars->fft_data[nfft-1-ti];
+    }
+    output_re[hnfft] = membvars->fft_data[hnfft];
+    output_im[hnfft] = 0;
+}
+
+// The start of fft_inverse(); fft_data holds the output once every pass has run
+inline void fft_pack_inverse(fft_vars* membvars, float* input_re, float* input_im)
+{
+    int ti;
+    int nfft;
+    int hnfft;
+    
+    nfft = membvars->nfft;
+    hnfft = nfft/2;
+    
+    for (ti=0; ti<hnfft; ti++) {
+        membvars->fft_data[ti] = input_re[ti];
+        membvars->fft_data[nfft-1-ti] = input_im[ti+1];
+    }
+    membvars->fft_data[hnfft] = input_re[hnfft];
+    
+    mayer_realifft_fold(nfft, membvars->fft_data);
+}
+
 // Perform inverse FFT, returning real data
 // Accepts:
 //   membvars - pointer to struct of FFT variables
@@ -85,11 +141,9 @@ inline void fft_inverse(fft_vars* membvars, float* input_re, float* input_im, fl
     int ti;
     int nfft;
     int hnfft;
-    int numfreqs;
     
     nfft = membvars->nfft;
     hnfft = nfft/2;
-    numfreqs = membvars->numfreqs;
     
     for (ti=0; ti<hnfft; ti++) {
         membvars->fft_data[ti] = input_re[ti];
@@ -103,3 +157,5 @@ inline void fft_inverse(fft_vars* membvars, float* input_re, float* input_im, fl
         output[ti] = membvars->fft_data[ti];
     }
 }
+
+#endif // FFTSETUP_H
@@ -213,7 +213,20 @@ static REAL sinwrk[20]=
 #define SQRT2_2   0.70710678118654752440084436210484
 #define SQRT2   2*0.70710678118654752440084436210484
 
-inline void mayer_fht(REAL *fz, int n)
+/* Number of mayer_fht_pass() calls one transform of n points takes: the
+** bit reversal, the first radix-4 or radix-8 pass, then a radix-4 pass
+** for every two further stages. */
+inline int mayer_fht_passes(int n)
+{
+ int k;
+ for ( k=0 ; (1<<k)<n ; k++ );
+ return (k<4) ? 2 : 2 + (k - (k&1) - 2)/2;
+}
+
+/* One pass of mayer_fht(), so the transform can be spread over several
+** calls; running passes 0 to mayer_fht_passes(n)-1 in order is the same
+** as mayer_fht(fz,n). */
+inline void mayer_fht_pass(REAL *fz, int n, int pass)
 {
 /*  REAL a,b;
 REAL c1,s1,s2,c2,s3,c3,s4,c4;
@@ -222,18 +235,22 @@ REAL c1,s1,s2,c2,s3,c3,s4,c4;
  REAL *fi,*fn,*gi;
  TRIG_VARS;
 
- for (k1=1,k2=0;k1<n;k1++)
+ if (pass==0)
     {
-     REAL aa;
-     for (k=n>>1; (!((k2^=k)&k)); k>>=1);
-     if (k1>k2)
+     for (k1=1,k2=0;k1<n;k1++)
         {
-             aa=fz[k1];fz[k1]=fz[k2];fz[k2]=aa;
+         REAL aa;
+         for (k=n>>1; (!((k2^=k)&k)); k>>=1);
+         if (k1>k2)
+            {
+                 aa=fz[k1];fz[k1]=fz[k2];fz[k2]=aa;
+            }
         }
+     return;
     }
  for ( k=0 ; (1<<k)<n ; k++ );
  k  &= 1;
- if (k==0)
+ if (pass==1 && k==0)
     {
          for (fi=fz,fn=fz+n;fi<fn;fi+=4)
             {
@@ -248,7 +265,7 @@ REAL c1,s1,s2,c2,s3,c3,s4,c4;
              fi[1 ] = (f1+f3);
             }
     }
- else
+ else if (pass==1)
     {
          for (fi=fz,fn=fz+n,gi=fi+1;fi<fn;fi+=8,gi+=8)
             {
@@ -280,13 +297,12 @@ REAL c1,s1,s2,c2,s3,c3,s4,c4;
              gi[2 ] = bg1 + bg3;
             }
     }
- if (n<16) return;
+ if (pass==1) return;
 
- do
     {
      REAL s1,c1;
      int ii;
-     k  += 2;
+     k  += 2*(pass - 1);
      k1  = 1  << k;
      k2  = k1 << 1;
      k4  = k2 << 1;
@@ -359,7 +375,14 @@ REAL c1,s1,s2,c2,s3,c3,s4,c4;
                 } while (fi<fn);
         }
      TRIG_RESET(k,c1,s1);
-    } while (k4<n);
+    }
+}
+
+inline void mayer_fht(REAL *fz, int n)
+{
+ int pass,passes=mayer_fht_passes(n);
+ for (pass=0;pass<passes;pass++)
+     mayer_fht_pass(fz,n,pass);
 }
 
 inline void mayer_fft(int n, REAL *real, REAL *imag)
@@ -392,12 +415,12 @@ inline void mayer_ifft(int n, REAL *real, REAL *imag)
  }
 }
 
-inline void mayer_realfft(int n, REAL *real)
+/* What mayer_realfft() does after the hartley transform */
+inline void mayer_realfft_unfold(int n, REAL *real)
 {
   REAL a,b;
  int i,j,k;
 
- mayer_fht(real,n);
  for (i=1,j=n-1,k=n/2;i<k;i++,j--) {
   a = real[i];
   b = real[j];
@@ -406,7 +429,8 @@ inline void mayer_realfft(int n, REAL *real)
  }
 }
 
-inline void mayer_realifft(int n, REAL *real)
+/* What mayer_realifft() does before the hartley transform */
+inline void mayer_realifft_fold(int n, REAL *real)
 {
   REAL a,b;
  int i,j,k;
@@ -417,5 +441,16 @@ inline void mayer_realifft(int n, REAL *real)
   real[j] = (a-b);
   real[i] = (a+b);
  }
+}
+
+inline void mayer_realfft(int n, REAL *real)
+{
+ mayer_fht(real,n);
+ mayer_realfft_unfold(n,real);
+}
+
+inline void mayer_realifft(int n, REAL *real)
+{
+ mayer_realifft_fold(n,real);
  mayer_fht(real,n);
 }
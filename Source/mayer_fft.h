@@ -10,6 +10,13 @@ extern "C" {
 inline void mayer_realfft(int n, REAL *real);
 inline void mayer_realifft(int n, REAL *real);
 
+// The same transforms spread over several calls: fold (inverse only), every
+// hartley pass in order, then unfold (forward only)
+inline int mayer_fht_passes(int n);
+inline void mayer_fht_pass(REAL *fz, int n, int pass);
+inline void mayer_realfft_unfold(int n, REAL *real);
+inline void mayer_realifft_fold(int n, REAL *real);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,89 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// PitchShifterBank throughput benchmark.
+//
+// Corrects K = 4, 8 and 16 streams of the same kind of synthetic vocal line,
+// once with K independent PitchShifter objects and once with a single
+// PitchShifterBank<K>, and prints the aggregate cost per stream sample. Lane
+// width depends on the target, so build it the way the server is built.
+//
+//   g++ -O3 -march=native -std=c++17 -I../Source BankBenchmark.cpp -o BankBenchmark
+//   ./BankBenchmark [seconds]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "PitchShifterBank.h"
+#include "TestSignals.h"
+
+static const int sampleRate = 44100;
+static const int blockSize = 256;
+
+template <int K>
+static void run(double seconds)
+{
+    int n = (int)(seconds * sampleRate) / blockSize * blockSize;
+    std::vector<std::vector<float>> input;
+    std::vector<std::vector<float>> output (K, std::vector<float> (blockSize));
+    std::vector<const float*> ins (K);
+    std::vector<float*> outs (K);
+
+    for (int k = 0; k < K; k++) {
+        input.push_back (makeVocalLine (sampleRate, n, 110.0 * pow(2.0, k / 12.0)));
+        outs[k] = output[k].data();
+    }
+
+    std::vector<std::unique_ptr<PitchShifter>> engines;
+    for (int k = 0; k < K; k++) {
+        engines.push_back (std::make_unique<PitchShifter>());
+        engines.back()->init (sampleRate);
+        engines.back()->setScale (Scales::NoteC, Scales::Major);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i += blockSize) {
+        for (int k = 0; k < K; k++) {
+            const float* in[] = { input[k].data() + i };
+            float* out[] = { outs[k] };
+            engines[k]->ProcessFloatReplacing (in, out, blockSize);
+        }
+    }
+    std::chrono::duration<double, std::nano> tobjects = std::chrono::steady_clock::now() - start;
+
+    auto bank = std::make_unique<PitchShifterBank<K>>();
+    bank->init (sampleRate);
+    for (int k = 0; k < K; k++) {
+        bank->setScale (k, Scales::NoteC, Scales::Major);
+    }
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i += blockSize) {
+        for (int k = 0; k < K; k++) {
+            ins[k] = input[k].data() + i;
+        }
+        bank->ProcessFloatReplacing (ins.data(), outs.data(), blockSize);
+    }
+    std::chrono::duration<double, std::nano> tbank = std::chrono::steady_clock::now() - start;
+
+    double perobjects = tobjects.count() / ((double)n * K);
+    double perbank = tbank.count() / ((double)n * K);
+    printf("%7d  %19.1f  %16.1f  %7.2fx\n", K, perobjects, perbank, perobjects / perbank);
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = (argc > 1) ? atof(argv[1]) : 10;
+
+    printf("streams  objects ns/sample  bank ns/sample  speedup\n");
+    run<4> (seconds);
+    run<8> (seconds);
+    run<16> (seconds);
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Per-block latency and jitter benchmark.
+//
+// Times every ProcessFloatReplacing() call of a mono PitchShifter over a long
+// synthetic sung phrase (from TestSignals.h) at host block sizes from 32
+// to 1024, so the blocks that contain analysis work show up instead of being
+// averaged away. For each configuration it prints the p50, p99, p99.9 and
+// slowest block, and counts the blocks that would miss their deadline: the
+// block's duration times the share of it the plugin may use (all of it by
+// default; pass a smaller share to model a busy session). The histogram below
+// that spreads each configuration's blocks over fractions of the deadline.
+//
+//   g++ -O2 -std=c++17 -I../Source BlockJitterBenchmark.cpp -o BlockJitterBenchmark
+//   ./BlockJitterBenchmark [seconds] [deadline share]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "PitchShifter.h"
+#include "TestSignals.h"
+
+static const Preset presets[] = {
+    { "standard", PitchShifter::QualityStandard, PitchShifter::ShifterOLA, false, 1 },
+    { "hq", PitchShifter::QualityHQ, PitchShifter::ShifterOLA, false, 1 },
+    { "formant", PitchShifter::QualityStandard, PitchShifter::ShifterOLA, true, 1 },
+    { "psola", PitchShifter::QualityStandard, PitchShifter::ShifterPSOLA, false, 1 },
+};
+
+// Upper edges of the histogram buckets, as fractions of the deadline; the last
+// bucket holds the misses
+static const double bucketEdges[] = { 0.01, 0.02, 0.05, 0.1, 0.2, 0.5, 1.0 };
+static const int numBuckets = 8;
+
+struct BlockTimes
+{
+    double p50, p99, p999, max; // microseconds
+    double deadline; // microseconds
+    int missed;
+    int buckets[numBuckets];
+};
+
+static BlockTimes measure(const Preset& preset, int sampleRate, int blockSize, const std::vector<float>& input, double deadlineShare)
+{
+    auto shifter = std::make_unique<PitchShifter>();
+    std::vector<float> output (input.size());
+    int n = (int)input.size() / blockSize * blockSize;
+    std::vector<double> times;
+    BlockTimes result = {};
+
+    shifter->setScale (Scales::NoteC, Scales::Major);
+    shifter->setQuality (preset.quality);
+    shifter->setShifterMode (preset.shifterMode);
+    shifter->setFormantPreservation (preset.formant);
+    shifter->init (sampleRate);
+    times.reserve (n / blockSize);
+
+    for (int i = 0; i < n; i += blockSize) {
+        const float* in[] = { input.data() + i };
+        float* out[] = { output.data() + i };
+        auto start = std::chrono::steady_clock::now();
+        shifter->ProcessFloatReplacing (in, out, blockSize);
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        times.push_back (elapsed.count());
+    }
+
+    result.deadline = 1e6 * blockSize / sampleRate * deadlineShare;
+    for (double t : times) {
+        int b = 0;
+        while (b < numBuckets - 1 && t >= bucketEdges[b] * result.deadline) {
+            b++;
+        }
+        result.buckets[b]++;
+    }
+    result.missed = result.buckets[numBuckets - 1];
+
+    std::sort (times.begin(), times.end());
+    result.p50 = times[times.size() / 2];
+    result.p99 = times[times.size() * 99 / 100];
+    result.p999 = times[times.size() * 999 / 1000];
+    result.max = times.back();
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = (argc > 1) ? atof(argv[1]) : 30;
+    double deadlineShare = (argc > 2) ? atof(argv[2]) : 1.0;
+    std::vector<BlockTimes> results;
+
+    printf("rate    block  preset     p50 us   p99 us  p99.9 us    max us  deadline us  missed\n");
+    for (int sampleRate : { 44100, 48000, 96000 }) {
+        std::vector<float> input = makePhrase(sampleRate, (int)(seconds * sampleRate));
+        for (int blockSize = 32; blockSize <= 1024; blockSize *= 2) {
+            for (const Preset& preset : presets) {
+                BlockTimes t = measure (preset, sampleRate, blockSize, input, deadlineShare);
+                printf("%-7d %5d  %-8s %8.1f %8.1f %9.1f %9.1f %12.1f %7d\n", sampleRate, blockSize, preset.name,
+                       t.p50, t.p99, t.p999, t.max, t.deadline, t.missed);
+                results.push_back (t);
+            }
+        }
+    }
+
+    printf("\nblocks by share of the deadline\n");
+    printf("rate    block  preset        <1%%     <2%%     <5%%    <10%%    <20%%    <50%%   <100%%  missed\n");
+    int r = 0;
+    for (int sampleRate : { 44100, 48000, 96000 }) {
+        for (int blockSize = 32; blockSize <= 1024; blockSize *= 2) {
+            for (const Preset& preset : presets) {
+                printf("%-7d %5d  %-8s", sampleRate, blockSize, preset.name);
+                for (int b = 0; b < numBuckets; b++) {
+                    printf(" %7d", results[r].buckets[b]);
+                }
+                printf("\n");
+                r++;
+            }
+        }
+    }
+    return 0;
+}
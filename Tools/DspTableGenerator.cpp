@@ -0,0 +1,135 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Generator for Source/DspTables.h.
+//
+// Emits the hann, analysis window and inverse window-autocorrelation tables
+// for every buffer size and window PitchShifter::init() picks, computed by the
+// same code
+// DspTableCache uses at runtime, so init() only has to look them up. With
+// --verify it instead checks the compiled-in tables against a fresh runtime
+// build, bit for bit, and that acquire() hands them out; it exits non-zero
+// on any mismatch. Re-run it whenever the table code or the sizes change.
+//
+//   g++ -O2 -std=c++17 -I../Source DspTableGenerator.cpp -o DspTableGenerator
+//   ./DspTableGenerator > ../Source/DspTables.h
+//   ./DspTableGenerator --verify
+//
+// Add -DDSPTABLES_NONE to build it before DspTables.h exists.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "mayer_fft.c"
+#include "DspTableCache.h"
+
+// Live and standard buffers at 44.1/48kHz and at 88.2kHz and up
+static const struct { unsigned long size; int windowType; } sets[] = {
+    { 1024, DspTableCache::WindowLiveHann },
+    { 2048, DspTableCache::WindowLiveHann },
+    { 2048, DspTableCache::WindowHalfHann },
+    { 4096, DspTableCache::WindowHalfHann }
+};
+static const int numSets = sizeof(sets) / sizeof(sets[0]);
+
+// Suffix telling each set's windows apart; the hann tables are shared
+static const char* windowSuffix(int windowType)
+{
+    return (windowType == DspTableCache::WindowLiveHann) ? "live" : "";
+}
+
+static void emitArray(const char* name, unsigned long cbsize, const char* suffix, const float* data)
+{
+    printf("    static const float %s%lu%s[%lu] = {", name, cbsize, suffix, cbsize);
+    for (unsigned long i = 0; i < cbsize; i++) {
+        printf("%s%.8ef%s", (i % 6 == 0) ? "\n        " : " ", data[i], (i + 1 < cbsize) ? "," : "");
+    }
+    printf("\n    };\n");
+}
+
+static int emit()
+{
+    int i;
+
+    printf("/*\n"
+           "     _______         __  __  __             _____    __       __\n"
+           "    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023\n"
+           "    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited\n"
+           "    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev\n"
+           "\n"
+           "    Quilio Software uses a commercial licence     -     see LICENCE.md for details.\n"
+           "*/\n"
+           "\n"
+           "// Generated by Tools/DspTableGenerator.cpp, do not edit. Included by\n"
+           "// DspTableCache.h after ShifterTables.\n"
+           "\n"
+           "#ifndef __DSPTABLES__\n"
+           "#define __DSPTABLES__\n"
+           "\n"
+           "static const int generatedTableCount = %d;\n"
+           "\n"
+           "inline const ShifterTables* generatedShifterTables()\n"
+           "{\n", numSets);
+
+    for (i = 0; i < numSets; i++) {
+        std::shared_ptr<const ShifterTables> t = DspTableCache::build (sets[i].size, sets[i].windowType);
+        const char* suffix = windowSuffix (sets[i].windowType);
+        if (i == 0 || sets[i].size != sets[i - 1].size) {
+            emitArray ("hannwindow", sets[i].size, "", t->hannwindow);
+        }
+        emitArray ("cbwindow", sets[i].size, suffix, t->cbwindow);
+        emitArray ("acwinv", sets[i].size, suffix, t->acwinv);
+        printf("\n");
+    }
+
+    printf("    static const ShifterTables tables[generatedTableCount] = {\n");
+    for (i = 0; i < numSets; i++) {
+        const char* suffix = windowSuffix (sets[i].windowType);
+        printf("        { %lu, %d, hannwindow%lu, cbwindow%lu%s, acwinv%lu%s, {} }%s\n",
+               sets[i].size, sets[i].windowType, sets[i].size, sets[i].size, suffix, sets[i].size, suffix,
+               (i + 1 < numSets) ? "," : "");
+    }
+    printf("    };\n"
+           "    return tables;\n"
+           "}\n"
+           "\n"
+           "#endif\n");
+    return 0;
+}
+
+static int verify()
+{
+    int failures = 0;
+
+    if (generatedTableCount != numSets) {
+        printf("compiled-in tables cover %d sets, expected %d\n", generatedTableCount, numSets);
+        return 1;
+    }
+    for (int i = 0; i < numSets; i++) {
+        unsigned long n = sets[i].size;
+        std::shared_ptr<const ShifterTables> built = DspTableCache::build (n, sets[i].windowType);
+        std::shared_ptr<const ShifterTables> acquired = DspTableCache::acquire (n, sets[i].windowType);
+        bool ok = acquired->storage.empty()
+            && memcmp(acquired->hannwindow, built->hannwindow, n * sizeof(float)) == 0
+            && memcmp(acquired->cbwindow, built->cbwindow, n * sizeof(float)) == 0
+            && memcmp(acquired->acwinv, built->acwinv, n * sizeof(float)) == 0;
+
+        printf("%5lu%-5s %s\n", n, windowSuffix (sets[i].windowType), ok ? "ok" : "MISMATCH, regenerate DspTables.h");
+        failures += ok ? 0 : 1;
+    }
+    return failures == 0 ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && strcmp(argv[1], "--verify") == 0) {
+        return verify();
+    }
+    return emit();
+}
@@ -0,0 +1,181 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Formant preservation check.
+//
+// Shifts a synthetic /a/ (see makeVowel()) up and down five semitones with each
+// shifter, with and without formant preservation, and compares the spectral
+// envelope of the output with the input's. The envelope is an all-pole fit
+// to the autocorrelation averaged over the whole steady part of the signal,
+// independent of the shifter's own. Reported per case:
+//   F1            the envelope's peak between 400 and 1100 Hz
+//   distance      RMS difference of the two envelopes, in dB, over 200-3500 Hz
+//                 with their mean levels matched
+// With preservation F1 has to stay within 10% of the input's and the distance
+// under 1.5 dB. OLA resamples its grains, so without preservation the formants
+// move with the pitch, and there the distance also has to be at most half of
+// what it is without. PSOLA's grains are not resampled, so it keeps the
+// envelope either way; preservation only has to do no harm. Any miss fails
+// the run with a non-zero exit; ctest runs it.
+//
+//   g++ -O2 -std=c++17 -I../Source FormantCheck.cpp -o FormantCheck
+//   ./FormantCheck
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "PitchShifter.h"
+#include "TestSignals.h"
+
+static const int sampleRate = 44100;
+static const int envelopeOrder = 16;
+static const double gridLow = 200, gridHigh = 3500, gridStep = 10;
+
+// Log-magnitude envelope in dB on the grid from gridLow to gridHigh, from
+// Hann-windowed frames of x after the first skip samples
+static std::vector<double> envelope(const std::vector<float>& x, int skip)
+{
+    const int frame = 2048;
+    double r[envelopeOrder + 1] = {};
+    double a[envelopeOrder + 1] = { 1 };
+    double tmp[envelopeOrder + 1];
+    std::vector<double> w (frame), db;
+    int i, j, k;
+
+    for (i = 0; i < frame; i++) {
+        w[i] = 0.5 - 0.5 * cos(2 * M_PI * i / frame);
+    }
+    for (int start = skip; start + frame <= (int)x.size(); start += frame / 4) {
+        for (k = 0; k <= envelopeOrder; k++) {
+            for (i = k; i < frame; i++) {
+                r[k] += x[start + i] * w[i] * x[start + i - k] * w[i - k];
+            }
+        }
+    }
+
+    // Widen the peaks with a Gaussian lag window, like the shifter's, so the fit
+    // follows the formants rather than the harmonics
+    for (k = 1; k <= envelopeOrder; k++) {
+        double t = 2 * M_PI * 100 * k / sampleRate;
+        r[k] *= exp(-0.5 * t * t);
+    }
+    r[0] *= 1.0001;
+
+    double err = r[0];
+    for (i = 1; i <= envelopeOrder; i++) {
+        double acc = r[i];
+        for (j = 1; j < i; j++) {
+            acc += a[j] * r[i - j];
+        }
+        double refl = -acc / err;
+        for (j = 1; j < i; j++) {
+            tmp[j] = a[j] + refl * a[i - j];
+        }
+        for (j = 1; j < i; j++) {
+            a[j] = tmp[j];
+        }
+        a[i] = refl;
+        err *= 1 - refl * refl;
+    }
+
+    double mean = 0;
+    for (double f = gridLow; f <= gridHigh; f += gridStep) {
+        double re = 0, im = 0;
+        for (k = 0; k <= envelopeOrder; k++) {
+            re += a[k] * cos(2 * M_PI * f * k / sampleRate);
+            im -= a[k] * sin(2 * M_PI * f * k / sampleRate);
+        }
+        db.push_back (-10 * log10(re * re + im * im));
+        mean += db.back();
+    }
+    mean /= db.size();
+    for (double& v : db) {
+        v -= mean;
+    }
+    return db;
+}
+
+static double firstFormant(const std::vector<double>& db)
+{
+    double best = -1e9, hz = 0;
+    for (size_t i = 0; i < db.size(); i++) {
+        double f = gridLow + i * gridStep;
+        if (f >= 400 && f <= 1100 && db[i] > best) {
+            best = db[i];
+            hz = f;
+        }
+    }
+    return hz;
+}
+
+static double distance(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double sum = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        sum += (a[i] - b[i]) * (a[i] - b[i]);
+    }
+    return sqrt(sum / a.size());
+}
+
+static std::vector<float> shift(const std::vector<float>& input, int shifterMode, float semitones, bool formant)
+{
+    std::unique_ptr<PitchShifter> shifter (new PitchShifter());
+    std::vector<float> output (input.size());
+
+    shifter->init (sampleRate);
+    shifter->setShifterMode (shifterMode);
+    shifter->setFormantPreservation (formant);
+    shifter->setAmountAmount (0);
+    shifter->setShiftAmount (semitones);
+    shifter->setMixAmount (1);
+
+    for (size_t i = 0; i < input.size(); i += 256) {
+        int n = (int)std::min ((size_t)256, input.size() - i);
+        const float* in[] = { input.data() + i };
+        float* out[] = { output.data() + i };
+        shifter->process (in, out, n);
+    }
+    return output;
+}
+
+int main()
+{
+    static const char* shifterNames[] = { "ola", "psola" };
+    static const float shifts[] = { 5, -5 };
+    std::vector<float> input = makeVowel (sampleRate, sampleRate * 3, 160);
+    int skip = sampleRate / 2;
+    std::vector<double> reference = envelope (input, skip);
+    double inputF1 = firstFormant (reference);
+    int failures = 0;
+
+    printf("input F1 %.0f Hz\n\n", inputF1);
+    printf("shifter  shift  formant    F1 Hz  distance dB\n");
+    for (int mode = PitchShifter::ShifterOLA; mode <= PitchShifter::ShifterPSOLA; mode++) {
+        for (float semitones : shifts) {
+            double distances[2];
+            for (int formant = 0; formant <= 1; formant++) {
+                std::vector<double> db = envelope (shift (input, mode, semitones, formant != 0), skip);
+                double f1 = firstFormant (db);
+                bool ok = true;
+                distances[formant] = distance (reference, db);
+                if (formant) {
+                    ok = fabs(f1 / inputF1 - 1) <= 0.1 && distances[1] <= 1.5
+                        && (mode != PitchShifter::ShifterOLA || distances[1] <= 0.5 * distances[0]);
+                }
+                printf("%-8s %+5.0f  %-8s %7.0f  %11.2f  %s\n", shifterNames[mode], semitones, formant ? "on" : "off",
+                       f1, distances[formant], ok ? "" : "FAIL");
+                failures += ok ? 0 : 1;
+            }
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
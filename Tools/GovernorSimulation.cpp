@@ -0,0 +1,89 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Load governor simulation.
+//
+// Drives a stereo CorrectionEngine in HQ the way processBlock() does, timing
+// each block against its duration and feeding the LoadGovernor. Between 10s
+// and 20s of session time every block also burns a fixed share of its
+// duration, standing in for the rest of a heavy session. Prints the running
+// tier, the governor's load percentile and its transition counters once per
+// session second.
+//
+//   g++ -O2 -std=c++17 -I../Source GovernorSimulation.cpp -o GovernorSimulation -pthread
+//   ./GovernorSimulation [busy share]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "CorrectionEngine.h"
+#include "LoadGovernor.h"
+
+static const int sampleRate = 44100;
+static const int blockSize = 256;
+static const int numChannels = 2;
+static const int sessionSeconds = 40;
+
+int main(int argc, char** argv)
+{
+    double busyShare = (argc > 1) ? atof(argv[1]) : 0.6;
+    double blockSeconds = (double)blockSize / sampleRate;
+    int blocksPerSecond = sampleRate / blockSize;
+    const char* tierNames[] = { "Eco", "Standard", "HQ" };
+
+    CorrectionEngine engine;
+    LoadGovernor governor;
+    engine.prepare (sampleRate, numChannels);
+    governor.reset();
+
+    std::vector<std::vector<float>> audio (numChannels, std::vector<float> (blockSize));
+    float* channels[numChannels];
+    for (int c = 0; c < numChannels; c++) {
+        channels[c] = audio[c].data();
+    }
+    double phase = 0;
+    int tier = -1;
+
+    printf("second  tier      load p94  steps down  steps up\n");
+    for (int b = 0; b < sessionSeconds * blocksPerSecond; b++) {
+        auto start = std::chrono::steady_clock::now();
+        double second = (double)b / blocksPerSecond;
+
+        // As processBlock(): the tier for this block comes from the last update
+        int limited = std::min ((int)PitchShifter::QualityHQ, governor.getTierLimit());
+        if (limited != tier) {
+            tier = limited;
+            engine.forEachShifter ([=](PitchShifter& s) { s.setQuality (tier); });
+        }
+
+        for (int s = 0; s < blockSize; s++) {
+            phase += 2 * M_PI * 196 / sampleRate;
+            for (int c = 0; c < numChannels; c++) {
+                audio[c][s] = (float)(0.3 * sin(phase) + 0.1 * sin(2 * phase));
+            }
+        }
+        engine.process (channels, blockSize);
+
+        if (second >= 10 && second < 20) {
+            auto busyUntil = start + std::chrono::duration<double> (busyShare * blockSeconds);
+            while (std::chrono::steady_clock::now() < busyUntil) {
+            }
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        governor.update (elapsed.count(), blockSeconds, PitchShifter::QualityHQ);
+
+        if ((b + 1) % blocksPerSecond == 0) {
+            printf("%6d  %-8s %9.2f %11d %9d\n", (b + 1) / blocksPerSecond, tierNames[tier],
+                   governor.getLoadPercentile(), governor.getStepsDown(), governor.getStepsUp());
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Harmonizer scaling benchmark.
+//
+// Runs K = 1..8 voices two ways over the same synthetic vocal line: as harmony
+// voices of a single PitchShifter (one analysis, shared grain captures), and as
+// K independent PitchShifter instances, which is what we did before. Prints the
+// cost per input sample and the cost relative to a single voice.
+//
+//   g++ -O2 -std=c++17 -I../Source HarmonizerBenchmark.cpp -o HarmonizerBenchmark
+//   ./HarmonizerBenchmark [seconds]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "PitchShifter.h"
+#include "TestSignals.h"
+
+static const int sampleRate = 44100;
+static const int blockSize = 256;
+
+template <typename Fn>
+static double nsPerSample(const std::vector<float>& input, Fn&& process)
+{
+    std::vector<float> in (blockSize);
+    std::vector<float> out (blockSize);
+    auto start = std::chrono::steady_clock::now();
+    int n = (int)input.size() / blockSize * blockSize;
+
+    for (int i = 0; i < n; i += blockSize) {
+        std::copy (input.begin() + i, input.begin() + i + blockSize, in.begin());
+        process (in.data(), out.data());
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / n;
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = (argc > 1) ? atof(argv[1]) : 20;
+    // Around G3, close enough to a voice for the detector to stay voiced
+    std::vector<float> input = makeVocalLine(sampleRate, (int)(seconds * sampleRate), 196.0);
+    double shared1 = 0, independent1 = 0;
+
+    printf("voices  shared ns/sample  (x1 voice)  independent ns/sample  (x1 voice)\n");
+    for (int k = 1; k <= MAX_VOICES; k++) {
+        // One analysis feeding k voices
+        auto shared = std::make_unique<PitchShifter>();
+        shared->init (sampleRate, 1, k);
+        shared->setScale (Scales::NoteC, Scales::Major);
+        shared->setHarmonyMode (PitchShifter::HarmonyScale);
+        shared->setNumVoices (k);
+        double tshared = nsPerSample (input, [&](float* in, float* out) {
+            const float* ins[] = { in };
+            float* outs[] = { out };
+            shared->ProcessFloatReplacing (ins, outs, blockSize);
+        });
+
+        // k full engines, each with its own analysis and a fixed shift
+        std::vector<std::unique_ptr<PitchShifter>> engines;
+        for (int v = 0; v < k; v++) {
+            engines.push_back (std::make_unique<PitchShifter>());
+            engines.back()->init (sampleRate);
+            engines.back()->setScale (Scales::NoteC, Scales::Major);
+            engines.back()->setShiftAmount ((float)(2 * v));
+        }
+        double tindependent = nsPerSample (input, [&](float* in, float* out) {
+            const float* ins[] = { in };
+            float* outs[] = { out };
+            for (auto& e : engines) {
+                e->ProcessFloatReplacing (ins, outs, blockSize);
+            }
+        });
+
+        if (k == 1) {
+            shared1 = tshared;
+            independent1 = tindependent;
+        }
+        printf("%6d  %16.1f  %10.2f  %21.1f  %10.2f\n", k, tshared, tshared / shared1, tindependent, tindependent / independent1);
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Instantiation benchmark.
+//
+// Times what a host does to the processor's CorrectionEngine while scanning
+// plugins and loading sessions: bare construction, create/prepare/destroy
+// cycles, and prepareToPlay() again on a live instance, both at the same
+// configuration and alternating between 44.1kHz and 96kHz.
+//
+//   g++ -O2 -std=c++17 -I../Source InstantiationBenchmark.cpp -o InstantiationBenchmark -pthread
+//   ./InstantiationBenchmark [cycles]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include "CorrectionEngine.h"
+
+static const int numChannels = 2;
+
+template <typename Fn>
+static void time(const char* name, int cycles, Fn&& fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cycles; i++) {
+        fn (i);
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    printf("%-32s %10.2f us/cycle\n", name, elapsed.count() / cycles);
+}
+
+int main(int argc, char** argv)
+{
+    int cycles = (argc > 1) ? atoi(argv[1]) : 1000;
+
+    time ("shifter construct/destroy", cycles, [](int) {
+        auto shifter = std::make_unique<PitchShifter>();
+    });
+
+    time ("engine construct/destroy", cycles, [](int) {
+        auto engine = std::make_unique<CorrectionEngine>();
+    });
+
+    time ("engine construct/prepare/destroy", cycles, [](int) {
+        auto engine = std::make_unique<CorrectionEngine>();
+        engine->prepare (44100, numChannels, MAX_VOICES);
+    });
+
+    CorrectionEngine engine;
+    engine.prepare (44100, numChannels, MAX_VOICES);
+
+    time ("re-prepare, same configuration", cycles, [&](int) {
+        engine.prepare (44100, numChannels, MAX_VOICES);
+    });
+
+    time ("re-prepare, 44.1k/96k", cycles, [&](int i) {
+        engine.prepare ((i % 2 == 0) ? 96000 : 44100, numChannels, MAX_VOICES);
+    });
+    return 0;
+}
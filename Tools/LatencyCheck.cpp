@@ -0,0 +1,193 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Wet latency check.
+//
+// Measures the delay of the shifted signal in both latency modes, with both
+// shifters, at 44.1, 48 and 96kHz, and checks it against getLatencySamples(),
+// which the host compensates for and the dry path is delayed by. The same goes
+// for PitchShifterBank, which runs the standard OLA shifter.
+//
+// The input is a glottal-like pulse train around E3, A3 and E4 in turn, with
+// vibrato, 6% period jitter and a random level for every pulse. The lead voice's level is set
+// just under unity, which keeps the shifter out of the identity fast path
+// without changing the pitch. The delay is the peak of the cross-correlation
+// of the input and output energy envelopes, each taken over one period. An OLA
+// grain is cut at the last input pitch mark, so it plays out from no earlier
+// than the reported latency to up to a period after it, depending on how the
+// output marks fall against the input's. Each PSOLA grain comes from the input
+// mark nearest the analysis centre, up to half a period either side of it. Any
+// miss fails the run with a non-zero exit; ctest runs it.
+//
+//   g++ -O2 -std=c++17 -I../Source LatencyCheck.cpp -o LatencyCheck
+//   ./LatencyCheck
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "PitchShifterBank.h"
+
+static std::vector<float> makePulses(int sampleRate, int numSamples, double pitchHz)
+{
+    std::vector<float> x (numSamples);
+    int width = sampleRate / 5500;
+    unsigned int noise = 1;
+    double t = 0, level;
+
+    while (t < numSamples - width) {
+        int i = (int)t;
+        noise = noise * 1664525 + 1013904223;
+        level = 0.2 + 0.8 * ((double)noise / 4294967296.0);
+        for (int k = 0; k < width; k++) {
+            x[i + k] += (float)(0.5 * level * (1 - cos(2 * M_PI * (k + 0.5) / width)));
+        }
+        noise = noise * 1664525 + 1013904223;
+        double f0 = pitchHz * pow(2.0, 0.5 * sin(2 * M_PI * 5.5 * t / sampleRate) / 12);
+        t += sampleRate / f0 * (1 + 0.06 * ((double)noise / 4294967296.0 - 0.5));
+    }
+    return x;
+}
+
+// Energy over the last window samples, less its mean
+static std::vector<double> envelope(const std::vector<float>& x, int window)
+{
+    std::vector<double> e (x.size());
+    double sum = 0, mean = 0;
+
+    for (size_t i = 0; i < x.size(); i++) {
+        sum += (double)x[i] * x[i];
+        if (i >= (size_t)window) {
+            sum -= (double)x[i - window] * x[i - window];
+        }
+        e[i] = sum;
+        mean += sum;
+    }
+    mean /= x.size();
+    for (double& v : e) {
+        v -= mean;
+    }
+    return e;
+}
+
+static int measureDelay(const std::vector<float>& input, const std::vector<float>& output, int settle, int window, int maxDelay)
+{
+    std::vector<double> ein = envelope (input, window);
+    std::vector<double> eout = envelope (output, window);
+    int best = 0;
+    double bestSum = -1e300;
+
+    // The envelopes are smooth over a period, so every fourth sample will do
+    for (int d = 0; d <= maxDelay; d++) {
+        double sum = 0;
+        for (size_t i = settle; i + maxDelay < input.size(); i += 4) {
+            sum += ein[i] * eout[i + d];
+        }
+        if (sum > bestSum) {
+            bestSum = sum;
+            best = d;
+        }
+    }
+    return best;
+}
+
+// Wet delay of one configuration, fed the input in 64-sample blocks
+static int run(int sampleRate, int mode, int shifterMode, const std::vector<float>& input, int period, int& reported)
+{
+    auto shifter = std::make_unique<PitchShifter>();
+    int n = (int)input.size();
+    std::vector<float> output (n);
+
+    shifter->setScale (Scales::NoteC, Scales::Chromatic);
+    shifter->setShifterMode (shifterMode);
+    shifter->init (sampleRate, 1, 1, mode);
+    shifter->setAmountAmount (0);
+    shifter->setVoiceLevel (0, 0.999f);
+    for (int i = 0; i < n; i += 64) {
+        const float* in[] = { input.data() + i };
+        float* out[] = { output.data() + i };
+        shifter->ProcessFloatReplacing (in, out, std::min (64, n - i));
+    }
+
+    reported = shifter->getLatencySamples();
+    return measureDelay (input, output, sampleRate, period, 2 * reported + period);
+}
+
+// As run(), for the first stream of a PitchShifterBank fed the same input on
+// every stream
+static int runBank(int sampleRate, const std::vector<float>& input, int period, int& reported)
+{
+    auto bank = std::make_unique<PitchShifterBank<4>>();
+    int n = (int)input.size();
+    std::vector<std::vector<float>> output (4, std::vector<float> (n));
+
+    bank->init (sampleRate);
+    for (int k = 0; k < 4; k++) {
+        bank->setAmountAmount (k, 0);
+    }
+    for (int i = 0; i < n; i += 64) {
+        const float* in[4];
+        float* out[4];
+        for (int k = 0; k < 4; k++) {
+            in[k] = input.data() + i;
+            out[k] = output[k].data() + i;
+        }
+        bank->ProcessFloatReplacing (in, out, std::min (64, n - i));
+    }
+
+    reported = bank->getLatencySamples();
+    return measureDelay (input, output[0], sampleRate, period, 2 * reported + period);
+}
+
+int main()
+{
+    static const char* modeNames[] = { "standard", "live" };
+    static const char* shifterNames[] = { "ola", "psola" };
+    int failures = 0;
+
+    printf("rate    pitch  mode      shifter  reported  measured    allowed\n");
+    for (int sampleRate : { 44100, 48000, 96000 }) {
+        for (double pitchHz : { 165.0, 220.0, 330.0 }) {
+            int period = (int)(sampleRate / pitchHz);
+            // Vibrato and jitter stretch it by up to half a semitone and 3%
+            int longest = (int)(period * pow(2.0, 0.5 / 12) * 1.03) + 1;
+            std::vector<float> input = makePulses(sampleRate, sampleRate * 3, pitchHz);
+
+            for (int mode : { PitchShifter::LatencyStandard, PitchShifter::LatencyLive }) {
+                for (int shifterMode : { PitchShifter::ShifterOLA, PitchShifter::ShifterPSOLA }) {
+                    int reported;
+                    int measured = run (sampleRate, mode, shifterMode, input, period, reported);
+                    // Live tracking always runs PSOLA
+                    bool psola = (shifterMode == PitchShifter::ShifterPSOLA || mode == PitchShifter::LatencyLive);
+                    int early = psola ? longest / 2 : 2;
+                    int late = psola ? longest / 2 : longest;
+                    bool ok = measured >= reported - early && measured <= reported + late;
+
+                    printf("%-7d %5.0f  %-9s %-8s %8d  %8d  %5d %5d  %s\n", sampleRate, pitchHz, modeNames[mode],
+                           shifterNames[shifterMode], reported, measured, -early, late, ok ? "ok" : "FAILED");
+                    if (!ok) {
+                        failures++;
+                    }
+                }
+            }
+
+            int reported;
+            int measured = runBank (sampleRate, input, period, reported);
+            bool ok = measured >= reported - 2 && measured <= reported + longest;
+            printf("%-7d %5.0f  %-9s %-8s %8d  %8d  %5d %5d  %s\n", sampleRate, pitchHz, "bank", "ola",
+                   reported, measured, -2, longest, ok ? "ok" : "FAILED");
+            if (!ok) {
+                failures++;
+            }
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
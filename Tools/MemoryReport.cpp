@@ -0,0 +1,210 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Per-instance memory and cache behaviour of PitchShifter.
+//
+// The first table is what one shifter owns in a few common layouts: the
+// object itself plus every heap block init() asks for (malloc is interposed,
+// so it counts the same way whatever the buffers live in). Tables shared by
+// every shifter at a rate are built by an earlier init() and not counted. The second runs
+// growing numbers of mono shifters round-robin on 64-sample blocks, the way
+// a session full of instances is served, and reports the cost per sample
+// together with L1D and last-level cache misses per sample. The miss columns
+// need the kernel to expose hardware counters; most VMs and containers don't,
+// and there the table leaves them out and says why.
+//
+// Linux/glibc only.
+//
+//   g++ -O2 -std=c++17 -I../Source MemoryReport.cpp -o MemoryReport
+//   ./MemoryReport
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <memory>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+#include "PitchShifter.h"
+
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_calloc(size_t, size_t);
+extern "C" void* __libc_memalign(size_t, size_t);
+
+static bool counting = false;
+static size_t heapBytes = 0;
+static int heapBlocks = 0;
+
+extern "C" void* malloc(size_t size)
+{
+    if (counting) {
+        heapBytes += size;
+        heapBlocks++;
+    }
+    return __libc_malloc (size);
+}
+
+extern "C" void* calloc(size_t num, size_t size)
+{
+    if (counting) {
+        heapBytes += num * size;
+        heapBlocks++;
+    }
+    return __libc_calloc (num, size);
+}
+
+// Aligned operator new lands in one of these, depending on the libstdc++ build
+extern "C" void* aligned_alloc(size_t alignment, size_t size)
+{
+    if (counting) {
+        heapBytes += size;
+        heapBlocks++;
+    }
+    return __libc_memalign (alignment, size);
+}
+
+extern "C" int posix_memalign(void** ptr, size_t alignment, size_t size)
+{
+    if (counting) {
+        heapBytes += size;
+        heapBlocks++;
+    }
+    *ptr = __libc_memalign (alignment, size);
+    return *ptr != nullptr ? 0 : ENOMEM;
+}
+
+static const int sampleRate = 44100;
+static const int blockSize = 64;
+
+static void reportLayout(const char* name, unsigned long sr, int numChannels, int maxVoices, int latencyMode)
+{
+    auto shifter = std::make_unique<PitchShifter>();
+
+    PitchShifter().init (sr, numChannels, maxVoices, latencyMode);
+    heapBytes = 0;
+    heapBlocks = 0;
+    counting = true;
+    shifter->init (sr, numChannels, maxVoices, latencyMode);
+    counting = false;
+    printf("%-28s %8zu %10zu %7d %10zu\n", name, sizeof(PitchShifter), heapBytes, heapBlocks, sizeof(PitchShifter) + heapBytes);
+}
+
+static int openCounter(unsigned int type, unsigned long long config)
+{
+    perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = type;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static long long readCounter(int fd)
+{
+    long long value = 0;
+
+    if (fd < 0 || read(fd, &value, sizeof(value)) != sizeof(value)) {
+        return -1;
+    }
+    return value;
+}
+
+// l1 and ll are counters from openCounter(), or -1 if they couldn't be opened
+static void reportScaling(int numInstances, double seconds, int l1, int ll)
+{
+    std::vector<std::unique_ptr<PitchShifter>> shifters;
+    std::vector<float> audio (blockSize);
+    int numBlocks = (int)(seconds * sampleRate / blockSize);
+    double phase = 0;
+    char l1text[32], lltext[32];
+
+    for (int i = 0; i < numInstances; i++) {
+        shifters.push_back (std::make_unique<PitchShifter>());
+        shifters.back()->setScale (Scales::NoteC, Scales::Major);
+        shifters.back()->init (sampleRate);
+    }
+
+    for (int fd : { l1, ll }) {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int b = 0; b < numBlocks; b++) {
+        for (int i = 0; i < numInstances; i++) {
+            for (int s = 0; s < blockSize; s++) {
+                phase += 2 * M_PI * (180 + i) / sampleRate;
+                audio[s] = (float)(0.4 * sin(phase) + 0.2 * sin(2 * phase));
+            }
+            float* io[] = { audio.data() };
+            shifters[i]->ProcessFloatReplacing (io, io, blockSize);
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    for (int fd : { l1, ll }) {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    double samples = (double)numBlocks * blockSize * numInstances;
+    long long l1misses = readCounter (l1);
+    long long llmisses = readCounter (ll);
+    if (l1 < 0 && ll < 0) {
+        printf("%9d %10.1f\n", numInstances, elapsed.count() / samples);
+        return;
+    }
+    snprintf(l1text, sizeof(l1text), l1misses < 0 ? "n/a" : "%.3f", l1misses / samples);
+    snprintf(lltext, sizeof(lltext), llmisses < 0 ? "n/a" : "%.4f", llmisses / samples);
+    printf("%9d %10.1f %18s %18s\n", numInstances, elapsed.count() / samples, l1text, lltext);
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = (argc > 1) ? atof(argv[1]) : 5;
+
+    printf("layout                         object  heap bytes  blocks      total\n");
+    reportLayout ("44.1k mono", 44100, 1, 1, PitchShifter::LatencyStandard);
+    reportLayout ("44.1k stereo", 44100, 2, 1, PitchShifter::LatencyStandard);
+    reportLayout ("44.1k stereo, 8 voices", 44100, 2, MAX_VOICES, PitchShifter::LatencyStandard);
+    reportLayout ("96k mono", 96000, 1, 1, PitchShifter::LatencyStandard);
+    reportLayout ("44.1k mono, live", 44100, 1, 1, PitchShifter::LatencyLive);
+
+    int l1 = openCounter (PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    int l1error = errno;
+    int ll = openCounter (PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+
+    if (l1 < 0 && ll < 0) {
+        printf("\nno hardware cache counters (%s), so no miss columns\n", strerror(l1error));
+        printf("instances  ns/sample\n");
+    }
+    else {
+        printf("\ninstances  ns/sample  L1D misses/sample  LLC misses/sample\n");
+    }
+    for (int n : { 1, 16, 64, 256 }) {
+        reportScaling (n, seconds * 4 / n > 0.25 ? seconds * 4 / n : 0.25, l1, ll);
+    }
+
+    for (int fd : { l1, ll }) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+    return 0;
+}
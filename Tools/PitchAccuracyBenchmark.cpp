@@ -0,0 +1,519 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Pitch detection accuracy against cost.
+//
+// Generates a labelled corpus: sine and sawtooth sweeps over 70-700Hz, vibrato,
+// synthetic vowels (a Rosenberg glottal pulse through three formants) at
+// 70-700Hz, the same vowels in noise, and pure noise and silence. Every
+// detector is run over every signal, and each hop's estimate is compared with
+// the label at the centre of the window it measured. Hops whose window spans
+// a voicing change are left out.
+//
+// Reported per detector:
+//   gross error   voiced hops, detected voiced, more than 20% off
+//   cent error    mean absolute error of the other voiced hops
+//   V->UV, UV->V  voiced hops called unvoiced, and the other way round
+//   us/hop        cost of the whole shifter per hop, since the analysis runs
+//                 spread through the hop inside it
+//   % of a core   the same per second of audio, which compares tiers with
+//                 different hop sizes
+// The detectors on the Pareto front of share of a core against gross error
+// are starred.
+// A second table breaks the gross error down by signal.
+//
+// The detectors are PitchShifter's own, at each quality tier and latency mode,
+// and PitchShifterBank's batched one, whose cost is per stream with the bank
+// full. To compare another one, derive from Detector and add it to main().
+//
+// --write <dir> also saves the corpus as 32-bit float WAVs, each with a CSV of
+// its f0 every 10ms (0 where unvoiced), for running other engines on it.
+//
+//   g++ -O2 -std=c++17 -I../Source PitchAccuracyBenchmark.cpp -o PitchAccuracyBenchmark
+//   ./PitchAccuracyBenchmark [--write dir]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "PitchShifterBank.h"
+
+static const int sampleRate = 44100;
+
+struct Signal
+{
+    std::string name;
+    std::vector<float> audio;
+    std::vector<float> f0; // per sample, 0 where unvoiced
+};
+
+// One hop's estimate, and the sample at the centre of the window it measured
+struct Frame
+{
+    int centre;
+    int halfWidth; // half the span of the window it measured
+    float hz;
+    bool voiced;
+};
+
+class Detector
+{
+public:
+    virtual ~Detector() = default;
+    virtual const char* getName() const = 0;
+    // Estimates over the whole signal; adds the processing time to seconds
+    virtual std::vector<Frame> run(const Signal& signal, double& seconds) = 0;
+};
+
+// PitchShifter's autocorrelation tracker, read back through a PitchHistory
+class ShifterDetector : public Detector
+{
+public:
+    ShifterDetector(const char* detectorName, int qualityTier, int latency)
+        : name (detectorName), quality (qualityTier), latencyMode (latency)
+    {
+    }
+
+    const char* getName() const override
+    {
+        return name;
+    }
+
+    std::vector<Frame> run(const Signal& signal, double& seconds) override
+    {
+        auto shifter = std::make_unique<PitchShifter>();
+        PitchHistory history;
+        std::vector<Frame> frames;
+        std::vector<float> output (signal.audio.size());
+        PitchRecord r;
+
+        shifter->setQuality (quality);
+        shifter->setPitchHistory (&history);
+        shifter->init (sampleRate, 1, 1, latencyMode);
+
+        // Blocks of one hop end on hop boundaries, so each publishes one record
+        int hop = shifter->getHopSize();
+        int lag = shifter->getAnalysisLag();
+        int n = (int)signal.audio.size() / hop * hop;
+
+        for (int i = 0; i < n; i += hop) {
+            const float* in[] = { signal.audio.data() + i };
+            float* out[] = { output.data() + i };
+            auto start = std::chrono::steady_clock::now();
+            shifter->ProcessFloatReplacing (in, out, hop);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            seconds += elapsed.count();
+
+            // The window is the Hann over the middle half of the analysis buffer
+            while (history.pop (r)) {
+                frames.push_back ({ i + hop - lag, (lag - hop) / 2, 440.0f * powf(2.0f, (r.pitch - 69) / 12), r.confidence >= 0.8f });
+            }
+        }
+        return frames;
+    }
+
+private:
+    const char* name;
+    int quality;
+    int latencyMode;
+};
+
+// PitchShifterBank's batched tracker, with the signal on every stream and
+// stream 0 read back. It has no sub-sample peak interpolation, so its cent
+// error shows what that costs.
+template <int K>
+class BankDetector : public Detector
+{
+public:
+    explicit BankDetector(const char* detectorName)
+        : name (detectorName)
+    {
+    }
+
+    const char* getName() const override
+    {
+        return name;
+    }
+
+    std::vector<Frame> run(const Signal& signal, double& seconds) override
+    {
+        auto bank = std::make_unique<PitchShifterBank<K>>();
+        std::vector<Frame> frames;
+        std::vector<std::vector<float>> output (K, std::vector<float> (signal.audio.size()));
+        const float* in[K];
+        float* out[K];
+
+        bank->init (sampleRate);
+
+        // Blocks of one hop end on hop boundaries, so each ends with an analysis
+        int hop = bank->getHopSize();
+        int lag = bank->getAnalysisLag();
+        int n = (int)signal.audio.size() / hop * hop;
+
+        for (int i = 0; i < n; i += hop) {
+            for (int k = 0; k < K; k++) {
+                in[k] = signal.audio.data() + i;
+                out[k] = output[k].data() + i;
+            }
+            auto start = std::chrono::steady_clock::now();
+            bank->ProcessFloatReplacing (in, out, hop);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            seconds += elapsed.count() / K;
+
+            // As above, the window is the Hann over the middle half of the buffer
+            frames.push_back ({ i + hop - lag, lag / 2, 440.0f * powf(2.0f, bank->getPitch (0) / 12), bank->getConfidence (0) >= 0.8f });
+        }
+        return frames;
+    }
+
+private:
+    const char* name;
+};
+
+// ---- Corpus ----
+
+static void append(Signal& s, float sample, float hz)
+{
+    s.audio.push_back (sample);
+    s.f0.push_back (hz);
+}
+
+static Signal sweep(const char* name, double fromHz, double toHz, double seconds, bool saw)
+{
+    Signal s { name, {}, {} };
+    int n = (int)(seconds * sampleRate);
+    double phase = 0;
+
+    for (int i = 0; i < n; i++) {
+        double hz = fromHz * pow(toHz / fromHz, (double)i / n);
+        double v = 0;
+        phase += 2 * M_PI * hz / sampleRate;
+        if (saw) {
+            for (int k = 1; k * hz < 8000; k++) {
+                v += sin(k * phase) / k;
+            }
+            v *= 0.3;
+        }
+        else {
+            v = 0.5 * sin(phase);
+        }
+        append (s, (float)v, (float)hz);
+    }
+    return s;
+}
+
+static Signal vibrato(const char* name, double hz, double seconds, bool saw)
+{
+    Signal s { name, {}, {} };
+    int n = (int)(seconds * sampleRate);
+    double phase = 0;
+
+    for (int i = 0; i < n; i++) {
+        double f = hz * pow(2.0, 0.5 / 12 * sin(2 * M_PI * 6 * i / sampleRate));
+        double v = 0;
+        phase += 2 * M_PI * f / sampleRate;
+        if (saw) {
+            for (int k = 1; k * f < 8000; k++) {
+                v += sin(k * phase) / k;
+            }
+            v *= 0.3;
+        }
+        else {
+            v = 0.5 * sin(phase);
+        }
+        append (s, (float)v, (float)f);
+    }
+    return s;
+}
+
+// Derivative of a Rosenberg glottal pulse through /a/ formants, drifting by
+// up to 20 cents, with white noise at the given SNR (none if snrDb is 0)
+static Signal vowel(double hz, double seconds, double snrDb)
+{
+    static const double formants[3][2] = { { 700, 80 }, { 1220, 90 }, { 2600, 120 } };
+    Signal s { "vowel " + std::to_string((int)hz) + (snrDb > 0 ? " snr " + std::to_string((int)snrDb) : ""), {}, {} };
+    int n = (int)(seconds * sampleRate);
+    double phase = 0, prev = 0, peak = 0;
+    double state[3][2] = {};
+    unsigned int noise = 12345;
+    std::vector<double> y (n);
+
+    for (int i = 0; i < n; i++) {
+        double f = hz * pow(2.0, 0.2 / 12 * sin(2 * M_PI * 0.7 * i / sampleRate));
+        double g;
+        phase += f / sampleRate;
+        phase -= floor(phase);
+        if (phase < 0.4) {
+            g = 0.5 * (1 - cos(M_PI * phase / 0.4));
+        }
+        else if (phase < 0.56) {
+            g = cos(M_PI / 2 * (phase - 0.4) / 0.16);
+        }
+        else {
+            g = 0;
+        }
+
+        double v = g - prev;
+        prev = g;
+        for (int k = 0; k < 3; k++) {
+            double r = exp(-M_PI * formants[k][1] / sampleRate);
+            double c = 2 * r * cos(2 * M_PI * formants[k][0] / sampleRate);
+            double out = (1 - r) * v + c * state[k][0] - r * r * state[k][1];
+            state[k][1] = state[k][0];
+            state[k][0] = out;
+            v = out;
+        }
+        y[i] = v;
+        peak = std::max (peak, fabs(v));
+        s.f0.push_back ((float)f);
+    }
+
+    double rms = 0;
+    for (int i = 0; i < n; i++) {
+        y[i] *= 0.5 / peak;
+        rms += y[i] * y[i];
+    }
+    double noiseLevel = (snrDb > 0) ? sqrt(rms / n) * pow(10.0, -snrDb / 20) * sqrt(12.0) : 0;
+    for (int i = 0; i < n; i++) {
+        noise = noise * 1664525 + 1013904223;
+        s.audio.push_back ((float)(y[i] + noiseLevel * ((double)noise / 4294967296.0 - 0.5)));
+    }
+    return s;
+}
+
+static Signal unvoiced(const char* name, double seconds, double level)
+{
+    Signal s { name, {}, {} };
+    unsigned int noise = 777;
+
+    for (int i = 0; i < (int)(seconds * sampleRate); i++) {
+        noise = noise * 1664525 + 1013904223;
+        append (s, (float)(level * ((double)noise / 4294967296.0 - 0.5)), 0);
+    }
+    return s;
+}
+
+static std::vector<Signal> makeCorpus()
+{
+    std::vector<Signal> corpus;
+
+    corpus.push_back (sweep ("sine sweep up", 70, 700, 4, false));
+    corpus.push_back (sweep ("saw sweep down", 700, 70, 4, true));
+    corpus.push_back (vibrato ("sine vibrato 220", 220, 2, false));
+    corpus.push_back (vibrato ("saw vibrato 110", 110, 2, true));
+    for (double hz : { 70, 100, 150, 220, 330, 500, 700 }) {
+        corpus.push_back (vowel (hz, 1.5, 0));
+    }
+    for (double hz : { 150, 330 }) {
+        corpus.push_back (vowel (hz, 1.5, 20));
+        corpus.push_back (vowel (hz, 1.5, 5));
+    }
+    corpus.push_back (unvoiced ("noise", 2, 0.2));
+    corpus.push_back (unvoiced ("silence", 2, 0));
+    return corpus;
+}
+
+// ---- Writing the corpus out ----
+
+static void writeLittleEndian(FILE* f, unsigned int value, int bytes)
+{
+    for (int i = 0; i < bytes; i++) {
+        fputc((value >> (8 * i)) & 0xff, f);
+    }
+}
+
+static bool writeSignal(const std::string& dir, const Signal& s)
+{
+    std::string base = dir + "/" + s.name;
+    std::replace (base.begin() + dir.size() + 1, base.end(), ' ', '_');
+    FILE* wav = fopen((base + ".wav").c_str(), "wb");
+    FILE* csv = fopen((base + ".csv").c_str(), "w");
+    unsigned int bytes = (unsigned int)(s.audio.size() * sizeof(float));
+
+    if (wav == nullptr || csv == nullptr) {
+        if (wav != nullptr) fclose(wav);
+        if (csv != nullptr) fclose(csv);
+        return false;
+    }
+
+    fwrite("RIFF", 1, 4, wav);
+    writeLittleEndian (wav, 36 + bytes, 4);
+    fwrite("WAVEfmt ", 1, 8, wav);
+    writeLittleEndian (wav, 16, 4);
+    writeLittleEndian (wav, 3, 2); // IEEE float
+    writeLittleEndian (wav, 1, 2);
+    writeLittleEndian (wav, sampleRate, 4);
+    writeLittleEndian (wav, sampleRate * sizeof(float), 4);
+    writeLittleEndian (wav, sizeof(float), 2);
+    writeLittleEndian (wav, 32, 2);
+    fwrite("data", 1, 4, wav);
+    writeLittleEndian (wav, bytes, 4);
+    fwrite(s.audio.data(), sizeof(float), s.audio.size(), wav);
+    fclose(wav);
+
+    fprintf(csv, "seconds,f0\n");
+    for (size_t i = 0; i < s.f0.size(); i += sampleRate / 100) {
+        fprintf(csv, "%.3f,%.2f\n", (double)i / sampleRate, s.f0[i]);
+    }
+    fclose(csv);
+    return true;
+}
+
+// ---- Scoring ----
+
+struct Score
+{
+    int voiced = 0; // hops labelled voiced
+    int unvoiced = 0; // hops labelled unvoiced
+    int bothVoiced = 0; // labelled and detected voiced
+    int gross = 0;
+    int voicedAsUnvoiced = 0;
+    int unvoicedAsVoiced = 0;
+    double cents = 0; // summed over the fine hops
+    int hops = 0;
+
+    void add(const Score& other)
+    {
+        voiced += other.voiced;
+        unvoiced += other.unvoiced;
+        bothVoiced += other.bothVoiced;
+        gross += other.gross;
+        voicedAsUnvoiced += other.voicedAsUnvoiced;
+        unvoicedAsVoiced += other.unvoicedAsVoiced;
+        cents += other.cents;
+        hops += other.hops;
+    }
+
+    double grossRate() const { return bothVoiced > 0 ? 100.0 * gross / bothVoiced : 0; }
+    double centError() const { return bothVoiced > gross ? cents / (bothVoiced - gross) : 0; }
+    double voicedAsUnvoicedRate() const { return voiced > 0 ? 100.0 * voicedAsUnvoiced / voiced : 0; }
+    double unvoicedAsVoicedRate() const { return unvoiced > 0 ? 100.0 * unvoicedAsVoiced / unvoiced : 0; }
+};
+
+static Score score(const Signal& s, const std::vector<Frame>& frames)
+{
+    Score result;
+    int n = (int)s.f0.size();
+
+    for (const Frame& f : frames) {
+        int quarter = f.halfWidth / 2;
+        result.hops++;
+        if (f.centre - f.halfWidth < 0 || f.centre + f.halfWidth >= n) {
+            continue;
+        }
+
+        // Skip windows that straddle a voicing change
+        bool early = s.f0[f.centre - quarter] > 0;
+        bool mid = s.f0[f.centre] > 0;
+        bool late = s.f0[f.centre + quarter] > 0;
+        if (early != mid || late != mid) {
+            continue;
+        }
+
+        if (! mid) {
+            result.unvoiced++;
+            result.unvoicedAsVoiced += f.voiced ? 1 : 0;
+            continue;
+        }
+        result.voiced++;
+        if (! f.voiced) {
+            result.voicedAsUnvoiced++;
+            continue;
+        }
+        result.bothVoiced++;
+        double truth = s.f0[f.centre];
+        if (fabs(f.hz / truth - 1) > 0.2) {
+            result.gross++;
+        }
+        else {
+            result.cents += fabs(1200 * log2(f.hz / truth));
+        }
+    }
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<Signal> corpus = makeCorpus();
+
+    if (argc > 2 && strcmp(argv[1], "--write") == 0) {
+        for (const Signal& s : corpus) {
+            if (! writeSignal (argv[2], s)) {
+                fprintf(stderr, "can't write %s to %s\n", s.name.c_str(), argv[2]);
+                return 1;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Detector>> detectors;
+    detectors.push_back (std::make_unique<ShifterDetector> ("eco", PitchShifter::QualityEco, PitchShifter::LatencyStandard));
+    detectors.push_back (std::make_unique<ShifterDetector> ("standard", PitchShifter::QualityStandard, PitchShifter::LatencyStandard));
+    detectors.push_back (std::make_unique<ShifterDetector> ("hq", PitchShifter::QualityHQ, PitchShifter::LatencyStandard));
+    detectors.push_back (std::make_unique<ShifterDetector> ("live eco", PitchShifter::QualityEco, PitchShifter::LatencyLive));
+    detectors.push_back (std::make_unique<ShifterDetector> ("live standard", PitchShifter::QualityStandard, PitchShifter::LatencyLive));
+    detectors.push_back (std::make_unique<ShifterDetector> ("live hq", PitchShifter::QualityHQ, PitchShifter::LatencyLive));
+    detectors.push_back (std::make_unique<BankDetector<8>> ("bank x8"));
+
+    std::vector<Score> totals (detectors.size());
+    std::vector<std::vector<Score>> bySignal (detectors.size(), std::vector<Score> (corpus.size()));
+    std::vector<double> usPerHop (detectors.size());
+    std::vector<double> coreShare (detectors.size());
+    double audioSeconds = 0;
+
+    for (const Signal& s : corpus) {
+        audioSeconds += (double)s.audio.size() / sampleRate;
+    }
+    for (size_t d = 0; d < detectors.size(); d++) {
+        double seconds = 0;
+        for (size_t c = 0; c < corpus.size(); c++) {
+            bySignal[d][c] = score (corpus[c], detectors[d]->run (corpus[c], seconds));
+            totals[d].add (bySignal[d][c]);
+        }
+        usPerHop[d] = 1e6 * seconds / totals[d].hops;
+        coreShare[d] = 100 * seconds / audioSeconds;
+    }
+
+    // Cheapest first; a detector is on the front if nothing cheaper is as accurate
+    std::vector<size_t> order (detectors.size());
+    for (size_t d = 0; d < order.size(); d++) {
+        order[d] = d;
+    }
+    std::sort (order.begin(), order.end(), [&](size_t a, size_t b) { return coreShare[a] < coreShare[b]; });
+
+    printf("   detector       %% of a core  us/hop  gross err %%  cent err  V->UV %%  UV->V %%\n");
+    double bestGross = 1e9;
+    for (size_t d : order) {
+        const Score& t = totals[d];
+        bool front = t.grossRate() < bestGross;
+        bestGross = std::min (bestGross, t.grossRate());
+        printf(" %c %-14s %11.3f %7.2f %12.2f %9.2f %8.2f %8.2f\n", front ? '*' : ' ', detectors[d]->getName(), coreShare[d],
+               usPerHop[d], t.grossRate(), t.centError(), t.voicedAsUnvoicedRate(), t.unvoicedAsVoicedRate());
+    }
+
+    printf("\ngross error %% by signal (voicing errors %% in brackets)\n%-20s", "");
+    for (size_t d : order) {
+        printf(" %15s", detectors[d]->getName());
+    }
+    printf("\n");
+    for (size_t c = 0; c < corpus.size(); c++) {
+        printf("%-20s", corpus[c].name.c_str());
+        for (size_t d : order) {
+            const Score& s = bySignal[d][c];
+            int scored = s.voiced + s.unvoiced;
+            double voicing = scored > 0 ? 100.0 * (s.voicedAsUnvoiced + s.unvoicedAsVoiced) / scored : 0;
+            printf("    %5.1f (%5.1f)", s.grossRate(), voicing);
+        }
+        printf("\n");
+    }
+    return 0;
+}
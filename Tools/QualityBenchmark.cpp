@@ -0,0 +1,85 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Quality tier benchmark.
+//
+// Runs a mono PitchShifter at 44.1kHz over a synthetic vocal line in each
+// quality tier, for both shifters with and without formant preservation, and
+// prints the cost per sample, the share of one core a realtime stream takes and
+// how its slow 64-sample blocks (the 99th percentile, which leaves out the odd
+// preemption) compare with the average one.
+//
+//   g++ -O2 -std=c++17 -I../Source QualityBenchmark.cpp -o QualityBenchmark
+//   ./QualityBenchmark [seconds]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "PitchShifter.h"
+#include "TestSignals.h"
+
+static const int sampleRate = 44100;
+static const int blockSize = 64;
+
+struct BlockCost
+{
+    double nsPerSample;
+    double slowToMean; // 99th percentile block over the average block
+};
+
+static BlockCost measure(const std::vector<float>& input, int tier, int shifterMode, bool formant)
+{
+    auto shifter = std::make_unique<PitchShifter>();
+    std::vector<float> block (blockSize);
+    int n = (int)input.size() / blockSize * blockSize;
+    std::vector<double> times;
+    double total = 0;
+
+    shifter->setScale (Scales::NoteC, Scales::Major);
+    shifter->setQuality (tier);
+    shifter->setShifterMode (shifterMode);
+    shifter->setFormantPreservation (formant);
+    shifter->init (sampleRate);
+
+    for (int i = 0; i < n; i += blockSize) {
+        std::copy (input.begin() + i, input.begin() + i + blockSize, block.begin());
+        float* io[] = { block.data() };
+        auto start = std::chrono::steady_clock::now();
+        shifter->ProcessFloatReplacing (io, io, blockSize);
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        total += elapsed.count();
+        times.push_back (elapsed.count());
+    }
+    std::nth_element (times.begin(), times.begin() + times.size() * 99 / 100, times.end());
+    return { total / n, times[times.size() * 99 / 100] / (total / times.size()) };
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = (argc > 1) ? atof(argv[1]) : 20;
+    // Around G3, close enough to a voice for the detector to stay voiced
+    std::vector<float> input = makeVocalLine(sampleRate, (int)(seconds * sampleRate), 196.0);
+    const char* tierNames[] = { "Eco", "Standard", "HQ" };
+    const char* shifterNames[] = { "OLA", "PSOLA" };
+
+    printf("tier      shifter  formant  ns/sample  %% of a core  p99/mean block\n");
+    for (int tier = PitchShifter::QualityEco; tier <= PitchShifter::QualityHQ; tier++) {
+        for (int mode = PitchShifter::ShifterOLA; mode <= PitchShifter::ShifterPSOLA; mode++) {
+            for (int formant = 0; formant <= 1; formant++) {
+                BlockCost cost = measure (input, tier, mode, formant != 0);
+                printf("%-9s %-8s %-8s %9.1f %12.2f %14.1f\n", tierNames[tier], shifterNames[mode], formant ? "on" : "off",
+                       cost.nsPerSample, cost.nsPerSample * sampleRate / 1e7, cost.slowToMean);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,188 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Realtime-safety check for the audio path.
+//
+// Interposes malloc, calloc, realloc, free and pthread_mutex_lock, then drives
+// the CorrectionEngine that processBlock() hands every block to, with random
+// block sizes, timestamped automation within blocks, and random parameter and
+// quality tier changes, MIDI-style voice notes, bypass and linked/independent
+// mode switches between blocks. The interposers only count while a block is
+// being processed, so prepare() and the checker's own bookkeeping are free to
+// allocate. Any hit fails the run with a non-zero exit.
+//
+// Linux/glibc only (it forwards to __libc_malloc and friends).
+//
+//   g++ -O2 -std=c++17 -I../Source RealtimeSafetyCheck.cpp -o RealtimeSafetyCheck -pthread -ldl
+//   ./RealtimeSafetyCheck [blocks] [seed]
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <pthread.h>
+#include <random>
+#include <vector>
+#include "CorrectionEngine.h"
+
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_calloc(size_t, size_t);
+extern "C" void* __libc_realloc(void*, size_t);
+extern "C" void __libc_free(void*);
+
+static std::atomic<bool> armed { false };
+static std::atomic<int> allocHits { 0 };
+static std::atomic<int> freeHits { 0 };
+static std::atomic<int> lockHits { 0 };
+
+typedef int (*MutexLockFn)(pthread_mutex_t*);
+static MutexLockFn realMutexLock = nullptr;
+
+extern "C" void* malloc(size_t size)
+{
+    if (armed.load (std::memory_order_relaxed)) {
+        allocHits++;
+    }
+    return __libc_malloc (size);
+}
+
+extern "C" void* calloc(size_t num, size_t size)
+{
+    if (armed.load (std::memory_order_relaxed)) {
+        allocHits++;
+    }
+    return __libc_calloc (num, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size)
+{
+    if (armed.load (std::memory_order_relaxed)) {
+        allocHits++;
+    }
+    return __libc_realloc (ptr, size);
+}
+
+extern "C" void free(void* ptr)
+{
+    if (ptr != nullptr && armed.load (std::memory_order_relaxed)) {
+        freeHits++;
+    }
+    __libc_free (ptr);
+}
+
+extern "C" int pthread_mutex_lock(pthread_mutex_t* mutex)
+{
+    if (armed.load (std::memory_order_relaxed)) {
+        lockHits++;
+    }
+    return realMutexLock (mutex);
+}
+
+static const int sampleRate = 44100;
+static const int maxBlockSize = 2048;
+
+int main(int argc, char** argv)
+{
+    int numBlocks = (argc > 1) ? atoi(argv[1]) : 4000;
+    unsigned seed = (argc > 2) ? (unsigned)atoi(argv[2]) : 1;
+    std::mt19937 rng (seed);
+    auto uniform = [&](int lo, int hi) { return std::uniform_int_distribution<int> (lo, hi) (rng); };
+    int failures = 0;
+
+    realMutexLock = (MutexLockFn)dlsym (RTLD_NEXT, "pthread_mutex_lock");
+
+    // A linked stereo bus, a linked bus at the limit and a wide independent one,
+    // each in both latency modes
+    for (int config = 0; config < 6; config++) {
+        int numChannels = (config / 2 == 0) ? 2 : (config / 2 == 1) ? MAX_LINKED_CHANNELS : 24;
+        int latencyMode = config % 2;
+        CorrectionEngine engine;
+        engine.prepare (sampleRate, numChannels, MAX_VOICES, latencyMode);
+
+        std::vector<std::vector<float>> audio (numChannels, std::vector<float> (maxBlockSize));
+        std::vector<float*> channels (numChannels);
+        std::vector<PitchShifter::ParameterEvent> events;
+        events.reserve (64);
+        for (int c = 0; c < numChannels; c++) {
+            channels[c] = audio[c].data();
+        }
+        double phase = 0;
+        allocHits = freeHits = lockHits = 0;
+
+        for (int b = 0; b < numBlocks; b++) {
+            int numSamples = (uniform (0, 7) == 0) ? uniform (1, 63) : uniform (64, maxBlockSize);
+            for (int s = 0; s < numSamples; s++) {
+                phase += 2 * M_PI * 220 / sampleRate;
+                for (int c = 0; c < numChannels; c++) {
+                    audio[c][s] = (float)(0.3 * sin(phase * (1 + 0.01 * c)));
+                }
+            }
+
+            // Automation ramps within the block, as processBlock() schedules them
+            events.clear();
+            if (uniform (0, 3) == 0) {
+                int numEvents = uniform (1, 64);
+                for (int i = 0; i < numEvents; i++) {
+                    events.push_back ({ i * numSamples / numEvents, uniform (0, PitchShifter::NumAutomationParameters - 1), uniform (0, 100) / 100.0f });
+                }
+            }
+
+            armed = true;
+
+            // Parameter and note changes arrive between blocks on the audio thread,
+            // as processBlock() applies them
+            if (uniform (0, 3) == 0) {
+                float mix = uniform (0, 100) / 100.0f;
+                float shift = (float)uniform (-12, 12);
+                float tune = uniform (-100, 100) / 100.0f;
+                float glide = (float)uniform (0, 1000);
+                int root = uniform (0, 11);
+                int scale = uniform (0, 12);
+                bool formant = uniform (0, 1) != 0;
+                int shifter = uniform (0, 1);
+                int harmony = uniform (0, 2);
+                int voices = uniform (1, MAX_VOICES);
+                int voice = uniform (1, MAX_VOICES - 1);
+                int note = uniform (-1, 80);
+                int quality = uniform (PitchShifter::QualityEco, PitchShifter::QualityHQ);
+                engine.forEachShifter ([=](PitchShifter& s) {
+                    s.setMixAmount (mix);
+                    s.setShiftAmount (shift);
+                    s.setTuneAmount (tune);
+                    s.setGlideAmount (glide);
+                    s.setScale (root, scale);
+                    s.setFormantPreservation (formant);
+                    s.setShifterMode (shifter);
+                    s.setHarmonyMode (harmony);
+                    s.setNumVoices (voices);
+                    s.setVoiceNote (voice, note);
+                    s.setQuality (quality);
+                });
+            }
+            if (uniform (0, 50) == 0) {
+                engine.setChannelMode (uniform (0, 1));
+            }
+            if (uniform (0, 30) == 0) {
+                bool bypassed = uniform (0, 1) != 0;
+                engine.forEachShifter ([=](PitchShifter& s) { s.setBypassed (bypassed); });
+            }
+
+            engine.process (channels.data(), numSamples, events.data(), (int)events.size());
+            armed = false;
+        }
+
+        bool ok = allocHits == 0 && freeHits == 0 && lockHits == 0;
+        printf("%2d channels, %-8s: %d blocks, %d allocations, %d frees, %d mutex locks  %s\n",
+               numChannels, latencyMode == PitchShifter::LatencyLive ? "live" : "standard", numBlocks,
+               allocHits.load(), freeHits.load(), lockHits.load(), ok ? "ok" : "FAILED");
+        failures += ok ? 0 : 1;
+    }
+
+    return failures == 0 ? 0 : 1;
+}
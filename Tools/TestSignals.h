@@ -0,0 +1,126 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+#ifndef __TESTSIGNALS__
+#define __TESTSIGNALS__
+#include <algorithm>
+#include <math.h>
+#include <vector>
+
+// Synthetic inputs and parameter sets shared by the tools in this directory, so
+// their numbers stay comparable with each other.
+
+// One parameter set a benchmark runs the shifter with
+struct Preset
+{
+    const char* name;
+    int quality;
+    int shifterMode;
+    bool formant;
+    int numVoices; // lead plus scale harmonies a third and a fifth up
+};
+
+// Half-second notes of a slightly off-pitch phrase around A3, each with 5.5 Hz
+// vibrato and a soft attack, separated by short noise breaths the tracker
+// should treat as unvoiced
+inline std::vector<float> makePhrase(int sampleRate, int numSamples)
+{
+    static const double notes[] = { 57.3, 59.2, 60.8, 62.1, 60.7, 59.1, 55.4, 57.2 };
+    std::vector<float> x (numSamples);
+    int noteSamples = sampleRate / 2;
+    int breathSamples = sampleRate / 20;
+    double phase = 0;
+    unsigned int noise = 1;
+
+    for (int i = 0; i < numSamples; i++) {
+        int pos = i % noteSamples;
+        double note = notes[(i / noteSamples) % 8];
+        noise = noise * 1664525 + 1013904223;
+
+        if (pos >= noteSamples - breathSamples) {
+            x[i] = (float)(0.02 * ((double)noise / 4294967296.0 - 0.5));
+            continue;
+        }
+
+        double f0 = 440.0 * pow(2.0, (note - 69 + 0.25 * sin(2 * M_PI * 5.5 * i / sampleRate)) / 12);
+        double attack = std::min (1.0, pos / (0.03 * sampleRate));
+        phase += 2 * M_PI * f0 / sampleRate;
+        double v = 0;
+        for (int k = 1; k * f0 < 5000; k++) {
+            v += sin(k * phase) / k;
+        }
+        x[i] = (float)(0.3 * attack * v);
+    }
+    return x;
+}
+
+// Band-limited sawtooth at f0 with 5 Hz vibrato of 0.3 semitones, a steady
+// stand-in for a sustained sung note
+inline std::vector<float> makeVocalLine(int sampleRate, int numSamples, double f0)
+{
+    std::vector<float> x (numSamples);
+    double phase = 0;
+
+    for (int i = 0; i < numSamples; i++) {
+        double f = f0 * pow(2.0, 0.3 / 12 * sin(2 * M_PI * 5 * i / sampleRate));
+        phase += 2 * M_PI * f / sampleRate;
+        double v = 0;
+        for (int k = 1; k * f < 5000; k++) {
+            v += sin(k * phase) / k;
+        }
+        x[i] = (float)(0.3 * v);
+    }
+    return x;
+}
+
+// Formants of makeVowel(), in Hz
+static const double vowelFormants[3] = { 700, 1220, 2600 };
+
+// Sustained /a/ at f0 with 5 Hz vibrato of 0.2 semitones: a Rosenberg glottal
+// pulse through a resonator at each of vowelFormants
+inline std::vector<float> makeVowel(int sampleRate, int numSamples, double f0)
+{
+    static const double bandwidths[3] = { 80, 90, 120 };
+    std::vector<float> x (numSamples);
+    double phase = 0, prev = 0, peak = 0;
+    double state[3][2] = {};
+    std::vector<double> y (numSamples);
+
+    for (int i = 0; i < numSamples; i++) {
+        double f = f0 * pow(2.0, 0.2 / 12 * sin(2 * M_PI * 5 * i / sampleRate));
+        double g = 0;
+        phase += f / sampleRate;
+        phase -= floor(phase);
+        if (phase < 0.4) {
+            g = 0.5 * (1 - cos(M_PI * phase / 0.4));
+        }
+        else if (phase < 0.56) {
+            g = cos(M_PI / 2 * (phase - 0.4) / 0.16);
+        }
+
+        double v = g - prev;
+        prev = g;
+        for (int k = 0; k < 3; k++) {
+            double r = exp(-M_PI * bandwidths[k] / sampleRate);
+            double c = 2 * r * cos(2 * M_PI * vowelFormants[k] / sampleRate);
+            double out = (1 - r) * v + c * state[k][0] - r * r * state[k][1];
+            state[k][1] = state[k][0];
+            state[k][0] = out;
+            v = out;
+        }
+        y[i] = v;
+        peak = std::max (peak, fabs(v));
+    }
+    for (int i = 0; i < numSamples; i++) {
+        x[i] = (float)(0.5 * y[i] / peak);
+    }
+    return x;
+}
+
+#endif
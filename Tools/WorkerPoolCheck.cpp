@@ -0,0 +1,217 @@
+/*
+     _______         __  __  __             _____    __       __
+    |       |.--.--.|__||  ||__|.-----.    |     |_ |  |_ .--|  |    Copyright 2023
+    |   -  _||  |  ||  ||  ||  ||  _  |    |       ||   _||  _  |    Quilio Limited
+    |_______||_____||__||__||__||_____|    |_______||____||_____|    www.quilio.dev
+
+    Quilio Software uses a commercial licence     -     see LICENCE.md for details.
+*/
+
+// Worker pool deadline check.
+//
+// Runs jobs on a RealtimeWorkerPool until a worker has picked up a task, then
+// stalls that worker inside it for 50ms, as a preempted thread would be. Every
+// run() has to return within its budget (plus a little for the caller's own
+// share), every task has to run at most once and exactly once unless run()
+// reported it late, and the stalled task has to be skipped until its worker is
+// done with it.
+//
+// Then checks that CorrectionEngine's staging changes nothing: independent
+// channels processed through it, in blocks long enough to be sliced and with
+// more events than a slice holds, match shifters run directly on the same
+// input. Any miss fails the run with a non-zero exit; ctest runs it.
+//
+//   g++ -O2 -std=c++17 -I../Source WorkerPoolCheck.cpp -o WorkerPoolCheck -lpthread
+//   ./WorkerPoolCheck
+
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "CorrectionEngine.h"
+#include "TestSignals.h"
+
+static const int numTasks = 8;
+static const int budgetMicroseconds = 2000;
+static const int stallMicroseconds = 50000;
+
+struct StallContext
+{
+    std::thread::id caller;
+    std::atomic<bool> armed { true };
+    std::atomic<int> stalledTask { -1 };
+    std::atomic<int> runs[numTasks];
+};
+
+static void stallTask(void* context, int task)
+{
+    StallContext* s = (StallContext*)context;
+    volatile double sink = 0;
+
+    s->runs[task].fetch_add (1);
+    if (std::this_thread::get_id() != s->caller && s->armed.exchange (false)) {
+        s->stalledTask.store (task);
+        std::this_thread::sleep_for (std::chrono::microseconds (stallMicroseconds));
+        return;
+    }
+    // Long enough that the workers get a share
+    for (int i = 0; i < 20000; i++) {
+        sink = sink + sqrt((double)i);
+    }
+}
+
+static int checkDeadline()
+{
+    RealtimeWorkerPool pool;
+    StallContext s;
+    int failures = 0;
+    int stalledAt = -1, skipped = 0;
+
+    // On a single core, workers spinning between jobs would keep the caller off
+    // it themselves, so there they go straight back to sleep
+    pool.start (3, std::thread::hardware_concurrency() < 2 ? 0 : 5000);
+    s.caller = std::this_thread::get_id();
+
+    for (int job = 0; job < 2000; job++) {
+        for (auto& r : s.runs) {
+            r.store (0);
+        }
+
+        auto started = std::chrono::steady_clock::now();
+        int numLate = pool.run (numTasks, stallTask, &s, budgetMicroseconds);
+        auto micros = std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now() - started).count();
+
+        int counted = 0;
+        for (int t = 0; t < numTasks; t++) {
+            int runs = s.runs[t].load();
+            counted += pool.isLate (t) ? 1 : 0;
+            if (runs > 1 || (runs == 0 && ! pool.isLate (t))) {
+                printf("job %d: task %d ran %d times%s\n", job, t, runs, pool.isLate (t) ? " (late)" : "");
+                failures++;
+            }
+        }
+        if (counted != numLate) {
+            printf("job %d: run() reported %d late, isLate() %d\n", job, numLate, counted);
+            failures++;
+        }
+        // Generous, since the caller also runs its own share of the tasks
+        if (micros > budgetMicroseconds + 5000) {
+            printf("job %d: run() took %lldus against a %dus budget\n", job, (long long)micros, budgetMicroseconds);
+            failures++;
+        }
+
+        int stalled = s.stalledTask.load();
+        if (stalled >= 0 && stalledAt < 0) {
+            stalledAt = job;
+            if (! pool.isLate (stalled)) {
+                printf("job %d: the stalled task %d was not reported late\n", job, stalled);
+                failures++;
+            }
+            printf("deadline: worker stalled in task %d of job %d, run() returned after %lldus\n", stalled, job, (long long)micros);
+        }
+        else if (stalledAt >= 0 && pool.isBusy (stalled)) {
+            skipped++;
+            if (! pool.isLate (stalled) || s.runs[stalled].load() != 0) {
+                printf("job %d: busy task %d was not skipped\n", job, stalled);
+                failures++;
+            }
+        }
+        else if (stalledAt >= 0) {
+            break;
+        }
+    }
+
+    if (stalledAt < 0) {
+        printf("deadline: no worker picked up a task\n");
+        return failures;
+    }
+
+    pool.waitForAbandonedTasks();
+    for (auto& r : s.runs) {
+        r.store (0);
+    }
+    if (pool.run (numTasks, stallTask, &s, budgetMicroseconds) != 0) {
+        printf("deadline: tasks still late once the stalled worker was done\n");
+        failures++;
+    }
+    printf("deadline: %d runs skipped the busy task, %s\n", skipped, failures == 0 ? "ok" : "FAIL");
+    return failures;
+}
+
+static int checkStaging()
+{
+    const int sampleRate = 48000;
+    const int numChannels = 4;
+    const int blockSize = CorrectionEngine::maxStagedBlock * 2 + 100;
+    const int numBlocks = 12;
+    CorrectionEngine engine;
+    std::vector<std::unique_ptr<PitchShifter>> direct (numChannels);
+    std::vector<std::vector<float>> input (numChannels), viaEngine (numChannels), viaShifter (numChannels);
+    std::vector<PitchShifter::ParameterEvent> events;
+    int failures = 0;
+
+    auto setup = [] (PitchShifter& s)
+    {
+        s.setShiftAmount (2);
+        s.setAmountAmount (1);
+        s.setMixAmount (1);
+        s.setScale (0, 0);
+    };
+
+    engine.prepare (sampleRate, numChannels);
+    engine.setChannelMode (CorrectionEngine::ChannelsIndependent);
+    engine.forEachShifter (setup);
+    for (int c = 0; c < numChannels; c++) {
+        direct[c].reset (new PitchShifter());
+        direct[c]->init (sampleRate, 1, 1, PitchShifter::LatencyStandard);
+        setup (*direct[c]);
+        input[c] = makeVocalLine (sampleRate, blockSize * numBlocks, 110.0 * (c + 2));
+        viaEngine[c] = input[c];
+        viaShifter[c] = input[c];
+    }
+
+    for (int b = 0; b < numBlocks; b++) {
+        // Odd blocks pile many events onto a few offsets, past the end too
+        events.clear();
+        for (int i = 0; i < 400; i++) {
+            int offset = (b & 1) ? (i / 40) * blockSize / 9 : i * blockSize / 400;
+            events.push_back ({ offset, i % PitchShifter::NumAutomationParameters, 0.5f + 0.5f * (float)((i * 7 + b) % 11) / 10 });
+        }
+        if (b & 1) {
+            events.push_back ({ blockSize + 10, PitchShifter::AutomateMix, 0.9f });
+        }
+
+        std::vector<float*> channels (numChannels);
+        for (int c = 0; c < numChannels; c++) {
+            channels[c] = viaEngine[c].data() + b * blockSize;
+        }
+        engine.process (channels.data(), blockSize, events.data(), (int)events.size());
+
+        for (int c = 0; c < numChannels; c++) {
+            float* io[] = { viaShifter[c].data() + b * blockSize };
+            direct[c]->process (io, io, blockSize, events.data(), (int)events.size());
+        }
+    }
+
+    for (int c = 0; c < numChannels; c++) {
+        for (size_t i = 0; i < viaEngine[c].size(); i++) {
+            if (viaEngine[c][i] != viaShifter[c][i]) {
+                printf("staging: channel %d differs from sample %zu\n", c, i);
+                failures++;
+                break;
+            }
+        }
+    }
+    printf("staging: %d channels of %d-sample blocks, %s\n", numChannels, blockSize, failures == 0 ? "ok" : "FAIL");
+    return failures;
+}
+
+int main()
+{
+    int failures = checkDeadline() + checkStaging();
+    return failures == 0 ? 0 : 1;
+}